@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_LOG_LIMITER_H
+#define OHOS_DMS_LOG_LIMITER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <mutex>
+
+namespace OHOS {
+namespace DistributedSchedule {
+/*
+ * Samples the logs of one call site. In every window the first firstNum calls
+ * are logged, after that only every everyNum-th call is, and the logged call
+ * reports how many calls were dropped since the previous logged one. The time
+ * is passed in so that the window can be tested without sleeping.
+ */
+class DmsLogLimiter {
+public:
+    constexpr static uint32_t DEFAULT_FIRST_NUM = 10;
+    constexpr static uint32_t DEFAULT_EVERY_NUM = 100;
+    constexpr static int64_t DEFAULT_WINDOW_MS = 1000;
+
+    explicit DmsLogLimiter(uint32_t firstNum = DEFAULT_FIRST_NUM, uint32_t everyNum = DEFAULT_EVERY_NUM,
+        int64_t windowMs = DEFAULT_WINDOW_MS)
+        : firstNum_(firstNum), everyNum_(std::max<uint32_t>(everyNum, 1)), windowMs_(windowMs)
+    {
+    }
+    ~DmsLogLimiter() = default;
+
+    // suppressed is the number of calls dropped since the last allowed one, valid when true is returned
+    bool Allow(int64_t nowMs, uint64_t& suppressed)
+    {
+        std::lock_guard<std::mutex> lock(limiterMutex_);
+        // the clock going back also starts a new window
+        if (windowCount_ == 0 || nowMs - windowBeginMs_ >= windowMs_ || nowMs < windowBeginMs_) {
+            windowBeginMs_ = nowMs;
+            windowCount_ = 0;
+        }
+        windowCount_++;
+        if (windowCount_ > firstNum_ && (windowCount_ - firstNum_) % everyNum_ != 0) {
+            suppressed_++;
+            return false;
+        }
+        suppressed = suppressed_;
+        suppressed_ = 0;
+        return true;
+    }
+
+    static int64_t GetNowMs()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    std::mutex limiterMutex_;
+    uint32_t firstNum_;
+    uint32_t everyNum_;
+    int64_t windowMs_;
+    int64_t windowBeginMs_ = 0;
+    uint64_t windowCount_ = 0;
+    uint64_t suppressed_ = 0;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+
+/*
+ * Rate limited variants of the HILOG macros for the per packet and per frame
+ * paths, each call site gets its own limiter. The level is checked before the
+ * limiter, so a call site whose level is off costs one loggable query and
+ * neither takes the limiter lock nor reads the clock. State changes and errors
+ * keep using the plain macros.
+ */
+#define DMS_LOG_LIMITED(IS_LOGGABLE, LOG_MACRO, fmt, ...)                                                 \
+    do {                                                                                                  \
+        if (!(IS_LOGGABLE)) {                                                                             \
+            break;                                                                                        \
+        }                                                                                                 \
+        static OHOS::DistributedSchedule::DmsLogLimiter dmsLogLimiter;                                    \
+        uint64_t dmsLogSuppressed = 0;                                                                    \
+        if (!dmsLogLimiter.Allow(OHOS::DistributedSchedule::DmsLogLimiter::GetNowMs(), dmsLogSuppressed)) { \
+            break;                                                                                        \
+        }                                                                                                 \
+        if (dmsLogSuppressed == 0) {                                                                      \
+            LOG_MACRO(fmt, ##__VA_ARGS__);                                                                \
+        } else {                                                                                          \
+            LOG_MACRO(fmt ", %{public}" PRIu64 " logs suppressed", ##__VA_ARGS__, dmsLogSuppressed);      \
+        }                                                                                                 \
+    } while (0)
+
+#define DMS_LOG_LOGGABLE(level) HiLogIsLoggable(LOG_DOMAIN, LOG_TAG, (level))
+
+#define HILOGE_LIMITED(fmt, ...) DMS_LOG_LIMITED(DMS_LOG_LOGGABLE(LOG_ERROR), HILOGE, fmt, ##__VA_ARGS__)
+#define HILOGW_LIMITED(fmt, ...) DMS_LOG_LIMITED(DMS_LOG_LOGGABLE(LOG_WARN), HILOGW, fmt, ##__VA_ARGS__)
+#define HILOGI_LIMITED(fmt, ...) DMS_LOG_LIMITED(DMS_LOG_LOGGABLE(LOG_INFO), HILOGI, fmt, ##__VA_ARGS__)
+#define HILOGD_LIMITED(fmt, ...) DMS_LOG_LIMITED(DMS_LOG_LOGGABLE(LOG_DEBUG), HILOGD, fmt, ##__VA_ARGS__)
+#endif // OHOS_DMS_LOG_LIMITER_H
@@ -598,6 +598,18 @@ enum {
      * Result(29360341) for DistributedSched Service Collab Ability Reject Error.
      */
     COLLAB_ABILITY_REJECT_ERR = 29360341,
+    /**
+     * Result(29360342) for DistributedSched Service system event report queue full.
+     */
+    DMS_SYS_EVENT_QUEUE_FULL_ERR = 29360342,
+    /**
+     * Result(29360343) for all connect manager has too many resource applications in flight.
+     */
+    DMS_CONNECT_APPLY_BUSY_FAILED = 29360343,
+    /**
+     * Result(29360344) for the kv store is not open yet, the kv data service is not ready.
+     */
+    DMS_KV_STORE_NOT_READY = 29360344,
 };
 } // namespace DistributedSchedule
 } // namespace OHOS
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_log_limiter_test.h"
+
+#include <cstring>
+#include <string>
+
+#include "dms_log_limiter.h"
+#include "dtbschedmgr_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DmsLogLimiterTest";
+constexpr uint32_t TEST_FIRST_NUM = 3;
+constexpr uint32_t TEST_EVERY_NUM = 5;
+constexpr int64_t TEST_WINDOW_MS = 1000;
+constexpr int64_t TEST_BEGIN_MS = 10000;
+constexpr uint32_t TEST_CALL_NUM = DmsLogLimiter::DEFAULT_FIRST_NUM + DmsLogLimiter::DEFAULT_EVERY_NUM;
+
+uint32_t g_loggedNum = 0;
+uint32_t g_suppressedLineNum = 0;
+uint64_t g_lastSuppressed = 0;
+
+void RecordLog(const char*)
+{
+    g_loggedNum++;
+}
+
+template<typename T>
+void RecordLog(const char* fmt, T suppressed)
+{
+    g_loggedNum++;
+    if (strstr(fmt, "logs suppressed") != nullptr) {
+        g_suppressedLineNum++;
+        g_lastSuppressed = static_cast<uint64_t>(suppressed);
+    }
+}
+
+void ResetRecordedLogs()
+{
+    g_loggedNum = 0;
+    g_suppressedLineNum = 0;
+    g_lastSuppressed = 0;
+}
+}
+
+#define TEST_LOG(fmt, ...) RecordLog(fmt, ##__VA_ARGS__)
+
+void DmsLogLimiterTest::SetUpTestCase()
+{
+    HILOGI("DmsLogLimiterTest::SetUpTestCase");
+}
+
+void DmsLogLimiterTest::TearDownTestCase()
+{
+    HILOGI("DmsLogLimiterTest::TearDownTestCase");
+}
+
+void DmsLogLimiterTest::TearDown()
+{
+    HILOGI("DmsLogLimiterTest::TearDown");
+}
+
+void DmsLogLimiterTest::SetUp()
+{
+    HILOGI("DmsLogLimiterTest::SetUp");
+}
+
+/**
+ * @tc.name: Allow_001
+ * @tc.desc: the first calls of a window are allowed, then every Kth call with the suppressed count
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLogLimiterTest, Allow_001, TestSize.Level1)
+{
+    DmsLogLimiter limiter(TEST_FIRST_NUM, TEST_EVERY_NUM, TEST_WINDOW_MS);
+    uint64_t suppressed = 0;
+    for (uint32_t i = 0; i < TEST_FIRST_NUM; i++) {
+        EXPECT_TRUE(limiter.Allow(TEST_BEGIN_MS, suppressed));
+        EXPECT_EQ(suppressed, 0u);
+    }
+    for (uint32_t i = 1; i < TEST_EVERY_NUM; i++) {
+        EXPECT_FALSE(limiter.Allow(TEST_BEGIN_MS, suppressed));
+    }
+    EXPECT_TRUE(limiter.Allow(TEST_BEGIN_MS, suppressed));
+    EXPECT_EQ(suppressed, TEST_EVERY_NUM - 1);
+
+    uint32_t allowed = 0;
+    for (uint32_t i = 0; i < TEST_EVERY_NUM * TEST_EVERY_NUM; i++) {
+        if (limiter.Allow(TEST_BEGIN_MS + TEST_WINDOW_MS - 1, suppressed)) {
+            allowed++;
+            EXPECT_EQ(suppressed, TEST_EVERY_NUM - 1);
+        }
+    }
+    EXPECT_EQ(allowed, TEST_EVERY_NUM);
+}
+
+/**
+ * @tc.name: Allow_002
+ * @tc.desc: a new window allows the first calls again and reports the calls suppressed before it
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLogLimiterTest, Allow_002, TestSize.Level1)
+{
+    DmsLogLimiter limiter(TEST_FIRST_NUM, TEST_EVERY_NUM, TEST_WINDOW_MS);
+    uint64_t suppressed = 0;
+    constexpr uint32_t droppedNum = 2;
+    for (uint32_t i = 0; i < TEST_FIRST_NUM + droppedNum; i++) {
+        limiter.Allow(TEST_BEGIN_MS, suppressed);
+    }
+    EXPECT_FALSE(limiter.Allow(TEST_BEGIN_MS, suppressed));
+
+    EXPECT_TRUE(limiter.Allow(TEST_BEGIN_MS + TEST_WINDOW_MS, suppressed));
+    EXPECT_EQ(suppressed, droppedNum + 1);
+    for (uint32_t i = 1; i < TEST_FIRST_NUM; i++) {
+        EXPECT_TRUE(limiter.Allow(TEST_BEGIN_MS + TEST_WINDOW_MS, suppressed));
+        EXPECT_EQ(suppressed, 0u);
+    }
+    EXPECT_FALSE(limiter.Allow(TEST_BEGIN_MS + TEST_WINDOW_MS, suppressed));
+}
+
+/**
+ * @tc.name: Allow_003
+ * @tc.desc: the clock going back starts a new window
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLogLimiterTest, Allow_003, TestSize.Level1)
+{
+    DmsLogLimiter limiter(TEST_FIRST_NUM, TEST_EVERY_NUM, TEST_WINDOW_MS);
+    uint64_t suppressed = 0;
+    for (uint32_t i = 0; i <= TEST_FIRST_NUM; i++) {
+        limiter.Allow(TEST_BEGIN_MS, suppressed);
+    }
+    EXPECT_TRUE(limiter.Allow(TEST_BEGIN_MS - 1, suppressed));
+    EXPECT_EQ(suppressed, 1u);
+}
+
+/**
+ * @tc.name: Allow_004
+ * @tc.desc: every call is allowed when the first num covers them, every num 0 is taken as 1
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLogLimiterTest, Allow_004, TestSize.Level1)
+{
+    uint64_t suppressed = 0;
+    DmsLogLimiter firstLimiter(TEST_EVERY_NUM, TEST_EVERY_NUM, TEST_WINDOW_MS);
+    for (uint32_t i = 0; i < TEST_EVERY_NUM; i++) {
+        EXPECT_TRUE(firstLimiter.Allow(TEST_BEGIN_MS, suppressed));
+    }
+
+    DmsLogLimiter everyLimiter(0, 0, TEST_WINDOW_MS);
+    for (uint32_t i = 0; i < TEST_EVERY_NUM; i++) {
+        EXPECT_TRUE(everyLimiter.Allow(TEST_BEGIN_MS, suppressed));
+        EXPECT_EQ(suppressed, 0u);
+    }
+}
+
+/**
+ * @tc.name: LogLimited_001
+ * @tc.desc: a call site logs its first calls, then every Kth call with the count of the suppressed ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLogLimiterTest, LogLimited_001, TestSize.Level1)
+{
+    ResetRecordedLogs();
+    for (uint32_t i = 0; i < TEST_CALL_NUM; i++) {
+        DMS_LOG_LIMITED(true, TEST_LOG, "limited log");
+    }
+    EXPECT_EQ(g_loggedNum, DmsLogLimiter::DEFAULT_FIRST_NUM + 1);
+    EXPECT_EQ(g_suppressedLineNum, 1u);
+    EXPECT_EQ(g_lastSuppressed, DmsLogLimiter::DEFAULT_EVERY_NUM - 1);
+}
+
+/**
+ * @tc.name: LogLimited_002
+ * @tc.desc: a call site whose level is off logs nothing and leaves its limiter untouched
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLogLimiterTest, LogLimited_002, TestSize.Level1)
+{
+    ResetRecordedLogs();
+    for (uint32_t round = 0; round < 2; round++) {
+        for (uint32_t i = 0; i < TEST_CALL_NUM; i++) {
+            DMS_LOG_LIMITED(round != 0, TEST_LOG, "limited log");
+        }
+        if (round == 0) {
+            EXPECT_EQ(g_loggedNum, 0u);
+        }
+    }
+    EXPECT_EQ(g_loggedNum, DmsLogLimiter::DEFAULT_FIRST_NUM + 1);
+    EXPECT_EQ(g_lastSuppressed, DmsLogLimiter::DEFAULT_EVERY_NUM - 1);
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
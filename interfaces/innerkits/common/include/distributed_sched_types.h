@@ -16,6 +16,7 @@
 #ifndef OHOS_DISTRIBUTED_SCHED_TYPES_H
 #define OHOS_DISTRIBUTED_SCHED_TYPES_H
 
+#include <cstdint>
 #include <string>
 
 namespace OHOS {
@@ -55,6 +56,23 @@ public:
     std::string developerId_ = "";
     DSchedEventType dSchedEventType_ = DMS_UNKNOW;
     DSchedEventState state_ = DMS_DSCHED_EVENT_INIT;
+    // milliseconds since epoch, stamped when the event is recorded
+    int64_t eventTime_ = 0;
+};
+
+class DSchedEventQuery {
+public:
+    DSchedEventType type_ = DMS_ALL;
+    // matches the source or the destination, empty matches any
+    std::string bundleName_ = "";
+    std::string networkId_ = "";
+    // event time range in milliseconds, 0 leaves the bound open
+    int64_t beginTime_ = 0;
+    int64_t endTime_ = 0;
+    // events recorded after the cursor are returned, 0 starts from the oldest
+    uint64_t cursor_ = 0;
+    // 0 takes the default page size
+    uint32_t pageSize_ = 0;
 };
 } // namespace DistributedSchedule
 } // namespace OHOS
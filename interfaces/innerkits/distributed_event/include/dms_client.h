@@ -16,9 +16,13 @@
 #ifndef OHOS_DMS_CLIENT_H
 #define OHOS_DMS_CLIENT_H
 
+#include <functional>
+#include <map>
+#include <mutex>
 #include <string>
 
 #include "iremote_broker.h"
+#include "iremote_object.h"
 
 #include "ability_manager_errors.h"
 #include "distributed_event_listener.h"
@@ -28,15 +32,34 @@ namespace OHOS {
 namespace DistributedSchedule {
 class DistributedClient {
 public:
+    using ProxyLoader = std::function<sptr<IRemoteObject>()>;
+
     int32_t RegisterDSchedEventListener(const DSchedEventType& type, const sptr<IDSchedEventListener>& obj);
+    int32_t RegisterDSchedEventListeners(const std::map<DSchedEventType, sptr<IDSchedEventListener>>& listeners);
     int32_t UnRegisterDSchedEventListener(const DSchedEventType& type, const sptr<IDSchedEventListener>& obj);
     int32_t GetContinueInfo(ContinueInfo &continueInfo);
     int32_t GetDSchedEventInfo(const DSchedEventType &type, std::vector<EventNotify> &events);
+    int32_t GetDSchedEventInfo(const DSchedEventQuery &query, std::vector<EventNotify> &events, uint64_t &nextCursor);
     int32_t ConnectDExtAbility(std::string& bundleName, std::string& abilityName, int32_t userId);
 
+    static sptr<IRemoteObject> GetDmsProxy();
+    static void ResetDmsProxy(const sptr<IRemoteObject>& remote = nullptr);
+
 private:
-    sptr<IRemoteObject> GetDmsProxy();
+    class DmsProxyDeathRecipient : public IRemoteObject::DeathRecipient {
+    public:
+        void OnRemoteDied(const wptr<IRemoteObject>& remote) override;
+    };
+
+    static sptr<IRemoteObject> LoadDmsProxy();
     int32_t GetDecodeDSchedEventNotify(MessageParcel &reply, EventNotify &event);
+
+    // the dms proxy is shared by all clients of the process and dropped when dms dies
+    static std::mutex proxyMutex_;
+    static sptr<IRemoteObject> dmsProxy_;
+    static sptr<IRemoteObject::DeathRecipient> proxyDeathRecipient_;
+    // looks the dms proxy up, samgr is asked when it is not set
+    static ProxyLoader proxyLoader_;
 };
 }  // namespace DistributedSchedule
 }  // namespace OHOS
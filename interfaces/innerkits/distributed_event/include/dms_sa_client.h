@@ -39,6 +39,7 @@ public:
     int32_t DelDSchedEventListener(const DSchedEventType& type, const sptr<IDSchedEventListener>& listener);
     int32_t GetContinueInfo(ContinueInfo &continueInfo);
     int32_t GetDSchedEventInfo(const DSchedEventType &type, std::vector<EventNotify> &events);
+    int32_t GetDSchedEventInfo(const DSchedEventQuery &query, std::vector<EventNotify> &events, uint64_t &nextCursor);
     void OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId) override;
     void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string& deviceId) override;
 
@@ -24,16 +24,32 @@
 
 #include "distributed_parcel_helper.h"
 #include "distributedsched_ipc_interface_code.h"
+#include "dsched_event_codec.h"
 
 namespace OHOS {
 namespace DistributedSchedule {
 namespace {
 const std::u16string DMS_PROXY_INTERFACE_TOKEN = u"ohos.distributedschedule.accessToken";
 constexpr uint32_t DSCHED_EVENT_MAX_NUM = 10000;
+constexpr uint32_t DSCHED_EVENT_LISTENER_MAX_NUM = 16;
 }
 
-sptr<IRemoteObject> DistributedClient::GetDmsProxy()
+std::mutex DistributedClient::proxyMutex_;
+sptr<IRemoteObject> DistributedClient::dmsProxy_;
+sptr<IRemoteObject::DeathRecipient> DistributedClient::proxyDeathRecipient_;
+DistributedClient::ProxyLoader DistributedClient::proxyLoader_;
+
+void DistributedClient::DmsProxyDeathRecipient::OnRemoteDied(const wptr<IRemoteObject>& remote)
+{
+    HILOG_INFO("dms proxy died.");
+    DistributedClient::ResetDmsProxy(remote.promote());
+}
+
+sptr<IRemoteObject> DistributedClient::LoadDmsProxy()
 {
+    if (proxyLoader_ != nullptr) {
+        return proxyLoader_();
+    }
     auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (samgrProxy == nullptr) {
         HILOG_ERROR("fail to get samgr.");
@@ -42,6 +58,45 @@ sptr<IRemoteObject> DistributedClient::GetDmsProxy()
     return samgrProxy->CheckSystemAbility(DISTRIBUTED_SCHED_SA_ID);
 }
 
+sptr<IRemoteObject> DistributedClient::GetDmsProxy()
+{
+    {
+        std::lock_guard<std::mutex> lock(proxyMutex_);
+        if (dmsProxy_ != nullptr) {
+            return dmsProxy_;
+        }
+    }
+    sptr<IRemoteObject> remote = LoadDmsProxy();
+    if (remote == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(proxyMutex_);
+    if (dmsProxy_ != nullptr) {
+        return dmsProxy_;
+    }
+    if (proxyDeathRecipient_ == nullptr) {
+        proxyDeathRecipient_ = sptr<IRemoteObject::DeathRecipient>(new DmsProxyDeathRecipient());
+    }
+    // a proxy whose death can not be watched is not cached
+    if (!remote->AddDeathRecipient(proxyDeathRecipient_)) {
+        HILOG_WARN("add death recipient to dms proxy failed.");
+        return remote;
+    }
+    dmsProxy_ = remote;
+    return dmsProxy_;
+}
+
+void DistributedClient::ResetDmsProxy(const sptr<IRemoteObject>& remote)
+{
+    std::lock_guard<std::mutex> lock(proxyMutex_);
+    if (dmsProxy_ == nullptr || (remote != nullptr && remote != dmsProxy_)) {
+        return;
+    }
+    HILOG_INFO("reset dms proxy.");
+    dmsProxy_->RemoveDeathRecipient(proxyDeathRecipient_);
+    dmsProxy_ = nullptr;
+}
+
 int32_t DistributedClient::RegisterDSchedEventListener(const DSchedEventType& type,
     const sptr<IDSchedEventListener>& obj)
 {
@@ -66,6 +121,37 @@ int32_t DistributedClient::RegisterDSchedEventListener(const DSchedEventType& ty
         data, reply);
 }
 
+int32_t DistributedClient::RegisterDSchedEventListeners(
+    const std::map<DSchedEventType, sptr<IDSchedEventListener>>& listeners)
+{
+    HILOG_INFO("RegisterDSchedEventListeners called, size: %{public}zu", listeners.size());
+    if (listeners.empty() || listeners.size() > DSCHED_EVENT_LISTENER_MAX_NUM) {
+        HILOG_ERROR("invalid listeners size: %{public}zu", listeners.size());
+        return AAFwk::INVALID_PARAMETERS_ERR;
+    }
+    sptr<IRemoteObject> remote = GetDmsProxy();
+    if (remote == nullptr) {
+        HILOG_ERROR("remote system ablity is nullptr");
+        return AAFwk::INVALID_PARAMETERS_ERR;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    if (!data.WriteInterfaceToken(DMS_PROXY_INTERFACE_TOKEN)) {
+        return ERR_FLATTEN_OBJECT;
+    }
+    PARCEL_WRITE_HELPER(data, Uint32, static_cast<uint32_t>(listeners.size()));
+    for (const auto& listener : listeners) {
+        if (listener.second == nullptr) {
+            HILOG_ERROR("Received null IDSchedEventListener object, type: %{public}d", listener.first);
+            return AAFwk::INVALID_PARAMETERS_ERR;
+        }
+        PARCEL_WRITE_HELPER(data, Uint8, listener.first);
+        PARCEL_WRITE_HELPER(data, RemoteObject, listener.second->AsObject());
+    }
+    PARCEL_TRANSACT_SYNC_RET_INT(remote, static_cast<uint32_t>(IDSchedInterfaceCode::REGISTER_DSCHED_EVENT_LISTENERS),
+        data, reply);
+}
+
 int32_t DistributedClient::UnRegisterDSchedEventListener(const DSchedEventType& type,
     const sptr<IDSchedEventListener>& obj)
 {
@@ -205,5 +291,57 @@ int32_t DistributedClient::GetDSchedEventInfo(const DSchedEventType &type, std::
     }
     return ret;
 }
+
+int32_t DistributedClient::GetDSchedEventInfo(const DSchedEventQuery &query, std::vector<EventNotify> &events,
+    uint64_t &nextCursor)
+{
+    HILOG_INFO("%{public}s called", __func__);
+    nextCursor = 0;
+    sptr<IRemoteObject> remote = GetDmsProxy();
+    if (remote == nullptr) {
+        HILOG_ERROR("remote system ablity is null");
+        return ERR_FLATTEN_OBJECT;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    if (!data.WriteInterfaceToken(DMS_PROXY_INTERFACE_TOKEN)) {
+        HILOG_DEBUG("write interface token failed.");
+        return ERR_FLATTEN_OBJECT;
+    }
+    PARCEL_WRITE_HELPER(data, Int32, query.type_);
+    PARCEL_WRITE_HELPER(data, String, query.bundleName_);
+    PARCEL_WRITE_HELPER(data, String, query.networkId_);
+    PARCEL_WRITE_HELPER(data, Int64, query.beginTime_);
+    PARCEL_WRITE_HELPER(data, Int64, query.endTime_);
+    PARCEL_WRITE_HELPER(data, Uint64, query.cursor_);
+    PARCEL_WRITE_HELPER(data, Uint32, query.pageSize_);
+
+    MessageOption option;
+    int32_t ret = remote->SendRequest(static_cast<uint32_t>(IDSchedInterfaceCode::QUERY_DSCHED_EVENT_INFO),
+        data, reply, option);
+    if (ret != ERR_OK) {
+        HILOG_ERROR("sendRequest fail, ret: %{public}d", ret);
+        return ret;
+    }
+    ret = reply.ReadInt32();
+    if (ret != ERR_OK) {
+        HILOG_ERROR("Proxy query dms eventInfos from dms service fail, ret: %{public}d", ret);
+        return ret;
+    }
+    uint64_t cursor = 0;
+    PARCEL_READ_HELPER(reply, Uint64, cursor);
+    std::vector<uint8_t> buffer;
+    if (!reply.ReadUInt8Vector(&buffer)) {
+        HILOG_ERROR("read dms eventInfos buffer failed.");
+        return ERR_FLATTEN_OBJECT;
+    }
+    ret = DSchedEventCodec::Decode(buffer, events);
+    if (ret != ERR_OK) {
+        HILOG_ERROR("decode dms eventInfos failed, ret: %{public}d", ret);
+        return ret;
+    }
+    nextCursor = cursor;
+    return ERR_OK;
+}
 }  // namespace DistributedSchedule
 }  // namespace OHOS
\ No newline at end of file
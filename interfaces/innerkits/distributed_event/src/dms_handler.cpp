@@ -77,5 +77,17 @@ int32_t DmsHandler::GetDSchedEventInfo(const DSchedEventType &type, std::vector<
     }
     return ERR_OK;
 }
+
+int32_t DmsHandler::GetDSchedEventInfo(const DSchedEventQuery &query, std::vector<EventNotify> &events,
+    uint64_t &nextCursor)
+{
+    HILOGI("%{public}s called", __func__);
+    int32_t ret = DmsSaClient::GetInstance().GetDSchedEventInfo(query, events, nextCursor);
+    if (ret != ERR_OK) {
+        HILOGE("DmsSaClient GetDSchedEventInfo fail, ret %{public}d.", ret);
+        return GET_REMOTE_DMS_FAIL;
+    }
+    return ERR_OK;
+}
 } // namespace DistributedSchedule
 } // namespace OHOS
\ No newline at end of file
@@ -55,17 +55,18 @@ int32_t DmsSaClient::AddDSchedEventListener(const DSchedEventType& type, const s
         HILOGE("fail to get saMgrProxy.");
         return AAFwk::INNER_ERR;
     }
-    if (saMgrProxy_->CheckSystemAbility(DISTRIBUTED_SCHED_SA_ID)) {
+    {
+        std::lock_guard<std::mutex> lock(eventMutex_);
+        listeners_[type] = listener;
+    }
+    // without dms the listener is registered once dms is added
+    if (DistributedClient::GetDmsProxy() != nullptr) {
         DistributedClient distributedClient;
         distributedClient.RegisterDSchedEventListener(type, listener);
     }
     if (!hasSubscribeDmsSA_) {
         if (SubscribeDmsSA()) {
             hasSubscribeDmsSA_ = true;
-            {
-                std::lock_guard<std::mutex> lock(eventMutex_);
-                listeners_[type] = listener;
-            }
         } else {
             return AAFwk::INNER_ERR;
         }
@@ -84,7 +85,7 @@ int32_t DmsSaClient::DelDSchedEventListener(const DSchedEventType& type, const s
         HILOGE("fail to get saMgrProxy.");
         return AAFwk::INNER_ERR;
     }
-    if (saMgrProxy_->CheckSystemAbility(DISTRIBUTED_SCHED_SA_ID)) {
+    if (DistributedClient::GetDmsProxy() != nullptr) {
         DistributedClient distributedClient;
         distributedClient.UnRegisterDSchedEventListener(type, listener);
     }
@@ -104,7 +105,7 @@ int32_t DmsSaClient::GetContinueInfo(ContinueInfo &continueInfo)
         HILOGE("fail to get saMgrProxy.");
         return AAFwk::INNER_ERR;
     }
-    if (saMgrProxy_->CheckSystemAbility(DISTRIBUTED_SCHED_SA_ID)) {
+    if (DistributedClient::GetDmsProxy() != nullptr) {
         DistributedClient distributedClient;
         distributedClient.GetContinueInfo(continueInfo);
     }
@@ -122,8 +123,8 @@ int32_t DmsSaClient::GetDSchedEventInfo(const DSchedEventType &type, std::vector
         HILOGE("Get SA manager proxy fail.");
         return AAFwk::INNER_ERR;
     }
-    if (!saMgrProxy_->CheckSystemAbility(DISTRIBUTED_SCHED_SA_ID)) {
-        HILOGE("Get SA manager proxy fail.");
+    if (DistributedClient::GetDmsProxy() == nullptr) {
+        HILOGE("Get dms proxy fail.");
         return AAFwk::INNER_ERR;
     }
 
@@ -135,23 +136,52 @@ int32_t DmsSaClient::GetDSchedEventInfo(const DSchedEventType &type, std::vector
     return ret;
 }
 
+int32_t DmsSaClient::GetDSchedEventInfo(const DSchedEventQuery &query, std::vector<EventNotify> &events,
+    uint64_t &nextCursor)
+{
+    HILOGI("%{public}s called", __func__);
+    if (DistributedClient::GetDmsProxy() == nullptr) {
+        HILOGE("Get dms proxy fail.");
+        return AAFwk::INNER_ERR;
+    }
+    DistributedClient distributedClient;
+    int32_t ret = distributedClient.GetDSchedEventInfo(query, events, nextCursor);
+    if (ret != ERR_OK) {
+        HILOGE("Query dms event Info proxy call fail, ret %{public}d.", ret);
+    }
+    return ret;
+}
+
 void DmsSaClient::OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId)
 {
     HILOGI("%{public}s called, the systemAbilityId is %{public}d", __func__, systemAbilityId);
-    std::lock_guard<std::mutex> lock(eventMutex_);
-    if (systemAbilityId == DISTRIBUTED_SCHED_SA_ID) {
-        HILOGI("%{public}s listeners size: %{public}zu .", __func__, listeners_.size());
-        for (auto& listener : listeners_) {
-            DistributedClient distributedClient;
-            distributedClient.RegisterDSchedEventListener(listener.first, listener.second);
-        }
-    } else {
+    if (systemAbilityId != DISTRIBUTED_SCHED_SA_ID) {
         HILOGE("SystemAbilityId must be DISTRIBUTED_SCHED_SA_ID,but it is %{public}d", systemAbilityId);
+        return;
+    }
+    std::map<DSchedEventType, sptr<IDSchedEventListener>> listeners;
+    {
+        std::lock_guard<std::mutex> lock(eventMutex_);
+        listeners = listeners_;
+    }
+    HILOGI("%{public}s listeners size: %{public}zu .", __func__, listeners.size());
+    if (listeners.empty()) {
+        return;
+    }
+    // all listeners are restored in one transaction
+    DistributedClient distributedClient;
+    int32_t ret = distributedClient.RegisterDSchedEventListeners(listeners);
+    if (ret != ERR_OK) {
+        HILOGE("restore dsched event listeners fail, ret %{public}d.", ret);
     }
 }
 
 void DmsSaClient::OnRemoveSystemAbility(int32_t systemAbilityId, const std::string& deviceId)
 {
+    HILOGI("%{public}s called, the systemAbilityId is %{public}d", __func__, systemAbilityId);
+    if (systemAbilityId == DISTRIBUTED_SCHED_SA_ID) {
+        DistributedClient::ResetDmsProxy();
+    }
 }
 
 DmsSystemAbilityStatusChange::DmsSystemAbilityStatusChange()
@@ -184,7 +214,7 @@ void DmsSystemAbilityStatusChange::OnRemoveSystemAbility(int32_t systemAbilityId
         return;
     }
 
-    // notify listener
+    DmsSaClient::GetInstance().OnRemoveSystemAbility(systemAbilityId, deviceId);
 }
 }  // namespace DistributedSchedule
 }  // namespace OHOS
\ No newline at end of file
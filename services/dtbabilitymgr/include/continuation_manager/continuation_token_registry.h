@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DISTRIBUTED_ABILITY_MANAGER_CONTINUATION_TOKEN_REGISTRY_H
+#define OHOS_DISTRIBUTED_ABILITY_MANAGER_CONTINUATION_TOKEN_REGISTRY_H
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "connect_status_info.h"
+#include "iremote_object.h"
+#include "notifier_info.h"
+#include "refbase.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+/*
+ * The registrations of the continuation manager: the tokens of each caller and
+ * the device selection notifiers of each token. Tokens are indexed by caller
+ * and by value, notifiers by token and by remote object, so registering,
+ * unregistering and dropping every token of a dead notifier are hash lookups.
+ * Lookups share one reader-writer lock, only changes take it exclusively.
+ */
+class ContinuationTokenRegistry {
+public:
+    ContinuationTokenRegistry() = default;
+    ~ContinuationTokenRegistry() = default;
+
+    void SetDeathRecipient(const sptr<IRemoteObject::DeathRecipient>& deathRecipient);
+
+    void AddToken(uint32_t accessToken, int32_t token);
+    bool RemoveToken(int32_t token);
+    std::vector<int32_t> RemoveTokensByNotifiers(const std::vector<sptr<IRemoteObject>>& notifiers);
+    bool IsTokenRegistered(uint32_t accessToken, int32_t token) const;
+    uint32_t GetTokenCount(uint32_t accessToken) const;
+
+    bool SetNotifier(int32_t token, const std::string& cbType, const sptr<IRemoteObject>& notifier);
+    bool DeleteNotifier(int32_t token, const std::string& cbType);
+    sptr<IRemoteObject> GetNotifier(int32_t token, const std::string& cbType) const;
+    bool IsNotifierRegistered(int32_t token) const;
+    bool SetConnectStatusInfo(int32_t token, const std::shared_ptr<ConnectStatusInfo>& connectStatusInfo);
+    std::shared_ptr<ConnectStatusInfo> GetConnectStatusInfo(int32_t token) const;
+
+    void Dump(std::string& info) const;
+    void Clear();
+
+private:
+    // the methods below must be in registryMutex_ scope
+    bool RemoveTokenLocked(int32_t token);
+    void IndexNotifierLocked(const sptr<IRemoteObject>& notifier, int32_t token);
+    void UnindexNotifierLocked(const sptr<IRemoteObject>& notifier, int32_t token);
+    void DumpNotifierLocked(int32_t token, std::string& info) const;
+
+    mutable std::shared_mutex registryMutex_;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient_;
+    std::unordered_map<uint32_t, std::unordered_set<int32_t>> tokenMap_;
+    std::unordered_map<int32_t, uint32_t> tokenOwners_;
+    std::unordered_map<int32_t, std::unique_ptr<NotifierInfo>> callbackMap_;
+    // one entry per callback type a notifier object is registered for
+    std::unordered_map<IRemoteObject*, std::unordered_multiset<int32_t>> notifierTokens_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DISTRIBUTED_ABILITY_MANAGER_CONTINUATION_TOKEN_REGISTRY_H
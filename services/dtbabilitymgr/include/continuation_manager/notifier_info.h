@@ -39,6 +39,7 @@ public:
     void SetNotifier(const std::string& cbType, const sptr<IRemoteObject>& notifier);
     void DeleteNotifier(const std::string& cbType);
     bool QueryNotifier(const sptr<IRemoteObject>& notifier) const;
+    const NotifierMap& GetNotifierMap() const;
     bool IsNotifierMapEmpty();
     void RemoveDeathRecipient(const sptr<IRemoteObject::DeathRecipient>& notifierDeathRecipient,
         const std::string& cbType = std::string());
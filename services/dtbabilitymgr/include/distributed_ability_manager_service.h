@@ -18,6 +18,7 @@
 
 #include "bundlemgr/bundle_mgr_interface.h"
 #include "bundlemgr/bundle_mgr_proxy.h"
+#include "continuation_manager/continuation_token_registry.h"
 #include "continuation_manager/notifier_info.h"
 #include "distributed_ability_manager_stub.h"
 #include "event_handler.h"
@@ -63,7 +64,6 @@ private:
     bool IsTokenRegistered(uint32_t accessToken, int32_t token);
     bool IsNotifierRegistered(int32_t token);
     bool IsNotifierRegisteredLocked(int32_t token, const std::string& cbType);
-    bool QueryTokenByNotifier(const sptr<IRemoteObject>& notifier, int32_t& token);
     bool HandleDeviceConnect(const sptr<IRemoteObject>& notifier,
         const std::vector<ContinuationResult>& continuationResults);
     bool HandleDeviceDisconnect(const sptr<IRemoteObject>& notifier,
@@ -78,15 +78,14 @@ private:
         const std::shared_ptr<ContinuationExtraParams>& continuationExtraParams = nullptr);
     void HandleUpdateConnectStatus(int32_t token, std::string deviceId,
         const DeviceConnectStatus& deviceConnectStatus);
-    void DumpNotifierLocked(const std::vector<int32_t>& tokenVec, std::string& info);
+    void RemoveDiedNotifiers();
 
     std::mutex tokenMutex_;
     std::atomic<int32_t> token_ {0};
-    std::mutex tokenMapMutex_;
-    std::map<uint32_t, std::vector<int32_t>> tokenMap_;
-    std::mutex callbackMapMutex_;
-    std::map<int32_t, std::unique_ptr<NotifierInfo>> callbackMap_;
+    ContinuationTokenRegistry registry_;
     sptr<IRemoteObject::DeathRecipient> notifierDeathRecipient_;
+    std::mutex diedNotifierMutex_;
+    std::vector<sptr<IRemoteObject>> diedNotifiers_;
     sptr<IRemoteObject> connect_;
     std::mutex appProxyMutex_;
     sptr<IRemoteObject> appProxy_;
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "continuation_manager/continuation_token_registry.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "base/continuationmgr_log.h"
+#include "idevice_selection_notifier.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "ContinuationTokenRegistry";
+}
+
+void ContinuationTokenRegistry::SetDeathRecipient(const sptr<IRemoteObject::DeathRecipient>& deathRecipient)
+{
+    std::unique_lock<std::shared_mutex> registryLock(registryMutex_);
+    deathRecipient_ = deathRecipient;
+}
+
+void ContinuationTokenRegistry::AddToken(uint32_t accessToken, int32_t token)
+{
+    std::unique_lock<std::shared_mutex> registryLock(registryMutex_);
+    // the token counter wraps around, a reused token must not stay with its former caller
+    auto ownerIter = tokenOwners_.find(token);
+    if (ownerIter != tokenOwners_.end() && ownerIter->second != accessToken) {
+        HILOGW("token is reused, drop its former registration");
+        RemoveTokenLocked(token);
+    }
+    tokenMap_[accessToken].insert(token);
+    tokenOwners_[token] = accessToken;
+}
+
+bool ContinuationTokenRegistry::RemoveToken(int32_t token)
+{
+    std::unique_lock<std::shared_mutex> registryLock(registryMutex_);
+    return RemoveTokenLocked(token);
+}
+
+std::vector<int32_t> ContinuationTokenRegistry::RemoveTokensByNotifiers(
+    const std::vector<sptr<IRemoteObject>>& notifiers)
+{
+    std::vector<int32_t> removedTokens;
+    std::unique_lock<std::shared_mutex> registryLock(registryMutex_);
+    for (const auto& notifier : notifiers) {
+        if (notifier == nullptr) {
+            continue;
+        }
+        auto iter = notifierTokens_.find(notifier.GetRefPtr());
+        if (iter == notifierTokens_.end()) {
+            continue;
+        }
+        // the entry is erased while its tokens are removed
+        std::unordered_set<int32_t> tokens(iter->second.begin(), iter->second.end());
+        for (int32_t token : tokens) {
+            if (RemoveTokenLocked(token)) {
+                removedTokens.emplace_back(token);
+            }
+        }
+    }
+    return removedTokens;
+}
+
+bool ContinuationTokenRegistry::IsTokenRegistered(uint32_t accessToken, int32_t token) const
+{
+    std::shared_lock<std::shared_mutex> registryLock(registryMutex_);
+    auto iter = tokenOwners_.find(token);
+    return iter != tokenOwners_.end() && iter->second == accessToken;
+}
+
+uint32_t ContinuationTokenRegistry::GetTokenCount(uint32_t accessToken) const
+{
+    std::shared_lock<std::shared_mutex> registryLock(registryMutex_);
+    auto iter = tokenMap_.find(accessToken);
+    if (iter == tokenMap_.end()) {
+        return 0;
+    }
+    return static_cast<uint32_t>(iter->second.size());
+}
+
+bool ContinuationTokenRegistry::SetNotifier(int32_t token, const std::string& cbType,
+    const sptr<IRemoteObject>& notifier)
+{
+    if (notifier == nullptr) {
+        HILOGE("notifier is nullptr");
+        return false;
+    }
+    std::unique_lock<std::shared_mutex> registryLock(registryMutex_);
+    auto& notifierInfo = callbackMap_[token];
+    if (notifierInfo == nullptr) {
+        notifierInfo = std::make_unique<NotifierInfo>();
+    }
+    sptr<IRemoteObject> oldNotifier = notifierInfo->GetNotifier(cbType);
+    if (oldNotifier == notifier) {
+        return true;
+    }
+    if (oldNotifier != nullptr) {
+        UnindexNotifierLocked(oldNotifier, token);
+    }
+    notifierInfo->SetNotifier(cbType, notifier);
+    IndexNotifierLocked(notifier, token);
+    return true;
+}
+
+bool ContinuationTokenRegistry::DeleteNotifier(int32_t token, const std::string& cbType)
+{
+    std::unique_lock<std::shared_mutex> registryLock(registryMutex_);
+    auto iter = callbackMap_.find(token);
+    if (iter == callbackMap_.end()) {
+        return false;
+    }
+    sptr<IRemoteObject> notifier = iter->second->GetNotifier(cbType);
+    if (notifier == nullptr) {
+        return false;
+    }
+    UnindexNotifierLocked(notifier, token);
+    iter->second->DeleteNotifier(cbType);
+    if (iter->second->IsNotifierMapEmpty()) {
+        callbackMap_.erase(iter);
+    }
+    return true;
+}
+
+sptr<IRemoteObject> ContinuationTokenRegistry::GetNotifier(int32_t token, const std::string& cbType) const
+{
+    std::shared_lock<std::shared_mutex> registryLock(registryMutex_);
+    auto iter = callbackMap_.find(token);
+    if (iter == callbackMap_.end()) {
+        return nullptr;
+    }
+    return iter->second->GetNotifier(cbType);
+}
+
+bool ContinuationTokenRegistry::IsNotifierRegistered(int32_t token) const
+{
+    std::shared_lock<std::shared_mutex> registryLock(registryMutex_);
+    return callbackMap_.find(token) != callbackMap_.end();
+}
+
+bool ContinuationTokenRegistry::SetConnectStatusInfo(int32_t token,
+    const std::shared_ptr<ConnectStatusInfo>& connectStatusInfo)
+{
+    std::unique_lock<std::shared_mutex> registryLock(registryMutex_);
+    auto iter = callbackMap_.find(token);
+    if (iter == callbackMap_.end()) {
+        return false;
+    }
+    iter->second->SetConnectStatusInfo(connectStatusInfo);
+    return true;
+}
+
+std::shared_ptr<ConnectStatusInfo> ContinuationTokenRegistry::GetConnectStatusInfo(int32_t token) const
+{
+    std::shared_lock<std::shared_mutex> registryLock(registryMutex_);
+    auto iter = callbackMap_.find(token);
+    if (iter == callbackMap_.end()) {
+        return nullptr;
+    }
+    return iter->second->GetConnectStatusInfo();
+}
+
+void ContinuationTokenRegistry::Dump(std::string& info) const
+{
+    std::shared_lock<std::shared_mutex> registryLock(registryMutex_);
+    info += "application register infos:\n";
+    info += "  ";
+    if (tokenMap_.empty()) {
+        info += "  <none info>\n";
+        return;
+    }
+    for (const auto& tokenMap : tokenMap_) {
+        info += "accessToken: ";
+        info += std::to_string(tokenMap.first);
+        std::vector<int32_t> tokens(tokenMap.second.begin(), tokenMap.second.end());
+        std::sort(tokens.begin(), tokens.end());
+        for (int32_t token : tokens) {
+            DumpNotifierLocked(token, info);
+        }
+        info += "\n";
+        info += "  ";
+    }
+}
+
+void ContinuationTokenRegistry::Clear()
+{
+    std::unique_lock<std::shared_mutex> registryLock(registryMutex_);
+    if (deathRecipient_ != nullptr) {
+        for (const auto& callback : callbackMap_) {
+            callback.second->RemoveDeathRecipient(deathRecipient_);
+        }
+    }
+    tokenMap_.clear();
+    tokenOwners_.clear();
+    callbackMap_.clear();
+    notifierTokens_.clear();
+}
+
+bool ContinuationTokenRegistry::RemoveTokenLocked(int32_t token)
+{
+    bool isRemoved = false;
+    auto ownerIter = tokenOwners_.find(token);
+    if (ownerIter != tokenOwners_.end()) {
+        auto tokenIter = tokenMap_.find(ownerIter->second);
+        if (tokenIter != tokenMap_.end()) {
+            tokenIter->second.erase(token);
+            if (tokenIter->second.empty()) {
+                tokenMap_.erase(tokenIter);
+            }
+        }
+        tokenOwners_.erase(ownerIter);
+        isRemoved = true;
+    }
+    auto callbackIter = callbackMap_.find(token);
+    if (callbackIter != callbackMap_.end()) {
+        for (const auto& notifier : callbackIter->second->GetNotifierMap()) {
+            UnindexNotifierLocked(notifier.second, token);
+        }
+        callbackMap_.erase(callbackIter);
+        isRemoved = true;
+    }
+    return isRemoved;
+}
+
+void ContinuationTokenRegistry::IndexNotifierLocked(const sptr<IRemoteObject>& notifier, int32_t token)
+{
+    auto& tokens = notifierTokens_[notifier.GetRefPtr()];
+    if (tokens.empty() && deathRecipient_ != nullptr) {
+        notifier->AddDeathRecipient(deathRecipient_);
+    }
+    tokens.insert(token);
+}
+
+void ContinuationTokenRegistry::UnindexNotifierLocked(const sptr<IRemoteObject>& notifier, int32_t token)
+{
+    if (notifier == nullptr) {
+        return;
+    }
+    auto iter = notifierTokens_.find(notifier.GetRefPtr());
+    if (iter == notifierTokens_.end()) {
+        return;
+    }
+    auto tokenIter = iter->second.find(token);
+    if (tokenIter != iter->second.end()) {
+        iter->second.erase(tokenIter);
+    }
+    // the death recipient stays while any registration still uses the notifier
+    if (iter->second.empty()) {
+        if (deathRecipient_ != nullptr) {
+            notifier->RemoveDeathRecipient(deathRecipient_);
+        }
+        notifierTokens_.erase(iter);
+    }
+}
+
+void ContinuationTokenRegistry::DumpNotifierLocked(int32_t token, std::string& info) const
+{
+    info += ", ";
+    info += "token: ";
+    info += std::to_string(token);
+    auto iter = callbackMap_.find(token);
+    if (iter == callbackMap_.end() || iter->second->IsNotifierMapEmpty()) {
+        return;
+    }
+    info += ", ";
+    info += "cbType: ";
+    if (iter->second->GetNotifier(EVENT_CONNECT) != nullptr) {
+        info += " ";
+        info += EVENT_CONNECT;
+    }
+    if (iter->second->GetNotifier(EVENT_DISCONNECT) != nullptr) {
+        info += " ";
+        info += EVENT_DISCONNECT;
+    }
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -49,6 +49,11 @@ bool NotifierInfo::QueryNotifier(const sptr<IRemoteObject>& notifier) const
     return false;
 }
 
+const NotifierInfo::NotifierMap& NotifierInfo::GetNotifierMap() const
+{
+    return notifierMap_;
+}
+
 bool NotifierInfo::IsNotifierMapEmpty()
 {
     if (notifierMap_.empty()) {
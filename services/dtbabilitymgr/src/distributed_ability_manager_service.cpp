@@ -67,6 +67,7 @@ void DistributedAbilityManagerService::OnStart()
         }
     }
     notifierDeathRecipient_ = sptr<IRemoteObject::DeathRecipient>(new NotifierDeathRecipient());
+    registry_.SetDeathRecipient(notifierDeathRecipient_);
     if (continuationHandler_ == nullptr) {
         continuationHandler_ = std::make_shared<ffrt::queue>("ContinuationMgr");
     }
@@ -95,50 +96,7 @@ int32_t DistributedAbilityManagerService::Dump(int32_t fd, const std::vector<std
 
 void DistributedAbilityManagerService::DumpAppRegisterInfo(std::string& info)
 {
-    std::lock_guard<std::mutex> autoLock(tokenMapMutex_);
-    info += "application register infos:\n";
-    info += "  ";
-    if (!tokenMap_.empty()) {
-        for (const auto& tokenMap : tokenMap_) {
-            info += "accessToken: ";
-            info += std::to_string(tokenMap.first);
-            std::vector<int32_t> tokenVec = tokenMap.second;
-            DumpNotifierLocked(tokenVec, info);
-            info += "\n";
-            info += "  ";
-        }
-    } else {
-        info += "  <none info>\n";
-    }
-}
-
-void DistributedAbilityManagerService::DumpNotifierLocked(const std::vector<int32_t>& tokenVec, std::string& info)
-{
-    std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-    for (const auto& token : tokenVec) {
-        info += ", ";
-        info += "token: ";
-        info += std::to_string(token);
-        if (callbackMap_.find(token) == callbackMap_.end()) {
-            continue;
-        }
-        if (callbackMap_[token] == nullptr) {
-            HILOGE("this ptr is null");
-            return;
-        }
-        if (!callbackMap_[token]->IsNotifierMapEmpty()) {
-            info += ", ";
-            info += "cbType: ";
-            if (callbackMap_[token]->GetNotifier(EVENT_CONNECT) != nullptr) {
-                info += " ";
-                info += EVENT_CONNECT;
-            }
-            if (callbackMap_[token]->GetNotifier(EVENT_DISCONNECT) != nullptr) {
-                info += " ";
-                info += EVENT_DISCONNECT;
-            }
-        }
-    }
+    registry_.Dump(info);
 }
 
 int32_t DistributedAbilityManagerService::Register(
@@ -166,11 +124,7 @@ int32_t DistributedAbilityManagerService::Register(
         // save at parameters
         system::SetParameter(TOKEN_KEY, std::to_string(tToken));
     }
-    // update tokenMap_
-    {
-        std::lock_guard<std::mutex> tokenMapLock(tokenMapMutex_);
-        tokenMap_[accessToken].emplace_back(tToken);
-    }
+    registry_.AddToken(accessToken, tToken);
     token = tToken;
     return ERR_OK;
 }
@@ -182,28 +136,8 @@ int32_t DistributedAbilityManagerService::Unregister(int32_t token)
     if (!IsTokenRegistered(accessToken, token)) {
         return TOKEN_HAS_NOT_REGISTERED;
     }
-    // remove death recipient and update callbackMap_ by token
-    {
-        std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-        if (IsNotifierRegistered(token)) {
-            callbackMap_[token]->RemoveDeathRecipient(notifierDeathRecipient_);
-            callbackMap_.erase(token);
-        }
-    }
-    // update tokenMap_ by token
-    {
-        std::lock_guard<std::mutex> tokenMapLock(tokenMapMutex_);
-        for (auto iter = tokenMap_.begin(); iter != tokenMap_.end();) {
-            iter->second.erase(std::remove_if(iter->second.begin(), iter->second.end(),
-                [token](int32_t n) { return n == token; }), iter->second.end());
-            if (iter->second.empty()) {
-                tokenMap_.erase(iter++);
-                break;
-            } else {
-                iter++;
-            }
-        }
-    }
+    // remove the token with its notifiers and their death recipients
+    registry_.RemoveToken(token);
     // disconnect to app when third-party app called unregister
     (void)HandleDisconnectAbility();
     return ERR_OK;
@@ -224,22 +158,10 @@ int32_t DistributedAbilityManagerService::RegisterDeviceSelectionCallback(
     if (IsNotifierRegisteredLocked(token, cbType)) {
         return CALLBACK_HAS_REGISTERED;
     }
-    {
-        std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-        auto iter = callbackMap_.find(token);
-        if (iter != callbackMap_.end()) { // registered at least once
-            if (iter->second == nullptr) {
-                return ERR_NULL_OBJECT;
-            }
-            iter->second->SetNotifier(cbType, notifier);
-        } else { // never registered
-            std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-            notifierInfo->SetNotifier(cbType, notifier);
-            callbackMap_[token] = std::move(notifierInfo);
-            notifier->AddDeathRecipient(notifierDeathRecipient_);
-        }
-        HILOGD("token register success");
+    if (!registry_.SetNotifier(token, cbType, notifier)) {
+        return ERR_NULL_OBJECT;
     }
+    HILOGD("token register success");
     return ERR_OK;
 }
 
@@ -257,17 +179,7 @@ int32_t DistributedAbilityManagerService::UnregisterDeviceSelectionCallback(int3
     if (!IsNotifierRegisteredLocked(token, cbType)) {
         return CALLBACK_HAS_NOT_REGISTERED;
     }
-    {
-        std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-        auto iter = callbackMap_.find(token);
-        if (iter != callbackMap_.end()) {
-            iter->second->RemoveDeathRecipient(notifierDeathRecipient_, cbType);
-            iter->second->DeleteNotifier(cbType);
-            if (iter->second->IsNotifierMapEmpty()) {
-                callbackMap_.erase(iter);
-            }
-        }
-    }
+    (void)registry_.DeleteNotifier(token, cbType);
     HILOGD("token unregister success");
     return ERR_OK;
 }
@@ -287,14 +199,11 @@ int32_t DistributedAbilityManagerService::UpdateConnectStatus(int32_t token, con
     if (!IsTokenRegistered(accessToken, token)) {
         return TOKEN_HAS_NOT_REGISTERED;
     }
-    {
-        std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-        if (!IsNotifierRegistered(token)) {
-            return CALLBACK_HAS_NOT_REGISTERED;
-        }
-        std::shared_ptr<ConnectStatusInfo> connectStatusInfo =
-            std::make_shared<ConnectStatusInfo>(deviceId, deviceConnectStatus);
-        callbackMap_[token]->SetConnectStatusInfo(connectStatusInfo);
+    std::shared_ptr<ConnectStatusInfo> connectStatusInfo =
+        std::make_shared<ConnectStatusInfo>(deviceId, deviceConnectStatus);
+    if (!registry_.SetConnectStatusInfo(token, connectStatusInfo)) {
+        HILOGE("accessToken has not registered in callback map.");
+        return CALLBACK_HAS_NOT_REGISTERED;
     }
     // sendRequest status(token, connectStatusInfo) to app by app proxy when appProxy_ is not null.
     {
@@ -320,11 +229,8 @@ int32_t DistributedAbilityManagerService::StartDeviceManager(
     if (!IsTokenRegistered(accessToken, token)) {
         return TOKEN_HAS_NOT_REGISTERED;
     }
-    {
-        std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-        if (!IsNotifierRegistered(token)) {
-            return CALLBACK_HAS_NOT_REGISTERED;
-        }
+    if (!IsNotifierRegistered(token)) {
+        return CALLBACK_HAS_NOT_REGISTERED;
     }
     // 1. connect to app and get the app proxy if appProxy_ is null, otherwise start device manager directly.
     {
@@ -443,15 +349,13 @@ int32_t DistributedAbilityManagerService::OnDeviceConnect(int32_t token,
     if (!HandleDisconnectAbility()) {
         return DISCONNECT_ABILITY_FAILED;
     }
-    if (!IsNotifierRegisteredLocked(token, EVENT_CONNECT)) {
+    sptr<IRemoteObject> notifier = registry_.GetNotifier(token, EVENT_CONNECT);
+    if (notifier == nullptr) {
+        HILOGE("token and cbType:%{public}s has not registered", EVENT_CONNECT);
         return CALLBACK_HAS_NOT_REGISTERED;
     }
-    {
-        std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-        auto notifier = callbackMap_[token]->GetNotifier(EVENT_CONNECT);
-        if (!HandleDeviceConnect(notifier, continuationResults)) {
-            return INVALID_PARAMETERS_ERR;
-        }
+    if (!HandleDeviceConnect(notifier, continuationResults)) {
+        return INVALID_PARAMETERS_ERR;
     }
     return ERR_OK;
 }
@@ -463,15 +367,13 @@ int32_t DistributedAbilityManagerService::OnDeviceDisconnect(int32_t token,
     if (!HandleDisconnectAbility()) {
         return DISCONNECT_ABILITY_FAILED;
     }
-    if (!IsNotifierRegisteredLocked(token, EVENT_DISCONNECT)) {
+    sptr<IRemoteObject> notifier = registry_.GetNotifier(token, EVENT_DISCONNECT);
+    if (notifier == nullptr) {
+        HILOGE("token and cbType:%{public}s has not registered", EVENT_DISCONNECT);
         return CALLBACK_HAS_NOT_REGISTERED;
     }
-    {
-        std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-        auto notifier = callbackMap_[token]->GetNotifier(EVENT_DISCONNECT);
-        if (!HandleDeviceDisconnect(notifier, continuationResults)) {
-            return INVALID_PARAMETERS_ERR;
-        }
+    if (!HandleDeviceDisconnect(notifier, continuationResults)) {
+        return INVALID_PARAMETERS_ERR;
     }
     return ERR_OK;
 }
@@ -505,9 +407,7 @@ bool DistributedAbilityManagerService::HandleDisconnectAbility()
 
 bool DistributedAbilityManagerService::IsExceededRegisterMaxNum(uint32_t accessToken)
 {
-    std::lock_guard<std::mutex> tokenMapLock(tokenMapMutex_);
-    auto iter = tokenMap_.find(accessToken);
-    if (iter != tokenMap_.end() && iter->second.size() >= MAX_REGISTER_NUM) {
+    if (registry_.GetTokenCount(accessToken) >= MAX_REGISTER_NUM) {
         HILOGE("accessToken registered too much times");
         return true;
     }
@@ -536,43 +436,25 @@ bool DistributedAbilityManagerService::IsConnectStatusValid(DeviceConnectStatus
 
 bool DistributedAbilityManagerService::IsTokenRegistered(uint32_t accessToken, int32_t token)
 {
-    std::lock_guard<std::mutex> tokenMapLock(tokenMapMutex_);
-    auto iter = tokenMap_.find(accessToken);
-    if (iter == tokenMap_.end()) {
-        HILOGE("accessToken has not registered in token map.");
+    if (!registry_.IsTokenRegistered(accessToken, token)) {
+        HILOGE("token has not registered");
         return false;
     }
-    for (auto it = iter->second.begin(); it != iter->second.end(); it++) {
-        if (*it == token) {
-            return true;
-        }
-    }
-    HILOGE("token has not registered");
-    return false;
+    return true;
 }
 
 bool DistributedAbilityManagerService::IsNotifierRegistered(int32_t token)
 {
-    // must be in callbackMapLock scope
-    auto iter = callbackMap_.find(token);
-    if (iter == callbackMap_.end()) {
+    if (!registry_.IsNotifierRegistered(token)) {
         HILOGE("accessToken has not registered in callback map.");
         return false;
     }
-    if (iter->second == nullptr) {
-        HILOGE("notifierInfo is nullptr");
-        return false;
-    }
     return true;
 }
 
 bool DistributedAbilityManagerService::IsNotifierRegisteredLocked(int32_t token, const std::string& cbType)
 {
-    std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-    if (!IsNotifierRegistered(token)) {
-        return false;
-    }
-    if (callbackMap_[token]->GetNotifier(cbType) != nullptr) {
+    if (registry_.GetNotifier(token, cbType) != nullptr) {
         HILOGD("token and cbType:%{public}s has already registered", cbType.c_str());
         return true;
     }
@@ -655,22 +537,15 @@ void DistributedAbilityManagerService::HandleStartDeviceManager(int32_t token,
         sptr<AppDeviceCallbackStub> callback(new AppDeviceCallbackStub());
         PARCEL_WRITE_HELPER_NORET(data, RemoteObject, callback);
         // query whether the connect status needs to be send
-        {
-            std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-            if (IsNotifierRegistered(token)) {
-                std::shared_ptr<ConnectStatusInfo> connectStatusInfo = callbackMap_[token]->GetConnectStatusInfo();
-                if (connectStatusInfo == nullptr) {
-                    PARCEL_WRITE_HELPER_NORET(data, Int32, VALUE_NULL);
-                } else {
-                    PARCEL_WRITE_HELPER_NORET(data, Int32, VALUE_OBJECT);
-                    // use u16string, because send to app
-                    PARCEL_WRITE_HELPER_NORET(data, String16, Str8ToStr16(connectStatusInfo->GetDeviceId()));
-                    PARCEL_WRITE_HELPER_NORET(data, Int32,
-                        static_cast<int32_t>(connectStatusInfo->GetDeviceConnectStatus()));
-                }
-            } else {
-                PARCEL_WRITE_HELPER_NORET(data, Int32, VALUE_NULL);
-            }
+        std::shared_ptr<ConnectStatusInfo> connectStatusInfo = registry_.GetConnectStatusInfo(token);
+        if (connectStatusInfo == nullptr) {
+            PARCEL_WRITE_HELPER_NORET(data, Int32, VALUE_NULL);
+        } else {
+            PARCEL_WRITE_HELPER_NORET(data, Int32, VALUE_OBJECT);
+            // use u16string, because send to app
+            PARCEL_WRITE_HELPER_NORET(data, String16, Str8ToStr16(connectStatusInfo->GetDeviceId()));
+            PARCEL_WRITE_HELPER_NORET(data, Int32,
+                static_cast<int32_t>(connectStatusInfo->GetDeviceConnectStatus()));
         }
         MessageParcel reply;
         MessageOption option;
@@ -710,21 +585,6 @@ void DistributedAbilityManagerService::HandleUpdateConnectStatus(int32_t token,
     continuationHandler_->submit(func);
 }
 
-bool DistributedAbilityManagerService::QueryTokenByNotifier(const sptr<IRemoteObject>& notifier, int32_t& token)
-{
-    std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-    for (auto iter = callbackMap_.begin(); iter != callbackMap_.end(); iter++) {
-        if (iter->second == nullptr) {
-            return false;
-        }
-        if (iter->second->QueryNotifier(notifier)) {
-            token = iter->first;
-            return true;
-        }
-    }
-    return false;
-}
-
 void DistributedAbilityManagerService::ProcessNotifierDied(const sptr<IRemoteObject>& notifier)
 {
     // update cache when third-party app died
@@ -740,40 +600,35 @@ void DistributedAbilityManagerService::HandleNotifierDied(const sptr<IRemoteObje
         HILOGE("continuationHandler_ is nullptr");
         return;
     }
-    auto func = [this, notifier] () {
-        HILOGD("HandleNotifierDied called.");
-        // query token in callbackMap_ by notifier
-        int32_t token = -1;
-        if (!QueryTokenByNotifier(notifier, token)) {
-            HILOGE("QueryTokenByNotifier failed");
+    // deaths arriving before the queued task runs are handled by that task together
+    {
+        std::lock_guard<std::mutex> diedNotifierLock(diedNotifierMutex_);
+        diedNotifiers_.emplace_back(notifier);
+        if (diedNotifiers_.size() > 1) {
             return;
         }
-        // remove death recipient and update callbackMap_ by token
-        {
-            std::lock_guard<std::mutex> callbackMapLock(callbackMapMutex_);
-            if (IsNotifierRegistered(token)) {
-                callbackMap_[token]->RemoveDeathRecipient(notifierDeathRecipient_);
-                callbackMap_.erase(token);
-            }
-        }
-        // update tokenMap_ by token
-        {
-            std::lock_guard<std::mutex> tokenMapLock(tokenMapMutex_);
-            for (auto iter = tokenMap_.begin(); iter != tokenMap_.end();) {
-                iter->second.erase(std::remove_if(iter->second.begin(), iter->second.end(),
-                    [token](int32_t n) { return n == token; }), iter->second.end());
-                if (iter->second.empty()) {
-                    tokenMap_.erase(iter++);
-                    break;
-                } else {
-                    iter++;
-                }
-            }
-        }
-        // disconnect to app when third-party app died
-        (void)HandleDisconnectAbility();
+    }
+    auto func = [this]() {
+        HILOGD("HandleNotifierDied called.");
+        RemoveDiedNotifiers();
     };
     continuationHandler_->submit(func);
 }
+
+void DistributedAbilityManagerService::RemoveDiedNotifiers()
+{
+    std::vector<sptr<IRemoteObject>> diedNotifiers;
+    {
+        std::lock_guard<std::mutex> diedNotifierLock(diedNotifierMutex_);
+        diedNotifiers.swap(diedNotifiers_);
+    }
+    std::vector<int32_t> removedTokens = registry_.RemoveTokensByNotifiers(diedNotifiers);
+    HILOGI("%{public}zu notifiers died, %{public}zu tokens removed", diedNotifiers.size(), removedTokens.size());
+    if (removedTokens.empty()) {
+        return;
+    }
+    // disconnect to app when third-party app died
+    (void)HandleDisconnectAbility();
+}
 } // namespace DistributedSchedule
 } // namespace OHOS
\ No newline at end of file
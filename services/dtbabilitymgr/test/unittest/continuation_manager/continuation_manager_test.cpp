@@ -787,10 +787,8 @@ HWTEST_F(ContinuationManagerTest, IsExceededRegisterMaxNumTest_001, TestSize.Lev
 {
     DTEST_LOG << "ContinuationManagerTest IsExceededRegisterMaxNumTest_001 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::vector<int32_t> tokenVec;
-    tokenVec.emplace_back(TEST_TOKEN);
-    uint32_t accessToken = TEST_ACCESS_TOKEN;
-    dtbabilitymgrService_->tokenMap_[accessToken] = tokenVec;
+    dtbabilitymgrService_->registry_.Clear();
+    dtbabilitymgrService_->registry_.AddToken(TEST_ACCESS_TOKEN, TEST_TOKEN);
     bool result = dtbabilitymgrService_->IsExceededRegisterMaxNum(TEST_ACCESS_TOKEN);
     DTEST_LOG << "result:" << result << std::endl;
     EXPECT_EQ(false, result);
@@ -870,9 +868,7 @@ HWTEST_F(ContinuationManagerTest, IsTokenRegisteredTest_001, TestSize.Level1)
 {
     DTEST_LOG << "ContinuationManagerTest IsTokenRegisteredTest_002 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::vector<int32_t> tokenVec;
-    uint32_t accessToken = TEST_ACCESS_TOKEN;
-    dtbabilitymgrService_->tokenMap_[accessToken] = tokenVec;
+    dtbabilitymgrService_->registry_.Clear();
     bool result = dtbabilitymgrService_->IsTokenRegistered(TEST_ACCESS_TOKEN, TEST_TOKEN);
     DTEST_LOG << "result:" << result << std::endl;
     EXPECT_EQ(false, result);
@@ -888,10 +884,8 @@ HWTEST_F(ContinuationManagerTest, IsTokenRegisteredTest_002, TestSize.Level1)
 {
     DTEST_LOG << "ContinuationManagerTest IsTokenRegisteredTest_002 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::vector<int32_t> tokenVec;
-    tokenVec.emplace_back(TEST_TOKEN);
-    uint32_t accessToken = TEST_ACCESS_TOKEN;
-    dtbabilitymgrService_->tokenMap_[accessToken] = tokenVec;
+    dtbabilitymgrService_->registry_.Clear();
+    dtbabilitymgrService_->registry_.AddToken(TEST_ACCESS_TOKEN, TEST_TOKEN);
     bool result = dtbabilitymgrService_->IsTokenRegistered(TEST_ACCESS_TOKEN, TEST_TOKEN);
     DTEST_LOG << "result:" << result << std::endl;
     EXPECT_EQ(true, result);
@@ -952,10 +946,8 @@ HWTEST_F(ContinuationManagerTest, IsNotifierRegisteredTest_004, TestSize.Level1)
 {
     DTEST_LOG << "ContinuationManagerTest IsNotifierRegisteredTest_004 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    notifierInfo->SetNotifier(CALLBACK_TYPE1, notifier);
-    dtbabilitymgrService_->callbackMap_[TEST_TOKEN] = std::move(notifierInfo);
+    dtbabilitymgrService_->registry_.SetNotifier(TEST_TOKEN, CALLBACK_TYPE1, notifier);
     bool result = dtbabilitymgrService_->IsNotifierRegistered(TEST_TOKEN);
     DTEST_LOG << "result:" << result << std::endl;
     EXPECT_EQ(true, result);
@@ -971,10 +963,8 @@ HWTEST_F(ContinuationManagerTest, IsNotifierRegisteredLockedTest_005, TestSize.L
 {
     DTEST_LOG << "ContinuationManagerTest IsNotifierRegisteredLockedTest_005 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    notifierInfo->SetNotifier(CALLBACK_TYPE1, notifier);
-    dtbabilitymgrService_->callbackMap_[TEST_TOKEN] = std::move(notifierInfo);
+    dtbabilitymgrService_->registry_.SetNotifier(TEST_TOKEN, CALLBACK_TYPE1, notifier);
     bool result = dtbabilitymgrService_->IsNotifierRegisteredLocked(TEST_TOKEN, CALLBACK_TYPE2);
     DTEST_LOG << "result:" << result << std::endl;
     EXPECT_EQ(false, result);
@@ -990,10 +980,8 @@ HWTEST_F(ContinuationManagerTest, IsNotifierRegisteredLockedTest_006, TestSize.L
 {
     DTEST_LOG << "ContinuationManagerTest IsNotifierRegisteredLockedTest_006 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    notifierInfo->SetNotifier(CALLBACK_TYPE1, notifier);
-    dtbabilitymgrService_->callbackMap_[TEST_TOKEN] = std::move(notifierInfo);
+    dtbabilitymgrService_->registry_.SetNotifier(TEST_TOKEN, CALLBACK_TYPE1, notifier);
     bool result = dtbabilitymgrService_->IsNotifierRegisteredLocked(UNREGISTER_TOKEN, CALLBACK_TYPE1);
     DTEST_LOG << "result:" << result << std::endl;
     EXPECT_EQ(false, result);
@@ -1010,10 +998,8 @@ HWTEST_F(ContinuationManagerTest, IsNotifierRegisteredLockedTest_007, TestSize.L
 {
     DTEST_LOG << "ContinuationManagerTest IsNotifierRegisteredLockedTest_007 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    notifierInfo->SetNotifier(CALLBACK_TYPE1, notifier);
-    dtbabilitymgrService_->callbackMap_[TEST_TOKEN] = std::move(notifierInfo);
+    dtbabilitymgrService_->registry_.SetNotifier(TEST_TOKEN, CALLBACK_TYPE1, notifier);
     bool result = dtbabilitymgrService_->IsNotifierRegisteredLocked(TEST_TOKEN, CALLBACK_TYPE1);
     DTEST_LOG << "result:" << result << std::endl;
     EXPECT_EQ(true, result);
@@ -1021,44 +1007,40 @@ HWTEST_F(ContinuationManagerTest, IsNotifierRegisteredLockedTest_007, TestSize.L
 }
 
 /**
- * @tc.name: QueryTokenByNotifier_001
- * @tc.desc: test QueryTokenByNotifier function with incorrect notifier.
+ * @tc.name: RemoveTokensByNotifiers_001
+ * @tc.desc: test RemoveTokensByNotifiers function with incorrect notifier.
  * @tc.type: FUNC
  */
-HWTEST_F(ContinuationManagerTest, QueryTokenByNotifier_001, TestSize.Level1)
+HWTEST_F(ContinuationManagerTest, RemoveTokensByNotifiers_001, TestSize.Level1)
 {
-    DTEST_LOG << "ContinuationManagerTest QueryTokenByNotifier_001 start" << std::endl;
+    DTEST_LOG << "ContinuationManagerTest RemoveTokensByNotifiers_001 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    notifierInfo->SetNotifier(CALLBACK_TYPE1, notifier);
-    dtbabilitymgrService_->callbackMap_[TEST_TOKEN] = std::move(notifierInfo);
-    int32_t token = -1;
-    bool result = dtbabilitymgrService_->QueryTokenByNotifier(nullptr, token);
-    DTEST_LOG << "result:" << result << std::endl;
-    EXPECT_EQ(false, result);
-    DTEST_LOG << "ContinuationManagerTest QueryTokenByNotifier_001 end" << std::endl;
+    dtbabilitymgrService_->registry_.SetNotifier(TEST_TOKEN, CALLBACK_TYPE1, notifier);
+    std::vector<int32_t> result = dtbabilitymgrService_->registry_.RemoveTokensByNotifiers({ nullptr });
+    DTEST_LOG << "result size:" << result.size() << std::endl;
+    EXPECT_TRUE(result.empty());
+    EXPECT_TRUE(dtbabilitymgrService_->IsNotifierRegistered(TEST_TOKEN));
+    DTEST_LOG << "ContinuationManagerTest RemoveTokensByNotifiers_001 end" << std::endl;
 }
 
 /**
- * @tc.name: QueryTokenByNotifier_002
- * @tc.desc: test QueryTokenByNotifier function with correct notifier.
+ * @tc.name: RemoveTokensByNotifiers_002
+ * @tc.desc: test RemoveTokensByNotifiers function with correct notifier.
  * @tc.type: FUNC
  */
-HWTEST_F(ContinuationManagerTest, QueryTokenByNotifier_002, TestSize.Level1)
+HWTEST_F(ContinuationManagerTest, RemoveTokensByNotifiers_002, TestSize.Level1)
 {
-    DTEST_LOG << "ContinuationManagerTest QueryTokenByNotifier_002 start" << std::endl;
+    DTEST_LOG << "ContinuationManagerTest RemoveTokensByNotifiers_002 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    notifierInfo->SetNotifier(CALLBACK_TYPE1, notifier);
-    dtbabilitymgrService_->callbackMap_[TEST_TOKEN] = std::move(notifierInfo);
-    int32_t token = -1;
-    bool result = dtbabilitymgrService_->QueryTokenByNotifier(notifier, token);
-    DTEST_LOG << "result:" << result << std::endl;
-    EXPECT_EQ(true, result);
-    EXPECT_EQ(TEST_TOKEN, token);
-    DTEST_LOG << "ContinuationManagerTest QueryTokenByNotifier_002 end" << std::endl;
+    dtbabilitymgrService_->registry_.SetNotifier(TEST_TOKEN, CALLBACK_TYPE1, notifier);
+    std::vector<int32_t> result = dtbabilitymgrService_->registry_.RemoveTokensByNotifiers({ notifier });
+    DTEST_LOG << "result size:" << result.size() << std::endl;
+    ASSERT_EQ(1u, result.size());
+    EXPECT_EQ(TEST_TOKEN, result[0]);
+    EXPECT_EQ(false, dtbabilitymgrService_->IsNotifierRegistered(TEST_TOKEN));
+    DTEST_LOG << "ContinuationManagerTest RemoveTokensByNotifiers_002 end" << std::endl;
 }
 
 /**
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "continuation_token_registry_test.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "idevice_selection_notifier.h"
+#include "mock_remote_stub.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr uint32_t TEST_ACCESS_TOKEN = 10000000;
+constexpr uint32_t OTHER_ACCESS_TOKEN = 10000001;
+constexpr int32_t TEST_TOKEN = 1000;
+constexpr int32_t OTHER_TOKEN = 1001;
+constexpr int32_t THIRD_TOKEN = 1002;
+constexpr int32_t THREAD_NUM = 8;
+constexpr int32_t TOKENS_PER_THREAD = 2000;
+constexpr int32_t LOOKUP_TIMES = 4;
+const std::string DEVICE_ID = "testDeviceId";
+}
+
+void ContinuationTokenRegistryTest::SetUpTestCase()
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest::SetUpTestCase" << std::endl;
+}
+
+void ContinuationTokenRegistryTest::TearDownTestCase()
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest::TearDownTestCase" << std::endl;
+}
+
+void ContinuationTokenRegistryTest::SetUp()
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest::SetUp" << std::endl;
+}
+
+void ContinuationTokenRegistryTest::TearDown()
+{
+    registry_.Clear();
+    DTEST_LOG << "ContinuationTokenRegistryTest::TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: AddToken_001
+ * @tc.desc: tokens are found by caller and removed by value
+ * @tc.type: FUNC
+ */
+HWTEST_F(ContinuationTokenRegistryTest, AddToken_001, TestSize.Level3)
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest AddToken_001 begin" << std::endl;
+    registry_.AddToken(TEST_ACCESS_TOKEN, TEST_TOKEN);
+    registry_.AddToken(TEST_ACCESS_TOKEN, OTHER_TOKEN);
+    EXPECT_EQ(registry_.GetTokenCount(TEST_ACCESS_TOKEN), 2u);
+    EXPECT_TRUE(registry_.IsTokenRegistered(TEST_ACCESS_TOKEN, TEST_TOKEN));
+    EXPECT_FALSE(registry_.IsTokenRegistered(OTHER_ACCESS_TOKEN, TEST_TOKEN));
+
+    EXPECT_TRUE(registry_.RemoveToken(TEST_TOKEN));
+    EXPECT_FALSE(registry_.RemoveToken(TEST_TOKEN));
+    EXPECT_FALSE(registry_.IsTokenRegistered(TEST_ACCESS_TOKEN, TEST_TOKEN));
+    EXPECT_EQ(registry_.GetTokenCount(TEST_ACCESS_TOKEN), 1u);
+    EXPECT_TRUE(registry_.RemoveToken(OTHER_TOKEN));
+    EXPECT_EQ(registry_.GetTokenCount(TEST_ACCESS_TOKEN), 0u);
+    EXPECT_TRUE(registry_.tokenMap_.empty());
+    DTEST_LOG << "ContinuationTokenRegistryTest AddToken_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: AddToken_002
+ * @tc.desc: a token reused after the counter wrapped leaves its former caller and notifiers
+ * @tc.type: FUNC
+ */
+HWTEST_F(ContinuationTokenRegistryTest, AddToken_002, TestSize.Level3)
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest AddToken_002 begin" << std::endl;
+    sptr<IRemoteObject> notifier(new MockRemoteStub());
+    registry_.AddToken(TEST_ACCESS_TOKEN, TEST_TOKEN);
+    EXPECT_TRUE(registry_.SetNotifier(TEST_TOKEN, EVENT_CONNECT, notifier));
+    registry_.AddToken(OTHER_ACCESS_TOKEN, TEST_TOKEN);
+    EXPECT_FALSE(registry_.IsTokenRegistered(TEST_ACCESS_TOKEN, TEST_TOKEN));
+    EXPECT_TRUE(registry_.IsTokenRegistered(OTHER_ACCESS_TOKEN, TEST_TOKEN));
+    EXPECT_EQ(registry_.GetTokenCount(TEST_ACCESS_TOKEN), 0u);
+    EXPECT_FALSE(registry_.IsNotifierRegistered(TEST_TOKEN));
+    EXPECT_TRUE(registry_.notifierTokens_.empty());
+    DTEST_LOG << "ContinuationTokenRegistryTest AddToken_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: SetNotifier_001
+ * @tc.desc: notifiers are set, replaced and deleted per callback type
+ * @tc.type: FUNC
+ */
+HWTEST_F(ContinuationTokenRegistryTest, SetNotifier_001, TestSize.Level3)
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest SetNotifier_001 begin" << std::endl;
+    sptr<IRemoteObject> notifier(new MockRemoteStub());
+    sptr<IRemoteObject> otherNotifier(new MockRemoteStub());
+    EXPECT_FALSE(registry_.SetNotifier(TEST_TOKEN, EVENT_CONNECT, nullptr));
+    EXPECT_FALSE(registry_.IsNotifierRegistered(TEST_TOKEN));
+
+    EXPECT_TRUE(registry_.SetNotifier(TEST_TOKEN, EVENT_CONNECT, notifier));
+    EXPECT_TRUE(registry_.SetNotifier(TEST_TOKEN, EVENT_DISCONNECT, notifier));
+    EXPECT_EQ(registry_.GetNotifier(TEST_TOKEN, EVENT_CONNECT), notifier);
+    EXPECT_EQ(registry_.notifierTokens_[notifier.GetRefPtr()].count(TEST_TOKEN), 2u);
+
+    EXPECT_TRUE(registry_.SetNotifier(TEST_TOKEN, EVENT_CONNECT, otherNotifier));
+    EXPECT_EQ(registry_.GetNotifier(TEST_TOKEN, EVENT_CONNECT), otherNotifier);
+    EXPECT_EQ(registry_.notifierTokens_[notifier.GetRefPtr()].count(TEST_TOKEN), 1u);
+
+    EXPECT_TRUE(registry_.DeleteNotifier(TEST_TOKEN, EVENT_DISCONNECT));
+    EXPECT_FALSE(registry_.DeleteNotifier(TEST_TOKEN, EVENT_DISCONNECT));
+    EXPECT_EQ(registry_.notifierTokens_.count(notifier.GetRefPtr()), 0u);
+    EXPECT_TRUE(registry_.DeleteNotifier(TEST_TOKEN, EVENT_CONNECT));
+    EXPECT_FALSE(registry_.IsNotifierRegistered(TEST_TOKEN));
+    EXPECT_TRUE(registry_.notifierTokens_.empty());
+    DTEST_LOG << "ContinuationTokenRegistryTest SetNotifier_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: SetConnectStatusInfo_001
+ * @tc.desc: the connect status is kept with the notifiers of the token
+ * @tc.type: FUNC
+ */
+HWTEST_F(ContinuationTokenRegistryTest, SetConnectStatusInfo_001, TestSize.Level3)
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest SetConnectStatusInfo_001 begin" << std::endl;
+    auto connectStatusInfo = std::make_shared<ConnectStatusInfo>(DEVICE_ID, DeviceConnectStatus::CONNECTED);
+    EXPECT_FALSE(registry_.SetConnectStatusInfo(TEST_TOKEN, connectStatusInfo));
+    EXPECT_EQ(registry_.GetConnectStatusInfo(TEST_TOKEN), nullptr);
+
+    sptr<IRemoteObject> notifier(new MockRemoteStub());
+    EXPECT_TRUE(registry_.SetNotifier(TEST_TOKEN, EVENT_CONNECT, notifier));
+    EXPECT_TRUE(registry_.SetConnectStatusInfo(TEST_TOKEN, connectStatusInfo));
+    EXPECT_EQ(registry_.GetConnectStatusInfo(TEST_TOKEN), connectStatusInfo);
+    EXPECT_TRUE(registry_.RemoveToken(TEST_TOKEN));
+    EXPECT_EQ(registry_.GetConnectStatusInfo(TEST_TOKEN), nullptr);
+    DTEST_LOG << "ContinuationTokenRegistryTest SetConnectStatusInfo_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: RemoveTokensByNotifiers_001
+ * @tc.desc: every token using a died notifier is removed in one call, other tokens stay
+ * @tc.type: FUNC
+ */
+HWTEST_F(ContinuationTokenRegistryTest, RemoveTokensByNotifiers_001, TestSize.Level3)
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest RemoveTokensByNotifiers_001 begin" << std::endl;
+    sptr<IRemoteObject> diedNotifier(new MockRemoteStub());
+    sptr<IRemoteObject> aliveNotifier(new MockRemoteStub());
+    registry_.AddToken(TEST_ACCESS_TOKEN, TEST_TOKEN);
+    registry_.AddToken(OTHER_ACCESS_TOKEN, OTHER_TOKEN);
+    registry_.AddToken(OTHER_ACCESS_TOKEN, THIRD_TOKEN);
+    EXPECT_TRUE(registry_.SetNotifier(TEST_TOKEN, EVENT_CONNECT, diedNotifier));
+    EXPECT_TRUE(registry_.SetNotifier(TEST_TOKEN, EVENT_DISCONNECT, diedNotifier));
+    EXPECT_TRUE(registry_.SetNotifier(OTHER_TOKEN, EVENT_CONNECT, diedNotifier));
+    EXPECT_TRUE(registry_.SetNotifier(THIRD_TOKEN, EVENT_CONNECT, aliveNotifier));
+
+    std::vector<int32_t> removedTokens = registry_.RemoveTokensByNotifiers({ diedNotifier, diedNotifier, nullptr });
+    std::sort(removedTokens.begin(), removedTokens.end());
+    EXPECT_EQ(removedTokens, std::vector<int32_t>({ TEST_TOKEN, OTHER_TOKEN }));
+    EXPECT_FALSE(registry_.IsTokenRegistered(TEST_ACCESS_TOKEN, TEST_TOKEN));
+    EXPECT_FALSE(registry_.IsTokenRegistered(OTHER_ACCESS_TOKEN, OTHER_TOKEN));
+    EXPECT_TRUE(registry_.IsTokenRegistered(OTHER_ACCESS_TOKEN, THIRD_TOKEN));
+    EXPECT_EQ(registry_.GetNotifier(THIRD_TOKEN, EVENT_CONNECT), aliveNotifier);
+    EXPECT_EQ(registry_.notifierTokens_.size(), 1u);
+    EXPECT_TRUE(registry_.RemoveTokensByNotifiers({ diedNotifier }).empty());
+    DTEST_LOG << "ContinuationTokenRegistryTest RemoveTokensByNotifiers_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Dump_001
+ * @tc.desc: the dump lists the tokens of each caller with their callback types
+ * @tc.type: FUNC
+ */
+HWTEST_F(ContinuationTokenRegistryTest, Dump_001, TestSize.Level3)
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest Dump_001 begin" << std::endl;
+    std::string info;
+    registry_.Dump(info);
+    EXPECT_NE(info.find("<none info>"), std::string::npos);
+
+    sptr<IRemoteObject> notifier(new MockRemoteStub());
+    registry_.AddToken(TEST_ACCESS_TOKEN, OTHER_TOKEN);
+    registry_.AddToken(TEST_ACCESS_TOKEN, TEST_TOKEN);
+    EXPECT_TRUE(registry_.SetNotifier(OTHER_TOKEN, EVENT_DISCONNECT, notifier));
+    info.clear();
+    registry_.Dump(info);
+    EXPECT_NE(info.find("accessToken: 10000000, token: 1000, token: 1001, cbType:  deviceUnselected"),
+        std::string::npos);
+    DTEST_LOG << "ContinuationTokenRegistryTest Dump_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: ConcurrentAccess_001
+ * @tc.desc: callers register, look up and unregister thousands of tokens at once
+ * @tc.type: FUNC
+ */
+HWTEST_F(ContinuationTokenRegistryTest, ConcurrentAccess_001, TestSize.Level3)
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest ConcurrentAccess_001 begin" << std::endl;
+    std::atomic<int32_t> missCount { 0 };
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < THREAD_NUM; i++) {
+        threads.emplace_back([this, i, &missCount]() {
+            uint32_t accessToken = TEST_ACCESS_TOKEN + static_cast<uint32_t>(i);
+            sptr<IRemoteObject> notifier(new MockRemoteStub());
+            int32_t firstToken = i * TOKENS_PER_THREAD + 1;
+            for (int32_t token = firstToken; token < firstToken + TOKENS_PER_THREAD; token++) {
+                registry_.AddToken(accessToken, token);
+                registry_.SetNotifier(token, EVENT_CONNECT, notifier);
+            }
+            for (int32_t times = 0; times < LOOKUP_TIMES; times++) {
+                for (int32_t token = firstToken; token < firstToken + TOKENS_PER_THREAD; token++) {
+                    if (!registry_.IsTokenRegistered(accessToken, token) ||
+                        registry_.GetNotifier(token, EVENT_CONNECT) != notifier) {
+                        missCount++;
+                    }
+                }
+            }
+            for (int32_t token = firstToken; token < firstToken + TOKENS_PER_THREAD; token++) {
+                if (!registry_.RemoveToken(token)) {
+                    missCount++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    DTEST_LOG << THREAD_NUM * TOKENS_PER_THREAD << " tokens in " << elapsedMs << "ms" << std::endl;
+    EXPECT_EQ(missCount.load(), 0);
+    EXPECT_TRUE(registry_.tokenMap_.empty());
+    EXPECT_TRUE(registry_.tokenOwners_.empty());
+    EXPECT_TRUE(registry_.callbackMap_.empty());
+    EXPECT_TRUE(registry_.notifierTokens_.empty());
+    DTEST_LOG << "ContinuationTokenRegistryTest ConcurrentAccess_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: ConcurrentAccess_002
+ * @tc.desc: died notifiers are removed in one batch while other callers keep registering
+ * @tc.type: FUNC
+ */
+HWTEST_F(ContinuationTokenRegistryTest, ConcurrentAccess_002, TestSize.Level3)
+{
+    DTEST_LOG << "ContinuationTokenRegistryTest ConcurrentAccess_002 begin" << std::endl;
+    std::vector<sptr<IRemoteObject>> notifiers;
+    for (int32_t i = 0; i < THREAD_NUM; i++) {
+        notifiers.emplace_back(new MockRemoteStub());
+    }
+    auto registerTokens = [this, &notifiers](int32_t i) {
+        uint32_t accessToken = TEST_ACCESS_TOKEN + static_cast<uint32_t>(i);
+        int32_t firstToken = i * TOKENS_PER_THREAD + 1;
+        for (int32_t token = firstToken; token < firstToken + TOKENS_PER_THREAD; token++) {
+            registry_.AddToken(accessToken, token);
+            registry_.SetNotifier(token, EVENT_CONNECT, notifiers[i]);
+        }
+    };
+    // the callers of even index register first and then die
+    std::vector<std::thread> threads;
+    std::vector<sptr<IRemoteObject>> diedNotifiers;
+    for (int32_t i = 0; i < THREAD_NUM; i += 2) {
+        threads.emplace_back(registerTokens, i);
+        diedNotifiers.emplace_back(notifiers[i]);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+    for (int32_t i = 1; i < THREAD_NUM; i += 2) {
+        threads.emplace_back(registerTokens, i);
+    }
+    std::vector<int32_t> removedTokens = registry_.RemoveTokensByNotifiers(diedNotifiers);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(static_cast<int32_t>(removedTokens.size()), THREAD_NUM / 2 * TOKENS_PER_THREAD);
+    for (int32_t i = 0; i < THREAD_NUM; i++) {
+        uint32_t expectedCount = (i % 2 == 0) ? 0 : TOKENS_PER_THREAD;
+        EXPECT_EQ(registry_.GetTokenCount(TEST_ACCESS_TOKEN + static_cast<uint32_t>(i)), expectedCount);
+    }
+    EXPECT_EQ(registry_.notifierTokens_.size(), static_cast<size_t>(THREAD_NUM / 2));
+    DTEST_LOG << "ContinuationTokenRegistryTest ConcurrentAccess_002 end" << std::endl;
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -106,21 +106,14 @@ HWTEST_F(DistributedAbilityManagerServiceTest, Dump_001, TestSize.Level3)
     int32_t result = dtbabilitymgrService_->Dump(INVALID_CODE, args);
     EXPECT_EQ(result, DMS_WRITE_FILE_FAILED_ERR);
     /**
-     * @tc.steps: step2. test DumpAppRegisterInfo when tokenMap_ is not empty.
+     * @tc.steps: step2. test DumpAppRegisterInfo when a token is registered.
      */
     std::string info;
-    std::vector<int32_t> tokenMapValue;
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->tokenMapMutex_);
-        dtbabilitymgrService_->tokenMap_.clear();
-        tokenMapValue.push_back(INVALID_CODE);
-        dtbabilitymgrService_->tokenMap_[TEST_UINT32_T] = tokenMapValue;
-    }
+    dtbabilitymgrService_->registry_.Clear();
+    dtbabilitymgrService_->registry_.AddToken(TEST_UINT32_T, INVALID_CODE);
     dtbabilitymgrService_->DumpAppRegisterInfo(info);
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->tokenMapMutex_);
-        dtbabilitymgrService_->tokenMap_.clear();
-    }
+    EXPECT_NE(info.find("accessToken: 0, token: -1"), std::string::npos);
+    dtbabilitymgrService_->registry_.Clear();
     DTEST_LOG << "DistributedAbilityManagerServiceTest Dump_001 end" << std::endl;
 }
 
@@ -229,18 +222,16 @@ HWTEST_F(DistributedAbilityManagerServiceTest, Register_001, TestSize.Level3)
     DTEST_LOG << "DistributedAbilityManagerServiceTest Register_001 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
     /**
-     * @tc.steps: step1. test DumpNotifierLocked when callbackMap_ is not empty.
+     * @tc.steps: step1. test DumpAppRegisterInfo when a notifier is registered.
      */
-    std::vector<int32_t> tokenVec;
     std::string info;
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-        dtbabilitymgrService_->callbackMap_[INVALID_CODE] = std::move(notifierInfo);;
-    }
-    tokenVec.push_back(INVALID_CODE);
-    dtbabilitymgrService_->DumpNotifierLocked(tokenVec, info);
+    sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
+    dtbabilitymgrService_->registry_.Clear();
+    dtbabilitymgrService_->registry_.AddToken(TEST_UINT32_T, INVALID_CODE);
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(INVALID_CODE, EVENT_CONNECT, notifier));
+    dtbabilitymgrService_->DumpAppRegisterInfo(info);
+    EXPECT_NE(info.find(EVENT_CONNECT), std::string::npos);
+    dtbabilitymgrService_->registry_.Clear();
     /**
      * @tc.steps: step2. test Register when register max num.
      */
@@ -251,10 +242,7 @@ HWTEST_F(DistributedAbilityManagerServiceTest, Register_001, TestSize.Level3)
     }
     int32_t ret = dtbabilitymgrService_->Register(continuationExtraParams, token);
     EXPECT_EQ(ret, REGISTER_EXCEED_MAX_TIMES);
-    {
-        std::lock_guard<std::mutex> tokenLock(dtbabilitymgrService_->tokenMutex_);
-        dtbabilitymgrService_->tokenMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     DTEST_LOG << "DistributedAbilityManagerServiceTest Register_001 end" << std::endl;
 }
 
@@ -276,10 +264,7 @@ HWTEST_F(DistributedAbilityManagerServiceTest, Unregister_001, TestSize.Level3)
     /**
      * @tc.steps: step2. test Unregister when notifier is not registered.
      */
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     int32_t token = 0;
     std::shared_ptr<ContinuationExtraParams> continuationExtraParams = std::make_shared<ContinuationExtraParams>();
     ret = dtbabilitymgrService_->Register(continuationExtraParams, token);
@@ -291,17 +276,11 @@ HWTEST_F(DistributedAbilityManagerServiceTest, Unregister_001, TestSize.Level3)
      */
     ret = dtbabilitymgrService_->Register(continuationExtraParams, token);
     EXPECT_EQ(ret, ERR_OK);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-        dtbabilitymgrService_->callbackMap_[token] = std::move(notifierInfo);;
-    }
+    sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(token, EVENT_CONNECT, notifier));
     ret = dtbabilitymgrService_->Unregister(token);
     EXPECT_EQ(ret, ERR_OK);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     DTEST_LOG << "DistributedAbilityManagerServiceTest Unregister_001 end" << std::endl;
 }
 
@@ -325,19 +304,13 @@ HWTEST_F(DistributedAbilityManagerServiceTest, Unregister_002, TestSize.Level3)
     EXPECT_EQ(ret, ERR_OK);
     ret = dtbabilitymgrService_->Register(continuationExtraParams, tokenBackup);
     EXPECT_EQ(ret, ERR_OK);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-        dtbabilitymgrService_->callbackMap_[token] = std::move(notifierInfo);;
-    }
+    sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(token, EVENT_CONNECT, notifier));
     ret = dtbabilitymgrService_->Unregister(token);
     EXPECT_EQ(ret, ERR_OK);
     ret = dtbabilitymgrService_->Unregister(tokenBackup);
     EXPECT_EQ(ret, ERR_OK);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     DTEST_LOG << "DistributedAbilityManagerServiceTest Unregister_002 end" << std::endl;
 }
 
@@ -418,19 +391,16 @@ HWTEST_F(DistributedAbilityManagerServiceTest, RegisterDeviceSelectionCallback_0
     DTEST_LOG << "DistributedAbilityManagerServiceTest RegisterDeviceSelectionCallback_002 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
     /**
-     * @tc.steps: step1. test RegisterDeviceSelectionCallback when iter->second != nullptr.
+     * @tc.steps: step1. test RegisterDeviceSelectionCallback when notifier is nullptr.
      */
     int32_t token = 0;
     std::shared_ptr<ContinuationExtraParams> continuationExtraParams = std::make_shared<ContinuationExtraParams>();
     int32_t ret = dtbabilitymgrService_->Register(continuationExtraParams, token);
     EXPECT_EQ(ret, ERR_OK);
-    sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_[token] = nullptr;
-    }
-    ret = dtbabilitymgrService_->RegisterDeviceSelectionCallback(token, EVENT_CONNECT, notifier);
+    ret = dtbabilitymgrService_->RegisterDeviceSelectionCallback(token, EVENT_CONNECT, nullptr);
     EXPECT_EQ(ret, ERR_NULL_OBJECT);
+    ret = dtbabilitymgrService_->Unregister(token);
+    EXPECT_EQ(ret, ERR_OK);
     DTEST_LOG << "DistributedAbilityManagerServiceTest RegisterDeviceSelectionCallback_003 end" << std::endl;
 }
 
@@ -445,20 +415,15 @@ HWTEST_F(DistributedAbilityManagerServiceTest, IsTokenRegistered_001, TestSize.L
     DTEST_LOG << "DistributedAbilityManagerServiceTest IsTokenRegistered_001 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
     /**
-     * @tc.steps: step1. test RegisterDeviceSelectionCallback when iter->second != nullptr.
+     * @tc.steps: step1. test IsTokenRegistered when accessToken has other tokens registered.
      */
     int32_t token = 0;
-    {
-        std::lock_guard<std::mutex> tokenMapLock(dtbabilitymgrService_->tokenMapMutex_);
-        dtbabilitymgrService_->tokenMap_.clear();
-        std::vector<int32_t> vec;
-        for (int32_t i = 0; i < MAX_REGISTER_NUM; ++i) {
-            vec.push_back(INVALID_CODE);
-        }
-        dtbabilitymgrService_->tokenMap_[TEST_UINT32_T] = vec;
-    }
-    int32_t ret = dtbabilitymgrService_->IsTokenRegistered(TEST_UINT32_T, token);
-    EXPECT_EQ(ret, ERR_OK);
+    dtbabilitymgrService_->registry_.Clear();
+    dtbabilitymgrService_->registry_.AddToken(TEST_UINT32_T, INVALID_CODE);
+    EXPECT_FALSE(dtbabilitymgrService_->IsTokenRegistered(TEST_UINT32_T, token));
+    EXPECT_TRUE(dtbabilitymgrService_->IsTokenRegistered(TEST_UINT32_T, INVALID_CODE));
+    EXPECT_FALSE(dtbabilitymgrService_->IsTokenRegistered(TEST_UINT32_T + 1, INVALID_CODE));
+    dtbabilitymgrService_->registry_.Clear();
     DTEST_LOG << "DistributedAbilityManagerServiceTest IsTokenRegistered_001 end" << std::endl;
 }
 
@@ -660,23 +625,21 @@ HWTEST_F(DistributedAbilityManagerServiceTest, IsExceededRegisterMaxNum_001, Tes
 {
     DTEST_LOG << "DistributedAbilityManagerServiceTest IsExceededRegisterMaxNum_001 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    {
-        std::lock_guard<std::mutex> tokenMapLock(dtbabilitymgrService_->tokenMapMutex_);
-        dtbabilitymgrService_->tokenMap_.clear();
-        std::vector<int32_t> vec;
-        for (int32_t i = 0; i < MAX_REGISTER_NUM; ++i) {
-            vec.push_back(INVALID_CODE);
-        }
-        dtbabilitymgrService_->tokenMap_[TEST_UINT32_T] = vec;
+    dtbabilitymgrService_->registry_.Clear();
+    for (int32_t i = 1; i < MAX_REGISTER_NUM; ++i) {
+        dtbabilitymgrService_->registry_.AddToken(TEST_UINT32_T, i);
     }
+    EXPECT_FALSE(dtbabilitymgrService_->IsExceededRegisterMaxNum(TEST_UINT32_T));
+    dtbabilitymgrService_->registry_.AddToken(TEST_UINT32_T, MAX_REGISTER_NUM);
     bool ret = dtbabilitymgrService_->IsExceededRegisterMaxNum(TEST_UINT32_T);
     EXPECT_EQ(ret, true);
+    dtbabilitymgrService_->registry_.Clear();
     DTEST_LOG << "DistributedAbilityManagerServiceTest IsExceededRegisterMaxNum_001 end" << std::endl;
 }
 
 /**
  * @tc.name: IsNotifierRegistered_001
- * @tc.desc: test IsNotifierRegistered when callbackMap_[token] = nullptr.
+ * @tc.desc: test IsNotifierRegistered when no notifier of the token is registered.
  * @tc.type: FUNC
  * @tc.require: I5NOA1
  */
@@ -684,10 +647,7 @@ HWTEST_F(DistributedAbilityManagerServiceTest, IsNotifierRegistered_001, TestSiz
 {
     DTEST_LOG << "DistributedAbilityManagerServiceTest IsNotifierRegistered_001 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_[INVALID_CODE] = nullptr;
-    }
+    dtbabilitymgrService_->registry_.Clear();
     bool ret = dtbabilitymgrService_->IsNotifierRegistered(INVALID_CODE);
     EXPECT_EQ(ret, false);
     DTEST_LOG << "DistributedAbilityManagerServiceTest IsNotifierRegistered_001 end" << std::endl;
@@ -779,31 +739,22 @@ HWTEST_F(DistributedAbilityManagerServiceTest, HandleDeviceConnect_001, TestSize
 }
 
 /**
- * @tc.name: QueryTokenByNotifier_001
- * @tc.desc: test QueryTokenByNotifier when iter->second == nullptr.
+ * @tc.name: RemoveTokensByNotifiers_001
+ * @tc.desc: test RemoveTokensByNotifiers when the notifier is registered or not.
  * @tc.type: FUNC
  * @tc.require: I5NOA1
  */
-HWTEST_F(DistributedAbilityManagerServiceTest, QueryTokenByNotifier_001, TestSize.Level3)
+HWTEST_F(DistributedAbilityManagerServiceTest, RemoveTokensByNotifiers_001, TestSize.Level3)
 {
-    DTEST_LOG << "DistributedAbilityManagerServiceTest QueryTokenByNotifier_001 start" << std::endl;
+    DTEST_LOG << "DistributedAbilityManagerServiceTest RemoveTokensByNotifiers_001 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
     /**
-     * @tc.steps: step1. test QueryTokenByNotifier when iter->second == nullptr.
+     * @tc.steps: step1. test RemoveTokensByNotifiers when the notifier is not registered.
      */
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-        dtbabilitymgrService_->callbackMap_[INVALID_CODE] = nullptr;
-    }
+    dtbabilitymgrService_->registry_.Clear();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    int32_t token;
-    bool ret = dtbabilitymgrService_->QueryTokenByNotifier(notifier, token);
-    EXPECT_FALSE(ret);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
+    std::vector<int32_t> tokens = dtbabilitymgrService_->registry_.RemoveTokensByNotifiers({ notifier, nullptr });
+    EXPECT_TRUE(tokens.empty());
     /**
      * @tc.steps: step2. test ProcessNotifierDied when notifier != nullptr.
      */
@@ -814,17 +765,16 @@ HWTEST_F(DistributedAbilityManagerServiceTest, QueryTokenByNotifier_001, TestSiz
     dtbabilitymgrService_->continuationHandler_ = nullptr;
     dtbabilitymgrService_->HandleNotifierDied(nullptr);
     /**
-     * @tc.steps: step4. test HandleNotifierDied when QueryTokenByNotifier returns true.
+     * @tc.steps: step4. test RemoveTokensByNotifiers when the notifier is registered.
      */
     dtbabilitymgrService_->continuationHandler_ = std::make_shared<ffrt::queue>("ContinuationMgr");
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-    notifierInfo->SetNotifier(EVENT_CONNECT, notifier);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_[INVALID_CODE] = std::move(notifierInfo);;
-    }
-    dtbabilitymgrService_->HandleNotifierDied(notifier);
-    DTEST_LOG << "DistributedAbilityManagerServiceTest QueryTokenByNotifier_001 end" << std::endl;
+    dtbabilitymgrService_->registry_.AddToken(TEST_UINT32_T, INVALID_CODE);
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(INVALID_CODE, EVENT_CONNECT, notifier));
+    tokens = dtbabilitymgrService_->registry_.RemoveTokensByNotifiers({ notifier });
+    ASSERT_EQ(tokens.size(), 1u);
+    EXPECT_EQ(tokens[0], INVALID_CODE);
+    EXPECT_FALSE(dtbabilitymgrService_->IsTokenRegistered(TEST_UINT32_T, INVALID_CODE));
+    DTEST_LOG << "DistributedAbilityManagerServiceTest RemoveTokensByNotifiers_001 end" << std::endl;
 }
 
 /**
@@ -849,13 +799,7 @@ HWTEST_F(DistributedAbilityManagerServiceTest, HandleNotifierDied_001, TestSize.
     int32_t res = dtbabilitymgrService_->Register(continuationExtraParams, token);
     EXPECT_EQ(res, ERR_OK);
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-    notifierInfo->SetNotifier(EVENT_CONNECT, notifier);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-        dtbabilitymgrService_->callbackMap_[token] = std::move(notifierInfo);;
-    }
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(token, EVENT_CONNECT, notifier));
     dtbabilitymgrService_->HandleNotifierDied(notifier);
     DTEST_LOG << "DistributedAbilityManagerServiceTest HandleNotifierDied_001 end" << std::endl;
 }
@@ -893,36 +837,28 @@ HWTEST_F(DistributedAbilityManagerServiceTest, HandleUpdateConnectStatus_001, Te
 }
 
 /**
- * @tc.name: DumpNotifierLocked_002
- * @tc.desc: test DumpNotifierLocked
+ * @tc.name: DumpAppRegisterInfo_002
+ * @tc.desc: test DumpAppRegisterInfo
  * @tc.type: FUNC
  * @tc.require: I76U22
  */
-HWTEST_F(DistributedAbilityManagerServiceTest, DumpNotifierLocked_002, TestSize.Level3)
+HWTEST_F(DistributedAbilityManagerServiceTest, DumpAppRegisterInfo_002, TestSize.Level3)
 {
-    DTEST_LOG << "DistributedAbilityManagerServiceTest DumpNotifierLocked_002 start" << std::endl;
+    DTEST_LOG << "DistributedAbilityManagerServiceTest DumpAppRegisterInfo_002 start" << std::endl;
     ASSERT_NE(nullptr, dtbabilitymgrService_);
     /**
-     * @tc.steps: step1. test DumpNotifierLocked when callbackMap_ is not empty.
+     * @tc.steps: step1. test DumpAppRegisterInfo when both callback types are registered.
      */
-    std::vector<int32_t> tokenVec;
     std::string info;
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    notifierInfo->SetNotifier(EVENT_CONNECT, notifier);
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-        dtbabilitymgrService_->callbackMap_[INVALID_CODE] = std::move(notifierInfo);;
-    }
-    tokenVec.push_back(INVALID_CODE);
-    dtbabilitymgrService_->DumpNotifierLocked(tokenVec, info);
-    EXPECT_NE(dtbabilitymgrService_, nullptr);
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
-    DTEST_LOG << "DistributedAbilityManagerServiceTest DumpNotifierLocked_002 end" << std::endl;
+    dtbabilitymgrService_->registry_.Clear();
+    dtbabilitymgrService_->registry_.AddToken(TEST_UINT32_T, INVALID_CODE);
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(INVALID_CODE, EVENT_CONNECT, notifier));
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(INVALID_CODE, EVENT_DISCONNECT, notifier));
+    dtbabilitymgrService_->DumpAppRegisterInfo(info);
+    EXPECT_NE(info.find(std::string("cbType:  ") + EVENT_CONNECT + " " + EVENT_DISCONNECT), std::string::npos);
+    dtbabilitymgrService_->registry_.Clear();
+    DTEST_LOG << "DistributedAbilityManagerServiceTest DumpAppRegisterInfo_002 end" << std::endl;
 }
 
 /**
@@ -942,10 +878,7 @@ HWTEST_F(DistributedAbilityManagerServiceTest, Register_002, TestSize.Level3)
     continuationExtraParams->SetContinuationMode(continuationMode);
     int32_t ret = dtbabilitymgrService_->Register(continuationExtraParams, token);
     EXPECT_EQ(ret, INVALID_CONTINUATION_MODE);
-    {
-        std::lock_guard<std::mutex> tokenLock(dtbabilitymgrService_->tokenMutex_);
-        dtbabilitymgrService_->tokenMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     DTEST_LOG << "DistributedAbilityManagerServiceTest Register_002 end" << std::endl;
 }
 
@@ -1047,22 +980,11 @@ HWTEST_F(DistributedAbilityManagerServiceTest, StartDeviceManager_003, TestSize.
     int32_t res = dtbabilitymgrService_->Register(continuationExtraParams, token);
     EXPECT_EQ(res, ERR_OK);
 
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-        dtbabilitymgrService_->callbackMap_[token] = std::move(notifierInfo);
-    }
+    sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(token, EVENT_CONNECT, notifier));
     int32_t ret = dtbabilitymgrService_->StartDeviceManager(token, continuationExtraParams);
     EXPECT_EQ(ret, ERR_OK);
-    {
-        std::lock_guard<std::mutex> tokenLock(dtbabilitymgrService_->tokenMutex_);
-        dtbabilitymgrService_->tokenMap_.clear();
-    }
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     DTEST_LOG << "DistributedAbilityManagerServiceTest StartDeviceManager_003 end" << std::endl;
 }
 
@@ -1119,19 +1041,11 @@ HWTEST_F(DistributedAbilityManagerServiceTest, OnDeviceConnect_002, TestSize.Lev
     }
     int32_t token = 0;
     std::vector<ContinuationResult> continuationResults;
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    notifierInfo->SetNotifier(EVENT_CONNECT, notifier);
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-        dtbabilitymgrService_->callbackMap_[token] = std::move(notifierInfo);
-    }
+    dtbabilitymgrService_->registry_.Clear();
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(token, EVENT_CONNECT, notifier));
     int32_t ret = dtbabilitymgrService_->OnDeviceConnect(token, continuationResults);
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     EXPECT_EQ(ret, ERR_OK);
     DTEST_LOG << "DistributedAbilityManagerServiceTest OnDeviceConnect_002 end" << std::endl;
 }
@@ -1170,17 +1084,10 @@ HWTEST_F(DistributedAbilityManagerServiceTest, HandleStartDeviceManager_002, Tes
     }
     int32_t token = 0;
     std::shared_ptr<ContinuationExtraParams> continuationExtraParams = std::make_shared<ContinuationExtraParams>();
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-        dtbabilitymgrService_->callbackMap_[token] = std::move(notifierInfo);
-    }
+    sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(token, EVENT_CONNECT, notifier));
     dtbabilitymgrService_->HandleStartDeviceManager(token, continuationExtraParams);
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     EXPECT_NE(dtbabilitymgrService_, nullptr);
     DTEST_LOG << "DistributedAbilityManagerServiceTest HandleStartDeviceManager_002 end" << std::endl;
 }
@@ -1197,18 +1104,10 @@ HWTEST_F(DistributedAbilityManagerServiceTest, HandleNotifierDied_002, TestSize.
     ASSERT_NE(nullptr, dtbabilitymgrService_);
     int32_t token = 0;
     sptr<DeviceSelectionNotifierTest> notifier(new DeviceSelectionNotifierTest());
-    std::unique_ptr<NotifierInfo> notifierInfo = std::make_unique<NotifierInfo>();
-    notifierInfo->SetNotifier(EVENT_CONNECT, notifier);
-    {
-        std::lock_guard<std::mutex> callbackMapLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-        dtbabilitymgrService_->callbackMap_[token] = std::move(notifierInfo);;
-    }
+    dtbabilitymgrService_->registry_.Clear();
+    EXPECT_TRUE(dtbabilitymgrService_->registry_.SetNotifier(token, EVENT_CONNECT, notifier));
     dtbabilitymgrService_->HandleNotifierDied(dtbabilitymgrService_);
-    {
-        std::lock_guard<std::mutex> autoLock(dtbabilitymgrService_->callbackMapMutex_);
-        dtbabilitymgrService_->callbackMap_.clear();
-    }
+    dtbabilitymgrService_->registry_.Clear();
     EXPECT_NE(dtbabilitymgrService_, nullptr);
     DTEST_LOG << "DistributedAbilityManagerServiceTest HandleNotifierDied_002 end" << std::endl;
 }
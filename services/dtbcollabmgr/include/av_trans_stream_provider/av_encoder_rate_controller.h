@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AV_TRANS_STREAM_AV_ENCODER_RATE_CONTROLLER_H
+#define OHOS_AV_TRANS_STREAM_AV_ENCODER_RATE_CONTROLLER_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedCollab {
+struct RateControlConfig {
+    int64_t maxBitrate = 0;
+    int64_t minBitrate = 0;
+    // added per uncongested window once the frame rate is back at its maximum
+    int64_t bitrateStep = 0;
+    double maxFrameRate = 0.0;
+    double minFrameRate = 0.0;
+    double frameRateStep = 0.0;
+    double decreaseFactor = 0.7;
+    // a sample is congested when any of these is reached
+    uint32_t queueHighWater = 3;
+    int64_t sendLatencyHighUs = 40000;
+    uint32_t frameGapHighWater = 1;
+    // consecutive clean samples before one additive step
+    uint32_t cleanSamplesToIncrease = 10;
+    // feedback lags the encoder, do not cut again until this long after a cut
+    int64_t holdAfterDecreaseMs = 500;
+
+    static RateControlConfig CreateDefault(int64_t bitrate, double frameRate);
+};
+
+struct RateFeedback {
+    int64_t timeMs = 0;
+    uint32_t queueDepth = 0;
+    int64_t sendLatencyUs = 0;
+    uint32_t frameGaps = 0;
+};
+
+struct RateDecision {
+    int64_t bitrate = 0;
+    double frameRate = 0.0;
+};
+
+/*
+ * AIMD control of encoder bitrate and frame rate from sender feedback. A
+ * congested sample cuts the bitrate multiplicatively, and the frame rate too
+ * once the bitrate sits at its floor. A run of clean samples raises the frame
+ * rate first and then the bitrate additively. Not thread safe, it is driven
+ * by the single sender thread.
+ */
+class AVEncoderRateController {
+public:
+    explicit AVEncoderRateController(const RateControlConfig& config);
+    ~AVEncoderRateController() = default;
+
+    // returns true when the decision changed and should be pushed to the encoder
+    bool OnFeedback(const RateFeedback& feedback, RateDecision& decision);
+    RateDecision GetCurrent() const;
+    void Reset();
+
+private:
+    bool IsCongested(const RateFeedback& feedback) const;
+    bool Decrease(int64_t timeMs);
+    bool Increase();
+
+    RateControlConfig config_;
+    RateDecision current_;
+    uint32_t cleanSamples_ = 0;
+    int64_t lastDecreaseMs_ = -1;
+};
+} // namespace DistributedCollab
+} // namespace OHOS
+#endif
@@ -73,6 +73,7 @@ namespace DistributedCollab {
         void ChangeState(const EngineState state);
         int32_t InitVideoHeaderFilter();
         bool isVideoParam(const StreamParam& recParam);
+        void ConfigureRateControl();
 
     private:
         std::shared_ptr<Media::Pipeline::Pipeline> pipeline_ = nullptr;
@@ -15,6 +15,7 @@
 #ifndef OHOS_AV_TRANS_STREAM_AV_SENDER_FILTER_H
 #define OHOS_AV_TRANS_STREAM_AV_SENDER_FILTER_H
 
+#include "av_encoder_rate_controller.h"
 #include "buffer/avbuffer_queue.h"
 #include "buffer/avbuffer_queue_define.h"
 #include "channel_common_definition.h"
@@ -28,6 +29,7 @@
 #include <queue>
 #include "event_handler.h"
 #include <atomic>
+#include <functional>
 #ifdef DSCH_COLLAB_AV_TRANS_TEST_DEMO
 #include "ichannel_listener.h"
 #endif
@@ -64,6 +66,9 @@ public:
     void SetTransChannel(int32_t channelId, const ChannelDataType type);
     int32_t SendPixelMap(const std::shared_ptr<Media::PixelMap>& pixelMap);
     int32_t SetSurfaceParam(const SurfaceParam& param);
+    using RateChangeCallback = std::function<void(const RateDecision& decision)>;
+    void SetRateControl(const RateControlConfig& config, const RateChangeCallback& callback);
+    void OnReceiverFrameGap(uint32_t frameGaps);
 #ifdef DSCH_COLLAB_AV_TRANS_TEST_DEMO
     void SetChannelListener(const std::shared_ptr<IChannelListener>& listener);
     void WriteFile(const std::shared_ptr<AVTransDataBuffer>& data);
@@ -91,6 +96,8 @@ private:
         const std::shared_ptr<AVTransDataBuffer>& dataBuffer);
     std::shared_ptr<AVTransStreamData> PackStreamDataForSurfaceParam(const SurfaceParam& param);
     void Process();
+    void UpdateRateControl(uint32_t queueDepth, int64_t sendLatencyUs);
+    std::function<void(int32_t ret, int64_t sendLatencyUs)> CreateSendCompleteCallback();
     int32_t WriteDataToBuffer(std::shared_ptr<AVTransDataBuffer>& buffer,
         cJSON* headerJson, char* headerStr, const std::shared_ptr<AVTransStreamData>& streamData);
 
@@ -129,6 +136,13 @@ private:
     std::condition_variable cv_;
     std::atomic<bool> isRunning_ = false;
     std::thread processingThread_;
+
+    std::mutex rateMutex_;
+    std::unique_ptr<AVEncoderRateController> rateController_ = nullptr;
+    RateChangeCallback rateChangeCallback_ = nullptr;
+    std::atomic<uint32_t> frameGaps_ = 0;
+    // post to socket time of the last frame the channel manager finished sending
+    std::atomic<int64_t> lastSendLatencyUs_ = 0;
 };
 
 } // namespace DistributedCollab
@@ -15,22 +15,33 @@
 #ifndef OHOS_AV_TRANS_STREAM_AV_SURFACE_BUFFER_CACHE_H
 #define OHOS_AV_TRANS_STREAM_AV_SURFACE_BUFFER_CACHE_H
 
-#include "av_trans_data_buffer.h"
 #include "ibuffer_consumer_listener.h"
 #include "iconsumer_surface.h"
 #include "surface_type.h"
 #include "surface_utils.h"
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <thread>
 
+#ifndef SURFACE_BUFFER_CACHE_PREBUFFER_DEPTH
+#define SURFACE_BUFFER_CACHE_PREBUFFER_DEPTH 3
+#endif
+
 namespace OHOS {
 namespace DistributedCollab {
+/*
+ * Sits between the decoder and the app surface. Decoded buffers stay acquired
+ * on the inner surface until they are copied into the output surface, so each
+ * frame is copied once. The first prebufferDepth frames are held back to absorb
+ * jitter, a depth of 0 forwards every frame as soon as it is decoded.
+ */
 class AVSurfaceBufferCache : public std::enable_shared_from_this<AVSurfaceBufferCache> {
 public:
-    AVSurfaceBufferCache(const sptr<Surface>& surface)
-        : outputSurface_(surface) {};
+    explicit AVSurfaceBufferCache(const sptr<Surface>& surface,
+        uint32_t prebufferDepth = SURFACE_BUFFER_CACHE_PREBUFFER_DEPTH)
+        : prebufferDepth_(prebufferDepth), outputSurface_(surface) {};
     ~AVSurfaceBufferCache();
     void Init();
     void Start();
@@ -39,7 +50,7 @@ public:
 
 private:
     struct Cache {
-        std::unique_ptr<AVTransDataBuffer> data_ = nullptr;
+        sptr<SurfaceBuffer> buffer_ = nullptr;
         BufferRequestConfig config_;
         uint32_t index_ = 0;
     };
@@ -57,28 +68,25 @@ private:
     };
 
 private:
-    void AddCache(std::unique_ptr<AVTransDataBuffer>& data, BufferRequestConfig& config);
+    int32_t AddCache(const sptr<SurfaceBuffer>& buffer, BufferRequestConfig& config);
     int32_t AddSurfaceBuffer(const sptr<SurfaceBuffer>& buffer);
     void Process();
     void WriteDataToSurface(const std::unique_ptr<Cache>& cacheData);
+    void ReleaseCache(const std::unique_ptr<Cache>& cacheData);
+    void ClearCache();
 
 private:
-    struct CacheCompare {
-        bool operator()(const std::unique_ptr<Cache>& lhs, const std::unique_ptr<Cache>& rhs) const
-        {
-            return lhs->index_ > rhs->index_;
-        }
-    };
-
     std::mutex queueMutex_;
-    std::priority_queue<std::unique_ptr<Cache>,
-        std::vector<std::unique_ptr<Cache>>, CacheCompare>
-        cacheQueue_;
+    // indexes are assigned under queueMutex_, so arrival order is frame order
+    std::queue<std::unique_ptr<Cache>> cacheQueue_;
 
     std::condition_variable cv_;
     std::atomic<bool> isRunning_ = false;
     std::thread processingThread_;
     uint32_t lastIndex_ = 0;
+    uint32_t prebufferDepth_ = SURFACE_BUFFER_CACHE_PREBUFFER_DEPTH;
+    std::atomic<uint64_t> copiedBytes_ = 0;
+    std::atomic<uint32_t> flushedFrames_ = 0;
 
     sptr<Surface> outputSurface_ { nullptr };
     sptr<Surface> innerSurface_ = { nullptr };
@@ -19,6 +19,7 @@
 #include "channel_common_definition.h"
 #include "data_sender_receiver.h"
 #include "event_handler.h"
+#include "file_transfer_scheduler.h"
 #include "single_instance.h"
 #include "socket.h"
 #include <map>
@@ -30,6 +31,7 @@
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <functional>
 
 namespace OHOS {
 namespace DistributedCollab {
@@ -51,11 +53,20 @@ public:
         const std::shared_ptr<IChannelListener> listener);
     int32_t ConnectChannel(const int32_t channelId);
 
-    int32_t SendBytes(const int32_t channelId, const std::shared_ptr<AVTransDataBuffer>& data);
-    int32_t SendStream(const int32_t channelId, const std::shared_ptr<AVTransStreamData>& data);
+    // called on the send thread once the data is handed to the socket, the latency includes the queueing
+    using SendCompleteCallback = std::function<void(int32_t ret, int64_t sendLatencyUs)>;
+    int32_t SendBytes(const int32_t channelId, const std::shared_ptr<AVTransDataBuffer>& data,
+        const SendCompleteCallback& onComplete = nullptr);
+    int32_t SendStream(const int32_t channelId, const std::shared_ptr<AVTransStreamData>& data,
+        const SendCompleteCallback& onComplete = nullptr);
+    // bytes and stream sends posted for the channel that have not been handed to the socket yet
+    uint32_t GetPendingSendCount(const int32_t channelId);
     int32_t SendMessage(const int32_t channelId, const std::shared_ptr<AVTransDataBuffer>& data);
     int32_t SendFile(const int32_t channelId, const std::vector<std::string>& sFiles,
         const std::vector<std::string>& dFiles);
+    // stripes one transfer over the sockets of several file channels, progress goes to the first one
+    int32_t SendFile(const std::vector<int32_t>& channelIds, const std::vector<std::string>& sFiles,
+        const std::vector<std::string>& dFiles);
 
     void OnSocketError(int32_t socketId, const int32_t errorCode);
     void OnSocketConnected(int32_t socketId, const PeerSocketInfo& info);
@@ -114,6 +125,14 @@ private:
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> eventHandler_;
     std::condition_variable eventCon_;
 
+    std::mutex fileTransferMutex_;
+    // socketId->transfer in flight on it
+    std::map<int32_t, std::shared_ptr<FileTransferScheduler>> fileTransfers_;
+
+    std::mutex pendingSendMutex_;
+    // channelId->posted sends not done yet
+    std::map<int32_t, uint32_t> pendingSends_;
+
     std::mutex callbackEventMutex_;
     std::thread callbackEventThread_;
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> callbackEventHandler_;
@@ -167,11 +186,19 @@ private:
     void NotifyListeners(const int32_t channelId, Func listenerFunc,
         const AppExecFwk::EventQueue::Priority priority, Args&& ...args);
     int32_t GetValidSocket(const int32_t channelId);
+    void AddPendingSend(const int32_t channelId);
+    void RemovePendingSend(const int32_t channelId);
+    static int64_t GetSteadyTimeUs();
     int32_t DoSendBytes(const int32_t channelId, const std::shared_ptr<AVTransDataBuffer>& data);
     int32_t DoSendMessage(const int32_t channelId, const std::shared_ptr<AVTransDataBuffer>& data);
     int32_t DoSendStream(const int32_t channelId, const std::shared_ptr<AVTransStreamData>& data);
-    int32_t DoSendFile(const int32_t channelId, const std::vector<std::string>& sFiles,
+    int32_t DoSendFile(const std::vector<int32_t>& channelIds, const std::vector<std::string>& sFiles,
+        const std::vector<std::string>& dFiles);
+    int32_t DoSendFileOnSocket(const int32_t socketId, const std::vector<std::string>& sFiles,
         const std::vector<std::string>& dFiles);
+    std::vector<int32_t> GetValidFileSockets(const std::vector<int32_t>& channelIds);
+    std::shared_ptr<FileTransferScheduler> GetFileTransfer(const int32_t socketId);
+    void ClearFileTransfer(const std::shared_ptr<FileTransferScheduler>& transfer);
     std::shared_ptr<AVTransDataBuffer> ProcessRecvData(const int32_t channelId,
         const int32_t socketId, const void* data, const uint32_t dataLen);
     void DoConnectCallback(const int32_t channelId);
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DSCHED_COLLAB_FILE_TRANSFER_SCHEDULER_H
+#define OHOS_DSCHED_COLLAB_FILE_TRANSFER_SCHEDULER_H
+
+#include "channel_common_definition.h"
+#include "socket.h"
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedCollab {
+struct FileTransferConfig {
+    // one softbus SendFile call never carries more than this
+    uint32_t maxFilesPerWindow = 500;
+    uint64_t maxBytesPerWindow = 64 * 1024 * 1024;
+    // resends of one window after a send error before the whole transfer fails
+    uint32_t maxRetry = 3;
+};
+
+/*
+ * Schedules one SendFile request. The file list is cut into windows that are
+ * striped over the given file sockets, one window in flight per socket. The
+ * bytes acknowledged by send progress events are tracked per file, so a window
+ * interrupted by an error or a closed socket is resent without the files that
+ * already went through. Progress of all sockets is reported as one transfer.
+ */
+class FileTransferScheduler {
+public:
+    using SendFunc = std::function<int32_t(const int32_t socketId, const std::vector<std::string>& sFiles,
+        const std::vector<std::string>& dFiles)>;
+    using ReportFunc = std::function<void(const FileInfo& info)>;
+
+    FileTransferScheduler(const std::vector<int32_t>& socketIds, const SendFunc& sendFunc,
+        const ReportFunc& reportFunc, const FileTransferConfig& config = FileTransferConfig());
+    ~FileTransferScheduler() = default;
+
+    int32_t Start(const std::vector<std::string>& sFiles, const std::vector<std::string>& dFiles);
+    void OnFileEvent(const int32_t socketId, const FileEvent* event);
+    void OnSocketClosed(const int32_t socketId);
+    bool IsFinished();
+    std::vector<int32_t> GetSocketIds();
+
+private:
+    struct FileItem {
+        std::string srcFile;
+        std::string dstFile;
+        uint64_t size = 0;
+        uint64_t ackedBytes = 0;
+        bool isDone = false;
+    };
+
+    struct Window {
+        std::vector<size_t> files;
+        uint32_t retry = 0;
+    };
+
+    struct Lane {
+        bool isBusy = false;
+        bool isClosed = false;
+        Window window;
+        uint32_t rate = 0;
+    };
+
+    struct SendTask {
+        int32_t socketId = 0;
+        std::vector<std::string> sFiles;
+        std::vector<std::string> dFiles;
+    };
+
+    void BuildWindowsLocked();
+    std::vector<SendTask> DispatchLocked();
+    void Dispatch();
+    void AckProgressLocked(Lane& lane, uint64_t bytesProcessed);
+    void FinishWindowLocked(Lane& lane);
+    bool RequeueWindowLocked(Lane& lane, int32_t errorCode);
+    bool HasOpenLaneLocked();
+    void CheckFinishLocked();
+    FileInfo BuildInfoLocked(ChannelFileEvent eventType);
+    void Report(const FileInfo& info);
+
+    std::mutex mutex_;
+    FileTransferConfig config_;
+    SendFunc sendFunc_;
+    ReportFunc reportFunc_;
+    std::vector<FileItem> files_;
+    std::deque<Window> pending_;
+    std::map<int32_t, Lane> lanes_;
+    uint64_t bytesTotal_ = 0;
+    bool isFinished_ = false;
+    int32_t errorCode_ = 0;
+    std::vector<FileInfo> reports_;
+};
+} // namespace DistributedCollab
+} // namespace OHOS
+#endif
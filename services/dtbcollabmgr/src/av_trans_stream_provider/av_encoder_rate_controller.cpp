@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "av_encoder_rate_controller.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace DistributedCollab {
+namespace {
+    static constexpr int64_t MIN_BITRATE_DIVISOR = 4;
+    static constexpr int64_t BITRATE_STEP_DIVISOR = 20;
+    static constexpr double MIN_FRAME_RATE_DIVISOR = 2.0;
+    static constexpr double FRAME_RATE_STEP = 5.0;
+}
+
+RateControlConfig RateControlConfig::CreateDefault(int64_t bitrate, double frameRate)
+{
+    RateControlConfig config;
+    config.maxBitrate = bitrate;
+    config.minBitrate = bitrate / MIN_BITRATE_DIVISOR;
+    config.bitrateStep = std::max<int64_t>(bitrate / BITRATE_STEP_DIVISOR, 1);
+    config.maxFrameRate = frameRate;
+    config.minFrameRate = frameRate / MIN_FRAME_RATE_DIVISOR;
+    config.frameRateStep = FRAME_RATE_STEP;
+    return config;
+}
+
+AVEncoderRateController::AVEncoderRateController(const RateControlConfig& config)
+    : config_(config)
+{
+    config_.minBitrate = std::min(config_.minBitrate, config_.maxBitrate);
+    config_.minFrameRate = std::min(config_.minFrameRate, config_.maxFrameRate);
+    Reset();
+}
+
+void AVEncoderRateController::Reset()
+{
+    current_.bitrate = config_.maxBitrate;
+    current_.frameRate = config_.maxFrameRate;
+    cleanSamples_ = 0;
+    lastDecreaseMs_ = -1;
+}
+
+RateDecision AVEncoderRateController::GetCurrent() const
+{
+    return current_;
+}
+
+bool AVEncoderRateController::OnFeedback(const RateFeedback& feedback, RateDecision& decision)
+{
+    bool changed = false;
+    if (IsCongested(feedback)) {
+        cleanSamples_ = 0;
+        changed = Decrease(feedback.timeMs);
+    } else if (++cleanSamples_ >= config_.cleanSamplesToIncrease) {
+        cleanSamples_ = 0;
+        changed = Increase();
+    }
+    decision = current_;
+    return changed;
+}
+
+bool AVEncoderRateController::IsCongested(const RateFeedback& feedback) const
+{
+    return feedback.queueDepth >= config_.queueHighWater ||
+        feedback.sendLatencyUs >= config_.sendLatencyHighUs ||
+        (config_.frameGapHighWater > 0 && feedback.frameGaps >= config_.frameGapHighWater);
+}
+
+bool AVEncoderRateController::Decrease(int64_t timeMs)
+{
+    if (lastDecreaseMs_ >= 0 && timeMs - lastDecreaseMs_ < config_.holdAfterDecreaseMs) {
+        return false;
+    }
+    RateDecision before = current_;
+    if (current_.bitrate > config_.minBitrate) {
+        int64_t bitrate = static_cast<int64_t>(static_cast<double>(current_.bitrate) * config_.decreaseFactor);
+        current_.bitrate = std::max(bitrate, config_.minBitrate);
+    } else {
+        current_.frameRate = std::max(current_.frameRate * config_.decreaseFactor, config_.minFrameRate);
+    }
+    lastDecreaseMs_ = timeMs;
+    return current_.bitrate != before.bitrate || current_.frameRate != before.frameRate;
+}
+
+bool AVEncoderRateController::Increase()
+{
+    // smoothness first, a stuttering stream looks worse than a soft one
+    if (current_.frameRate < config_.maxFrameRate) {
+        current_.frameRate = std::min(current_.frameRate + config_.frameRateStep, config_.maxFrameRate);
+        return true;
+    }
+    if (current_.bitrate < config_.maxBitrate) {
+        current_.bitrate = std::min(current_.bitrate + config_.bitrateStep, config_.maxBitrate);
+        return true;
+    }
+    return false;
+}
+} // namespace DistributedCollab
+} // namespace OHOS
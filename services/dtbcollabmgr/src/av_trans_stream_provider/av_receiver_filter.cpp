@@ -17,6 +17,7 @@
 #include "av_sender_filter.h"
 #include "av_trans_data_buffer.h"
 #include "channel_manager.h"
+#include "dms_log_limiter.h"
 #include "dtbcollabmgr_log.h"
 #include "filter/filter_factory.h"
 #include "image_source.h"
@@ -243,7 +244,7 @@ void AVReceiverFilter::OnUnlinkedResult(std::shared_ptr<Meta>& meta)
 
 void AVReceiverFilter::OnBufferAvailable()
 {
-    HILOGI("OnBufferAvailable");
+    HILOGI_LIMITED("OnBufferAvailable");
     availableBuffers_++;
     cv_.notify_one();
 }
@@ -335,7 +336,7 @@ void AVReceiverFilter::Process()
 
 void AVReceiverFilter::DispatchProcessData(const std::shared_ptr<AVTransStreamData>& data)
 {
-    HILOGD("AVReceiverFilter::DispatchProcessData enter");
+    HILOGD_LIMITED("AVReceiverFilter::DispatchProcessData enter");
     if (eventHandler_ == nullptr) {
         HILOGE("event handler null");
         return;
@@ -351,7 +352,7 @@ void AVReceiverFilter::DispatchProcessData(const std::shared_ptr<AVTransStreamDa
         }
         default: {
             int32_t ret = RequestAndPushData(data);
-            HILOGD("process data ret = %{public}d", ret);
+            HILOGD_LIMITED("process data ret = %{public}d", ret);
             break;
         }
     }
@@ -420,7 +421,7 @@ int32_t AVReceiverFilter::RequestAndPushData(const std::shared_ptr<AVTransStream
     std::shared_ptr<AVBuffer> outputBuffer = nullptr;
     Media::AVBufferConfig avBufferConfig;
     avBufferConfig.size = static_cast<int32_t>(data->StreamData()->Size());
-    HILOGD("recv raw stream data size = %{public}d", avBufferConfig.size);
+    HILOGD_LIMITED("recv raw stream data size = %{public}d", avBufferConfig.size);
     avBufferConfig.memoryType = Media::MemoryType::HARDWARE_MEMORY;
     avBufferConfig.memoryFlag = Media::MemoryFlag::MEMORY_READ_WRITE;
     Status ret = bufferQProxy_->RequestBuffer(outputBuffer, avBufferConfig);
@@ -430,7 +431,7 @@ int32_t AVReceiverFilter::RequestAndPushData(const std::shared_ptr<AVTransStream
         return static_cast<int32_t>(ret);
     }
 
-    HILOGD("write data to buffer, id=%{public}llu, size=%{public}d",
+    HILOGD_LIMITED("write data to buffer, id=%{public}llu, size=%{public}d",
         outputBuffer->GetUniqueId(), outputBuffer->GetConfig().size);
     auto& memory = outputBuffer->memory_;
     memory->SetSize(avBufferConfig.size);
@@ -463,7 +464,7 @@ void AVReceiverFilter::GetParameter(std::shared_ptr<Media::Meta>& parameter)
 
 void AVReceiverFilter::OnStream(const std::shared_ptr<AVTransStreamData>& stream)
 {
-    HILOGI("start to parse stream by Stream");
+    HILOGI_LIMITED("start to parse stream by Stream");
     if (isRunning_) {
         AddStreamData(stream);
     }
@@ -471,7 +472,7 @@ void AVReceiverFilter::OnStream(const std::shared_ptr<AVTransStreamData>& stream
 
 void AVReceiverFilter::OnBytes(const std::shared_ptr<AVTransDataBuffer>& buffer)
 {
-    HILOGI("start to parse stream by Bytes");
+    HILOGI_LIMITED("start to parse stream by Bytes");
     if (buffer == nullptr || buffer->Size() < sizeof(AVSenderFilter::version) +
         sizeof(AVSenderFilter::transType) + sizeof(uint32_t)) {
         HILOGE("Invalid buffer or buffer size is too small");
@@ -531,7 +532,7 @@ std::shared_ptr<AVTransStreamData> AVReceiverFilter::ReadStreamDataFromBuffer(ui
     }
     char* headerStr = cJSON_PrintUnformatted(headerJson);
     if (headerStr != nullptr) {
-        HILOGD("parse header = %{public}s", headerStr);
+        HILOGD_LIMITED("parse header = %{public}s", headerStr);
         cJSON_free(headerStr);
     } else {
         HILOGE("Failed to print headerJson");
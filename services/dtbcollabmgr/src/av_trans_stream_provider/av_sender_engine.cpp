@@ -239,6 +239,7 @@ Status AVSenderEngine::OnCallback(const std::shared_ptr<Filter>& filter, FilterC
                     return Status::ERROR_NULL_POINTER;
                 }
                 senderFilter_->Init(engineEventReceiver_, engineFilterCallback_);
+                ConfigureRateControl();
                 pipeline_->LinkFilters(filter, { senderFilter_ }, outType);
                 break;
             }
@@ -249,6 +250,34 @@ Status AVSenderEngine::OnCallback(const std::shared_ptr<Filter>& filter, FilterC
     return Status::OK;
 }
 
+void AVSenderEngine::ConfigureRateControl()
+{
+    int64_t bitrate = 0;
+    double frameRate = 0.0;
+    if (videoEncFormat_->Find(Media::Tag::MEDIA_BITRATE) != videoEncFormat_->end()) {
+        videoEncFormat_->Get<Media::Tag::MEDIA_BITRATE>(bitrate);
+    }
+    if (videoEncFormat_->Find(Media::Tag::VIDEO_FRAME_RATE) != videoEncFormat_->end()) {
+        videoEncFormat_->Get<Media::Tag::VIDEO_FRAME_RATE>(frameRate);
+    }
+    if (bitrate <= 0 || frameRate <= 0) {
+        HILOGW("bitrate or frame rate not configured, rate control disabled");
+        return;
+    }
+    std::weak_ptr<SurfaceEncoderFilter> weakEncoder = videoEncoderFilter_;
+    senderFilter_->SetRateControl(RateControlConfig::CreateDefault(bitrate, frameRate),
+        [weakEncoder](const RateDecision& decision) {
+            auto encoder = weakEncoder.lock();
+            if (encoder == nullptr) {
+                return;
+            }
+            std::shared_ptr<Media::Meta> parameter = std::make_shared<Media::Meta>();
+            parameter->Set<Media::Tag::MEDIA_BITRATE>(decision.bitrate);
+            parameter->Set<Media::Tag::VIDEO_FRAME_RATE>(decision.frameRate);
+            encoder->SetParameter(parameter);
+        });
+}
+
 int32_t AVSenderEngine::Prepare()
 {
     HILOGI("AVSenderEngine Prepare enter.");
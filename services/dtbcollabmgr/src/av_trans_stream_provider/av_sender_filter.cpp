@@ -16,6 +16,7 @@
 #include "av_trans_data_buffer.h"
 #include "av_trans_stream_data.h"
 #include "channel_manager.h"
+#include "dms_log_limiter.h"
 #include "dtbcollabmgr_log.h"
 #include "filter/filter_factory.h"
 #include "image_packer.h"
@@ -236,22 +237,82 @@ void AVSenderFilter::Process()
             return;
         }
         auto data = sendDatas_.front();
+        sendDatas_.pop();
+        lock.unlock();
         if (data == nullptr) {
             HILOGE("invalid data, empty");
-            sendDatas_.pop();
             continue;
         }
         SendStreamData(data);
-        sendDatas_.pop();
+        // the frames back up in the channel manager, and only it sees when one really left the socket
+        uint32_t queueDepth = ChannelManager::GetInstance().GetPendingSendCount(channelId_);
+        UpdateRateControl(queueDepth, lastSendLatencyUs_.load());
+    }
+}
+
+std::function<void(int32_t ret, int64_t sendLatencyUs)> AVSenderFilter::CreateSendCompleteCallback()
+{
+    std::weak_ptr<AVSenderFilter> weakFilter = weak_from_this();
+    return [weakFilter](int32_t ret, int64_t sendLatencyUs) {
+        auto filter = weakFilter.lock();
+        if (filter == nullptr || ret != ERR_OK) {
+            return;
+        }
+        filter->lastSendLatencyUs_.store(sendLatencyUs);
+    };
+}
+
+void AVSenderFilter::SetRateControl(const RateControlConfig& config, const RateChangeCallback& callback)
+{
+    HILOGI("set rate control, bitrate %{public}lld~%{public}lld, frame rate %{public}f~%{public}f",
+        static_cast<long long>(config.minBitrate), static_cast<long long>(config.maxBitrate),
+        config.minFrameRate, config.maxFrameRate);
+    std::lock_guard<std::mutex> lock(rateMutex_);
+    rateController_ = std::make_unique<AVEncoderRateController>(config);
+    rateChangeCallback_ = callback;
+    frameGaps_ = 0;
+    lastSendLatencyUs_ = 0;
+}
+
+void AVSenderFilter::OnReceiverFrameGap(uint32_t frameGaps)
+{
+    frameGaps_.fetch_add(frameGaps);
+}
+
+void AVSenderFilter::UpdateRateControl(uint32_t queueDepth, int64_t sendLatencyUs)
+{
+    RateDecision decision;
+    RateChangeCallback callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(rateMutex_);
+        if (rateController_ == nullptr) {
+            return;
+        }
+        RateFeedback feedback;
+        feedback.timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        feedback.queueDepth = queueDepth;
+        feedback.sendLatencyUs = sendLatencyUs;
+        feedback.frameGaps = frameGaps_.exchange(0);
+        if (!rateController_->OnFeedback(feedback, decision)) {
+            return;
+        }
+        callback = rateChangeCallback_;
+    }
+    HILOGI("rate changed, queue %{public}u, latency %{public}lld us, bitrate %{public}lld, frame rate %{public}f",
+        queueDepth, static_cast<long long>(sendLatencyUs), static_cast<long long>(decision.bitrate),
+        decision.frameRate);
+    if (callback != nullptr) {
+        callback(decision);
     }
 }
 
 void AVSenderFilter::OnBufferAvailable(const std::shared_ptr<AVBuffer>& buffer)
 {
-    HILOGD("AVSenderFilter OnBufferAvailable enter");
+    HILOGD_LIMITED("AVSenderFilter OnBufferAvailable enter");
     auto& memory = buffer->memory_;
     uint32_t size = static_cast<uint32_t>(memory->GetSize());
-    HILOGD("curIdx=%{public}d, curSize=%{public}u", lastIndex_.load(), size);
+    HILOGD_LIMITED("curIdx=%{public}d, curSize=%{public}u", lastIndex_.load(), size);
     std::shared_ptr<AVTransDataBuffer> transData = std::make_shared<AVTransDataBuffer>(size);
     int32_t ret = memcpy_s(transData->Data(), size, memory->GetAddr(),
         memory->GetSize());
@@ -288,7 +349,7 @@ std::shared_ptr<AVTransStreamData> AVSenderFilter::PackStreamDataForAVBuffer(con
     ext.index_ = static_cast<uint32_t>(lastIndex_.load());
     lastIndex_++;
     ext.pts_ = static_cast<uint64_t>(buffer->pts_);
-    HILOGD("send buffer pts: %{public}llu", ext.pts_);
+    HILOGD_LIMITED("send buffer pts: %{public}llu", ext.pts_);
 #ifdef DSCH_COLLAB_AV_TRANS_TEST_DEMO
     ext.pts_ = GetEncoderTimeStamp();
 #endif
@@ -312,19 +373,19 @@ int32_t AVSenderFilter::SendStreamData(const std::shared_ptr<AVTransStreamData>&
 
 int32_t AVSenderFilter::SendStreamDataByStream(const std::shared_ptr<AVTransStreamData>& streamData)
 {
-    HILOGD("AVSenderFilter SendStreamDataByStream enter");
+    HILOGD_LIMITED("AVSenderFilter SendStreamDataByStream enter");
 #ifdef DSCH_COLLAB_AV_TRANS_TEST_DEMO
     if (auto ptr = listener_.lock()) {
         ptr->OnStream(channelId_, streamData);
     }
 #endif
-    ChannelManager::GetInstance().SendStream(channelId_, streamData);
+    ChannelManager::GetInstance().SendStream(channelId_, streamData, CreateSendCompleteCallback());
     return ERR_OK;
 }
 
 int32_t AVSenderFilter::SendStreamDataByBytes(const std::shared_ptr<AVTransStreamData>& streamData)
 {
-    HILOGD("AVSenderFilter SendStreamDataByBytes enter");
+    HILOGD_LIMITED("AVSenderFilter SendStreamDataByBytes enter");
     cJSON* headerJson = streamData->SerializeStreamDataExt();
     if (!headerJson) {
         HILOGE("serialize stream data failed");
@@ -349,7 +410,7 @@ int32_t AVSenderFilter::SendStreamDataByBytes(const std::shared_ptr<AVTransStrea
         ptr->OnBytes(channelId_, buffer);
     }
 #endif
-    ChannelManager::GetInstance().SendBytes(channelId_, buffer);
+    ChannelManager::GetInstance().SendBytes(channelId_, buffer, CreateSendCompleteCallback());
     FREE_CJSON(headerStr, headerJson);
     return ERR_OK;
 }
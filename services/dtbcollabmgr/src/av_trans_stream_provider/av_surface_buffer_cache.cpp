@@ -20,7 +20,8 @@
 namespace OHOS {
 namespace DistributedCollab {
 namespace {
-    static constexpr uint32_t MAX_CACHE_SIZE = 3;
+    // buffers the decoder can still dequeue while prebufferDepth_ ones are held
+    static constexpr uint32_t DECODER_QUEUE_SIZE = 3;
     static const std::string TAG = "AVSurfaceBufferCache";
 }
 
@@ -42,7 +43,7 @@ void AVSurfaceBufferCache::Init()
 
 int32_t AVSurfaceBufferCache::GetSurface(sptr<Surface>& surface)
 {
-    HILOGI("AVSurfaceBufferCache::GetSurface enter");
+    HILOGI("AVSurfaceBufferCache::GetSurface enter, prebuffer depth %{public}u", prebufferDepth_);
     innerSurface_ = IConsumerSurface::Create();
     if (innerSurface_ == nullptr) {
         HILOGE("create inner surface failed");
@@ -50,12 +51,16 @@ int32_t AVSurfaceBufferCache::GetSurface(sptr<Surface>& surface)
     }
     surface = innerSurface_;
     surface->SetDefaultUsage(BUFFER_USAGE_MEM_MMZ_CACHE | BUFFER_USAGE_CPU_READ);
+    GSError err = surface->SetQueueSize(prebufferDepth_ + DECODER_QUEUE_SIZE);
+    if (err != GSERROR_OK) {
+        HILOGW("set inner surface queue size failed, error code: %{public}d", err);
+    }
     return ERR_OK;
 }
 
 void AVSurfaceBufferCache::SurfaceListener::OnBufferAvailable()
 {
-    HILOGI("AVSurfaceBufferCache::SurfaceListener::OnBufferAvailable enter");
+    HILOGD("AVSurfaceBufferCache::SurfaceListener::OnBufferAvailable enter");
     if (auto ptr = surface_.promote()) {
         int32_t flushFence = 0;
         int64_t timestamp = 0;
@@ -66,50 +71,51 @@ void AVSurfaceBufferCache::SurfaceListener::OnBufferAvailable()
             HILOGE("SurfaceListener AcquireBuffer failed");
             return;
         }
-        if (auto cachePtr = cache_.lock()) {
-            cachePtr->AddSurfaceBuffer(buffer);
+        // on success the cache keeps the buffer acquired until it is written out
+        auto cachePtr = cache_.lock();
+        if (cachePtr == nullptr || cachePtr->AddSurfaceBuffer(buffer) != ERR_OK) {
+            ptr->ReleaseBuffer(buffer, -1);
         }
-        ptr->ReleaseBuffer(buffer, -1);
     }
 };
 
 int32_t AVSurfaceBufferCache::AddSurfaceBuffer(const sptr<SurfaceBuffer>& buffer)
 {
-    HILOGI("AVSurfaceBufferCache::AddSurfaceBuffer enter");
+    HILOGD("AVSurfaceBufferCache::AddSurfaceBuffer enter");
     if (buffer == nullptr) {
         HILOGE("empty surface buffer");
         return INVALID_PARAMETERS_ERR;
     }
     BufferRequestConfig config = buffer->GetBufferRequestConfig();
     config.usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA;
-    void* dataPtr = buffer->GetVirAddr();
-    int32_t dataSize = static_cast<int32_t>(buffer->GetSize());
-    if ((dataPtr == nullptr) || (dataSize <= 0)) {
-        HILOGE("buffer invalid params, size: %{public}d", dataSize);
+    if ((buffer->GetVirAddr() == nullptr) || (buffer->GetSize() == 0)) {
+        HILOGE("buffer invalid params, size: %{public}u", buffer->GetSize());
         return INVALID_PARAMETERS_ERR;
     }
-    std::unique_ptr<AVTransDataBuffer> data = std::make_unique<AVTransDataBuffer>(dataSize);
-    int32_t ret = memcpy_s(data->Data(), data->Size(),
-        dataPtr, dataSize);
+    int32_t ret = AddCache(buffer, config);
     if (ret != ERR_OK) {
-        HILOGE("write buffer data failed");
-        return READ_SURFACE_BUFFER_FAILED;
+        return ret;
     }
-    AddCache(data, config);
     cv_.notify_one();
     return ERR_OK;
 }
 
-void AVSurfaceBufferCache::AddCache(std::unique_ptr<AVTransDataBuffer>& data, BufferRequestConfig& config)
+int32_t AVSurfaceBufferCache::AddCache(const sptr<SurfaceBuffer>& buffer, BufferRequestConfig& config)
 {
-    HILOGI("AVSurfaceBufferCache::AddCache enter");
+    HILOGD("AVSurfaceBufferCache::AddCache enter");
     std::lock_guard<std::mutex> lock(queueMutex_);
+    // checked under the lock so nothing is queued after Stop cleared the queue
+    if (!isRunning_) {
+        HILOGW("cache not running, drop buffer");
+        return INVALID_PARAMETERS_ERR;
+    }
     lastIndex_++;
     std::unique_ptr<Cache> cache = std::make_unique<Cache>();
-    cache->data_ = std::move(data);
+    cache->buffer_ = buffer;
     cache->index_ = lastIndex_;
     cache->config_ = std::move(config);
     cacheQueue_.push(std::move(cache));
+    return ERR_OK;
 }
 
 void AVSurfaceBufferCache::Start()
@@ -119,10 +125,10 @@ void AVSurfaceBufferCache::Start()
         HILOGE("inner surface should be created first");
         return;
     }
+    isRunning_ = true;
     sptr<IBufferConsumerListener> surfaceListener = sptr<SurfaceListener>::MakeSptr(
         innerSurface_, shared_from_this());
     innerSurface_->RegisterConsumerListener(surfaceListener);
-    isRunning_ = true;
     processingThread_ = std::thread(&AVSurfaceBufferCache::Process, this);
 }
 
@@ -134,28 +140,35 @@ void AVSurfaceBufferCache::Stop()
     if (processingThread_.joinable()) {
         processingThread_.join();
     }
+    ClearCache();
+    HILOGI("flushed %{public}u frames, copied %{public}llu bytes", flushedFrames_.load(),
+        static_cast<unsigned long long>(copiedBytes_.load()));
 }
 
 void AVSurfaceBufferCache::Process()
 {
     HILOGI("AVSurfaceBufferCache::Process enter");
     while (isRunning_) {
-        std::unique_lock<std::mutex> lock(queueMutex_);
-        cv_.wait(lock, [this] {
-            return !isRunning_ || !cacheQueue_.empty();
-        });
-        if (!isRunning_) {
-            HILOGI("exit running process thread");
-            return;
-        }
-        // first need MAX_CACHE_SIZE frame saved
-        if (lastIndex_ < MAX_CACHE_SIZE) {
-            continue;
+        std::vector<std::unique_ptr<Cache>> caches;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            // first need prebufferDepth_ frames saved
+            cv_.wait(lock, [this] {
+                return !isRunning_ || (!cacheQueue_.empty() && lastIndex_ >= prebufferDepth_);
+            });
+            if (!isRunning_) {
+                HILOGI("exit running process thread");
+                return;
+            }
+            while (!cacheQueue_.empty()) {
+                caches.push_back(std::move(cacheQueue_.front()));
+                cacheQueue_.pop();
+            }
         }
-        while (!cacheQueue_.empty()) {
-            auto& ptr = cacheQueue_.top();
-            WriteDataToSurface(ptr);
-            cacheQueue_.pop();
+        // write out of the lock so the decoder callback never waits on the output surface
+        for (auto& cache : caches) {
+            WriteDataToSurface(cache);
+            ReleaseCache(cache);
         }
     }
 }
@@ -176,24 +189,48 @@ void AVSurfaceBufferCache::WriteDataToSurface(const std::unique_ptr<Cache>& cach
         surfaceBuffer = nullptr;
         return;
     }
-    auto& dataPtr = cacheData->data_;
+    sptr<SurfaceBuffer>& srcBuffer = cacheData->buffer_;
     void* bufferAddr = surfaceBuffer->GetVirAddr();
     size_t bufferSize = surfaceBuffer->GetSize();
-    if (bufferSize < dataPtr->Size()) {
+    size_t dataSize = srcBuffer->GetSize();
+    if (bufferSize < dataSize) {
         HILOGE("Buffer size is smaller than frame size!");
+        outputSurface_->CancelBuffer(surfaceBuffer);
         return;
     }
-    int32_t ret = memcpy_s(bufferAddr, bufferSize,
-        dataPtr->Data(), dataPtr->Size());
+    int32_t ret = memcpy_s(bufferAddr, bufferSize, srcBuffer->GetVirAddr(), dataSize);
     if (ret != ERR_OK) {
         HILOGE("write buffer to surface failed");
+        outputSurface_->CancelBuffer(surfaceBuffer);
         return;
     }
+    copiedBytes_ += dataSize;
     BufferFlushConfig flushConfig = { { 0, 0, config.width, config.height }, 0 };
     SurfaceError flushRet = outputSurface_->FlushBuffer(surfaceBuffer, -1, flushConfig);
     if (flushRet != SURFACE_ERROR_OK) {
         HILOGE("Flush encoder input producer surface buffer failed");
+        return;
+    }
+    flushedFrames_++;
+}
+
+void AVSurfaceBufferCache::ReleaseCache(const std::unique_ptr<Cache>& cacheData)
+{
+    if (innerSurface_ == nullptr || cacheData == nullptr || cacheData->buffer_ == nullptr) {
+        return;
+    }
+    innerSurface_->ReleaseBuffer(cacheData->buffer_, -1);
+    cacheData->buffer_ = nullptr;
+}
+
+void AVSurfaceBufferCache::ClearCache()
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    while (!cacheQueue_.empty()) {
+        ReleaseCache(cacheQueue_.front());
+        cacheQueue_.pop();
     }
+    lastIndex_ = 0;
 }
 } // namespace DistributedCollab
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
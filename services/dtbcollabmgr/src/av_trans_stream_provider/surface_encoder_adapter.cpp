@@ -403,6 +403,16 @@ namespace DistributedCollab {
             return Status::ERROR_UNKNOWN;
         }
         MediaAVCodec::Format format = MediaAVCodec::Format();
+        if (parameter != nullptr && parameter->Find(Tag::MEDIA_BITRATE) != parameter->end()) {
+            int64_t mediaBitrate;
+            parameter->Get<Tag::MEDIA_BITRATE>(mediaBitrate);
+            format.PutLongValue(MDKey::MD_KEY_BITRATE, mediaBitrate);
+        }
+        if (parameter != nullptr && parameter->Find(Tag::VIDEO_FRAME_RATE) != parameter->end()) {
+            double videoFrameRate;
+            parameter->Get<Tag::VIDEO_FRAME_RATE>(videoFrameRate);
+            format.PutDoubleValue(MDKey::MD_KEY_FRAME_RATE, videoFrameRate);
+        }
         int32_t ret = codecServer_->SetParameter(format);
         return ret == ERR_OK ? Status::OK : Status::ERROR_UNKNOWN;
     }
@@ -14,6 +14,7 @@
 */
 
 #include "channel_manager.h"
+#include "dms_log_limiter.h"
 #include "dtbcollabmgr_log.h"
 #include "softbus_file_adapter.h"
 #include <algorithm>
@@ -328,6 +329,15 @@ void ChannelManager::DeInit()
     for (const int32_t id : channelIds) {
         DeleteChannel(id);
     }
+    {
+        std::lock_guard<std::mutex> transferLock(fileTransferMutex_);
+        fileTransfers_.clear();
+    }
+    {
+        // the sends still queued were dropped with the event runner
+        std::lock_guard<std::mutex> pendingLock(pendingSendMutex_);
+        pendingSends_.clear();
+    }
     Shutdown(serverSocketId_);
     Reset();
     HILOGI("end");
@@ -897,6 +907,13 @@ void ChannelManager::OnSocketClosed(int32_t socketId, const ShutdownReason reaso
 {
     int32_t channelId = 0;
     CHECK_SOCKET_ID(socketId);
+    auto transfer = GetFileTransfer(socketId);
+    if (transfer != nullptr) {
+        transfer->OnSocketClosed(socketId);
+        if (transfer->IsFinished()) {
+            ClearFileTransfer(transfer);
+        }
+    }
     CHECK_CHANNEL_ID(socketId, channelId);
     HILOGI("socket %{public}d closed, reason:%{public}d", socketId, reason);
     int32_t ret = SetSocketStatus(socketId, ChannelStatus::UNCONNECTED);
@@ -942,7 +959,7 @@ ChannelStatus ChannelManager::GetChannelStatus(const int32_t channelId)
 template <typename Func, typename... Args>
 int32_t ChannelManager::DoSendData(const int32_t channelId, Func doSendFunc, Args&&... args)
 {
-    HILOGD("start to send data");
+    HILOGD_LIMITED("start to send data");
     int32_t socketId = GetValidSocket(channelId);
     if (socketId <= 0) {
         HILOGE("no avaliable sockets, %{public}d", channelId);
@@ -974,32 +991,71 @@ int32_t ChannelManager::DoSendData(const int32_t channelId, Func doSendFunc, Arg
     return ERR_OK;
 }
 
-int32_t ChannelManager::SendBytes(const int32_t channelId, const std::shared_ptr<AVTransDataBuffer>& data)
+int32_t ChannelManager::SendBytes(const int32_t channelId, const std::shared_ptr<AVTransDataBuffer>& data,
+    const SendCompleteCallback& onComplete)
 {
     if (!isValidChannelId(channelId) || data == nullptr) {
         HILOGE("invalid channel id. %{public}d", channelId);
         return INVALID_CHANNEL_ID;
     }
-    HILOGI("start to send bytes");
-    auto func = [channelId, data, this]() {
-        DoSendBytes(channelId, data);
+    HILOGI_LIMITED("start to send bytes");
+    int64_t postUs = GetSteadyTimeUs();
+    auto func = [channelId, data, onComplete, postUs, this]() {
+        int32_t sendRet = DoSendBytes(channelId, data);
+        RemovePendingSend(channelId);
+        if (onComplete != nullptr) {
+            onComplete(sendRet, GetSteadyTimeUs() - postUs);
+        }
     };
+    AddPendingSend(channelId);
     int32_t ret = PostTask(func, AppExecFwk::EventQueue::Priority::LOW);
     if (ret != ERR_OK) {
         HILOGE("failed to add send bytes task, ret=%{public}d", ret);
+        RemovePendingSend(channelId);
         return ret;
     }
-    HILOGI("send bytes task added to handler");
+    HILOGI_LIMITED("send bytes task added to handler");
     return ERR_OK;
 }
 
 inline int32_t ChannelManager::DoSendBytes(const int32_t channelId,
     const std::shared_ptr<AVTransDataBuffer>& data)
 {
-    HILOGD("start to send bytes");
+    HILOGD_LIMITED("start to send bytes");
     return DoSendData(channelId, &DataSenderReceiver::SendBytesData, data);
 }
 
+void ChannelManager::AddPendingSend(const int32_t channelId)
+{
+    std::lock_guard<std::mutex> lock(pendingSendMutex_);
+    pendingSends_[channelId]++;
+}
+
+void ChannelManager::RemovePendingSend(const int32_t channelId)
+{
+    std::lock_guard<std::mutex> lock(pendingSendMutex_);
+    auto it = pendingSends_.find(channelId);
+    if (it == pendingSends_.end()) {
+        return;
+    }
+    if (--it->second == 0) {
+        pendingSends_.erase(it);
+    }
+}
+
+uint32_t ChannelManager::GetPendingSendCount(const int32_t channelId)
+{
+    std::lock_guard<std::mutex> lock(pendingSendMutex_);
+    auto it = pendingSends_.find(channelId);
+    return it == pendingSends_.end() ? 0 : it->second;
+}
+
+int64_t ChannelManager::GetSteadyTimeUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 int32_t ChannelManager::GetValidSocket(const int32_t channelId)
 {
     std::vector<int32_t> socketIds;
@@ -1023,29 +1079,36 @@ int32_t ChannelManager::GetValidSocket(const int32_t channelId)
 }
 
 int32_t ChannelManager::SendStream(const int32_t channelId,
-    const std::shared_ptr<AVTransStreamData>& data)
+    const std::shared_ptr<AVTransStreamData>& data, const SendCompleteCallback& onComplete)
 {
     if (!isValidChannelId(channelId) || data == nullptr) {
         HILOGE("invalid channel id");
         DoErrorCallback(channelId, INVALID_CHANNEL_ID);
         return INVALID_CHANNEL_ID;
     }
-    HILOGD("start to send stream");
+    HILOGD_LIMITED("start to send stream");
+    int64_t postUs = GetSteadyTimeUs();
     auto func = [=]() {
-        DoSendStream(channelId, data);
+        int32_t sendRet = DoSendStream(channelId, data);
+        RemovePendingSend(channelId);
+        if (onComplete != nullptr) {
+            onComplete(sendRet, GetSteadyTimeUs() - postUs);
+        }
     };
+    AddPendingSend(channelId);
     int32_t ret = PostTask(func, AppExecFwk::EventQueue::Priority::LOW);
     if (ret != ERR_OK) {
         HILOGE("failed to add send stream task, ret=%{public}d", ret);
+        RemovePendingSend(channelId);
         return POST_TASK_FAILED;
     }
-    HILOGD("send stream task added to handler");
+    HILOGD_LIMITED("send stream task added to handler");
     return ERR_OK;
 }
 
 int32_t ChannelManager::DoSendStream(const int32_t channelId, const std::shared_ptr<AVTransStreamData>& data)
 {
-    HILOGD("start to send stream");
+    HILOGD_LIMITED("start to send stream");
     return DoSendData(channelId, &DataSenderReceiver::SendStreamData, data);
 }
 
@@ -1056,7 +1119,7 @@ int32_t ChannelManager::SendMessage(const int32_t channelId,
         HILOGE("invalid channel id. %{public}d", channelId);
         return INVALID_CHANNEL_ID;
     }
-    HILOGD("start to send message");
+    HILOGD_LIMITED("start to send message");
     auto func = [channelId, data, this]() {
         DoSendMessage(channelId, data);
     };
@@ -1065,33 +1128,47 @@ int32_t ChannelManager::SendMessage(const int32_t channelId,
         HILOGE("failed to add send bytes task, ret=%{public}d", ret);
         return ret;
     }
-    HILOGD("send bytes task added to handler");
+    HILOGD_LIMITED("send bytes task added to handler");
     return ERR_OK;
 }
 
 int32_t ChannelManager::DoSendMessage(const int32_t channelId,
     const std::shared_ptr<AVTransDataBuffer>& data)
 {
-    HILOGI("start to send message");
+    HILOGI_LIMITED("start to send message");
     return DoSendData(channelId, &DataSenderReceiver::SendMessageData, data);
 }
 
 int32_t ChannelManager::SendFile(const int32_t channelId, const std::vector<std::string>& sFiles,
     const std::vector<std::string>& dFiles)
 {
-    HILOGI("start to send files, %{public}d", channelId);
-    if (!isValidChannelId(channelId) || sFiles.empty() || dFiles.empty()) {
-        HILOGE("invalid channel id. %{public}d or empty sfiles", channelId);
+    return SendFile(std::vector<int32_t>{ channelId }, sFiles, dFiles);
+}
+
+int32_t ChannelManager::SendFile(const std::vector<int32_t>& channelIds, const std::vector<std::string>& sFiles,
+    const std::vector<std::string>& dFiles)
+{
+    HILOGI("start to send files over %{public}d channels", static_cast<int32_t>(channelIds.size()));
+    if (channelIds.empty() || sFiles.empty() || dFiles.empty()) {
+        HILOGE("empty channel ids or empty sfiles");
         return INVALID_PARAMETERS_ERR;
     }
-    if (sFiles.size() != dFiles.size() || sFiles.size() > MAX_FILE_COUNT) {
+    for (const auto channelId : channelIds) {
+        if (!isValidChannelId(channelId)) {
+            HILOGE("invalid channel id. %{public}d", channelId);
+            return INVALID_PARAMETERS_ERR;
+        }
+    }
+    // batches over MAX_FILE_COUNT are split into windows by the scheduler
+    if (sFiles.size() != dFiles.size()) {
         HILOGE("src size:%{public}d, dst size:%{public}d illegal",
             static_cast<int32_t>(sFiles.size()),
             static_cast<int32_t>(dFiles.size()));
+        return INVALID_PARAMETERS_ERR;
     }
     int32_t ret = ERR_OK;
-    auto func = [channelId, sFiles, dFiles, this]() {
-        DoSendFile(channelId, sFiles, dFiles);
+    auto func = [channelIds, sFiles, dFiles, this]() {
+        DoSendFile(channelIds, sFiles, dFiles);
     };
     ret = PostTask(func, AppExecFwk::EventQueue::Priority::LOW);
     if (ret != ERR_OK) {
@@ -1102,11 +1179,104 @@ int32_t ChannelManager::SendFile(const int32_t channelId, const std::vector<std:
     return ERR_OK;
 }
 
-int32_t ChannelManager::DoSendFile(const int32_t channelId, const std::vector<std::string>& sFiles,
+int32_t ChannelManager::DoSendFile(const std::vector<int32_t>& channelIds, const std::vector<std::string>& sFiles,
     const std::vector<std::string>& dFiles)
 {
     HILOGI("start to do send files");
-    return DoSendData(channelId, &DataSenderReceiver::SendFileData, sFiles, dFiles);
+    int32_t channelId = channelIds.front();
+    std::vector<int32_t> socketIds = GetValidFileSockets(channelIds);
+    if (socketIds.empty()) {
+        HILOGE("no idle file sockets, %{public}d", channelId);
+        DoErrorCallback(channelId, NO_CONNECTED_SOCKET_ID);
+        return NO_CONNECTED_SOCKET_ID;
+    }
+    FileTransferConfig config;
+    config.maxFilesPerWindow = MAX_FILE_COUNT;
+    auto transfer = std::make_shared<FileTransferScheduler>(socketIds,
+        [this](const int32_t socketId, const std::vector<std::string>& sFiles,
+            const std::vector<std::string>& dFiles) {
+            return DoSendFileOnSocket(socketId, sFiles, dFiles);
+        },
+        [this, channelId](const FileInfo& info) {
+            DoFileSendCallback(channelId, info);
+        }, config);
+    {
+        std::lock_guard<std::mutex> transferLock(fileTransferMutex_);
+        for (const auto socketId : socketIds) {
+            fileTransfers_[socketId] = transfer;
+        }
+    }
+    int32_t ret = transfer->Start(sFiles, dFiles);
+    if (transfer->IsFinished()) {
+        ClearFileTransfer(transfer);
+    }
+    if (ret != ERR_OK) {
+        HILOGE("failed send files, %{public}d", ret);
+    }
+    return ret;
+}
+
+int32_t ChannelManager::DoSendFileOnSocket(const int32_t socketId, const std::vector<std::string>& sFiles,
+    const std::vector<std::string>& dFiles)
+{
+    int32_t channelId = GetChannelId(socketId);
+    std::shared_lock<std::shared_mutex> channelReadLock(channelMutex_);
+    auto infoIt = channelInfoMap_.find(channelId);
+    if (infoIt == channelInfoMap_.end()) {
+        HILOGE("no valid channel info exist");
+        return INVALID_CHANNEL_ID;
+    }
+    auto socketIt = infoIt->second.dataSenderReceivers.find(socketId);
+    if (socketIt == infoIt->second.dataSenderReceivers.end()) {
+        HILOGE("no valid socket");
+        return INVALID_SOCKET_ID;
+    }
+    return socketIt->second->SendFileData(sFiles, dFiles);
+}
+
+std::vector<int32_t> ChannelManager::GetValidFileSockets(const std::vector<int32_t>& channelIds)
+{
+    std::vector<int32_t> socketIds;
+    {
+        std::shared_lock<std::shared_mutex> channelReadLock(channelMutex_);
+        for (const auto channelId : channelIds) {
+            auto infoIt = channelInfoMap_.find(channelId);
+            if (infoIt == channelInfoMap_.end() || infoIt->second.status == ChannelStatus::UNCONNECTED) {
+                HILOGW("skip invalid channelId, %{public}d", channelId);
+                continue;
+            }
+            socketIds.insert(socketIds.end(),
+                infoIt->second.clientSockets.begin(), infoIt->second.clientSockets.end());
+        }
+    }
+    std::sort(socketIds.begin(), socketIds.end());
+    socketIds.erase(std::unique(socketIds.begin(), socketIds.end()), socketIds.end());
+    std::lock_guard<std::mutex> transferLock(fileTransferMutex_);
+    // one SendFile at a time per socket
+    socketIds.erase(std::remove_if(socketIds.begin(), socketIds.end(), [this](const int32_t socketId) {
+        return GetSocketStatus(socketId) != ChannelStatus::CONNECTED ||
+            fileTransfers_.find(socketId) != fileTransfers_.end();
+    }), socketIds.end());
+    return socketIds;
+}
+
+std::shared_ptr<FileTransferScheduler> ChannelManager::GetFileTransfer(const int32_t socketId)
+{
+    std::lock_guard<std::mutex> transferLock(fileTransferMutex_);
+    auto it = fileTransfers_.find(socketId);
+    return it == fileTransfers_.end() ? nullptr : it->second;
+}
+
+void ChannelManager::ClearFileTransfer(const std::shared_ptr<FileTransferScheduler>& transfer)
+{
+    std::vector<int32_t> socketIds = transfer->GetSocketIds();
+    std::lock_guard<std::mutex> transferLock(fileTransferMutex_);
+    for (const auto socketId : socketIds) {
+        auto it = fileTransfers_.find(socketId);
+        if (it != fileTransfers_.end() && it->second == transfer) {
+            fileTransfers_.erase(it);
+        }
+    }
 }
 
 void ChannelManager::OnBytesReceived(int32_t socketId,
@@ -1116,7 +1286,7 @@ void ChannelManager::OnBytesReceived(int32_t socketId,
     CHECK_SOCKET_ID(socketId);
     CHECK_CHANNEL_ID(socketId, channelId);
     CHECK_DATA_NULL(socketId, data, OnError);
-    HILOGI("receive data: %{public}d, len=%{public}d", socketId, dataLen);
+    HILOGI_LIMITED("receive data: %{public}d, len=%{public}d", socketId, dataLen);
     std::shared_ptr<AVTransDataBuffer> packedData = ProcessRecvData(channelId, socketId, data, dataLen);
     if (!packedData) {
         return;
@@ -1157,7 +1327,7 @@ void ChannelManager::OnMessageReceived(int32_t socketId, const void* data, const
     CHECK_SOCKET_ID(socketId);
     CHECK_CHANNEL_ID(socketId, channelId);
     CHECK_DATA_NULL(socketId, data, OnError);
-    HILOGI("receive data: %{public}d, len=%{public}d", socketId, dataLen);
+    HILOGI_LIMITED("receive data: %{public}d, len=%{public}d", socketId, dataLen);
     std::shared_ptr<AVTransDataBuffer> buffer = std::make_shared<AVTransDataBuffer>(dataLen);
     int32_t ret = memcpy_s(buffer->Data(),
         buffer->Size(), data, dataLen);
@@ -1217,6 +1387,18 @@ void ChannelManager::OnFileEventReceived(int32_t socketId, FileEvent *event)
         HILOGE("socket %{public}d event empty", socketId);
         return;
     }
+    if (event->type == FileEventType::FILE_EVENT_SEND_PROCESS ||
+        event->type == FileEventType::FILE_EVENT_SEND_FINISH ||
+        event->type == FileEventType::FILE_EVENT_SEND_ERROR) {
+        auto transfer = GetFileTransfer(socketId);
+        if (transfer != nullptr) {
+            transfer->OnFileEvent(socketId, event);
+            if (transfer->IsFinished()) {
+                ClearFileTransfer(transfer);
+            }
+            return;
+        }
+    }
     if (event->type == FileEventType::FILE_EVENT_RECV_UPDATE_PATH) {
         HILOGI("start to set update path func, %{public}d", socketId);
         return DispatchProcessFileEvent(fileChannelId_.load(), event);
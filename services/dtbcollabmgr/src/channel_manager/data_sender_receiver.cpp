@@ -15,6 +15,7 @@
 
 #include "data_sender_receiver.h"
 #include "channel_common_definition.h"
+#include "dms_log_limiter.h"
 #include "dtbcollabmgr_log.h"
 #include "session.h"
 #include "session_data_header.h"
@@ -113,7 +114,7 @@ int32_t DataSenderReceiver::SendBytesData(const std::shared_ptr<AVTransDataBuffe
 int32_t DataSenderReceiver::SendUnpackData(const std::shared_ptr<AVTransDataBuffer>& sendData,
     const int32_t dataType)
 {
-    HILOGI("start to send bytes");
+    HILOGI_LIMITED("start to send bytes");
     uint32_t maxSendSize = 0;
     GET_SOFTBUS_SESSION_OPTION(socketId_, maxSendSize, static_cast<uint32_t>(sizeof(maxSendSize)));
 
@@ -155,14 +156,14 @@ int32_t DataSenderReceiver::SendUnpackData(const std::shared_ptr<AVTransDataBuff
         }
         current += payloadLen;
     }
-    HILOGI("finish send all bytes by packet");
+    HILOGI_LIMITED("finish send all bytes by packet");
     return ERR_OK;
 }
 
 int32_t DataSenderReceiver::SendAllPackets(const std::shared_ptr<AVTransDataBuffer> sendData,
     const int32_t dataType)
 {
-    HILOGI("send all data");
+    HILOGI_LIMITED("send all data");
     uint8_t* current = sendData->Data();
     uint32_t totalLen = sendData->Size() + SessionDataHeader::HEADER_LEN;
     uint32_t packetLen = sendData->Size() + SessionDataHeader::HEADER_LEN;
@@ -185,14 +186,14 @@ int32_t DataSenderReceiver::SendAllPackets(const std::shared_ptr<AVTransDataBuff
     if (ret != ERR_OK) {
         return ret;
     }
-    HILOGI("finish send all bytes");
+    HILOGI_LIMITED("finish send all bytes");
     return ERR_OK;
 }
 
 int32_t DataSenderReceiver::DoSendPacket(SessionDataHeader& headerPara,
     const uint8_t* dataHeader, const uint32_t dataLen)
 {
-    HILOGI("start to send packet by softbus");
+    HILOGI_LIMITED("start to send packet by softbus");
     auto headerBuffer = headerPara.Serialize();
     auto sendBuffer = std::make_unique<AVTransDataBuffer>(SessionDataHeader::HEADER_LEN + dataLen);
     uint8_t* header = sendBuffer->Data();
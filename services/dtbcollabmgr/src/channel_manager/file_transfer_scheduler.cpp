@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "file_transfer_scheduler.h"
+
+#include <algorithm>
+#include <sys/stat.h>
+
+#include "dtbcollabmgr_log.h"
+
+namespace OHOS {
+namespace DistributedCollab {
+namespace {
+const std::string TAG = "FileTransferScheduler";
+}
+
+FileTransferScheduler::FileTransferScheduler(const std::vector<int32_t>& socketIds, const SendFunc& sendFunc,
+    const ReportFunc& reportFunc, const FileTransferConfig& config)
+    : config_(config), sendFunc_(sendFunc), reportFunc_(reportFunc)
+{
+    config_.maxFilesPerWindow = std::max<uint32_t>(config_.maxFilesPerWindow, 1);
+    for (const auto socketId : socketIds) {
+        lanes_[socketId] = Lane();
+    }
+}
+
+int32_t FileTransferScheduler::Start(const std::vector<std::string>& sFiles, const std::vector<std::string>& dFiles)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (sFiles.empty() || sFiles.size() != dFiles.size()) {
+            HILOGE("src size:%{public}d, dst size:%{public}d illegal",
+                static_cast<int32_t>(sFiles.size()), static_cast<int32_t>(dFiles.size()));
+            return INVALID_PARAMETERS_ERR;
+        }
+        if (lanes_.empty()) {
+            HILOGE("no file socket to send on");
+            return NO_CONNECTED_SOCKET_ID;
+        }
+        for (size_t i = 0; i < sFiles.size(); ++i) {
+            FileItem item;
+            item.srcFile = sFiles[i];
+            item.dstFile = dFiles[i];
+            struct stat fileStat = {};
+            if (stat(sFiles[i].c_str(), &fileStat) == 0) {
+                item.size = static_cast<uint64_t>(fileStat.st_size);
+            }
+            bytesTotal_ += item.size;
+            files_.push_back(std::move(item));
+        }
+        BuildWindowsLocked();
+        HILOGI("send %{public}d files, %{public}llu bytes in %{public}d windows over %{public}d sockets",
+            static_cast<int32_t>(files_.size()), static_cast<unsigned long long>(bytesTotal_),
+            static_cast<int32_t>(pending_.size()), static_cast<int32_t>(lanes_.size()));
+    }
+    // send failures from here on are reported as SEND_ERROR
+    Dispatch();
+    return ERR_OK;
+}
+
+void FileTransferScheduler::BuildWindowsLocked()
+{
+    Window window;
+    uint64_t windowBytes = 0;
+    for (size_t i = 0; i < files_.size(); ++i) {
+        bool isFull = window.files.size() >= config_.maxFilesPerWindow ||
+            (!window.files.empty() && windowBytes + files_[i].size > config_.maxBytesPerWindow);
+        if (isFull) {
+            pending_.push_back(std::move(window));
+            window = Window();
+            windowBytes = 0;
+        }
+        window.files.push_back(i);
+        windowBytes += files_[i].size;
+    }
+    if (!window.files.empty()) {
+        pending_.push_back(std::move(window));
+    }
+}
+
+std::vector<FileTransferScheduler::SendTask> FileTransferScheduler::DispatchLocked()
+{
+    std::vector<SendTask> tasks;
+    for (auto& [socketId, lane] : lanes_) {
+        if (isFinished_ || pending_.empty()) {
+            break;
+        }
+        if (lane.isBusy || lane.isClosed) {
+            continue;
+        }
+        Window window;
+        while (window.files.empty() && !pending_.empty()) {
+            window = std::move(pending_.front());
+            pending_.pop_front();
+            // resend only what has not been acknowledged yet
+            auto isDone = [this](size_t index) { return files_[index].isDone; };
+            window.files.erase(std::remove_if(window.files.begin(), window.files.end(), isDone),
+                window.files.end());
+        }
+        if (window.files.empty()) {
+            break;
+        }
+        SendTask task;
+        task.socketId = socketId;
+        for (const auto index : window.files) {
+            task.sFiles.push_back(files_[index].srcFile);
+            task.dFiles.push_back(files_[index].dstFile);
+        }
+        lane.isBusy = true;
+        lane.rate = 0;
+        lane.window = std::move(window);
+        tasks.push_back(std::move(task));
+    }
+    CheckFinishLocked();
+    return tasks;
+}
+
+void FileTransferScheduler::Dispatch()
+{
+    bool hasFailed = true;
+    while (hasFailed) {
+        hasFailed = false;
+        std::vector<SendTask> tasks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks = DispatchLocked();
+        }
+        for (const auto& task : tasks) {
+            HILOGI("send %{public}d files on socket %{public}d", static_cast<int32_t>(task.sFiles.size()),
+                task.socketId);
+            int32_t ret = sendFunc_(task.socketId, task.sFiles, task.dFiles);
+            if (ret == ERR_OK) {
+                continue;
+            }
+            HILOGE("send files on socket %{public}d failed, ret %{public}d", task.socketId, ret);
+            std::lock_guard<std::mutex> lock(mutex_);
+            Lane& lane = lanes_[task.socketId];
+            lane.isClosed = true;
+            hasFailed = RequeueWindowLocked(lane, ret) || hasFailed;
+        }
+    }
+    std::vector<FileInfo> reports;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reports.swap(reports_);
+    }
+    for (const auto& info : reports) {
+        Report(info);
+    }
+}
+
+void FileTransferScheduler::OnFileEvent(const int32_t socketId, const FileEvent* event)
+{
+    if (event == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = lanes_.find(socketId);
+        if (isFinished_ || iter == lanes_.end() || !iter->second.isBusy) {
+            HILOGW("no window in flight on socket %{public}d", socketId);
+            return;
+        }
+        Lane& lane = iter->second;
+        switch (event->type) {
+            case FileEventType::FILE_EVENT_SEND_PROCESS:
+                lane.rate = event->rate;
+                AckProgressLocked(lane, event->bytesProcessed);
+                reports_.push_back(BuildInfoLocked(ChannelFileEvent::SEND_PROCESS));
+                break;
+            case FileEventType::FILE_EVENT_SEND_FINISH:
+                FinishWindowLocked(lane);
+                break;
+            case FileEventType::FILE_EVENT_SEND_ERROR:
+                HILOGE("send files on socket %{public}d interrupted, error %{public}d", socketId, event->errorCode);
+                AckProgressLocked(lane, event->bytesProcessed);
+                RequeueWindowLocked(lane, event->errorCode);
+                break;
+            default:
+                return;
+        }
+    }
+    Dispatch();
+}
+
+void FileTransferScheduler::OnSocketClosed(const int32_t socketId)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = lanes_.find(socketId);
+        if (isFinished_ || iter == lanes_.end()) {
+            return;
+        }
+        HILOGW("file socket %{public}d closed", socketId);
+        Lane& lane = iter->second;
+        lane.isClosed = true;
+        if (lane.isBusy) {
+            RequeueWindowLocked(lane, NO_CONNECTED_SOCKET_ID);
+        }
+        if (!isFinished_ && !HasOpenLaneLocked()) {
+            isFinished_ = true;
+            errorCode_ = NO_CONNECTED_SOCKET_ID;
+            reports_.push_back(BuildInfoLocked(ChannelFileEvent::SEND_ERROR));
+        }
+    }
+    Dispatch();
+}
+
+void FileTransferScheduler::AckProgressLocked(Lane& lane, uint64_t bytesProcessed)
+{
+    // softbus counts the bytes of the whole SendFile call, the files go out in list order
+    uint64_t remaining = bytesProcessed;
+    for (const auto index : lane.window.files) {
+        FileItem& item = files_[index];
+        uint64_t acked = std::min(item.size, remaining);
+        remaining -= acked;
+        if (!item.isDone) {
+            item.ackedBytes = acked;
+            item.isDone = acked == item.size && (item.size > 0 || remaining > 0);
+        }
+        if (acked < item.size) {
+            break;
+        }
+    }
+}
+
+void FileTransferScheduler::FinishWindowLocked(Lane& lane)
+{
+    for (const auto index : lane.window.files) {
+        files_[index].ackedBytes = files_[index].size;
+        files_[index].isDone = true;
+    }
+    lane.isBusy = false;
+    lane.rate = 0;
+    lane.window = Window();
+    CheckFinishLocked();
+}
+
+bool FileTransferScheduler::RequeueWindowLocked(Lane& lane, int32_t errorCode)
+{
+    Window window = std::move(lane.window);
+    lane.window = Window();
+    lane.isBusy = false;
+    lane.rate = 0;
+    // a partly sent file starts over, softbus SendFile has no offset
+    for (const auto index : window.files) {
+        if (!files_[index].isDone) {
+            files_[index].ackedBytes = 0;
+        }
+    }
+    window.retry++;
+    if (window.retry > config_.maxRetry || !HasOpenLaneLocked()) {
+        HILOGE("give up file transfer after %{public}u tries, error %{public}d", window.retry, errorCode);
+        isFinished_ = true;
+        errorCode_ = errorCode;
+        reports_.push_back(BuildInfoLocked(ChannelFileEvent::SEND_ERROR));
+        return false;
+    }
+    pending_.push_front(std::move(window));
+    return true;
+}
+
+bool FileTransferScheduler::HasOpenLaneLocked()
+{
+    return std::any_of(lanes_.begin(), lanes_.end(), [](const auto& lane) { return !lane.second.isClosed; });
+}
+
+void FileTransferScheduler::CheckFinishLocked()
+{
+    if (isFinished_ || !pending_.empty()) {
+        return;
+    }
+    if (std::any_of(lanes_.begin(), lanes_.end(), [](const auto& lane) { return lane.second.isBusy; })) {
+        return;
+    }
+    isFinished_ = true;
+    HILOGI("all %{public}d files sent", static_cast<int32_t>(files_.size()));
+    reports_.push_back(BuildInfoLocked(ChannelFileEvent::SEND_FINISH));
+}
+
+FileInfo FileTransferScheduler::BuildInfoLocked(ChannelFileEvent eventType)
+{
+    FileInfo info;
+    info.commonInfo.eventType = eventType;
+    for (const auto& item : files_) {
+        if (eventType == ChannelFileEvent::SEND_FINISH || !item.isDone) {
+            info.commonInfo.fileList.push_back(item.srcFile);
+        }
+    }
+    info.commonInfo.fileCnt = static_cast<uint32_t>(info.commonInfo.fileList.size());
+    if (eventType == ChannelFileEvent::SEND_ERROR) {
+        FileErrorInfo errorInfo;
+        errorInfo.errorCode = errorCode_;
+        info.errorInfo = errorInfo;
+        return info;
+    }
+    FileSendInfo sendInfo;
+    for (const auto& item : files_) {
+        sendInfo.bytesProcessed += item.ackedBytes;
+    }
+    sendInfo.bytesTotal = bytesTotal_;
+    if (eventType == ChannelFileEvent::SEND_PROCESS) {
+        uint32_t rate = 0;
+        for (const auto& [socketId, lane] : lanes_) {
+            rate += lane.rate;
+        }
+        sendInfo.rate = rate;
+    }
+    info.sendInfo = sendInfo;
+    return info;
+}
+
+void FileTransferScheduler::Report(const FileInfo& info)
+{
+    if (reportFunc_ != nullptr) {
+        reportFunc_(info);
+    }
+}
+
+bool FileTransferScheduler::IsFinished()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return isFinished_;
+}
+
+std::vector<int32_t> FileTransferScheduler::GetSocketIds()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<int32_t> socketIds;
+    for (const auto& [socketId, lane] : lanes_) {
+        socketIds.push_back(socketId);
+    }
+    return socketIds;
+}
+} // namespace DistributedCollab
+} // namespace OHOS
@@ -0,0 +1,245 @@
+/*
+* Copyright (c) 2025 Huawei Device Co., Ltd.
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "av_encoder_rate_controller_test.h"
+#include "dtbcollabmgr_log.h"
+
+namespace OHOS {
+namespace DistributedCollab {
+
+namespace {
+    static const std::string TAG = "AVEncoderRateControllerTest";
+    using namespace testing;
+    using namespace testing::ext;
+    static constexpr int64_t BITRATE = 4000000;
+    static constexpr double FRAME_RATE = 30.0;
+    static constexpr int64_t HOLD_MS = 500;
+    static constexpr int64_t SAMPLE_INTERVAL_MS = 33;
+    static constexpr uint32_t CONGESTED_QUEUE = 5;
+    static constexpr int64_t CONGESTED_LATENCY_US = 80000;
+
+    RateFeedback CleanSample(int64_t timeMs)
+    {
+        RateFeedback feedback;
+        feedback.timeMs = timeMs;
+        return feedback;
+    }
+
+    RateFeedback CongestedSample(int64_t timeMs)
+    {
+        RateFeedback feedback;
+        feedback.timeMs = timeMs;
+        feedback.queueDepth = CONGESTED_QUEUE;
+        return feedback;
+    }
+}
+
+void AVEncoderRateControllerTest::SetUpTestCase()
+{
+    HILOGI("AVEncoderRateControllerTest::SetUpTestCase");
+}
+
+void AVEncoderRateControllerTest::TearDownTestCase()
+{
+    HILOGI("AVEncoderRateControllerTest::TearDownTestCase");
+}
+
+void AVEncoderRateControllerTest::SetUp()
+{
+    HILOGI("AVEncoderRateControllerTest::SetUp");
+}
+
+void AVEncoderRateControllerTest::TearDown()
+{
+    HILOGI("AVEncoderRateControllerTest::TearDown");
+}
+
+/**
+ * @tc.name: CreateDefault_Test
+ * @tc.desc: Test RateControlConfig::CreateDefault derives the bounds from the configured rate
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVEncoderRateControllerTest, CreateDefault_Test, TestSize.Level1)
+{
+    RateControlConfig config = RateControlConfig::CreateDefault(BITRATE, FRAME_RATE);
+    EXPECT_EQ(config.maxBitrate, BITRATE);
+    EXPECT_EQ(config.minBitrate, BITRATE / 4);
+    EXPECT_GT(config.bitrateStep, 0);
+    EXPECT_DOUBLE_EQ(config.maxFrameRate, FRAME_RATE);
+    EXPECT_DOUBLE_EQ(config.minFrameRate, FRAME_RATE / 2);
+
+    AVEncoderRateController controller(config);
+    RateDecision decision = controller.GetCurrent();
+    EXPECT_EQ(decision.bitrate, BITRATE);
+    EXPECT_DOUBLE_EQ(decision.frameRate, FRAME_RATE);
+}
+
+/**
+ * @tc.name: OnFeedback_Decrease_Test
+ * @tc.desc: Test every congestion signal cuts the bitrate multiplicatively
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVEncoderRateControllerTest, OnFeedback_Decrease_Test, TestSize.Level1)
+{
+    RateControlConfig config = RateControlConfig::CreateDefault(BITRATE, FRAME_RATE);
+    AVEncoderRateController controller(config);
+    RateDecision decision;
+    EXPECT_FALSE(controller.OnFeedback(CleanSample(0), decision));
+    EXPECT_EQ(decision.bitrate, BITRATE);
+
+    int64_t timeMs = 0;
+    EXPECT_TRUE(controller.OnFeedback(CongestedSample(timeMs), decision));
+    EXPECT_EQ(decision.bitrate, static_cast<int64_t>(BITRATE * config.decreaseFactor));
+
+    RateFeedback latency;
+    timeMs += HOLD_MS;
+    latency.timeMs = timeMs;
+    latency.sendLatencyUs = CONGESTED_LATENCY_US;
+    int64_t before = decision.bitrate;
+    EXPECT_TRUE(controller.OnFeedback(latency, decision));
+    EXPECT_LT(decision.bitrate, before);
+
+    RateFeedback gaps;
+    timeMs += HOLD_MS;
+    gaps.timeMs = timeMs;
+    gaps.frameGaps = 1;
+    before = decision.bitrate;
+    EXPECT_TRUE(controller.OnFeedback(gaps, decision));
+    EXPECT_LT(decision.bitrate, before);
+    EXPECT_DOUBLE_EQ(decision.frameRate, FRAME_RATE);
+}
+
+/**
+ * @tc.name: OnFeedback_Hold_Test
+ * @tc.desc: Test a congestion burst inside the hold window only cuts once
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVEncoderRateControllerTest, OnFeedback_Hold_Test, TestSize.Level1)
+{
+    RateControlConfig config = RateControlConfig::CreateDefault(BITRATE, FRAME_RATE);
+    AVEncoderRateController controller(config);
+    RateDecision decision;
+    int64_t timeMs = 0;
+    EXPECT_TRUE(controller.OnFeedback(CongestedSample(timeMs), decision));
+    int64_t afterCut = decision.bitrate;
+    for (timeMs += SAMPLE_INTERVAL_MS; timeMs < HOLD_MS; timeMs += SAMPLE_INTERVAL_MS) {
+        EXPECT_FALSE(controller.OnFeedback(CongestedSample(timeMs), decision));
+        EXPECT_EQ(decision.bitrate, afterCut);
+    }
+    EXPECT_TRUE(controller.OnFeedback(CongestedSample(HOLD_MS), decision));
+    EXPECT_LT(decision.bitrate, afterCut);
+}
+
+/**
+ * @tc.name: OnFeedback_FrameRateFloor_Test
+ * @tc.desc: Test the frame rate is only cut once the bitrate reaches its floor, and never below its own
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVEncoderRateControllerTest, OnFeedback_FrameRateFloor_Test, TestSize.Level1)
+{
+    RateControlConfig config = RateControlConfig::CreateDefault(BITRATE, FRAME_RATE);
+    AVEncoderRateController controller(config);
+    RateDecision decision;
+    int64_t timeMs = 0;
+    while (controller.GetCurrent().bitrate > config.minBitrate) {
+        controller.OnFeedback(CongestedSample(timeMs), decision);
+        EXPECT_DOUBLE_EQ(decision.frameRate, FRAME_RATE);
+        timeMs += HOLD_MS;
+    }
+    EXPECT_EQ(decision.bitrate, config.minBitrate);
+
+    EXPECT_TRUE(controller.OnFeedback(CongestedSample(timeMs), decision));
+    EXPECT_EQ(decision.bitrate, config.minBitrate);
+    EXPECT_LT(decision.frameRate, FRAME_RATE);
+
+    for (int32_t i = 0; i < 10; i++) {
+        timeMs += HOLD_MS;
+        controller.OnFeedback(CongestedSample(timeMs), decision);
+    }
+    EXPECT_EQ(decision.bitrate, config.minBitrate);
+    EXPECT_DOUBLE_EQ(decision.frameRate, config.minFrameRate);
+    timeMs += HOLD_MS;
+    EXPECT_FALSE(controller.OnFeedback(CongestedSample(timeMs), decision));
+}
+
+/**
+ * @tc.name: OnFeedback_Recover_Test
+ * @tc.desc: Test clean samples restore the frame rate first, then the bitrate up to its maximum
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVEncoderRateControllerTest, OnFeedback_Recover_Test, TestSize.Level1)
+{
+    RateControlConfig config = RateControlConfig::CreateDefault(BITRATE, FRAME_RATE);
+    AVEncoderRateController controller(config);
+    RateDecision decision;
+    int64_t timeMs = 0;
+    while (controller.GetCurrent().frameRate > config.minFrameRate) {
+        controller.OnFeedback(CongestedSample(timeMs), decision);
+        timeMs += HOLD_MS;
+    }
+
+    uint32_t changes = 0;
+    bool bitrateRaisedEarly = false;
+    for (int32_t i = 0; i < 10000; i++) {
+        timeMs += SAMPLE_INTERVAL_MS;
+        if (!controller.OnFeedback(CleanSample(timeMs), decision)) {
+            continue;
+        }
+        changes++;
+        if (decision.frameRate < FRAME_RATE && decision.bitrate > config.minBitrate) {
+            bitrateRaisedEarly = true;
+        }
+    }
+    EXPECT_FALSE(bitrateRaisedEarly);
+    EXPECT_GT(changes, 0u);
+    EXPECT_EQ(decision.bitrate, BITRATE);
+    EXPECT_DOUBLE_EQ(decision.frameRate, FRAME_RATE);
+}
+
+/**
+ * @tc.name: OnFeedback_CleanRun_Test
+ * @tc.desc: Test one additive step needs a full run of clean samples, and congestion restarts the run
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVEncoderRateControllerTest, OnFeedback_CleanRun_Test, TestSize.Level1)
+{
+    RateControlConfig config = RateControlConfig::CreateDefault(BITRATE, FRAME_RATE);
+    AVEncoderRateController controller(config);
+    RateDecision decision;
+    int64_t timeMs = 0;
+    EXPECT_TRUE(controller.OnFeedback(CongestedSample(timeMs), decision));
+    int64_t afterCut = decision.bitrate;
+
+    for (uint32_t i = 1; i < config.cleanSamplesToIncrease; i++) {
+        timeMs += SAMPLE_INTERVAL_MS;
+        EXPECT_FALSE(controller.OnFeedback(CleanSample(timeMs), decision));
+    }
+    // inside the hold window, resets the run without cutting
+    timeMs += SAMPLE_INTERVAL_MS;
+    EXPECT_FALSE(controller.OnFeedback(CongestedSample(timeMs), decision));
+    for (uint32_t i = 1; i < config.cleanSamplesToIncrease; i++) {
+        timeMs += SAMPLE_INTERVAL_MS;
+        EXPECT_FALSE(controller.OnFeedback(CleanSample(timeMs), decision));
+    }
+    timeMs += SAMPLE_INTERVAL_MS;
+    EXPECT_TRUE(controller.OnFeedback(CleanSample(timeMs), decision));
+    EXPECT_EQ(decision.bitrate, afterCut + config.bitrateStep);
+
+    controller.Reset();
+    decision = controller.GetCurrent();
+    EXPECT_EQ(decision.bitrate, BITRATE);
+    EXPECT_DOUBLE_EQ(decision.frameRate, FRAME_RATE);
+}
+}  // namespace DistributedCollab
+}  // namespace OHOS
@@ -0,0 +1,234 @@
+/*
+* Copyright (c) 2025 Huawei Device Co., Ltd.
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "av_surface_buffer_cache_test.h"
+#include "dtbcollabmgr_log.h"
+#include "securec.h"
+#include <chrono>
+
+namespace OHOS {
+namespace DistributedCollab {
+
+namespace {
+    static const std::string TAG = "AVSurfaceBufferCacheTest";
+    using namespace testing;
+    using namespace testing::ext;
+    static constexpr int32_t FRAME_WIDTH = 64;
+    static constexpr int32_t FRAME_HEIGHT = 64;
+    static constexpr int32_t STRIDE_ALIGNMENT = 8;
+    static constexpr uint32_t FRAME_COUNT = 5;
+    static constexpr uint32_t PREBUFFER_DEPTH = 2;
+    static constexpr int32_t WAIT_STEP_MS = 10;
+    static constexpr int32_t WAIT_TIMEOUT_MS = 2000;
+    static constexpr int32_t IDLE_WAIT_MS = 100;
+
+    BufferRequestConfig FrameConfig()
+    {
+        BufferRequestConfig config = {
+            .width = FRAME_WIDTH,
+            .height = FRAME_HEIGHT,
+            .strideAlignment = STRIDE_ALIGNMENT,
+            .format = GRAPHIC_PIXEL_FMT_RGBA_8888,
+            .usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA,
+            .timeout = 0,
+        };
+        return config;
+    }
+
+    // plays the decoder, writes one frame filled with pattern into the cache input surface
+    uint32_t ProduceFrame(const sptr<Surface>& producer, uint8_t pattern)
+    {
+        sptr<SurfaceBuffer> buffer = nullptr;
+        int32_t fence = -1;
+        BufferRequestConfig config = FrameConfig();
+        if (producer->RequestBuffer(buffer, fence, config) != GSERROR_OK || buffer == nullptr) {
+            return 0;
+        }
+        uint32_t size = buffer->GetSize();
+        if (memset_s(buffer->GetVirAddr(), size, pattern, size) != EOK) {
+            producer->CancelBuffer(buffer);
+            return 0;
+        }
+        BufferFlushConfig flushConfig = { { 0, 0, FRAME_WIDTH, FRAME_HEIGHT }, 0 };
+        if (producer->FlushBuffer(buffer, -1, flushConfig) != GSERROR_OK) {
+            return 0;
+        }
+        return size;
+    }
+
+    bool WaitFrames(const sptr<FakeOutputConsumer>& consumer, uint32_t frames)
+    {
+        for (int32_t waited = 0; waited < WAIT_TIMEOUT_MS; waited += WAIT_STEP_MS) {
+            if (consumer->frames_ >= frames) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_STEP_MS));
+        }
+        return consumer->frames_ >= frames;
+    }
+}
+
+void FakeOutputConsumer::OnBufferAvailable()
+{
+    auto surface = surface_.promote();
+    if (surface == nullptr) {
+        return;
+    }
+    sptr<SurfaceBuffer> buffer = nullptr;
+    int32_t fence = -1;
+    int64_t timestamp = 0;
+    Rect damage;
+    if (surface->AcquireBuffer(buffer, fence, timestamp, damage) != GSERROR_OK || buffer == nullptr) {
+        return;
+    }
+    lastPattern_ = *static_cast<uint8_t*>(buffer->GetVirAddr());
+    bytes_ += buffer->GetSize();
+    frames_++;
+    surface->ReleaseBuffer(buffer, -1);
+}
+
+void AVSurfaceBufferCacheTest::SetUpTestCase()
+{
+    HILOGI("AVSurfaceBufferCacheTest::SetUpTestCase");
+}
+
+void AVSurfaceBufferCacheTest::TearDownTestCase()
+{
+    HILOGI("AVSurfaceBufferCacheTest::TearDownTestCase");
+}
+
+void AVSurfaceBufferCacheTest::SetUp()
+{
+    HILOGI("AVSurfaceBufferCacheTest::SetUp");
+}
+
+void AVSurfaceBufferCacheTest::TearDown()
+{
+    HILOGI("AVSurfaceBufferCacheTest::TearDown");
+}
+
+/**
+ * @tc.name: AddSurfaceBuffer_Test
+ * @tc.desc: Test AddSurfaceBuffer rejects empty buffers and buffers arriving while stopped
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVSurfaceBufferCacheTest, AddSurfaceBuffer_Test, TestSize.Level1)
+{
+    sptr<IConsumerSurface> output = IConsumerSurface::Create();
+    ASSERT_NE(output, nullptr);
+    sptr<Surface> outputProducer = Surface::CreateSurfaceAsProducer(output->GetProducer());
+    auto cache = std::make_shared<AVSurfaceBufferCache>(outputProducer, 0);
+    EXPECT_EQ(cache->AddSurfaceBuffer(nullptr), INVALID_PARAMETERS_ERR);
+
+    sptr<SurfaceBuffer> buffer = SurfaceBuffer::Create();
+    EXPECT_EQ(cache->AddSurfaceBuffer(buffer), INVALID_PARAMETERS_ERR);
+    EXPECT_TRUE(cache->cacheQueue_.empty());
+}
+
+/**
+ * @tc.name: SingleCopy_Test
+ * @tc.desc: Test every frame reaches the output surface with exactly one copy of its bytes
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVSurfaceBufferCacheTest, SingleCopy_Test, TestSize.Level1)
+{
+    sptr<IConsumerSurface> output = IConsumerSurface::Create();
+    ASSERT_NE(output, nullptr);
+    sptr<FakeOutputConsumer> consumer = sptr<FakeOutputConsumer>::MakeSptr(output);
+    output->RegisterConsumerListener(consumer);
+    sptr<Surface> outputProducer = Surface::CreateSurfaceAsProducer(output->GetProducer());
+
+    auto cache = std::make_shared<AVSurfaceBufferCache>(outputProducer, 0);
+    sptr<Surface> input = nullptr;
+    ASSERT_EQ(cache->GetSurface(input), ERR_OK);
+    cache->Init();
+    cache->Start();
+    sptr<Surface> decoder = Surface::CreateSurfaceAsProducer(input->GetProducer());
+
+    uint64_t producedBytes = 0;
+    for (uint32_t i = 1; i <= FRAME_COUNT; i++) {
+        uint32_t size = ProduceFrame(decoder, static_cast<uint8_t>(i));
+        ASSERT_GT(size, 0u);
+        producedBytes += size;
+        EXPECT_TRUE(WaitFrames(consumer, i));
+        EXPECT_EQ(consumer->lastPattern_.load(), static_cast<uint8_t>(i));
+    }
+    cache->Stop();
+    EXPECT_EQ(cache->flushedFrames_.load(), FRAME_COUNT);
+    EXPECT_EQ(cache->copiedBytes_.load(), producedBytes);
+    EXPECT_EQ(consumer->bytes_.load(), producedBytes);
+}
+
+/**
+ * @tc.name: Prebuffer_Test
+ * @tc.desc: Test frames are held until the prebuffer depth is reached, then forwarded in order
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVSurfaceBufferCacheTest, Prebuffer_Test, TestSize.Level1)
+{
+    sptr<IConsumerSurface> output = IConsumerSurface::Create();
+    ASSERT_NE(output, nullptr);
+    sptr<FakeOutputConsumer> consumer = sptr<FakeOutputConsumer>::MakeSptr(output);
+    output->RegisterConsumerListener(consumer);
+    sptr<Surface> outputProducer = Surface::CreateSurfaceAsProducer(output->GetProducer());
+
+    auto cache = std::make_shared<AVSurfaceBufferCache>(outputProducer, PREBUFFER_DEPTH);
+    sptr<Surface> input = nullptr;
+    ASSERT_EQ(cache->GetSurface(input), ERR_OK);
+    cache->Init();
+    cache->Start();
+    sptr<Surface> decoder = Surface::CreateSurfaceAsProducer(input->GetProducer());
+
+    uint8_t pattern = 1;
+    for (uint32_t i = 1; i < PREBUFFER_DEPTH; i++) {
+        ASSERT_GT(ProduceFrame(decoder, pattern++), 0u);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_WAIT_MS));
+    EXPECT_EQ(consumer->frames_.load(), 0u);
+
+    ASSERT_GT(ProduceFrame(decoder, pattern), 0u);
+    EXPECT_TRUE(WaitFrames(consumer, PREBUFFER_DEPTH));
+    EXPECT_EQ(consumer->lastPattern_.load(), pattern);
+    cache->Stop();
+    EXPECT_EQ(cache->copiedBytes_.load(), consumer->bytes_.load());
+}
+
+/**
+ * @tc.name: Stop_Test
+ * @tc.desc: Test Stop hands held buffers back to the decoder side
+ * @tc.type: FUNC
+ */
+HWTEST_F(AVSurfaceBufferCacheTest, Stop_Test, TestSize.Level1)
+{
+    sptr<IConsumerSurface> output = IConsumerSurface::Create();
+    ASSERT_NE(output, nullptr);
+    sptr<Surface> outputProducer = Surface::CreateSurfaceAsProducer(output->GetProducer());
+
+    auto cache = std::make_shared<AVSurfaceBufferCache>(outputProducer, PREBUFFER_DEPTH + 1);
+    sptr<Surface> input = nullptr;
+    ASSERT_EQ(cache->GetSurface(input), ERR_OK);
+    cache->Init();
+    cache->Start();
+    sptr<Surface> decoder = Surface::CreateSurfaceAsProducer(input->GetProducer());
+    for (uint32_t i = 0; i < PREBUFFER_DEPTH; i++) {
+        ASSERT_GT(ProduceFrame(decoder, static_cast<uint8_t>(i)), 0u);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_WAIT_MS));
+    cache->Stop();
+    EXPECT_TRUE(cache->cacheQueue_.empty());
+    EXPECT_EQ(cache->copiedBytes_.load(), 0u);
+    EXPECT_EQ(cache->lastIndex_, 0u);
+}
+}  // namespace DistributedCollab
+}  // namespace OHOS
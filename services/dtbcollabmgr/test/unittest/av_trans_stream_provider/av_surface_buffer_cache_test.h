@@ -0,0 +1,47 @@
+/*
+* Copyright (c) 2025 Huawei Device Co., Ltd.
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef AV_SURFACE_BUFFER_CACHE_TEST_H
+#define AV_SURFACE_BUFFER_CACHE_TEST_H
+
+#include <gtest/gtest.h>
+#include "av_surface_buffer_cache.h"
+
+namespace OHOS {
+namespace DistributedCollab {
+class AVSurfaceBufferCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+// consumer end of the app surface, counts what the cache flushed into it
+class FakeOutputConsumer : public IBufferConsumerListener {
+public:
+    explicit FakeOutputConsumer(const sptr<IConsumerSurface>& surface) : surface_(surface) {};
+    void OnBufferAvailable() override;
+
+    std::atomic<uint32_t> frames_ = 0;
+    std::atomic<uint64_t> bytes_ = 0;
+    std::atomic<uint8_t> lastPattern_ = 0;
+
+private:
+    wptr<IConsumerSurface> surface_;
+};
+}  // namespace DistributedCollab
+}  // namespace OHOS
+#endif
@@ -18,6 +18,7 @@
 #include "securec.h"
 #include "ichannel_listener_mock.h"
 #include <chrono>
+#include <future>
 #include <thread>
 
 namespace OHOS {
@@ -37,6 +38,9 @@ namespace {
     static constexpr int32_t NUM_1024 = 1024;
     static constexpr int32_t NUM_1 = 1;
     static constexpr int32_t NUM_200 = 200;
+    static constexpr int32_t SEND_BLOCK_MS = 50;
+    static constexpr int32_t PENDING_SEND_NUM = 2;
+    static constexpr int64_t US_PER_MS = 1000;
 }
 
 void ChannelManagerTest::SetUpTestCase()
@@ -849,6 +853,60 @@ HWTEST_F(ChannelManagerTest, SendStream_Success, TestSize.Level1)
     EXPECT_EQ(result, ERR_OK);
 }
 
+/**
+ * @tc.name: SendStream_PendingAndComplete
+ * @tc.desc: sends stay pending until the socket takes them, the completion reports post to sent latency
+ * @tc.type: FUNC
+ */
+HWTEST_F(ChannelManagerTest, SendStream_PendingAndComplete, TestSize.Level1)
+{
+    EXPECT_CALL(mockSoftbus, Socket(testing::_)).WillRepeatedly(testing::Return(NUM_1234));
+    EXPECT_CALL(mockSoftbus, Listen(testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(ERR_OK));
+    EXPECT_EQ(ChannelManager::GetInstance().Init(ownerName), ERR_OK);
+    ChannelPeerInfo peerInfo = { "peerName", "networkId" };
+    int32_t channelId = ChannelManager::GetInstance().CreateClientChannel("TestPendingChannel",
+        ChannelDataType::MESSAGE, peerInfo);
+    EXPECT_CALL(mockSoftbus, Bind(testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(ERR_OK));
+    EXPECT_EQ(ChannelManager::GetInstance().ConnectChannel(channelId), ERR_OK);
+
+    // the first send blocks in the socket like a congested link
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    EXPECT_CALL(mockSoftbus, SendStream(NUM_1234, testing::_, testing::_, testing::_))
+        .WillRepeatedly(testing::Invoke([released](int32_t, const StreamData*, const StreamData*,
+            const StreamFrameInfo*) {
+            released.wait();
+            return ERR_OK;
+        }));
+    std::promise<int64_t> lastLatency;
+    int32_t doneNum = 0;
+    auto onComplete = [&lastLatency, &doneNum](int32_t ret, int64_t sendLatencyUs) {
+        EXPECT_EQ(ret, ERR_OK);
+        if (++doneNum == PENDING_SEND_NUM) {
+            lastLatency.set_value(sendLatencyUs);
+        }
+    };
+    AVTransStreamDataExt extData;
+    extData.flag_ = AvCodecBufferFlag::AVCODEC_BUFFER_FLAG_CODEC_DATA;
+    extData.index_ = NUM_1;
+    extData.pts_ = NUM_200;
+    for (int32_t i = 0; i < PENDING_SEND_NUM; i++) {
+        auto streamData = std::make_shared<AVTransStreamData>(std::make_shared<AVTransDataBuffer>(NUM_1024), extData);
+        EXPECT_EQ(ChannelManager::GetInstance().SendStream(channelId, streamData, onComplete), ERR_OK);
+    }
+    EXPECT_EQ(ChannelManager::GetInstance().GetPendingSendCount(channelId),
+        static_cast<uint32_t>(PENDING_SEND_NUM));
+    std::this_thread::sleep_for(std::chrono::milliseconds(SEND_BLOCK_MS));
+    release.set_value();
+
+    auto latency = lastLatency.get_future();
+    ASSERT_EQ(latency.wait_for(std::chrono::milliseconds(SLEEP_FOR_INIT)), std::future_status::ready);
+    EXPECT_GE(latency.get(), SEND_BLOCK_MS * US_PER_MS);
+    EXPECT_EQ(ChannelManager::GetInstance().GetPendingSendCount(channelId), 0u);
+}
+
 /**
  * @tc.name: SendStream_InvalidChannelId
  * @tc.desc: Test for SendStream when channelId is invalid.
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "file_transfer_scheduler_test.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+
+#include "dtbcollabmgr_log.h"
+#include "softbus_error_code.h"
+#include "softbus_loopback.h"
+
+namespace OHOS {
+namespace DistributedCollab {
+namespace {
+    static const std::string TAG = "FileTransferSchedulerTest";
+    using namespace testing;
+    using namespace testing::ext;
+    using OHOS::DistributedSchedule::LoopbackConfig;
+    using OHOS::DistributedSchedule::SoftbusLoopback;
+    static constexpr int64_t WAIT_IDLE_MS = 5000;
+    static constexpr uint32_t CHUNK_SIZE = 4 * 1024;
+    static constexpr uint32_t FILE_SIZE = 8 * 1024;
+    static constexpr int32_t NUM_2 = 2;
+    static constexpr int32_t NUM_3 = 3;
+    static constexpr int32_t NUM_4 = 4;
+    static constexpr int32_t NUM_10 = 10;
+    static const char* SERVER_NAME = "FileTransferSchedulerTestServer";
+    static const char* CLIENT_NAME = "FileTransferSchedulerTestClient";
+    static const char* PKG_NAME = "dms";
+
+    std::shared_ptr<FileTransferScheduler> g_scheduler = nullptr;
+
+    void OnFile(int32_t socket, FileEvent* event)
+    {
+        auto scheduler = g_scheduler;
+        if (scheduler != nullptr) {
+            scheduler->OnFileEvent(socket, event);
+        }
+    }
+
+    ISocketListener g_clientListener = {
+        .OnFile = OnFile,
+    };
+    ISocketListener g_serverListener = {};
+
+    int32_t SendOnLoopback(const int32_t socketId, const std::vector<std::string>& sFiles,
+        const std::vector<std::string>& dFiles)
+    {
+        std::vector<const char*> src;
+        std::vector<const char*> dst;
+        for (size_t i = 0; i < sFiles.size(); ++i) {
+            src.push_back(sFiles[i].c_str());
+            dst.push_back(dFiles[i].c_str());
+        }
+        return SendFile(socketId, src.data(), dst.data(), static_cast<uint32_t>(src.size()));
+    }
+
+    std::string ReadAll(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+}
+
+void FileTransferSchedulerTest::SetUpTestCase()
+{
+    HILOGI("FileTransferSchedulerTest::SetUpTestCase");
+}
+
+void FileTransferSchedulerTest::TearDownTestCase()
+{
+    HILOGI("FileTransferSchedulerTest::TearDownTestCase");
+}
+
+void FileTransferSchedulerTest::SetUp()
+{
+    HILOGI("FileTransferSchedulerTest::SetUp");
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "file_transfer_scheduler_test";
+    std::filesystem::remove_all(root);
+    srcRoot_ = (root / "src").string();
+    recvRoot_ = (root / "recv").string();
+    std::filesystem::create_directories(srcRoot_);
+    LoopbackConfig config;
+    config.fileRecvRoot = recvRoot_;
+    config.fileChunkSize = CHUNK_SIZE;
+    SoftbusLoopback::GetInstance().SetConfig(config);
+    reports_.clear();
+}
+
+void FileTransferSchedulerTest::TearDown()
+{
+    HILOGI("FileTransferSchedulerTest::TearDown");
+    SoftbusLoopback::GetInstance().Reset();
+    g_scheduler = nullptr;
+    std::error_code err;
+    std::filesystem::remove_all(std::filesystem::path(srcRoot_).parent_path(), err);
+}
+
+std::vector<int32_t> FileTransferSchedulerTest::CreateLanes(int32_t count)
+{
+    SocketInfo serverInfo = {
+        .name = const_cast<char*>(SERVER_NAME),
+        .pkgName = const_cast<char*>(PKG_NAME),
+        .dataType = DATA_TYPE_FILE,
+    };
+    int32_t server = Socket(serverInfo);
+    EXPECT_EQ(Listen(server, nullptr, 0, &g_serverListener), SOFTBUS_OK);
+    std::vector<int32_t> socketIds;
+    for (int32_t i = 0; i < count; ++i) {
+        SocketInfo clientInfo = {
+            .name = const_cast<char*>(CLIENT_NAME),
+            .peerName = const_cast<char*>(SERVER_NAME),
+            .peerNetworkId = const_cast<char*>(SoftbusLoopback::LOOPBACK_NETWORK_ID),
+            .pkgName = const_cast<char*>(PKG_NAME),
+            .dataType = DATA_TYPE_FILE,
+        };
+        int32_t client = Socket(clientInfo);
+        EXPECT_EQ(Bind(client, nullptr, 0, &g_clientListener), SOFTBUS_OK);
+        socketIds.push_back(client);
+    }
+    return socketIds;
+}
+
+void FileTransferSchedulerTest::CreateFiles(int32_t count, uint32_t size, std::vector<std::string>& sFiles,
+    std::vector<std::string>& dFiles)
+{
+    for (int32_t i = 0; i < count; ++i) {
+        std::string name = "file_" + std::to_string(i) + ".bin";
+        std::string path = srcRoot_ + "/" + name;
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        for (uint32_t j = 0; j < size; ++j) {
+            out.put(static_cast<char>((i * NUM_10 + j) & 0xff));
+        }
+        sFiles.push_back(path);
+        dFiles.push_back("/collab/" + name);
+    }
+}
+
+std::shared_ptr<FileTransferScheduler> FileTransferSchedulerTest::CreateScheduler(
+    const std::vector<int32_t>& socketIds, const FileTransferConfig& config)
+{
+    g_scheduler = std::make_shared<FileTransferScheduler>(socketIds, SendOnLoopback,
+        [this](const FileInfo& info) {
+            std::lock_guard<std::mutex> lock(reportMutex_);
+            reports_.push_back(info);
+        }, config);
+    return g_scheduler;
+}
+
+std::vector<FileInfo> FileTransferSchedulerTest::GetReports()
+{
+    std::lock_guard<std::mutex> lock(reportMutex_);
+    return reports_;
+}
+
+/**
+ * @tc.name: Start_InvalidParam
+ * @tc.desc: Test for Start with mismatched file lists and without sockets
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileTransferSchedulerTest, Start_InvalidParam, TestSize.Level1)
+{
+    std::vector<std::string> sFiles;
+    std::vector<std::string> dFiles;
+    CreateFiles(NUM_2, FILE_SIZE, sFiles, dFiles);
+    auto scheduler = CreateScheduler(CreateLanes(1), FileTransferConfig());
+    EXPECT_EQ(scheduler->Start(sFiles, { dFiles[0] }), INVALID_PARAMETERS_ERR);
+
+    FileTransferScheduler noLane({}, SendOnLoopback, nullptr);
+    EXPECT_EQ(noLane.Start(sFiles, dFiles), NO_CONNECTED_SOCKET_ID);
+}
+
+/**
+ * @tc.name: Start_StripesWindowsOverSockets
+ * @tc.desc: Test that a batch is cut into windows sent over every socket
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileTransferSchedulerTest, Start_StripesWindowsOverSockets, TestSize.Level1)
+{
+    std::vector<std::string> sFiles;
+    std::vector<std::string> dFiles;
+    CreateFiles(NUM_10, FILE_SIZE, sFiles, dFiles);
+    std::vector<int32_t> socketIds = CreateLanes(NUM_2);
+    FileTransferConfig config;
+    config.maxFilesPerWindow = NUM_3;
+    std::set<int32_t> usedSockets;
+    std::mutex usedMutex;
+    g_scheduler = std::make_shared<FileTransferScheduler>(socketIds,
+        [&usedSockets, &usedMutex](const int32_t socketId, const std::vector<std::string>& src,
+            const std::vector<std::string>& dst) {
+            std::lock_guard<std::mutex> lock(usedMutex);
+            EXPECT_LE(src.size(), static_cast<size_t>(NUM_3));
+            usedSockets.insert(socketId);
+            return SendOnLoopback(socketId, src, dst);
+        },
+        [this](const FileInfo& info) {
+            std::lock_guard<std::mutex> lock(reportMutex_);
+            reports_.push_back(info);
+        }, config);
+    EXPECT_EQ(g_scheduler->Start(sFiles, dFiles), ERR_OK);
+    EXPECT_TRUE(SoftbusLoopback::GetInstance().WaitIdle(WAIT_IDLE_MS));
+
+    EXPECT_TRUE(g_scheduler->IsFinished());
+    EXPECT_EQ(usedSockets.size(), static_cast<size_t>(NUM_2));
+    auto reports = GetReports();
+    ASSERT_FALSE(reports.empty());
+    EXPECT_EQ(reports.back().commonInfo.eventType, ChannelFileEvent::SEND_FINISH);
+    ASSERT_TRUE(reports.back().sendInfo.has_value());
+    EXPECT_EQ(reports.back().sendInfo->bytesProcessed, static_cast<uint64_t>(NUM_10) * FILE_SIZE);
+    EXPECT_EQ(reports.back().sendInfo->bytesTotal, static_cast<uint64_t>(NUM_10) * FILE_SIZE);
+    auto stat = SoftbusLoopback::GetInstance().GetStat();
+    for (size_t i = 0; i < sFiles.size(); ++i) {
+        EXPECT_EQ(stat.fileSends[sFiles[i]], 1u);
+        EXPECT_EQ(ReadAll(recvRoot_ + dFiles[i]), ReadAll(sFiles[i]));
+    }
+}
+
+/**
+ * @tc.name: OnFileEvent_ResumeAfterError
+ * @tc.desc: Test that an interrupted window is resent without the files already acknowledged
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileTransferSchedulerTest, OnFileEvent_ResumeAfterError, TestSize.Level1)
+{
+    std::vector<std::string> sFiles;
+    std::vector<std::string> dFiles;
+    CreateFiles(NUM_4, FILE_SIZE, sFiles, dFiles);
+    LoopbackConfig loopbackConfig = SoftbusLoopback::GetInstance().GetConfig();
+    // fails in the middle of the third file
+    loopbackConfig.fileFailAfterBytes = NUM_2 * FILE_SIZE + CHUNK_SIZE;
+    SoftbusLoopback::GetInstance().SetConfig(loopbackConfig);
+    auto scheduler = CreateScheduler(CreateLanes(1), FileTransferConfig());
+    EXPECT_EQ(scheduler->Start(sFiles, dFiles), ERR_OK);
+    EXPECT_TRUE(SoftbusLoopback::GetInstance().WaitIdle(WAIT_IDLE_MS));
+
+    EXPECT_TRUE(scheduler->IsFinished());
+    auto reports = GetReports();
+    ASSERT_FALSE(reports.empty());
+    EXPECT_EQ(reports.back().commonInfo.eventType, ChannelFileEvent::SEND_FINISH);
+    auto stat = SoftbusLoopback::GetInstance().GetStat();
+    EXPECT_EQ(stat.fileSends[sFiles[0]], 1u);
+    EXPECT_EQ(stat.fileSends[sFiles[1]], 1u);
+    EXPECT_EQ(stat.fileSends[sFiles[NUM_2]], 2u);
+    EXPECT_EQ(stat.fileSends[sFiles[NUM_3]], 1u);
+    for (size_t i = 0; i < sFiles.size(); ++i) {
+        EXPECT_EQ(ReadAll(recvRoot_ + dFiles[i]), ReadAll(sFiles[i]));
+    }
+}
+
+/**
+ * @tc.name: OnFileEvent_RetryExhausted
+ * @tc.desc: Test that the transfer reports SEND_ERROR once a window runs out of retries
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileTransferSchedulerTest, OnFileEvent_RetryExhausted, TestSize.Level1)
+{
+    std::vector<std::string> sFiles;
+    std::vector<std::string> dFiles;
+    CreateFiles(NUM_2, FILE_SIZE, sFiles, dFiles);
+    LoopbackConfig loopbackConfig = SoftbusLoopback::GetInstance().GetConfig();
+    loopbackConfig.fileFailAfterBytes = FILE_SIZE + CHUNK_SIZE;
+    SoftbusLoopback::GetInstance().SetConfig(loopbackConfig);
+    FileTransferConfig config;
+    config.maxRetry = 0;
+    auto scheduler = CreateScheduler(CreateLanes(1), config);
+    EXPECT_EQ(scheduler->Start(sFiles, dFiles), ERR_OK);
+    EXPECT_TRUE(SoftbusLoopback::GetInstance().WaitIdle(WAIT_IDLE_MS));
+
+    EXPECT_TRUE(scheduler->IsFinished());
+    auto reports = GetReports();
+    ASSERT_FALSE(reports.empty());
+    const FileInfo& last = reports.back();
+    EXPECT_EQ(last.commonInfo.eventType, ChannelFileEvent::SEND_ERROR);
+    ASSERT_TRUE(last.errorInfo.has_value());
+    EXPECT_EQ(last.errorInfo->errorCode, SOFTBUS_TRANS_INVALID_SESSION_ID);
+    ASSERT_EQ(last.commonInfo.fileCnt, 1u);
+    EXPECT_EQ(last.commonInfo.fileList[0], sFiles[1]);
+}
+
+/**
+ * @tc.name: OnSocketClosed_MovesWindow
+ * @tc.desc: Test that windows of a failed socket move to the sockets still open
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileTransferSchedulerTest, OnSocketClosed_MovesWindow, TestSize.Level1)
+{
+    std::vector<std::string> sFiles;
+    std::vector<std::string> dFiles;
+    CreateFiles(NUM_4, FILE_SIZE, sFiles, dFiles);
+    std::vector<int32_t> socketIds = CreateLanes(NUM_2);
+    // the first socket goes away before anything is sent on it
+    Shutdown(socketIds[0]);
+    FileTransferConfig config;
+    config.maxFilesPerWindow = 1;
+    auto scheduler = CreateScheduler(socketIds, config);
+    EXPECT_EQ(scheduler->Start(sFiles, dFiles), ERR_OK);
+    EXPECT_TRUE(SoftbusLoopback::GetInstance().WaitIdle(WAIT_IDLE_MS));
+
+    EXPECT_TRUE(scheduler->IsFinished());
+    auto reports = GetReports();
+    ASSERT_FALSE(reports.empty());
+    EXPECT_EQ(reports.back().commonInfo.eventType, ChannelFileEvent::SEND_FINISH);
+    for (size_t i = 0; i < sFiles.size(); ++i) {
+        EXPECT_EQ(ReadAll(recvRoot_ + dFiles[i]), ReadAll(sFiles[i]));
+    }
+
+    scheduler->OnSocketClosed(socketIds[1]);
+    EXPECT_EQ(GetReports().size(), reports.size());
+}
+
+/**
+ * @tc.name: OnSocketClosed_AllSockets
+ * @tc.desc: Test that the transfer fails once every socket is closed
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileTransferSchedulerTest, OnSocketClosed_AllSockets, TestSize.Level1)
+{
+    std::vector<std::string> sFiles;
+    std::vector<std::string> dFiles;
+    CreateFiles(NUM_2, FILE_SIZE, sFiles, dFiles);
+    std::vector<int32_t> socketIds = CreateLanes(NUM_2);
+    FileTransferScheduler scheduler(socketIds, [](const int32_t socketId, const std::vector<std::string>& src,
+        const std::vector<std::string>& dst) { return ERR_OK; }, [this](const FileInfo& info) {
+            std::lock_guard<std::mutex> lock(reportMutex_);
+            reports_.push_back(info);
+        });
+    EXPECT_EQ(scheduler.Start(sFiles, dFiles), ERR_OK);
+    scheduler.OnSocketClosed(socketIds[0]);
+    EXPECT_FALSE(scheduler.IsFinished());
+    scheduler.OnSocketClosed(socketIds[1]);
+
+    EXPECT_TRUE(scheduler.IsFinished());
+    auto reports = GetReports();
+    ASSERT_FALSE(reports.empty());
+    EXPECT_EQ(reports.back().commonInfo.eventType, ChannelFileEvent::SEND_ERROR);
+    ASSERT_TRUE(reports.back().errorInfo.has_value());
+    EXPECT_EQ(reports.back().errorInfo->errorCode, NO_CONNECTED_SOCKET_ID);
+}
+} // namespace DistributedCollab
+} // namespace OHOS
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISTRIBUTED_COLLAB_FILE_TRANSFER_SCHEDULER_TEST_H
+#define DISTRIBUTED_COLLAB_FILE_TRANSFER_SCHEDULER_TEST_H
+
+#include "file_transfer_scheduler.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedCollab {
+class FileTransferSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    std::vector<int32_t> CreateLanes(int32_t count);
+    void CreateFiles(int32_t count, uint32_t size, std::vector<std::string>& sFiles,
+        std::vector<std::string>& dFiles);
+    std::shared_ptr<FileTransferScheduler> CreateScheduler(const std::vector<int32_t>& socketIds,
+        const FileTransferConfig& config);
+    std::vector<FileInfo> GetReports();
+
+    std::string srcRoot_;
+    std::string recvRoot_;
+    std::mutex reportMutex_;
+    std::vector<FileInfo> reports_;
+};
+} // namespace DistributedCollab
+} // namespace OHOS
+#endif
@@ -219,10 +219,15 @@ private:
     int32_t PostErrEndTask(const int32_t &result);
     int32_t PostAbilityRejectTask(const std::string &reason);
     int32_t PostEndTask();
+    void PostConnectResultTask(CollabStateType stateType, int32_t result, int32_t sessionId);
 
     int32_t ExeSrcGetPeerVersion();
     int32_t ExeSrcGetVersion();
     int32_t ExeSrcStart();
+    int32_t ConnectSinkDevice(CollabStateType stateType);
+    void OnSinkConnected(CollabStateType stateType, int32_t result, int32_t sessionId);
+    int32_t SendGetPeerVersionCmd();
+    int32_t SendSrcStartCmd();
     int32_t ExeStartAbility();
     int32_t ExeAbilityRejectError(const std::string &reason);
     int32_t ExeSinkPrepareResult(const int32_t &result);
@@ -55,7 +55,7 @@ public:
     int32_t CancleReleaseAbilityLink(const std::string &bundleName, const int32_t &pid);
     void NotifyWifiOpen();
 
-    void Init();
+    int32_t Init();
     void UnInit();
     void NotifyAllConnectDecision(std::string peerDeviceId, bool isSupport);
     void OnDataRecv(int32_t softbusSessionId, std::shared_ptr<DSchedDataBuffer> dataBuffer);
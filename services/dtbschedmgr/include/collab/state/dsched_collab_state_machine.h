@@ -16,6 +16,7 @@
 #ifndef OHOS_DSCHED_COLLAB_STATE_MACHINE_H
 #define OHOS_DSCHED_COLLAB_STATE_MACHINE_H
 
+#include "dfx/dms_state_trace_recorder.h"
 #include "dsched_collab_state.h"
 
 namespace OHOS {
@@ -33,6 +34,7 @@ private:
     std::shared_ptr<DSchedCollabState> CreateState(CollabStateType stateType);
     std::shared_ptr<DSchedCollabState> currentState_;
     std::weak_ptr<DSchedCollab> dCollab_;
+    DmsStateTracer tracer_ { DmsStateMachineType::COLLAB };
 };
 }  // namespace DistributedSchedule
 }  // namespace OHOS
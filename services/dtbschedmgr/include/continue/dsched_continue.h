@@ -16,10 +16,13 @@
 #ifndef OHOS_DSCHED_CONTINUE_H
 #define OHOS_DSCHED_CONTINUE_H
 
+#include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <thread>
 #include <string>
+#include <tuple>
 
 #include "ability_manager_client.h"
 #include "distributedWant/distributed_want.h"
@@ -50,22 +53,17 @@ public:
         : sourceDeviceId_(sourceDeviceId), sinkDeviceId_(sinkDeviceId), missionId_(missionId) {}
     ~DSchedContinueInfo() = default;
 
+    // field-wise, concatenated ids would let "ab" + "c" collide with "a" + "bc"
     bool operator == (const DSchedContinueInfo &index) const
     {
-        std::string compareInfo = this->sourceDeviceId_ + this->sourceBundleName_ + this->sinkDeviceId_ +
-            this->sinkBundleName_;
-        std::string otherCompareInfo = index.sourceDeviceId_ + index.sourceBundleName_ + index.sinkDeviceId_ +
-            index.sinkBundleName_;
-        return compareInfo.compare(otherCompareInfo) == 0;
+        return std::tie(this->sourceDeviceId_, this->sourceBundleName_, this->sinkDeviceId_, this->sinkBundleName_) ==
+            std::tie(index.sourceDeviceId_, index.sourceBundleName_, index.sinkDeviceId_, index.sinkBundleName_);
     }
 
     bool operator < (const DSchedContinueInfo &index) const
     {
-        std::string compareInfo = this->sourceDeviceId_ + this->sourceBundleName_ + this->sinkDeviceId_ +
-            this->sinkBundleName_;
-        std::string otherCompareInfo = index.sourceDeviceId_ + index.sourceBundleName_ + index.sinkDeviceId_ +
-            index.sinkBundleName_;
-        return compareInfo < otherCompareInfo;
+        return std::tie(this->sourceDeviceId_, this->sourceBundleName_, this->sinkDeviceId_, this->sinkBundleName_) <
+            std::tie(index.sourceDeviceId_, index.sourceBundleName_, index.sinkDeviceId_, index.sinkBundleName_);
     }
 
     std::string ToStringIgnoreMissionId() const
@@ -98,6 +96,24 @@ public:
     int32_t sinkMissionId_ = 0;
 };
 
+struct DSchedContinueInfoHash {
+    size_t operator()(const DSchedContinueInfo &info) const
+    {
+        size_t seed = 0;
+        for (const std::string *field : { &info.sourceDeviceId_, &info.sourceBundleName_, &info.sinkDeviceId_,
+            &info.sinkBundleName_ }) {
+            seed ^= std::hash<std::string>()(*field) + HASH_SEED_MAGIC + (seed << HASH_SEED_SHIFT_LEFT) +
+                (seed >> HASH_SEED_SHIFT_RIGHT);
+        }
+        return seed;
+    }
+
+private:
+    static constexpr size_t HASH_SEED_MAGIC = 0x9e3779b9;
+    static constexpr size_t HASH_SEED_SHIFT_LEFT = 6;
+    static constexpr size_t HASH_SEED_SHIFT_RIGHT = 2;
+};
+
 typedef enum {
     CONTINUE_SOURCE = 0,
     CONTINUE_SINK = 1
@@ -205,14 +221,19 @@ private:
     int32_t PostContinueSendTask(const OHOS::AAFwk::Want& want, int32_t callerUid, int32_t status,
         uint32_t accessToken);
     int32_t PostContinueDataTask(std::shared_ptr<DSchedContinueDataCmd> cmd);
+    int32_t PostContinueDataHeaderTask(std::shared_ptr<DSchedContinueDataHeaderCmd> cmd);
     int32_t PostNotifyCompleteTask(int32_t result);
     int32_t PostContinueEndTask(int32_t result);
+    void PostConnectResultTask(int32_t result, int32_t sessionId, std::shared_ptr<DistributedWantParams> wantParams);
 
     int32_t ExecuteContinueReq(std::shared_ptr<DistributedWantParams> wantParams);
+    int32_t ExecuteContinueReqConnected(int32_t sessionId, std::shared_ptr<DistributedWantParams> wantParams);
     int32_t ExecuteContinueAbility(int32_t appVersion);
     int32_t ExecuteContinueReply();
     int32_t ExecuteContinueSend(std::shared_ptr<ContinueAbilityData> data);
     int32_t ExecuteContinueData(std::shared_ptr<DSchedContinueDataCmd> cmd);
+    int32_t ExecuteContinueDataHeader(std::shared_ptr<DSchedContinueDataHeaderCmd> cmd);
+    bool UsePreparedHeader(std::shared_ptr<DSchedContinueDataCmd> cmd);
     int32_t UpdateElementInfo(std::shared_ptr<DSchedContinueDataCmd> cmd);
     void FindSinkContinueAbilityInfo(const std::string &srcModuleName, const std::string &srcContinueType,
         std::vector<DmsAbilityInfo> &dmsAbilityInfos, std::vector<DmsAbilityInfo> &result);
@@ -245,6 +266,7 @@ private:
     int32_t PackDataCmd(std::shared_ptr<DSchedContinueDataCmd>& cmd, const OHOS::AAFwk::Want& want,
         const AppExecFwk::AbilityInfo& abilityInfo, const CallerInfo& callerInfo,
         const AccountInfo& accountInfo);
+    void SendDataHeaderCmd(const DSchedContinueDataCmd& dataCmd);
     int32_t CheckStartPermission(std::shared_ptr<DSchedContinueDataCmd> cmd);
     int32_t PackEndCmd(std::shared_ptr<DSchedContinueEndCmd> cmd, int32_t result);
     int32_t PackReplyCmd(std::shared_ptr<DSchedContinueReplyCmd> cmd, int32_t replyCmd, int32_t appVersion,
@@ -289,6 +311,7 @@ private:
     std::mutex eventMutex_;
 
     int32_t version_ = 0;
+    std::atomic<int32_t> peerVersion_ { 0 };
     int32_t subServiceType_ = 0;
     int32_t continueByType_ = 0;
     int32_t direction_ = 0;
@@ -298,6 +321,12 @@ private:
     sptr<IRemoteObject> callback_ = nullptr;
     EventNotify eventData_;
     int32_t accountId_ = INVALID_ACCOUNT_ID;
+    int64_t saveDataBeginUs_ = 0;
+    int64_t sinkStartBeginUs_ = 0;
+    // sink side, what the data header already resolved, the data cmd is still checked on its own
+    std::shared_ptr<DSchedContinueDataHeaderCmd> preparedHeader_ = nullptr;
+    AppExecFwk::ElementName preparedElement_;
+    int32_t preparedPersistentId_ = 0;
 };
 }  // namespace DistributedSchedule
 }  // namespace OHOS
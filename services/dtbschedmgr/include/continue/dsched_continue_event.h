@@ -39,7 +39,8 @@ typedef enum {
     DSHCED_CONTINUE_SEND_DATA_EVENT = 5,
 
     DSCHED_CONTINUE_COMPLETE_EVENT = 6,
-    DSCHED_CONTINUE_END_EVENT = 7
+    DSCHED_CONTINUE_END_EVENT = 7,
+    DSCHED_CONTINUE_DATA_HEADER_EVENT = 8
 } DSchedContinueEventType;
 
 typedef enum {
@@ -48,6 +49,7 @@ typedef enum {
     DSCHED_CONTINUE_CMD_DATA = 2,
     DSCHED_CONTINUE_CMD_REPLY = 3,
     DSCHED_CONTINUE_CMD_END = 4,
+    DSCHED_CONTINUE_CMD_DATA_HEADER = 5,
 } DSchedContinueCommand;
 
 class DSchedContinueCmdBase {
@@ -89,12 +91,15 @@ public:
     int32_t Marshal(std::string &jsonStr);
     int32_t Unmarshal(const std::string &jsonStr);
 
-private:
+protected:
     bool MarshalInner(cJSON* rootValue);
+    bool MarshalCallerAndAccount(cJSON* rootValue);
     int32_t MarshalCallerInfo(std::string &jsonStr);
     int32_t MarshalAccountInfo(std::string &jsonStr);
-    int32_t UnmarshalParcel(const std::string &jsonStr);
+    int32_t UnmarshalBaseCmd(cJSON* rootValue);
+    int32_t UnmarshalParcel(cJSON* rootValue);
     bool UnmarshalWantParcel(cJSON* rootValue);
+    int32_t UnmarshalCallerAndAccount(cJSON* rootValue);
     int32_t UnmarshalCallerInfo(const std::string &jsonStr);
     int32_t UnmarshalCallerInfoExtra(const std::string &jsonStr);
     int32_t UnmarshalAccountInfo(const std::string &jsonStr);
@@ -109,6 +114,25 @@ public:
     AccountInfo accountInfo_;
 };
 
+/*
+ * Sent ahead of the data command when the peer supports it. It carries the
+ * target element, the want flags, the caller and the account of the data
+ * command but not the want parameters, so the sink resolves the target and
+ * warms it up while the data command is still in flight. The data command is
+ * permission checked on its own when it arrives.
+ */
+class DSchedContinueDataHeaderCmd : public DSchedContinueDataCmd {
+public:
+    int32_t Marshal(std::string &jsonStr);
+    int32_t Unmarshal(const std::string &jsonStr);
+
+    void FromDataCmd(const DSchedContinueDataCmd &dataCmd);
+    bool IsHeaderOf(const DSchedContinueDataCmd &dataCmd) const;
+
+private:
+    int32_t UnmarshalElement(cJSON* rootValue);
+};
+
 class DSchedContinueReplyCmd : public DSchedContinueCmdBase {
 public:
     int32_t Marshal(std::string &jsonStr);
@@ -19,6 +19,8 @@
 #include <map>
 #include <string>
 #include <atomic>
+#include <unordered_map>
+#include <vector>
 
 #include "dsched_data_buffer.h"
 #include "dsched_continue.h"
@@ -30,8 +32,9 @@
 namespace OHOS {
 namespace DistributedSchedule {
 namespace {
-constexpr int32_t MAX_CONCURRENT_SINK = 1;
-constexpr int32_t MAX_CONCURRENT_SOURCE = 1;
+constexpr int32_t MAX_CONCURRENT_SINK = 4;
+constexpr int32_t MAX_CONCURRENT_SOURCE = 4;
+constexpr int32_t MAX_CONCURRENT_PER_PEER = 2;
 constexpr int32_t CONTINUE_TIMEOUT = 10000;
 }
 class DSchedContinueManager {
@@ -55,9 +58,11 @@ public:
     void OnDataRecv(int32_t sessionId, std::shared_ptr<DSchedDataBuffer> dataBuffer);
     void OnShutdown(int32_t socket, bool isSelfCalled);
 
+    // with several continuations in progress, reports the one with the smallest DSchedContinueInfo
     int32_t GetContinueInfo(std::string &srcDeviceId, std::string &dstDeviceId);
     std::shared_ptr<DSchedContinue> GetDSchedContinueByWant(const OHOS::AAFwk::Want& want, int32_t missionId);
-    std::shared_ptr<DSchedContinue> GetDSchedContinueByDevId(const std::u16string& devId, int32_t missionId);
+    std::shared_ptr<DSchedContinue> GetDSchedContinueByDevId(const std::u16string& devId, int32_t missionId,
+        const std::string& callerBundleName);
     void NotifyTerminateContinuation(const int32_t missionId);
     int32_t ContinueStateCallbackRegister(StateCallbackInfo &stateCallbackInfo, sptr<IRemoteObject> callback);
     int32_t ContinueStateCallbackUnRegister(StateCallbackInfo &stateCallbackInfo);
@@ -80,9 +85,14 @@ private:
     void HandleDataRecv(int32_t sessionId, std::shared_ptr<DSchedDataBuffer> dataBuffer);
     void NotifyContinueDataRecv(int32_t sessionId, int32_t command, const std::string& jsonStr,
         std::shared_ptr<DSchedDataBuffer> dataBuffer);
+    std::shared_ptr<DSchedContinue> FindContinueBySession(int32_t sessionId, int32_t command,
+        const std::string& jsonStr);
+    int32_t UnmarshalBaseCmd(const std::string& jsonStr, DSchedContinueCmdBase& cmd);
     int32_t CheckContinuationLimit(const std::string& srcDeviceId, const std::string& dstDeviceId, int32_t &direction);
+    int32_t CheckPeerLimit(const std::string& peerDeviceId);
     void WaitAllConnectDecision(int32_t direction, const DSchedContinueInfo &info, int32_t timeout);
     void SetTimeOut(const DSchedContinueInfo& info, int32_t timeout);
+    void RemovePendingDecision(const DSchedContinueInfo& info);
     void RemoveTimeout(const DSchedContinueInfo& info);
     std::shared_ptr<StateCallbackData> FindStateCallbackData(StateCallbackInfo &stateCallbackInfo);
     void AddStateCallbackData(StateCallbackInfo &stateCallbackInfo, StateCallbackData &stateCallbackData);
@@ -99,7 +109,7 @@ public:
     std::map<StateCallbackInfo, StateCallbackData> stateCallbackCache_;
 private:
 #ifdef DMSFWK_ALL_CONNECT_MGR
-    static constexpr int32_t CONNECT_DECISION_WAIT_S = 60;
+    static constexpr int32_t CONNECT_DECISION_WAIT_MS = 60000;
 #endif
 
     std::thread eventThread_;
@@ -108,13 +118,13 @@ private:
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> eventHandler_;
     std::shared_ptr<DSchedContinueManager::SoftbusListener> softbusListener_;
 
-    std::map<DSchedContinueInfo, std::shared_ptr<DSchedContinue>> continues_;
+    std::unordered_map<DSchedContinueInfo, std::shared_ptr<DSchedContinue>, DSchedContinueInfoHash> continues_;
     std::mutex continueMutex_;
 
 #ifdef DMSFWK_ALL_CONNECT_MGR
     std::mutex connectDecisionMutex_;
-    std::condition_variable connectDecisionCond_;
-    std::map<std::string, std::atomic<bool>> peerConnectDecision_;
+    // continuations waiting for the all connect decision of their peer, keyed by peer device id
+    std::map<std::string, std::vector<DSchedContinueInfo>> pendingDecisions_;
 #endif
 
     std::atomic<int32_t> cntSink_ {0};
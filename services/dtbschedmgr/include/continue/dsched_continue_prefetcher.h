@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DSCHED_CONTINUE_PREFETCHER_H
+#define OHOS_DSCHED_CONTINUE_PREFETCHER_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "event_handler.h"
+#include "idata_listener.h"
+#include "single_instance.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+struct DSchedPrefetchStat {
+    uint64_t startedCount = 0;
+    uint64_t readyCount = 0;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t canceledCount = 0;
+    uint64_t timeoutCount = 0;
+    uint64_t skippedCount = 0;
+    uint64_t failedCount = 0;
+};
+
+/*
+ * Opens the continue session to a peer as soon as its focus broadcast shows
+ * the dock icon, so that a tap on the icon finds the session up and the sink
+ * skips the softbus bind. Each prefetch holds one reference on the session
+ * it opened until the peer broadcasts unfocus, the device goes away or the
+ * prefetch times out, and forgets it when that session shuts down. At most
+ * budget peers are prefetched at a time.
+ */
+class DSchedContinuePrefetcher {
+DECLARE_SINGLE_INSTANCE_BASE(DSchedContinuePrefetcher);
+public:
+    static constexpr int32_t DEFAULT_BUDGET = 2;
+    static constexpr int64_t DEFAULT_TIMEOUT_MS = 10000;
+
+    void Init();
+    void UnInit();
+    void SetEnabled(bool isEnabled);
+    bool IsEnabled();
+    void SetBudget(int32_t budget);
+    void SetTimeout(int64_t timeoutMs);
+    void OnFocused(const std::string &networkId, uint16_t bundleNameId);
+    void OnUnfocused(const std::string &networkId, uint16_t bundleNameId);
+    void OnContinueStart(const std::string &networkId);
+    void Cancel(const std::string &networkId);
+    void CancelAll();
+    void OnShutdown(int32_t sessionId);
+    DSchedPrefetchStat GetStat();
+    void Dump(std::string &result);
+
+private:
+    class SoftbusListener : public IDataListener {
+        void OnBind(int32_t socket, PeerSocketInfo info);
+        void OnShutdown(int32_t socket, bool isSelfCalled);
+        void OnDataRecv(int32_t socket, std::shared_ptr<DSchedDataBuffer> dataBuffer);
+    };
+
+    enum class PrefetchState : int32_t {
+        CONNECTING = 0,
+        READY,
+    };
+
+    struct PrefetchEntry {
+        PrefetchState state = PrefetchState::CONNECTING;
+        uint16_t bundleNameId = 0;
+        uint64_t generation = 0;
+        // the session holding our reference, valid once READY
+        int32_t sessionId = 0;
+        // canceled while connecting, the connect result is dropped
+        bool isCanceled = false;
+    };
+
+    DSchedContinuePrefetcher() = default;
+    ~DSchedContinuePrefetcher() = default;
+    void DoPrefetch(const std::string &networkId);
+    void OnPrefetchConnected(const std::string &networkId, int32_t ret, int32_t sessionId);
+    void OnTimeout(const std::string &networkId, uint64_t generation);
+    // returns the session whose reference the caller must drop, 0 when there is none
+    int32_t CancelLocked(const std::string &networkId);
+    void ReleaseSession(int32_t sessionId);
+
+    std::mutex prefetchMutex_;
+    bool isEnabled_ = false;
+    int32_t budget_ = DEFAULT_BUDGET;
+    int64_t timeoutMs_ = DEFAULT_TIMEOUT_MS;
+    uint64_t nextGeneration_ = 0;
+    std::map<std::string, PrefetchEntry> entries_;
+    DSchedPrefetchStat stat_;
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+    std::shared_ptr<SoftbusListener> softbusListener_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DSCHED_CONTINUE_PREFETCHER_H
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DSCHED_READINESS_WAITER_H
+#define OHOS_DSCHED_READINESS_WAITER_H
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "single_instance.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+/*
+ * Waits for an ability or window session of the continue sink to come up.
+ * The probe is checked again whenever a mission event of the awaited mission
+ * arrives, and on an exponential backoff as a fallback for devices where no
+ * event is delivered. Mission listeners call Notify with the mission id.
+ */
+class DSchedReadinessWaiter {
+DECLARE_SINGLE_INSTANCE_BASE(DSchedReadinessWaiter);
+public:
+    using Probe = std::function<bool()>;
+
+    // matches the events of every mission, for waits that do not know the id yet
+    static constexpr int32_t ANY_MISSION = -1;
+    static constexpr int64_t MIN_BACKOFF_MS = 10;
+    static constexpr int64_t MAX_BACKOFF_MS = 160;
+
+    bool Wait(int32_t missionId, const Probe& probe, int64_t timeoutMs);
+    void Notify(int32_t missionId);
+
+private:
+    struct Waiter {
+        int32_t missionId = ANY_MISSION;
+        bool isNotified = false;
+        std::promise<void> promise;
+    };
+
+    DSchedReadinessWaiter() = default;
+    ~DSchedReadinessWaiter() = default;
+    std::shared_ptr<Waiter> AddWaiter(int32_t missionId);
+    void RemoveWaiter(const std::shared_ptr<Waiter>& waiter);
+
+    std::mutex waiterMutex_;
+    std::list<std::shared_ptr<Waiter>> waiters_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DSCHED_READINESS_WAITER_H
@@ -16,6 +16,7 @@
 #ifndef OHOS_DSCHED_CONTINUE_STATE_MACHINE_H
 #define OHOS_DSCHED_CONTINUE_STATE_MACHINE_H
 
+#include "dfx/dms_state_trace_recorder.h"
 #include "dsched_continue_state.h"
 
 namespace OHOS {
@@ -33,6 +34,7 @@ private:
     std::shared_ptr<DSchedContinueState> CreateState(DSchedContinueStateType stateType);
     std::shared_ptr<DSchedContinueState> currentState_;
     std::weak_ptr<DSchedContinue> dContinue_;
+    DmsStateTracer tracer_ { DmsStateMachineType::CONTINUE };
 };
 }  // namespace DistributedSchedule
 }  // namespace OHOS
@@ -31,6 +31,8 @@ public:
     DSchedContinueStateType GetStateType() override;
 
 private:
+    int32_t DoContinueDataHeaderTask(std::shared_ptr<DSchedContinue> dContinue,
+        const AppExecFwk::InnerEvent::Pointer &event);
     int32_t DoContinueDataTask(std::shared_ptr<DSchedContinue> dContinue,
         const AppExecFwk::InnerEvent::Pointer &event);
     int32_t DoContinueErrorTask(std::shared_ptr<DSchedContinue> dContinue,
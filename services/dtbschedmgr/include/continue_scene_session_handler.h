@@ -16,6 +16,7 @@
 #ifndef OHOS_DISTRIBUTED_CONTINUE_SCENE_SESSION_HANDLER_H
 #define OHOS_DISTRIBUTED_CONTINUE_SCENE_SESSION_HANDLER_H
 
+#include <mutex>
 #include <string>
 
 #include "single_instance.h"
@@ -28,12 +29,13 @@ public:
 public:
     ContinueSceneSessionHandler() = default;
     virtual ~ContinueSceneSessionHandler() = default;
-    void UpdateContinueSessionId(const std::string& bundleName, const std::string& abilityName);
+    std::string UpdateContinueSessionId(const std::string& bundleName, const std::string& abilityName);
     std::string GetContinueSessionId() const;
     void ClearContinueSessionId();
     int32_t GetPersistentId(int32_t& persistentId);
     int32_t GetPersistentId(int32_t& persistentId, std::string &continueSessionId);
 private:
+    mutable std::mutex sessionIdMutex_;
     std::string continueSessionId_;
 };
 } // namespace DistributedSchedule
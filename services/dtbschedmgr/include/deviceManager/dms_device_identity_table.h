@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_DEVICE_IDENTITY_TABLE_H
+#define OHOS_DMS_DEVICE_IDENTITY_TABLE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OHOS {
+namespace DistributedSchedule {
+struct DmsDeviceIdentity {
+    std::string networkId;
+    std::string uuid;
+    std::string udid;
+};
+
+/*
+ * networkId <-> uuid <-> udid of the online devices. Writers copy the current
+ * snapshot, modify the copy and publish it, readers only load the published
+ * snapshot and never wait for a writer. Devices go on and off line rarely
+ * while the ids are looked up on every request, so the copy is cheap overall.
+ */
+class DmsDeviceIdentityTable {
+public:
+    /**
+     * Add or replace the identity of a device. Any entry sharing the networkId
+     * or the uuid is replaced, networkId and uuid must not be empty.
+     */
+    bool Update(const DmsDeviceIdentity& identity);
+    void RemoveByNetworkId(const std::string& networkId);
+    void Clear();
+
+    bool GetUuidByNetworkId(const std::string& networkId, std::string& uuid) const;
+    bool GetUdidByNetworkId(const std::string& networkId, std::string& udid) const;
+    bool GetNetworkIdByUuid(const std::string& uuid, std::string& networkId) const;
+    size_t Size() const;
+
+private:
+    using IdentityPtr = std::shared_ptr<const DmsDeviceIdentity>;
+    struct Snapshot {
+        std::unordered_map<std::string, IdentityPtr> byNetworkId;
+        std::unordered_map<std::string, IdentityPtr> byUuid;
+    };
+
+    std::shared_ptr<const Snapshot> Load() const;
+    void Publish(std::shared_ptr<const Snapshot> snapshot);
+    static void EraseLocked(Snapshot& snapshot, const IdentityPtr& identity);
+
+    std::mutex writeLock_;
+    std::shared_ptr<const Snapshot> snapshot_ = std::make_shared<const Snapshot>();
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_DEVICE_IDENTITY_TABLE_H
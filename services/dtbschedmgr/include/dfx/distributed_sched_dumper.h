@@ -32,6 +32,13 @@ private:
     static bool DumpDefault(std::string& result);
     static void ShowConnectRemoteAbility(std::string& result);
     static void ShowDuration(std::string& result);
+    static void ShowContinueBroadcast(std::string& result);
+    static void ShowLatency(std::string& result);
+    static void ResetLatency(std::string& result);
+    static void ShowResourceLease(std::string& result);
+    static void ShowStateTrace(std::string& result);
+    static void ResetStateTrace(std::string& result);
+    static void ShowComponents(std::string& result);
     static void ShowHelp(std::string& result);
     static void IllegalInput(std::string& result);
 };
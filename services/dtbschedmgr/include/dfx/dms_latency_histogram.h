@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_LATENCY_HISTOGRAM_H
+#define OHOS_DMS_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace DistributedSchedule {
+enum class DmsLatencyStage : int32_t {
+    CONNECT = 0,
+    PACK_START_CMD,
+    DATA_SAVE,
+    TRANSFER,
+    SINK_START,
+    STAGE_MAX,
+};
+
+struct DmsLatencySnapshot {
+    uint64_t count = 0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+    uint64_t max = 0;
+};
+
+/*
+ * Log-linear histogram of microsecond values. Values below SUB_BUCKET_COUNT
+ * get one bucket each, every following power of two is split into
+ * SUB_BUCKET_COUNT equal buckets, so the relative error stays below 1/16.
+ * Record only does relaxed atomic adds and never takes a lock.
+ */
+class DmsLatencyHistogram {
+public:
+    constexpr static uint32_t SUB_BUCKET_BITS = 4;
+    constexpr static uint32_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    constexpr static uint32_t MAX_VALUE_BITS = 32;
+    constexpr static uint64_t MAX_TRACKABLE_VALUE = (1ull << MAX_VALUE_BITS) - 1;
+    constexpr static size_t BUCKET_COUNT = SUB_BUCKET_COUNT * (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1);
+
+    void Record(uint64_t value);
+    void Reset();
+    uint64_t GetCount() const;
+    uint64_t GetMax() const;
+    uint64_t GetPercentile(double percentile) const;
+    DmsLatencySnapshot GetSnapshot() const;
+
+    static size_t GetBucketIndex(uint64_t value);
+    static uint64_t GetBucketUpperBound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_ {};
+    std::atomic<uint64_t> count_ { 0 };
+    std::atomic<uint64_t> max_ { 0 };
+};
+
+class DmsLatencyRegistry {
+public:
+    static DmsLatencyRegistry& GetInstance();
+    static int64_t GetNowUs();
+
+    void Record(DmsLatencyStage stage, uint64_t latencyUs);
+    void RecordSince(DmsLatencyStage stage, int64_t beginUs);
+    DmsLatencySnapshot GetSnapshot(DmsLatencyStage stage) const;
+    void Reset();
+    void Dump(std::string& result) const;
+
+private:
+    DmsLatencyRegistry() = default;
+    ~DmsLatencyRegistry() = default;
+
+    std::array<DmsLatencyHistogram, static_cast<size_t>(DmsLatencyStage::STAGE_MAX)> histograms_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_LATENCY_HISTOGRAM_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_STATE_TRACE_RECORDER_H
+#define OHOS_DMS_STATE_TRACE_RECORDER_H
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedSchedule {
+enum class DmsStateMachineType : int32_t {
+    CONTINUE = 0,
+    COLLAB,
+    TYPE_MAX,
+};
+
+struct DmsStateTransition {
+    // NO_STATE for the first state of a session
+    int32_t fromState = -1;
+    int32_t toState = -1;
+    // NO_EVENT when the state was not changed while executing an event
+    int32_t eventId = -1;
+    int64_t timeUs = 0;
+    // time spent in fromState
+    int64_t dwellUs = 0;
+};
+
+struct DmsStateSessionTrace {
+    DmsStateMachineType type = DmsStateMachineType::CONTINUE;
+    uint64_t traceId = 0;
+    int64_t beginUs = 0;
+    int64_t endUs = 0;
+    bool isTruncated = false;
+    std::vector<DmsStateTransition> transitions;
+};
+
+struct DmsStateDwellStat {
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+};
+
+/*
+ * Follows one state machine. Execute marks the event being handled, every
+ * UpdateState adds a transition stamped with that event, and the trace is
+ * handed to the recorder when the tracer is finished or destroyed. Used from
+ * the event handler thread of its state machine only.
+ */
+class DmsStateTracer {
+public:
+    constexpr static int32_t NO_STATE = -1;
+    constexpr static int32_t NO_EVENT = -1;
+
+    explicit DmsStateTracer(DmsStateMachineType type);
+    ~DmsStateTracer();
+
+    void BeginEvent(int32_t eventId);
+    void EndEvent();
+    void OnStateChanged(int32_t toState);
+    void Finish();
+
+private:
+    DmsStateSessionTrace trace_;
+    int32_t currentState_ = NO_STATE;
+    int64_t enterUs_ = 0;
+    int32_t eventId_ = NO_EVENT;
+    bool isFinished_ = false;
+};
+
+/*
+ * Keeps the traces of the last MAX_SESSION_COUNT sessions and the dwell time
+ * of every state over all sessions, for hidumper.
+ */
+class DmsStateTraceRecorder {
+public:
+    constexpr static size_t MAX_SESSION_COUNT = 32;
+    constexpr static size_t MAX_TRANSITION_COUNT = 64;
+
+    static DmsStateTraceRecorder& GetInstance();
+    static int64_t GetNowUs();
+
+    uint64_t GenerateTraceId();
+    void RecordDwell(DmsStateMachineType type, int32_t state, int64_t dwellUs);
+    void Commit(DmsStateSessionTrace&& trace);
+    std::vector<DmsStateSessionTrace> GetTraces() const;
+    DmsStateDwellStat GetDwellStat(DmsStateMachineType type, int32_t state) const;
+    void Reset();
+    void Dump(std::string& result) const;
+
+private:
+    DmsStateTraceRecorder() = default;
+    ~DmsStateTraceRecorder() = default;
+
+    mutable std::mutex mutex_;
+    uint64_t nextTraceId_ = 1;
+    std::deque<DmsStateSessionTrace> traces_;
+    std::map<std::pair<DmsStateMachineType, int32_t>, DmsStateDwellStat> dwellStats_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_STATE_TRACE_RECORDER_H
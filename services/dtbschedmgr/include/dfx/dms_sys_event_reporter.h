@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_SYS_EVENT_REPORTER_H
+#define OHOS_DMS_SYS_EVENT_REPORTER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedSchedule {
+struct DmsSysEventParam {
+    enum class Type : int32_t {
+        INT32 = 0,
+        INT64 = 1,
+        STRING = 2,
+    };
+
+    std::string name;
+    Type type = Type::INT32;
+    int64_t intValue = 0;
+    std::string strValue;
+};
+
+struct DmsSysEvent {
+    std::string domain;
+    std::string eventName;
+    int32_t eventType = 0;
+    std::vector<DmsSysEventParam> params;
+
+    DmsSysEvent() = default;
+    DmsSysEvent(const std::string& domain, const std::string& eventName, int32_t eventType)
+        : domain(domain), eventName(eventName), eventType(eventType) {}
+
+    void AddParams() {}
+
+    template<typename V, typename... Types>
+    void AddParams(const std::string& key, const V& value, const Types&... keyValues)
+    {
+        AddParam(key, value);
+        AddParams(keyValues...);
+    }
+
+    void AddParam(const std::string& key, const std::string& value)
+    {
+        params.push_back({ key, DmsSysEventParam::Type::STRING, 0, value });
+    }
+
+    void AddParam(const std::string& key, const char* value)
+    {
+        params.push_back({ key, DmsSysEventParam::Type::STRING, 0, value == nullptr ? "" : value });
+    }
+
+    template<typename V, typename std::enable_if<std::is_integral<V>::value, int>::type = 0>
+    void AddParam(const std::string& key, V value)
+    {
+        DmsSysEventParam::Type type = (sizeof(V) <= sizeof(int32_t) && std::is_signed<V>::value) ?
+            DmsSysEventParam::Type::INT32 : DmsSysEventParam::Type::INT64;
+        params.push_back({ key, type, static_cast<int64_t>(value), "" });
+    }
+};
+
+class IDmsSysEventSink {
+public:
+    virtual ~IDmsSysEventSink() = default;
+    virtual void Write(const std::vector<DmsSysEvent>& events) = 0;
+};
+
+/*
+ * Bounded multi-producer multi-consumer ring. Each cell carries a sequence
+ * number, so producers and the consumer only contend on one atomic index.
+ */
+template<typename T>
+class DmsBoundedQueue {
+public:
+    explicit DmsBoundedQueue(size_t capacity)
+    {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool Push(T&& data)
+    {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(data);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(T& data)
+    {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        data = std::move(cell->data);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t Capacity() const
+    {
+        return mask_ + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    std::atomic<size_t> enqueuePos_ { 0 };
+    std::atomic<size_t> dequeuePos_ { 0 };
+};
+
+/*
+ * Moves HiSysEvent formatting and writing off the calling thread. Report only
+ * captures the fields and pushes them into the queue; a single low priority
+ * thread drains the queue in batches into the sink. Events are dropped and
+ * counted when the queue is full.
+ */
+class DmsSysEventReporter {
+public:
+    constexpr static size_t DEFAULT_QUEUE_CAPACITY = 256;
+    constexpr static size_t DEFAULT_BATCH_SIZE = 16;
+    constexpr static int32_t DRAIN_INTERVAL_MS = 200;
+
+    static DmsSysEventReporter& GetInstance();
+
+    explicit DmsSysEventReporter(const std::shared_ptr<IDmsSysEventSink>& sink,
+        size_t capacity = DEFAULT_QUEUE_CAPACITY, size_t batchSize = DEFAULT_BATCH_SIZE);
+    ~DmsSysEventReporter();
+
+    void SetSink(const std::shared_ptr<IDmsSysEventSink>& sink);
+    int32_t Report(DmsSysEvent&& event);
+
+    template<typename... Types>
+    int32_t Report(const std::string& domain, const std::string& eventName, int32_t eventType,
+        const Types&... keyValues)
+    {
+        DmsSysEvent event(domain, eventName, eventType);
+        event.AddParams(keyValues...);
+        return Report(std::move(event));
+    }
+
+    bool Flush(int32_t timeoutMs);
+    void Stop();
+    uint64_t GetReportedCount() const;
+    uint64_t GetDroppedCount() const;
+
+private:
+    void StartLocked();
+    void Run();
+    size_t DrainBatch();
+
+    DmsBoundedQueue<DmsSysEvent> queue_;
+    size_t batchSize_ = DEFAULT_BATCH_SIZE;
+    std::atomic<uint64_t> enqueuedCount_ { 0 };
+    std::atomic<uint64_t> reportedCount_ { 0 };
+    std::atomic<uint64_t> droppedCount_ { 0 };
+    std::atomic<size_t> pendingCount_ { 0 };
+
+    std::mutex sinkMutex_;
+    std::shared_ptr<IDmsSysEventSink> sink_;
+
+    std::mutex threadMutex_;
+    std::condition_variable wakeCon_;
+    std::condition_variable drainedCon_;
+    std::thread reporterThread_;
+    std::atomic<bool> isRunning_ { false };
+    std::atomic<bool> isStopped_ { false };
+    std::atomic<bool> flushRequested_ { false };
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_SYS_EVENT_REPORTER_H
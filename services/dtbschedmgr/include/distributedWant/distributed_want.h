@@ -114,6 +114,8 @@ public:
      */
     DistributedWant(const DistributedWant& want);
     DistributedWant& operator=(const DistributedWant&);
+    DistributedWant(DistributedWant&& want);
+    DistributedWant& operator=(DistributedWant&& want);
     DistributedWant(const AAFwk::Want& want);
 
     /**
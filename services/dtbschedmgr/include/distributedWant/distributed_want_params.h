@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -44,13 +45,52 @@ public:
     DistributedUnsupportedData& operator=(DistributedUnsupportedData&& other);
 };
 
+/*
+ * Parameter map shared by the copies of a DistributedWantParams. A copy only
+ * takes a reference, the first mutation of a shared map copies the map for the
+ * mutated object. The boxed values are immutable and are never copied, nested
+ * params are shared the same way through their wrappers.
+ */
+class DistributedParamMap {
+public:
+    using Map = std::map<std::string, sptr<AAFwk::IInterface>>;
+    using const_iterator = Map::const_iterator;
+    using const_reverse_iterator = Map::const_reverse_iterator;
+
+    DistributedParamMap() = default;
+
+    const Map& Get() const;
+    // the map of this object alone, copied first if another object shares it
+    Map& Mutable();
+    bool SharesWith(const DistributedParamMap& other) const;
+
+    sptr<AAFwk::IInterface>& operator[](const std::string& key);
+    size_t erase(const std::string& key);
+    void clear();
+
+    const_iterator find(const std::string& key) const;
+    size_t count(const std::string& key) const;
+    size_t size() const;
+    bool empty() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    const_reverse_iterator rbegin() const;
+
+private:
+    std::shared_ptr<Map> map_;
+};
+
 class DistributedWantParams final : public Parcelable {
 public:
     DistributedWantParams() = default;
     DistributedWantParams(const DistributedWantParams& wantParams);
+    DistributedWantParams(DistributedWantParams&& wantParams) noexcept;
     inline ~DistributedWantParams()
     {}
     DistributedWantParams& operator=(const DistributedWantParams& other);
+    DistributedWantParams& operator=(DistributedWantParams&& other) noexcept;
 
     bool operator==(const DistributedWantParams& other);
 
@@ -84,7 +124,7 @@ public:
 
     static DistributedWantParams* Unmarshalling(Parcel& parcel);
 
-    AAFwk::WantParams ToWantParams();
+    AAFwk::WantParams ToWantParams() const;
 
 private:
     static std::string BooleanQueryToStr(const sptr<AAFwk::IInterface> iIt);
@@ -167,7 +207,6 @@ private:
     bool ReadUnsupportedData(Parcel& parcel, const std::string& key, int type);
 
     bool NewArrayData(AAFwk::IArray* source, sptr<AAFwk::IArray>& dest);
-    bool NewParams(const DistributedWantParams& source, DistributedWantParams& dest);
 
 private:
     enum {
@@ -212,7 +251,7 @@ private:
     static std::map<int, InterfaceQueryEqualsFunc> interfaceQueryEqualsMap;
 
     // inner use function
-    std::map<std::string, sptr<AAFwk::IInterface>> params_;
+    DistributedParamMap params_;
     std::map<std::string, int> fds_;
     std::vector<DistributedUnsupportedData> cachedUnsupportedData_;
 };
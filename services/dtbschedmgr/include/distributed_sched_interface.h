@@ -114,6 +114,11 @@ public:
     {
         return 0;
     }
+    virtual int32_t QueryDSchedEventInfo(const DSchedEventQuery &query, std::vector<EventNotify> &events,
+        uint64_t &nextCursor)
+    {
+        return 0;
+    }
 #ifdef SUPPORT_DISTRIBUTED_MISSION_MANAGER
     virtual int32_t StartSyncRemoteMissions(const std::string& devId, bool fixConflict, int64_t tag,
         int32_t callingUid) = 0;
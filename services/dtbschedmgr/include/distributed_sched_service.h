@@ -35,6 +35,8 @@
 #include "distributed_sched_continuation.h"
 #include "dms_callback_task.h"
 #include "dsched_collaborate_callback_mgr.h"
+#include "dsched_connection_registry.h"
+#include "dsched_event_history.h"
 #include "idms_interactive_adapter.h"
 #ifdef SUPPORT_DISTRIBUTED_MISSION_MANAGER
 #include "mission/distributed_mission_focused_listener.h"
@@ -167,11 +169,14 @@ public:
     int32_t UnRegisterMissionListener(const std::u16string& devId, const sptr<IRemoteObject>& obj) override;
     int32_t SetMissionContinueState(int32_t missionId, const AAFwk::ContinueState &state, int32_t callingUid) override;
     void OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId) override;
+    void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string& deviceId) override;
 #endif
     int32_t RegisterDSchedEventListener(const DSchedEventType& type, const sptr<IRemoteObject>& obj) override;
     int32_t UnRegisterDSchedEventListener(const DSchedEventType& type, const sptr<IRemoteObject>& obj) override;
     int32_t GetContinueInfo(std::string& dstNetworkId, std::string& srcNetworkId) override;
     int32_t GetDSchedEventInfo(const DSchedEventType &type, std::vector<EventNotify> &events) override;
+    int32_t QueryDSchedEventInfo(const DSchedEventQuery &query, std::vector<EventNotify> &events,
+        uint64_t &nextCursor) override;
     void ProcessConnectDied(const sptr<IRemoteObject>& connect);
     void ProcessDeviceOffline(const std::string& deviceId);
     void DumpConnectInfo(std::string& info);
@@ -243,6 +248,8 @@ private:
     bool Init();
     void InitDataShareManager();
     void InitMissionManager();
+    void RegisterComponents();
+    void StartComponents();
     void InitCommonEventListener();
     int32_t GetCallerInfo(const std::string &localDeviceId, int32_t callerUid, uint32_t accessToken,
         CallerInfo &callerInfo);
@@ -264,6 +271,9 @@ private:
     int32_t CheckDistributedConnectLocked(const CallerInfo& callerInfo) const;
     void DecreaseConnectLocked(int32_t uid);
     static int32_t GetUidLocked(const std::list<ConnectAbilitySession>& sessionList);
+    static std::set<std::string> GetSessionsDeviceIds(const std::list<ConnectAbilitySession>& sessionsList);
+    static std::set<std::string> GetConnectInfoDeviceIds(const ConnectInfo& connectInfo);
+    static std::set<std::string> GetCallInfoDeviceIds(const CallInfo& callInfo);
     int32_t TryConnectRemoteAbility(const OHOS::AAFwk::Want& want,
         const sptr<IRemoteObject>& connect, const CallerInfo& callerInfo);
     int32_t ContinueLocalMissionDealFreeInstall(OHOS::AAFwk::Want& want, int32_t missionId,
@@ -338,11 +348,15 @@ private:
 private:
     std::shared_ptr<DSchedContinuation> dschedContinuation_;
     std::shared_ptr<DSchedCollaborationCallbackMgr> collaborateCbMgr_;
-    std::map<sptr<IRemoteObject>, std::list<ConnectAbilitySession>> distributedConnectAbilityMap_;
-    std::map<sptr<IRemoteObject>, ConnectInfo> connectAbilityMap_;
+    DSchedEventHistory eventHistory_;
+    // connect->sessions to remote devices, indexed by destination device
+    DSchedConnectionRegistry<std::list<ConnectAbilitySession>> distributedConnectAbilityMap_ {
+        GetSessionsDeviceIds };
+    // connect from a remote caller, indexed by source device
+    DSchedConnectionRegistry<ConnectInfo> connectAbilityMap_ { GetConnectInfoDeviceIds };
     std::unordered_map<int32_t, uint32_t> trackingUidMap_;
+    // guards trackingUidMap_, taken before any registry shard
     std::mutex distributedLock_;
-    std::mutex connectLock_;
     sptr<IRemoteObject::DeathRecipient> connectDeathRecipient_;
 #ifdef SUPPORT_DISTRIBUTED_FORM_SHARE
     sptr<IRemoteObject::DeathRecipient> formMgrDeathRecipient_;
@@ -354,13 +368,11 @@ private:
     sptr<IRemoteObject::DeathRecipient> callerDeathRecipient_;
     std::shared_ptr<DmsCallbackTask> dmsCallbackTask_;
     std::shared_ptr<AppExecFwk::EventHandler> componentChangeHandler_;
-    std::mutex callerLock_;
-    std::map<sptr<IRemoteObject>, std::list<ConnectAbilitySession>> callerMap_;
+    DSchedConnectionRegistry<std::list<ConnectAbilitySession>> callerMap_ { GetSessionsDeviceIds };
     sptr<IRemoteObject::DeathRecipient> callerDeathRecipientForLocalDevice_;
     std::mutex observerLock_;
     std::map<sptr<IRemoteObject>, ObserverInfo> observerMap_;
-    std::mutex callLock_;
-    std::map<sptr<IRemoteObject>, CallInfo> callMap_;
+    DSchedConnectionRegistry<CallInfo> callMap_ { GetCallInfoDeviceIds };
     std::mutex tokenMutex_;
     std::mutex registerMutex_;
     std::atomic<int32_t> token_ {0};
@@ -417,7 +429,7 @@ public:
         return targetComponent_;
     }
 
-    bool IsSameCaller(const CallerInfo& callerInfo);
+    bool IsSameCaller(const CallerInfo& callerInfo) const;
     void AddElement(const AppExecFwk::ElementName& element);
 
 private:
@@ -72,9 +72,11 @@ private:
     int32_t GetRemoteMissionSnapshotInfoInner(MessageParcel& data, MessageParcel& reply);
     int32_t RegisterMissionListenerInner(MessageParcel& data, MessageParcel& reply);
     int32_t RegisterDSchedEventListenerInner(MessageParcel& data, MessageParcel& reply);
+    int32_t RegisterDSchedEventListenersInner(MessageParcel& data, MessageParcel& reply);
     int32_t UnRegisterDSchedEventListenerInner(MessageParcel& data, MessageParcel& reply);
     int32_t GetContinueInfoInner(MessageParcel& data, MessageParcel& reply);
     int32_t GetDSchedEventInfoInner(MessageParcel& data, MessageParcel& reply);
+    int32_t QueryDSchedEventInfoInner(MessageParcel& data, MessageParcel& reply);
     int32_t RegisterOnListenerInner(MessageParcel& data, MessageParcel& reply);
     int32_t RegisterOffListenerInner(MessageParcel& data, MessageParcel& reply);
     int32_t UnRegisterMissionListenerInner(MessageParcel& data, MessageParcel& reply);
@@ -93,6 +93,8 @@ enum class IDSchedInterfaceCode : uint32_t {
     GET_CONTINUE_INFO = 264,
     GET_DSCHED_EVENT_INFO = 265,
     DSCHED_START_DEXTENSION = 266,
+    REGISTER_DSCHED_EVENT_LISTENERS = 267,
+    QUERY_DSCHED_EVENT_INFO = 268,
 
     // request code for set continue state
     SET_MISSION_CONTINUE_STATE = 300,
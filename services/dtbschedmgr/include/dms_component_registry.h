@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_COMPONENT_REGISTRY_H
+#define OHOS_DMS_COMPONENT_REGISTRY_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string DMS_COMPONENT_SOFTBUS_CHANNEL = "softbus_channel";
+const std::string DMS_COMPONENT_MISSION = "mission";
+const std::string DMS_COMPONENT_CONTINUE = "continue";
+const std::string DMS_COMPONENT_COLLAB = "collab";
+
+const std::string DMS_TRIGGER_SA_START = "sa start";
+const std::string DMS_TRIGGER_PEER_DATA = "peer data";
+const std::string DMS_TRIGGER_CONTINUE_MISSION = "continue mission";
+const std::string DMS_TRIGGER_COLLAB_MISSION = "collab mission";
+}
+
+enum class DmsComponentState : int32_t {
+    REGISTERED = 0,
+    STARTING,
+    STARTED,
+    FAILED,
+};
+
+struct DmsComponentInfo {
+    std::string name;
+    DmsComponentState state = DmsComponentState::REGISTERED;
+    std::vector<std::string> deps;
+    // entry point that caused the last start
+    std::string trigger;
+    int64_t startCostUs = 0;
+    uint32_t startCount = 0;
+};
+
+/*
+ * Starts the service subsystems on first use instead of at sa start. Every
+ * component declares the components it depends on, Ensure starts those first
+ * and then the component itself, once, and records which entry point caused
+ * the start and how long the init took, for hidumper.
+ */
+class DmsComponentRegistry {
+public:
+    using InitFunc = std::function<bool()>;
+    using UnInitFunc = std::function<void()>;
+
+    static DmsComponentRegistry& GetInstance();
+    static int64_t GetNowUs();
+
+    DmsComponentRegistry() = default;
+    ~DmsComponentRegistry() = default;
+
+    int32_t Register(const std::string& name, const std::vector<std::string>& deps, InitFunc init,
+        UnInitFunc unInit = nullptr);
+    // returns true once the component and all of its dependencies are started
+    bool Ensure(const std::string& name, const std::string& trigger);
+    // stops the started components depending on name first
+    void Stop(const std::string& name);
+    bool IsStarted(const std::string& name) const;
+    std::vector<std::string> GetStartedComponents() const;
+    bool GetComponentInfo(const std::string& name, DmsComponentInfo& info) const;
+    void Dump(std::string& result) const;
+    void Reset();
+
+private:
+    struct Component {
+        DmsComponentInfo info;
+        InitFunc init;
+        UnInitFunc unInit;
+    };
+
+    static const char* GetStateName(DmsComponentState state);
+
+    // init funcs of a component may ensure other components on the same thread
+    mutable std::recursive_mutex componentMutex_;
+    std::map<std::string, Component> components_;
+    std::vector<std::string> startOrder_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_COMPONENT_REGISTRY_H
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DSCHED_CONNECTION_REGISTRY_H
+#define OHOS_DSCHED_CONNECTION_REGISTRY_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "iremote_object.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+/**
+ * Connections keyed by the caller's remote object, spread over shards that are
+ * locked independently, with a secondary index from device id to the
+ * connections that involve that device. Lookups by connect lock one shard,
+ * device offline handling visits only the indexed connections.
+ *
+ * Lock order is shard then index. Callbacks run under the shard lock of their
+ * entry and must not call back into the registry.
+ */
+template<typename Value>
+class DSchedConnectionRegistry {
+public:
+    using DeviceIdsFunc = std::function<std::set<std::string>(const Value& value)>;
+    // returns false to drop the entry
+    using Updater = std::function<bool(Value& value)>;
+    using Predicate = std::function<bool(const sptr<IRemoteObject>& connect, const Value& value)>;
+    using Visitor = std::function<void(const sptr<IRemoteObject>& connect, const Value& value)>;
+    using Entry = std::pair<sptr<IRemoteObject>, Value>;
+
+    explicit DSchedConnectionRegistry(const DeviceIdsFunc& deviceIdsFunc) : deviceIdsFunc_(deviceIdsFunc) {}
+    ~DSchedConnectionRegistry() = default;
+
+    bool Find(const sptr<IRemoteObject>& connect, Value& value) const
+    {
+        const Shard& shard = GetShard(connect);
+        std::lock_guard<std::mutex> autoLock(shard.lock);
+        auto iter = shard.entries.find(connect);
+        if (iter == shard.entries.end()) {
+            return false;
+        }
+        value = iter->second;
+        return true;
+    }
+
+    bool Contains(const sptr<IRemoteObject>& connect) const
+    {
+        const Shard& shard = GetShard(connect);
+        std::lock_guard<std::mutex> autoLock(shard.lock);
+        return shard.entries.find(connect) != shard.entries.end();
+    }
+
+    // returns false and keeps the old value when the connect is already there
+    bool Emplace(const sptr<IRemoteObject>& connect, const Value& value)
+    {
+        Shard& shard = GetShard(connect);
+        std::lock_guard<std::mutex> autoLock(shard.lock);
+        auto [iter, isInserted] = shard.entries.emplace(connect, value);
+        if (isInserted) {
+            Reindex(connect, {}, deviceIdsFunc_(iter->second));
+        }
+        return isInserted;
+    }
+
+    void Assign(const sptr<IRemoteObject>& connect, const Value& value)
+    {
+        Update(connect, [&value](Value& entry) {
+            entry = value;
+            return true;
+        });
+    }
+
+    bool Erase(const sptr<IRemoteObject>& connect, Value* removed = nullptr)
+    {
+        Shard& shard = GetShard(connect);
+        std::lock_guard<std::mutex> autoLock(shard.lock);
+        auto iter = shard.entries.find(connect);
+        if (iter == shard.entries.end()) {
+            return false;
+        }
+        Reindex(connect, deviceIdsFunc_(iter->second), {});
+        if (removed != nullptr) {
+            *removed = std::move(iter->second);
+        }
+        shard.entries.erase(iter);
+        return true;
+    }
+
+    // creates a default value first when the connect is absent, returns true in that case
+    bool Update(const sptr<IRemoteObject>& connect, const Updater& updater)
+    {
+        Shard& shard = GetShard(connect);
+        std::lock_guard<std::mutex> autoLock(shard.lock);
+        auto [iter, isCreated] = shard.entries.try_emplace(connect);
+        ApplyLocked(shard, iter, isCreated ? std::set<std::string>() : deviceIdsFunc_(iter->second), updater);
+        return isCreated;
+    }
+
+    // returns false when the connect is absent
+    bool UpdateIfExists(const sptr<IRemoteObject>& connect, const Updater& updater)
+    {
+        Shard& shard = GetShard(connect);
+        std::lock_guard<std::mutex> autoLock(shard.lock);
+        auto iter = shard.entries.find(connect);
+        if (iter == shard.entries.end()) {
+            return false;
+        }
+        ApplyLocked(shard, iter, deviceIdsFunc_(iter->second), updater);
+        return true;
+    }
+
+    std::vector<sptr<IRemoteObject>> GetConnectsOfDevice(const std::string& deviceId) const
+    {
+        std::lock_guard<std::mutex> autoLock(indexLock_);
+        auto iter = deviceIndex_.find(deviceId);
+        if (iter == deviceIndex_.end()) {
+            return {};
+        }
+        return std::vector<sptr<IRemoteObject>>(iter->second.begin(), iter->second.end());
+    }
+
+    bool FindIf(const Predicate& pred, Entry& entry) const
+    {
+        for (const Shard& shard : shards_) {
+            std::lock_guard<std::mutex> autoLock(shard.lock);
+            for (const auto& [connect, value] : shard.entries) {
+                if (pred(connect, value)) {
+                    entry = { connect, value };
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // scans shard by shard, only one shard is locked at a time
+    std::vector<Entry> EraseIf(const Predicate& pred)
+    {
+        std::vector<Entry> removed;
+        for (Shard& shard : shards_) {
+            std::lock_guard<std::mutex> autoLock(shard.lock);
+            for (auto iter = shard.entries.begin(); iter != shard.entries.end();) {
+                if (!pred(iter->first, iter->second)) {
+                    iter++;
+                    continue;
+                }
+                Reindex(iter->first, deviceIdsFunc_(iter->second), {});
+                removed.emplace_back(iter->first, std::move(iter->second));
+                iter = shard.entries.erase(iter);
+            }
+        }
+        return removed;
+    }
+
+    void ForEach(const Visitor& visitor) const
+    {
+        for (const Shard& shard : shards_) {
+            std::lock_guard<std::mutex> autoLock(shard.lock);
+            for (const auto& [connect, value] : shard.entries) {
+                visitor(connect, value);
+            }
+        }
+    }
+
+    size_t Size() const
+    {
+        size_t size = 0;
+        for (const Shard& shard : shards_) {
+            std::lock_guard<std::mutex> autoLock(shard.lock);
+            size += shard.entries.size();
+        }
+        return size;
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+    void Clear()
+    {
+        for (Shard& shard : shards_) {
+            std::lock_guard<std::mutex> autoLock(shard.lock);
+            shard.entries.clear();
+        }
+        std::lock_guard<std::mutex> autoLock(indexLock_);
+        deviceIndex_.clear();
+    }
+
+private:
+    static constexpr size_t SHARD_COUNT = 16;
+    static constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+    static constexpr uint32_t HASH_SHIFT = 60;
+
+    struct Shard {
+        mutable std::mutex lock;
+        std::map<sptr<IRemoteObject>, Value> entries;
+    };
+
+    static size_t GetShardIndex(const sptr<IRemoteObject>& connect)
+    {
+        // heap addresses share their low bits, mix before taking the top bits
+        uint64_t addr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(connect.GetRefPtr()));
+        return static_cast<size_t>((addr * HASH_MULTIPLIER) >> HASH_SHIFT) % SHARD_COUNT;
+    }
+
+    Shard& GetShard(const sptr<IRemoteObject>& connect)
+    {
+        return shards_[GetShardIndex(connect)];
+    }
+
+    const Shard& GetShard(const sptr<IRemoteObject>& connect) const
+    {
+        return shards_[GetShardIndex(connect)];
+    }
+
+    void ApplyLocked(Shard& shard, typename std::map<sptr<IRemoteObject>, Value>::iterator iter,
+        const std::set<std::string>& oldIds, const Updater& updater)
+    {
+        if (!updater(iter->second)) {
+            Reindex(iter->first, oldIds, {});
+            shard.entries.erase(iter);
+            return;
+        }
+        Reindex(iter->first, oldIds, deviceIdsFunc_(iter->second));
+    }
+
+    void Reindex(const sptr<IRemoteObject>& connect, const std::set<std::string>& oldIds,
+        const std::set<std::string>& newIds)
+    {
+        if (oldIds == newIds) {
+            return;
+        }
+        std::lock_guard<std::mutex> autoLock(indexLock_);
+        for (const auto& deviceId : oldIds) {
+            if (newIds.count(deviceId) != 0) {
+                continue;
+            }
+            auto iter = deviceIndex_.find(deviceId);
+            if (iter == deviceIndex_.end()) {
+                continue;
+            }
+            iter->second.erase(connect);
+            if (iter->second.empty()) {
+                deviceIndex_.erase(iter);
+            }
+        }
+        for (const auto& deviceId : newIds) {
+            if (oldIds.count(deviceId) == 0) {
+                deviceIndex_[deviceId].insert(connect);
+            }
+        }
+    }
+
+    DeviceIdsFunc deviceIdsFunc_;
+    std::array<Shard, SHARD_COUNT> shards_;
+    mutable std::mutex indexLock_;
+    std::map<std::string, std::set<sptr<IRemoteObject>>> deviceIndex_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DSCHED_CONNECTION_REGISTRY_H
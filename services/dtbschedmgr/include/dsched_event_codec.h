@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DSCHED_EVENT_CODEC_H
+#define OHOS_DSCHED_EVENT_CODEC_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "distributed_sched_types.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+/*
+ * Packs a page of event records into one byte buffer. Each distinct string of
+ * the page is written once and records refer to it by index, numbers are
+ * varints, so the records of one app or one device pair take a few bytes each
+ * and the whole page crosses the ipc as a single parcel field.
+ */
+class DSchedEventCodec {
+public:
+    constexpr static uint8_t CODEC_VERSION = 1;
+
+    static int32_t Encode(const std::vector<EventNotify>& events, std::vector<uint8_t>& buffer);
+    static int32_t Decode(const std::vector<uint8_t>& buffer, std::vector<EventNotify>& events);
+
+private:
+    static void WriteVarint(uint64_t value, std::vector<uint8_t>& buffer);
+    static bool ReadVarint(const std::vector<uint8_t>& buffer, size_t& offset, uint64_t& value);
+    static uint64_t ZigZagEncode(int64_t value);
+    static int64_t ZigZagDecode(uint64_t value);
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DSCHED_EVENT_CODEC_H
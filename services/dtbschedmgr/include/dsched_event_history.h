@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DSCHED_EVENT_HISTORY_H
+#define OHOS_DSCHED_EVENT_HISTORY_H
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "distributed_sched_types.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+/*
+ * Ring buffer of the latest continuation and collaboration events. Every event
+ * gets the next sequence number, the sequence numbers in the buffer are
+ * contiguous, so a query cursor is turned into a buffer slot without a search
+ * and the oldest events are overwritten once the buffer is full.
+ */
+class DSchedEventHistory {
+public:
+    constexpr static size_t DEFAULT_CAPACITY = 1024;
+    constexpr static uint32_t DEFAULT_PAGE_SIZE = 64;
+    constexpr static uint32_t MAX_PAGE_SIZE = 256;
+
+    explicit DSchedEventHistory(size_t capacity = DEFAULT_CAPACITY);
+    ~DSchedEventHistory() = default;
+
+    void Record(const EventNotify& event);
+    // appends one page of matching events, oldest first; nextCursor is 0 when no match is left
+    int32_t Query(const DSchedEventQuery& query, std::vector<EventNotify>& events, uint64_t& nextCursor) const;
+    size_t GetSize() const;
+    void Clear();
+
+private:
+    static bool IsMatch(const DSchedEventQuery& query, const EventNotify& event);
+    static int64_t GetNowMs();
+
+    mutable std::mutex historyMutex_;
+    size_t capacity_;
+    std::vector<EventNotify> records_;
+    // slot of the oldest event once the buffer is full
+    size_t head_ = 0;
+    uint64_t nextSeq_ = 1;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DSCHED_EVENT_HISTORY_H
@@ -21,6 +21,7 @@
 #include <string>
 
 #include "adapter/dnetwork_adapter.h"
+#include "deviceManager/dms_device_identity_table.h"
 #include "deviceManager/dms_device_info.h"
 #include "distributed_device_node_listener.h"
 #include "event_handler.h"
@@ -111,8 +112,7 @@ private:
     std::shared_ptr<DistributedDeviceNodeListener> deviceNodeListener_;
     std::map<std::string, std::shared_ptr<DmsDeviceInfo>> remoteDevices_;
     std::string deviceId_;
-    std::map<std::string, std::string> uuidNetworkIdMap_;
-    std::mutex uuidNetworkIdLock_;
+    DmsDeviceIdentityTable identityTable_;
     std::shared_ptr<AppExecFwk::EventHandler> initHandler_;
     std::shared_ptr<AppExecFwk::EventHandler> networkIdMgrHandler_;
 };
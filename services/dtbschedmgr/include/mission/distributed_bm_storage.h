@@ -28,6 +28,7 @@
 #include "distributed_data_change_listener.h"
 #include "distributed_kv_data_manager.h"
 #include "distributed_sched_continuation.h"
+#include "event_handler.h"
 #include "mission/distributed_bundle_info.h"
 #include "kvstore_death_recipient.h"
 #include "os_account_manager.h"
@@ -82,9 +83,10 @@ public:
 
 private:
     std::string DeviceAndNameToKey(const std::string &udid, const std::string &bundleName) const;
-    void TryTwice(const std::function<DistributedKv::Status()> &func) const;
     bool CheckKvStore();
-    DistributedKv::Status GetKvStore();
+    static DistributedKv::Status GetKvStore(std::shared_ptr<DistributedKv::SingleKvStore> &kvStore);
+    void OnKvStoreChanged(const std::shared_ptr<DistributedKv::SingleKvStore> &kvStore);
+    void PublishLocalData();
     bool DealGetBundleName(const std::string &networkId, const uint16_t& bundleNameId, std::string &bundleName);
     uint16_t CreateBundleNameId(const std::string &bundleName, bool isPackageChange = false);
     void AddBundleNameId(const uint16_t &bundleNameId, const std::string &bundleName);
@@ -113,6 +115,8 @@ private:
     DistributedKv::DistributedKvDataManager dataManager_;
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     mutable std::mutex kvStorePtrMutex_;
+    int32_t storeListenerId_ = 0;
+    std::shared_ptr<AppExecFwk::EventHandler> publishHandler_;
     OHOS::sptr<OHOS::AppExecFwk::IBundleMgr> bundleMgr_;
     std::map<uint16_t, std::string> bundleNameIdTables_;
     int32_t waittingTime_ = 180; // 3 s
@@ -17,6 +17,9 @@
 #define OHOS_DISTRIBUTED_DATA_STORAGE_H
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -30,10 +33,60 @@
 
 namespace OHOS {
 namespace DistributedSchedule {
+/*
+ * State of one asynchronous Query, owned by whoever still holds it: the
+ * caller, the kv store callback or the deadline timer. The first of result,
+ * deadline and Cancel completes the task, later ones are ignored.
+ */
+class DistributedDataQueryTask {
+public:
+    using Callback = std::function<void(DistributedKv::Status status, const DistributedKv::Value& value)>;
+
+    DistributedDataQueryTask(std::chrono::steady_clock::time_point deadline, Callback callback)
+        : deadline_(deadline), callback_(std::move(callback)) {}
+    ~DistributedDataQueryTask() = default;
+
+    /**
+     * Complete the task and invoke the callback, unless it is already completed.
+     *
+     * @return Returns true if this call completed the task.
+     */
+    bool Complete(DistributedKv::Status status, DistributedKv::Value&& value);
+
+    /**
+     * Complete the task with an error without invoking the callback.
+     *
+     * @return Returns true if the task was still pending.
+     */
+    bool Cancel();
+
+    /**
+     * Block until the task completes or its deadline passes, whichever is first.
+     *
+     * @param value, if success return the value
+     * @return Returns the kv store status, TIME_OUT once the deadline passed.
+     */
+    DistributedKv::Status Wait(DistributedKv::Value& value);
+
+    bool IsDone() const;
+    std::chrono::steady_clock::time_point GetDeadline() const;
+
+private:
+    bool CompleteInner(DistributedKv::Status status, DistributedKv::Value&& value, bool notify);
+
+    const std::chrono::steady_clock::time_point deadline_;
+    mutable std::mutex lock_;
+    std::condition_variable doneCondition_;
+    bool isDone_ = false;
+    DistributedKv::Status status_ = DistributedKv::Status::ERROR;
+    DistributedKv::Value value_;
+    Callback callback_;
+};
+
 class DistributedDataStorage {
 public:
     DistributedDataStorage();
-    ~DistributedDataStorage() = default;
+    virtual ~DistributedDataStorage() = default;
 
     /**
      * Init DistributedDataStorage.
@@ -87,23 +140,41 @@ public:
      */
     bool Query(const std::string& networkId, int32_t missionId, DistributedKv::Value& value) const;
 
+    /**
+     * Query networkId + missionId in kvStore without blocking.
+     *
+     * @param networkId, the networkId to query
+     * @param missionId, the missionId to query
+     * @param deadline, the callback gets TIME_OUT if the kvStore has not answered by then
+     * @param callback, invoked once with the result unless the task is cancelled first
+     * @return Returns the pending task, nullptr if the query could not be issued.
+     */
+    std::shared_ptr<DistributedDataQueryTask> QueryAsync(const std::string& networkId, int32_t missionId,
+        std::chrono::steady_clock::time_point deadline, DistributedDataQueryTask::Callback callback = nullptr) const;
+
+    /**
+     * Deadline of a Query issued now.
+     */
+    std::chrono::steady_clock::time_point GetQueryDeadline() const;
+
     void NotifyRemoteDied(const wptr<IRemoteObject>& remote);
 
 private:
-    bool InitKvDataService();
-    bool WaitKvDataService();
-    void InitDistributedDataStorage();
-    bool TryGetKvStore();
-    DistributedKv::Status GetKvStore();
+    static DistributedKv::Status GetKvStore(std::shared_ptr<DistributedKv::SingleKvStore>& kvStore);
+    void OnKvStoreChanged(const std::shared_ptr<DistributedKv::SingleKvStore>& kvStore);
+    void AddKvDataServiceDeathRecipient();
     void SubscribeDistributedDataStorage();
     bool UninitDistributedDataStorage();
     bool InsertInnerLocked(const std::string& uuid, int32_t missionId, const uint8_t* byteStream, size_t len);
     bool DeleteInnerLocked(const std::string& uuid, int32_t missionId);
     bool FuzzyDeleteInnerLocked(const std::string& networkId);
-    bool QueryInnerLocked(const std::string& networkId, int32_t missionId, DistributedKv::Value& value) const;
+    bool QueryInnerLocked(const std::string& networkId, int32_t missionId,
+        const std::shared_ptr<DistributedDataQueryTask>& task) const;
+    virtual bool GetFromKvStoreLocked(const DistributedKv::Key& key, const std::string& networkId,
+        const std::function<void(DistributedKv::Status, DistributedKv::Value&&)>& onResult) const;
+    void ScheduleQueryDeadline(const std::shared_ptr<DistributedDataQueryTask>& task) const;
     static void GenerateKey(const std::string& uuid, int32_t missionId, DistributedKv::Key& key);
     static void GenerateValue(const uint8_t* byteStream, size_t len, DistributedKv::Value& value);
-    OHOS::DistributedKv::Status GetResultSatus(std::promise<OHOS::DistributedKv::Status> &resultStatusSignal) const;
 
     mutable std::shared_mutex initLock_;
     std::shared_ptr<AppExecFwk::EventHandler> dmsDataStorageHandler_;
@@ -113,6 +184,7 @@ private:
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_; // protected by initLock_
     std::unique_ptr<DistributedDataChangeListener> distributedDataChangeListener_;
     sptr<IRemoteObject::DeathRecipient> kvStoreDeathRecipient_;
+    int32_t storeListenerId_ = 0;
     int32_t waittingTime_ = 180; // 3 s
 };
 } // DistributedSchedule
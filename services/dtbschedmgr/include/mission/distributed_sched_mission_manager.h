@@ -16,6 +16,7 @@
 #ifndef DISTRIBUTEDSCHED_MISSION_MANAGER_H
 #define DISTRIBUTEDSCHED_MISSION_MANAGER_H
 
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -78,6 +79,8 @@ public:
     int32_t RemoveSnapshotInfo(const std::string& deviceId, int32_t missionId);
     int32_t GetRemoteMissionSnapshotInfo(const std::string& networkId, int32_t missionId,
         std::unique_ptr<AAFwk::MissionSnapshot>& missionSnapshot);
+    int32_t GetRemoteMissionSnapshotInfos(const std::string& networkId, const std::vector<int32_t>& missionIds,
+        std::map<int32_t, std::unique_ptr<AAFwk::MissionSnapshot>>& missionSnapshots);
     void DeviceOnlineNotify(const std::string& deviceId);
     void DeviceOfflineNotify(const std::string& deviceId);
     void DeleteDataStorage(const std::string& deviceId, bool isDelayed);
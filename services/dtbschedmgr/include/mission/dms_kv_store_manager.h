@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_DMS_KV_STORE_MANAGER_H
+#define OHOS_DMS_KV_STORE_MANAGER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "distributed_kv_data_manager.h"
+#include "event_handler.h"
+#include "single_instance.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+/*
+ * Opens the kv stores of dms once the kv data service is up and hands out
+ * their handles. Stores are opened on the manager's own thread when the kv
+ * data service is reported added, callers never wait for the service: they
+ * get the handle at once or DMS_KV_STORE_NOT_READY.
+ */
+class DmsKvStoreManager {
+DECLARE_SINGLE_INSTANCE_BASE(DmsKvStoreManager);
+public:
+    using Opener = std::function<DistributedKv::Status(std::shared_ptr<DistributedKv::SingleKvStore>& kvStore)>;
+    // gets the handle once the store is ready and nullptr once the kv data service is gone,
+    // runs without the manager's locks but must not remove itself
+    using StoreListener = std::function<void(const std::shared_ptr<DistributedKv::SingleKvStore>& kvStore)>;
+    using ServiceProbe = std::function<bool()>;
+
+    enum class StoreState : int32_t {
+        NOT_READY = 0,
+        OPENING,
+        READY,
+    };
+
+    static constexpr int32_t MAX_OPEN_TIMES = 5;
+    static constexpr int64_t OPEN_RETRY_INTERVAL_MS = 500;
+
+    /**
+     * Register a store, the first opener registered for a store id is kept.
+     */
+    void RegisterStore(const std::string& storeId, const Opener& opener);
+
+    /**
+     * Get the handle of a store without waiting.
+     *
+     * @return Returns ERR_OK with the handle, DMS_KV_STORE_NOT_READY while the store is not open.
+     */
+    int32_t GetKvStore(const std::string& storeId, std::shared_ptr<DistributedKv::SingleKvStore>& kvStore);
+    StoreState GetStoreState(const std::string& storeId);
+
+    /**
+     * Add a listener of a store, it gets the handle at once if the store is ready already.
+     *
+     * @return Returns the id to remove the listener with.
+     */
+    int32_t AddStoreListener(const std::string& storeId, const StoreListener& listener);
+    /**
+     * Remove a listener, it is not running any more when this returns.
+     */
+    void RemoveStoreListener(int32_t listenerId);
+
+    /**
+     * Drop the handle of a store its owner closed, the next GetKvStore opens it again.
+     */
+    void ResetStore(const std::string& storeId);
+
+    void OnKvServiceAdded();
+    void OnKvServiceRemoved();
+
+private:
+    struct StoreEntry {
+        Opener opener;
+        StoreState state = StoreState::NOT_READY;
+        int32_t openTimes = 0;
+        // a new open round drops the results of the one before
+        uint64_t generation = 0;
+        std::shared_ptr<DistributedKv::SingleKvStore> kvStore;
+    };
+
+    struct ListenerEntry {
+        std::string storeId;
+        StoreListener listener;
+    };
+
+    DmsKvStoreManager() = default;
+    ~DmsKvStoreManager() = default;
+    bool ProbeKvService();
+    void StartOpenLocked(const std::string& storeId, StoreEntry& entry);
+    void PostOpenLocked(const std::string& storeId, uint64_t generation, int64_t delayMs);
+    void OpenStore(const std::string& storeId, uint64_t generation);
+    void NotifyListeners(const std::string& storeId, const std::shared_ptr<DistributedKv::SingleKvStore>& kvStore);
+    void NotifyListener(int32_t listenerId);
+    void RunListener(int32_t listenerId, const std::shared_ptr<DistributedKv::SingleKvStore>& kvStore);
+
+    std::mutex storeMutex_;
+    std::map<std::string, StoreEntry> stores_;
+    bool isServiceReady_ = false;
+    // checks the kv data service with samgr when no added notification came yet
+    ServiceProbe serviceProbe_;
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+
+    // listeners run unlocked, removing one waits until it is out of runningListeners_
+    std::mutex listenerMutex_;
+    std::condition_variable listenerCond_;
+    std::map<int32_t, ListenerEntry> listeners_;
+    std::multiset<int32_t> runningListeners_;
+    int32_t nextListenerId_ = 0;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_KV_STORE_MANAGER_H
@@ -48,9 +48,8 @@ public:
     bool CheckBundleContinueConfig(const std::string &bundleName);
 
 private:
-    void TryTwice(const std::function<DistributedKv::Status()> &func) const;
     bool CheckKvStore();
-    DistributedKv::Status GetKvStore();
+    static DistributedKv::Status GetKvStore(std::shared_ptr<DistributedKv::SingleKvStore> &kvStore);
     bool IsValidPath(const std::string &inFilePath, std::string &realFilePath);
     bool UpdateWhiteList(const std::string &cfgJsonStr);
     int32_t LoadContinueConfig();
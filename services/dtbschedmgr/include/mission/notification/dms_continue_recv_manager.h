@@ -20,6 +20,7 @@
 #include <map>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <string>
 #include <thread>
 #include <utility>
@@ -60,6 +61,19 @@ struct currentIconInfo {
     ~currentIconInfo() = default;
 };
 
+struct BroadcastRecord {
+    uint16_t bundleNameId = 0;
+    uint8_t continueTypeId = 0;
+    int32_t state = -1;
+    int64_t recvTime = 0;
+};
+
+struct BroadcastRecvStat {
+    uint64_t recvCount = 0;
+    uint64_t droppedCount = 0;
+    uint64_t coalescedCount = 0;
+};
+
 class DMSContinueRecvMgr {
 public:
     constexpr static uint8_t DMS_DATA_LEN = 3; // Dms data Length
@@ -74,6 +88,7 @@ public:
     constexpr static uint8_t CONTINUE_SHIFT_08 = 0x08;
     constexpr static uint8_t CONTINUE_SHIFT_04 = 0x04;
     constexpr static int32_t INVALID_MISSION_ID = -1;
+    constexpr static int32_t DEFAULT_BROADCAST_DEDUP_WINDOW = 1000; // ms
 
     ~DMSContinueRecvMgr();
     void Init(int32_t accountId);
@@ -91,6 +106,8 @@ public:
     void OnContinueSwitchOff();
     void OnUserSwitch();
     std::string GetContinueType(const std::string& bundleName);
+    void SetBroadcastDedupWindow(int32_t windowMs);
+    BroadcastRecvStat GetBroadcastRecvStat();
 
 private:
     void StartEvent();
@@ -112,6 +129,9 @@ private:
     std::string ContinueTypeFormat(const std::string &continueType);
     void FindToNotifyRecvBroadcast(const std::string& senderNetworkId, const std::string& bundleName,
         const std::string& continueType);
+    bool IsDuplicateBroadcast(const std::string& senderNetworkId, uint16_t bundleNameId, uint8_t continueTypeId,
+        const int32_t state);
+    void ClearBroadcastRecord(const std::string& senderNetworkId = "");
 private:
     currentIconInfo iconInfo_;
     sptr<DistributedMissionDiedListener> missionDiedListener_;
@@ -124,6 +144,11 @@ private:
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> eventHandler_;
     int32_t accountId_ = -1;
     std::atomic<bool> isScreenOn = true;
+    std::map<std::string, BroadcastRecord> lastBroadcast_;
+    std::set<std::string> pendingBroadcast_;
+    BroadcastRecvStat broadcastStat_;
+    std::mutex broadcastMutex_;
+    std::atomic<int32_t> dedupWindow_ = DEFAULT_BROADCAST_DEDUP_WINDOW;
 };
 } // namespace DistributedSchedule
 } // namespace OHOS
@@ -25,6 +25,7 @@
 #include "event_handler.h"
 #include "single_instance.h"
 #include "mission/dms_continue_condition_manager.h"
+#include "mission/notification/dms_continue_send_scheduler.h"
 #include "mission/notification/dms_continue_send_strategy.h"
 
 namespace OHOS {
@@ -69,6 +70,7 @@ public:
     void OnDeviceScreenLocked();
     void OnDeviceScreenOn();
     void OnUserSwitched();
+    void DumpBroadcastInfo(std::string& result);
 
 private:
     void StartEvent();
@@ -78,6 +80,8 @@ private:
     int32_t ExecuteSendStrategy(MissionEventType type, const MissionStatus& status, uint8_t &sendType);
     int32_t QueryBroadcastInfo(const MissionStatus& status, uint16_t& bundleNameId, uint8_t& continueTypeId);
     void SendSoftbusEvent(uint16_t& bundleNameId, uint8_t& continueTypeId, uint8_t type);
+    void ScheduleBroadcast(const ContinueBroadcastInfo& info);
+    void PostBroadcastFlush(int64_t delay);
     void AddMMIListener();
     void RemoveMMIListener();
 
@@ -118,6 +122,7 @@ private:
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> eventHandler_;
     std::shared_ptr<ScreenLockedHandler> screenLockedHandler_;
     std::map<MissionEventType, std::shared_ptr<ContinueSendStrategy>> strategyMap_;
+    std::shared_ptr<DmsContinueSendScheduler> sendScheduler_;
 };
 } // namespace DistributedSchedule
 } // namespace OHOS
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_CONTINUE_SEND_SCHEDULER_H
+#define OHOS_DMS_CONTINUE_SEND_SCHEDULER_H
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+
+namespace OHOS {
+namespace DistributedSchedule {
+struct ContinueBroadcastInfo {
+    int32_t missionId = -1;
+    uint16_t bundleNameId = 0;
+    uint8_t continueTypeId = 0;
+    uint8_t sendType = 0;
+
+    bool operator==(const ContinueBroadcastInfo& other) const
+    {
+        return missionId == other.missionId && bundleNameId == other.bundleNameId &&
+            continueTypeId == other.continueTypeId && sendType == other.sendType;
+    }
+};
+
+struct ContinueBroadcastStat {
+    uint64_t submittedCount = 0;
+    uint64_t sentCount = 0;
+    uint64_t coalescedCount = 0;
+    uint64_t unchangedCount = 0;
+    uint64_t throttledCount = 0;
+};
+
+/*
+ * Coalesces mission transitions into the final state per mission and paces the
+ * resulting broadcasts with a token bucket. The class owns no thread: Submit and
+ * Flush return the delay after which the owner should call Flush again.
+ */
+class DmsContinueSendScheduler {
+public:
+    using Clock = std::function<int64_t()>;
+    using Sender = std::function<void(const ContinueBroadcastInfo&)>;
+
+    constexpr static int64_t NO_FLUSH = -1;
+    constexpr static int64_t DEFAULT_COALESCE_WINDOW = 100; // ms
+    constexpr static int64_t DEFAULT_MIN_INTERVAL = 200; // ms
+    constexpr static uint32_t DEFAULT_BURST = 3;
+
+    DmsContinueSendScheduler(const Sender& sender, const Clock& clock);
+    ~DmsContinueSendScheduler() = default;
+
+    void SetConfig(int64_t coalesceWindow, int64_t minInterval, uint32_t burst);
+    int64_t Submit(const ContinueBroadcastInfo& info);
+    int64_t Flush();
+    void Reset();
+    ContinueBroadcastStat GetStat();
+    void Dump(std::string& result);
+
+private:
+    struct PendingBroadcast {
+        ContinueBroadcastInfo info;
+        int64_t firstSubmitTime = 0;
+        bool isCoalesced = false;
+        bool isThrottled = false;
+    };
+
+    void RefillTokensLocked(int64_t now);
+    int64_t NextFlushDelayLocked(int64_t now);
+
+    Sender sender_;
+    Clock clock_;
+    int64_t coalesceWindow_ = DEFAULT_COALESCE_WINDOW;
+    int64_t minInterval_ = DEFAULT_MIN_INTERVAL;
+    uint32_t burst_ = DEFAULT_BURST;
+    uint32_t tokens_ = DEFAULT_BURST;
+    int64_t lastRefillTime_ = 0;
+
+    std::mutex mutex_;
+    std::list<PendingBroadcast> pending_;
+    // only the latest broadcast is held by the peers, older ones need no record
+    ContinueBroadcastInfo lastSentInfo_;
+    ContinueBroadcastStat stat_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_CONTINUE_SEND_SCHEDULER_H
@@ -16,16 +16,23 @@
 #ifndef OHOS_DSCHED_ALL_CONNECT_MANAGER_H
 #define OHOS_DSCHED_ALL_CONNECT_MANAGER_H
 
+#include <array>
+#include <chrono>
+#include <functional>
 #include <map>
 #include <mutex>
-#include <queue>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "event_handler.h"
 #include "service_collaboration_manager_capi.h"
 #include "single_instance.h"
 
 namespace OHOS {
 namespace DistributedSchedule {
+using AllConnectApplyCallback = std::function<void(int32_t result)>;
+
 class DSchedAllConnectManager {
 DECLARE_SINGLE_INSTANCE_BASE(DSchedAllConnectManager);
 public:
@@ -33,21 +40,52 @@ public:
     int32_t UninitAllConnectManager();
     int32_t PublishServiceState(const std::string &peerNetworkId, const std::string &extraInfo,
         ServiceCollaborationManagerBussinessStatus state);
-    int32_t ApplyAdvanceResource(const std::string &peerNetworkId,
-        ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets);
+    /**
+     * Apply for resources without waiting for the arbiter. Applications to different peers run
+     * in parallel, a second application to a peer already in flight joins it, and a peer that
+     * passed within CONNECT_DECISION_REUSE_MS is answered at once on the calling thread.
+     *
+     * @return ERR_OK if callback will be invoked exactly once, otherwise callback is dropped.
+     */
+    int32_t ApplyAdvanceResourceAsync(const std::string &peerNetworkId,
+        ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets, const AllConnectApplyCallback &callback);
+    void InvalidateConnectDecision(const std::string &peerNetworkId);
     void GetResourceRequest(ServiceCollaborationManager_ResourceRequestInfoSets &reqInfoSets);
 
 private:
+    using ApplyResultFunc = int32_t (*)(int32_t errorcode, int32_t result, const char *reason);
+    static constexpr int32_t MAX_APPLY_REQUEST = 8;
+
+    struct ApplyRequest {
+        bool inUse = false;
+        uint64_t seq = 0;
+        std::string peerNetworkId;
+        std::vector<AllConnectApplyCallback> callbacks;
+    };
+
     DSchedAllConnectManager() = default;
     ~DSchedAllConnectManager() = default;
     int32_t GetServiceCollaborationManagerProxy();
     int32_t RegistLifecycleCallback();
     int32_t UnregistLifecycleCallback();
-    int32_t WaitAllConnectApplyCb(const std::string &peerNetworkId);
-    void NotifyAllConnectDecision(const std::string &peerNetworkId, bool isSupport);
+    bool IsDecisionReusableLocked(const std::string &peerNetworkId);
+    int32_t AllocApplyRequestLocked(const std::string &peerNetworkId, const AllConnectApplyCallback &callback);
+    void PostApplyTimeout(int32_t requestId, uint64_t seq);
+    void FinishApplyRequest(int32_t requestId, uint64_t seq, int32_t result, bool skipIssuer = false);
+    int32_t OnApplyResult(int32_t requestId, int32_t errorcode, int32_t result, const char *reason);
 
     static int32_t OnStop(const char *peerNetworkId);
     static int32_t ApplyResult(int32_t errorcode, int32_t result, const char *reason);
+    // the arbiter callback carries no context, so every request slot gets its own entry point
+    template<int32_t REQUEST_ID>
+    static int32_t ApplyResultForRequest(int32_t errorcode, int32_t result, const char *reason);
+    template<int32_t... REQUEST_IDS>
+    static std::array<ApplyResultFunc, sizeof...(REQUEST_IDS)> MakeApplyResultFuncs(
+        std::integer_sequence<int32_t, REQUEST_IDS...>)
+    {
+        return { &ApplyResultForRequest<REQUEST_IDS>... };
+    }
+    static const std::array<ApplyResultFunc, MAX_APPLY_REQUEST> APPLY_RESULT_FUNCS;
 
 private:
     static constexpr int32_t DSCHED_QOS_TYPE_MIN_BW = 40 * 1024 * 1024;
@@ -56,7 +94,6 @@ private:
     static ServiceCollaborationManager_HardwareRequestInfo locReqInfo_;
     static ServiceCollaborationManager_HardwareRequestInfo rmtReqInfo_;
     static ServiceCollaborationManager_CommunicationRequestInfo communicationRequest_;
-    static std::queue<std::string> peerConnectCbQueue_;
     const char *DMS_BIND_MGR_SRV_NAME = "TaskContinue";
 
     std::mutex allConnectMgrLock_;
@@ -68,9 +105,13 @@ private:
         .ServiceCollaborationManager_UnRegisterLifecycleCallback = nullptr,
     };
 
-    std::mutex connectDecisionMutex_;
-    std::condition_variable connectDecisionCond_;
-    std::map<std::string, std::atomic<bool>> peerConnectDecision_;
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+
+    std::mutex applyRequestMutex_;
+    uint64_t applySeq_ = 0;
+    std::array<ApplyRequest, MAX_APPLY_REQUEST> applyRequests_;
+    // time each peer last passed, dropped when the peer goes idle or is seized
+    std::map<std::string, std::chrono::steady_clock::time_point> peerConnectDecision_;
 };
 } // namespace DistributedSchedule
 } // namespace OHOS
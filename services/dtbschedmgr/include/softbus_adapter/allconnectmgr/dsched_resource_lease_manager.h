@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DSCHED_RESOURCE_LEASE_MANAGER_H
+#define OHOS_DSCHED_RESOURCE_LEASE_MANAGER_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "dsched_transport_softbus_adapter.h"
+#include "event_handler.h"
+#include "single_instance.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+using ResourceLeaseCallback = std::function<void(int32_t result)>;
+
+struct DSchedResourceLeaseStat {
+    int32_t refCount = 0;
+    uint64_t continueAcquired = 0;
+    uint64_t collabAcquired = 0;
+    uint64_t negotiated = 0;
+    uint64_t reused = 0;
+    uint64_t released = 0;
+};
+
+/*
+ * Per peer lease on the all-connect resources. Continuation and collaboration
+ * sessions acquire a reference before connecting and drop it on disconnect.
+ * The first reference applies for the resources, later ones reuse them, and
+ * the last release only publishes SCM_IDLE after the idle grace period, so a
+ * mission handed straight back to the same peer skips the negotiation.
+ */
+class DSchedResourceLeaseManager {
+DECLARE_SINGLE_INSTANCE_BASE(DSchedResourceLeaseManager);
+public:
+    static constexpr int64_t DEFAULT_IDLE_GRACE_MS = 5000;
+    static constexpr int64_t MAX_IDLE_GRACE_MS = 60000;
+
+    void Init();
+    void UnInit();
+    /**
+     * Take a reference without waiting for the arbiter. A held lease is answered at once on the
+     * calling thread, otherwise callback runs on the lease event handler after the application.
+     * If the result can't be posted there, callback fails on the arbiter thread without a reference.
+     *
+     * @return ERR_OK if callback will be invoked exactly once, otherwise callback is dropped.
+     */
+    int32_t AcquireAsync(const std::string &peerNetworkId, DSchedServiceType type,
+        const ResourceLeaseCallback &callback);
+    void Release(const std::string &peerNetworkId);
+    void Revoke(const std::string &peerNetworkId);
+    void SetIdleGracePeriod(int64_t idleGraceMs);
+    int64_t GetIdleGracePeriod();
+    DSchedResourceLeaseStat GetLeaseStat(const std::string &peerNetworkId);
+    void Dump(std::string &result);
+
+private:
+    struct ResourceLease {
+        bool isHeld = false;
+        uint64_t generation = 0;
+        DSchedResourceLeaseStat stat;
+    };
+
+    DSchedResourceLeaseManager() = default;
+    ~DSchedResourceLeaseManager() = default;
+    void AddRefLocked(ResourceLease &lease, DSchedServiceType type);
+    void PostNegotiateResult(const std::string &peerNetworkId, DSchedServiceType type, int32_t result,
+        const ResourceLeaseCallback &callback);
+    void OnNegotiateResult(const std::string &peerNetworkId, DSchedServiceType type, int32_t result,
+        const ResourceLeaseCallback &callback);
+    void PostIdleRelease(const std::string &peerNetworkId, uint64_t generation, int64_t idleGraceMs);
+    void OnIdleRelease(const std::string &peerNetworkId, uint64_t generation);
+
+    std::mutex leaseMutex_;
+    std::map<std::string, ResourceLease> leases_;
+    uint64_t nextGeneration_ = 0;
+    int64_t idleGraceMs_ = DEFAULT_IDLE_GRACE_MS;
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DSCHED_RESOURCE_LEASE_MANAGER_H
@@ -16,6 +16,7 @@
 #ifndef OHOS_DSCHED_TRANSPORT_SOFTBUS_ADAPTER_H
 #define OHOS_DSCHED_TRANSPORT_SOFTBUS_ADAPTER_H
 
+#include <functional>
 #include <map>
 #include <string>
 
@@ -46,10 +47,25 @@ typedef enum {
 class DSchedTransportSoftbusAdapter {
 DECLARE_SINGLE_INSTANCE_BASE(DSchedTransportSoftbusAdapter);
 public:
+    // called when data of a service type without listener arrives, to start that service
+    using ListenerLoader = std::function<void(int32_t serviceType)>;
+    // sessionId is valid when result is ERR_OK
+    using ConnectCallback = std::function<void(int32_t result, int32_t sessionId)>;
+
     int32_t InitChannel();
-    int32_t ConnectDevice(const std::string &peerDeviceId, int32_t &sessionId,
-        DSchedServiceType type = SERVICE_TYPE_CONTINUE);
+    /**
+     * Connect to peer without waiting for the all-connect arbiter. callback runs on the calling
+     * thread when the peer is already connected or no decision is needed, otherwise on a connect
+     * thread of its own once the decision is made. A rejected decision is reported where the lease
+     * manager reports it.
+     *
+     * @return ERR_OK if callback will be invoked exactly once, otherwise callback is dropped.
+     */
+    int32_t ConnectDeviceAsync(const std::string &peerDeviceId, DSchedServiceType type,
+        const ConnectCallback &callback);
     void DisconnectDevice(const std::string &peerDeviceId);
+    // drops one reference on this session only, nothing happens when it is already shut down
+    void DisconnectSession(int32_t sessionId);
     int32_t ReleaseChannel();
     int32_t SendData(int32_t sessionId, int32_t dataType, std::shared_ptr<DSchedDataBuffer> dataBuffer);
     int32_t SendBytesBySoftbus(int32_t sessionId, std::shared_ptr<DSchedDataBuffer> dataBuffer);
@@ -62,6 +78,7 @@ public:
     void SetCallingTokenId(int32_t callingTokenId);
     bool GetSessionIdByDeviceId(const std::string &peerDeviceId, int32_t &sessionId);
     bool IsNeedAllConnect(DSchedServiceType type);
+    void SetListenerLoader(ListenerLoader loader);
 
 private:
     DSchedTransportSoftbusAdapter();
@@ -71,14 +88,21 @@ private:
     int32_t CreateSessionRecord(int32_t sessionId, const std::string &peerDeviceId, bool isServer,
         DSchedServiceType type);
     int32_t AddNewPeerSession(const std::string &peerDeviceId, int32_t &sessionId, DSchedServiceType type);
-    void ShutdownSession(const std::string &peerDeviceId, int32_t sessionId);
+    void ConnectNewSession(const std::string &peerDeviceId, DSchedServiceType type, int64_t connectBeginUs,
+        const ConnectCallback &callback);
+    void PostConnectNewSession(const std::string &peerDeviceId, DSchedServiceType type, int64_t connectBeginUs,
+        const ConnectCallback &callback);
+    void ShutdownSession(const std::string &peerDeviceId, int32_t sessionId, bool isIdle = false);
     void NotifyListenersSessionShutdown(int32_t sessionId, bool isSelfCalled);
-    int32_t DecisionByAllConnect(const std::string &peerDeviceId, DSchedServiceType type);
+    int32_t DecisionByAllConnect(const std::string &peerDeviceId, DSchedServiceType type,
+        const std::function<void(int32_t result)> &callback);
     void NotifyConnectDecision(const std::string &peerDeviceId, DSchedServiceType type);
+    void LoadListenerIfAbsent(uint32_t dataType);
 
 private:
     std::map<int32_t, std::shared_ptr<DSchedSoftbusSession>> sessions_;
     std::map<int32_t, std::vector<std::shared_ptr<IDataListener>>> listeners_;
+    ListenerLoader listenerLoader_;
 
     std::mutex sessionMutex_;
     std::mutex listenerMutex_;
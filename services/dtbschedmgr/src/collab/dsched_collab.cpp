@@ -23,6 +23,7 @@
 #include "ability_manager_client.h"
 #include "bool_wrapper.h"
 #include "bundle/bundle_manager_internal.h"
+#include "dfx/dms_latency_histogram.h"
 #include "distributed_sched_permission.h"
 #include "dsched_collab_manager.h"
 #include "dsched_transport_softbus_adapter.h"
@@ -421,17 +422,78 @@ void DSchedCollab::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event)
 int32_t DSchedCollab::ExeSrcGetPeerVersion()
 {
     HILOGI("called");
+    return ConnectSinkDevice(SOURCE_GET_PEER_VERSION_STATE);
+}
+
+int32_t DSchedCollab::ConnectSinkDevice(CollabStateType stateType)
+{
+    // the all-connect decision may take long, the state goes on in OnSinkConnected
     const std::string sinkDeviceId = collabInfo_.sinkInfo_.deviceId_;
-    int32_t ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDevice(sinkDeviceId,
-        softbusSessionId_, SERVICE_TYPE_COLLAB);
+    std::weak_ptr<DSchedCollab> weakCollab = shared_from_this();
+    int32_t ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDeviceAsync(sinkDeviceId,
+        SERVICE_TYPE_COLLAB, [weakCollab, stateType](int32_t result, int32_t sessionId) {
+            auto dCollab = weakCollab.lock();
+            if (dCollab == nullptr) {
+                HILOGW("collab released while connecting, softbusSessionId %{public}d", sessionId);
+                if (result == ERR_OK) {
+                    DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+                }
+                return;
+            }
+            dCollab->PostConnectResultTask(stateType, result, sessionId);
+        });
     if (ret != ERR_OK) {
         HILOGE("connect peer device failed, ret %{public}d", ret);
-        return ret;
     }
-    HILOGI("this bind is successful, softbusSessionId %{public}d", softbusSessionId_);
- 
+    return ret;
+}
+
+void DSchedCollab::PostConnectResultTask(CollabStateType stateType, int32_t result, int32_t sessionId)
+{
+    HILOGI("called, result %{public}d, softbusSessionId %{public}d", result, sessionId);
+    if (eventHandler_ == nullptr) {
+        HILOGE("eventHandler is nullptr");
+        if (result == ERR_OK) {
+            DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+        }
+        return;
+    }
+    auto dCollab = shared_from_this();
+    auto func = [dCollab, stateType, result, sessionId]() {
+        dCollab->OnSinkConnected(stateType, result, sessionId);
+    };
+    if (!eventHandler_->PostTask(func)) {
+        HILOGE("post connect result task fail");
+        if (result == ERR_OK) {
+            DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+        }
+    }
+}
+
+void DSchedCollab::OnSinkConnected(CollabStateType stateType, int32_t result, int32_t sessionId)
+{
+    if (result != ERR_OK) {
+        HILOGE("connect peer device failed, ret %{public}d", result);
+        PostErrEndTask(result);
+        return;
+    }
+    if (stateMachine_ == nullptr || stateMachine_->GetStateType() != stateType) {
+        HILOGW("collab already moved on, drop the late softbusSessionId %{public}d", sessionId);
+        DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+        return;
+    }
+    softbusSessionId_ = sessionId;
+    HILOGI("this connection is successful, softbusSessionId %{public}d", softbusSessionId_);
+    int32_t ret = (stateType == SOURCE_GET_PEER_VERSION_STATE) ? SendGetPeerVersionCmd() : SendSrcStartCmd();
+    if (ret != ERR_OK) {
+        PostErrEndTask(ret);
+    }
+}
+
+int32_t DSchedCollab::SendGetPeerVersionCmd()
+{
     auto getPeerVersionCmd = std::make_shared<GetSinkCollabVersionCmd>();
-    ret = PackGetPeerVersionCmd(getPeerVersionCmd);
+    int32_t ret = PackGetPeerVersionCmd(getPeerVersionCmd);
     if (ret != ERR_OK) {
         HILOGE("pack failed, ret %{public}d", ret);
         return ret;
@@ -461,21 +523,19 @@ int32_t DSchedCollab::ExeSrcGetVersion()
 int32_t DSchedCollab::ExeSrcStart()
 {
     HILOGI("called");
-    const std::string sinkDeviceId = collabInfo_.sinkInfo_.deviceId_;
-    int32_t ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDevice(sinkDeviceId,
-        softbusSessionId_, SERVICE_TYPE_COLLAB);
-    if (ret != ERR_OK) {
-        HILOGE("connect peer device failed, ret %{public}d", ret);
-        return ret;
-    }
-    HILOGI("this connection is successful, softbusSessionId %{public}d", softbusSessionId_);
+    return ConnectSinkDevice(SOURCE_START_STATE);
+}
 
+int32_t DSchedCollab::SendSrcStartCmd()
+{
     auto startCmd = std::make_shared<SinkStartCmd>();
-    ret = PackStartCmd(startCmd);
+    int64_t packBeginUs = DmsLatencyRegistry::GetNowUs();
+    int32_t ret = PackStartCmd(startCmd);
     if (ret != ERR_OK) {
         HILOGE("pack startCmd failed, ret %{public}d", ret);
         return ret;
     }
+    DmsLatencyRegistry::GetInstance().RecordSince(DmsLatencyStage::PACK_START_CMD, packBeginUs);
     ret = SendCommand(startCmd);
     if (ret != ERR_OK) {
         HILOGE("send startCmd failed, ret %{public}d", ret);
@@ -602,6 +662,7 @@ int32_t DSchedCollab::ExeStartAbility()
         return ret;
     }
     sptr<IRemoteObject> callbackWrapper = sptr<AbilityConnectionWrapperStub>(new AbilityConnectionWrapperStub());
+    int64_t startBeginUs = DmsLatencyRegistry::GetNowUs();
     ret = AAFwk::AbilityManagerClient::GetInstance()->StartAbilityByCall(want,
         iface_cast<AAFwk::IAbilityConnection>(callbackWrapper));
     if (ret != ERR_OK) {
@@ -609,6 +670,7 @@ int32_t DSchedCollab::ExeStartAbility()
         ret = PostErrEndTask(ret);
         return ret;
     }
+    DmsLatencyRegistry::GetInstance().RecordSince(DmsLatencyStage::SINK_START, startBeginUs);
 
     UpdateState(SINK_CONNECT_STATE);
     RegisterAbilityLifecycleObserver(collabInfo_.sinkInfo_.bundleName_);
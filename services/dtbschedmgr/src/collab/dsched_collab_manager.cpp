@@ -71,12 +71,12 @@ IFeatureAbilityRelationChecker iAbilityRelationChecker = {
     .CheckCollabRelation = CheckSynergisticRelation
 };
 
-void DSchedCollabManager::Init()
+int32_t DSchedCollabManager::Init()
 {
     HILOGI("Init DSchedCollabManager start");
     if (eventHandler_ != nullptr) {
         HILOGI("DSchedCollabManager already inited, end.");
-        return;
+        return ERR_OK;
     }
     DSchedTransportSoftbusAdapter::GetInstance().InitChannel();
     softbusListener_ = std::make_shared<DSchedCollabManager::SoftbusListener>();
@@ -84,7 +84,9 @@ void DSchedCollabManager::Init()
     int32_t ret =  RegisterRelationChecker(&iAbilityRelationChecker);
     if (ret != ERR_OK) {
         HILOGE("RegisterRelationChecker failed, ret: %{public}d", ret);
-        return;
+        // without a listener the next collab data from a peer retries the init
+        DSchedTransportSoftbusAdapter::GetInstance().UnregisterListener(SERVICE_TYPE_COLLAB, softbusListener_);
+        return ret;
     }
     eventThread_ = std::thread(&DSchedCollabManager::StartEvent, this);
     std::unique_lock<std::mutex> lock(eventMutex_);
@@ -92,6 +94,7 @@ void DSchedCollabManager::Init()
         return eventHandler_ != nullptr;
     });
     HILOGI("Init DSchedCollabManager end");
+    return ERR_OK;
 }
 
 int32_t DSchedCollabManager::CheckCollabRelation(const CollabInfo *sourceInfo, const CollabInfo *sinkInfo)
@@ -69,7 +69,9 @@ int32_t DSchedCollabStateMachine::Execute(const AppExecFwk::InnerEvent::Pointer
     }
 
     auto state = currentState_;
+    tracer_.BeginEvent(event != nullptr ? event->GetInnerEventId() : DmsStateTracer::NO_EVENT);
     int32_t ret = state->Execute(dCollab, event);
+    tracer_.EndEvent();
     if (ret != ERR_OK) {
         HILOGE("currentState: %{public}s, excute event: %{public}s failed, ret %{public}d",
             STATEDATA[state->GetStateType()].c_str(), EVENTDATA[event->GetInnerEventId()].c_str(), ret);
@@ -88,6 +90,9 @@ void DSchedCollabStateMachine::UpdateState(CollabStateType stateType)
         HILOGI("update state: %{public}s", STATEDATA[stateType].c_str());
     }
     currentState_ = CreateState(stateType);
+    if (currentState_ != nullptr) {
+        tracer_.OnStateChanged(stateType);
+    }
     HILOGI("end");
     return;
 }
@@ -28,12 +28,14 @@
 #include "dfx/distributed_ue.h"
 #include "dfx/dms_continue_time_dumper.h"
 #include "dfx/dms_hianalytics_report.h"
+#include "dfx/dms_latency_histogram.h"
 #include "distributed_sched_permission.h"
 #include "distributed_sched_service.h"
 #include "distributed_sched_utils.h"
 #include "dsched_continue_event.h"
 #include "dsched_continue_manager.h"
 #include "dsched_data_buffer.h"
+#include "dsched_readiness_waiter.h"
 #include "dtbschedmgr_device_info_storage.h"
 #include "dtbschedmgr_log.h"
 #include "mission/distributed_bm_storage.h"
@@ -67,7 +69,9 @@ const std::string QUICK_START_SUCCESS_MESSAGE = "quickstart success.";
 const std::string QUICK_START_FAILED_MESSAGE = "quickstart failed. error code: ";
 const std::u16string NAPI_MISSION_CALLBACK_INTERFACE_TOKEN = u"ohos.DistributedSchedule.IMissionCallback";
 
-constexpr int32_t DSCHED_CONTINUE_PROTOCOL_VERSION = 1;
+constexpr int32_t DSCHED_CONTINUE_PROTOCOL_VERSION = 2;
+// first protocol version whose sink accepts the data header command
+constexpr int32_t DSCHED_CONTINUE_DATA_HEADER_VERSION = 2;
 constexpr uint32_t MAX_MODULENAME_LEN = 2048;
 constexpr int32_t DEFAULT_REQUEST_CODE = -1;
 constexpr int32_t NOTIFY_MISSION_CALLBACK_RESULT = 4;
@@ -80,8 +84,7 @@ constexpr int32_t CONTINUE_TOTAL_TIME = 2;
 constexpr int32_t CONTINUE_FIRST_TRANS_TIME = 3;
 constexpr int32_t CONTINUE_DATA_TRANS_TIME = 5;
 constexpr int32_t CONTINUE_START_ABILITY_TIME = 6;
-constexpr int32_t GET_ABILITY_STATE_RETRY_TIMES = 40;
-constexpr int32_t GET_ABILITY_STATE_SLEEP_TIME = 50;
+constexpr int64_t GET_ABILITY_STATE_TIMEOUT = 2000; // ms
 constexpr int32_t QUICK_START_SUCCESS = 0;
 constexpr int32_t QUICK_START_FAILED = 1;
 
@@ -152,6 +155,7 @@ DSchedContinue::DSchedContinue(std::shared_ptr<DSchedContinueStartCmd> startCmd,
         return;
     }
     version_ = DSCHED_CONTINUE_PROTOCOL_VERSION;
+    peerVersion_ = startCmd->version_;
     subServiceType_ = startCmd->subServiceType_;
     continueByType_ = startCmd->continueByType_;
     direction_ = (startCmd->direction_ == CONTINUE_SOURCE) ? CONTINUE_SINK : CONTINUE_SOURCE;
@@ -307,6 +311,9 @@ int32_t DSchedContinue::PostCotinueAbilityTask(int32_t appVersion)
 int32_t DSchedContinue::OnReplyCmd(std::shared_ptr<DSchedContinueReplyCmd> cmd)
 {
     HILOGI("called");
+    if (cmd != nullptr) {
+        peerVersion_ = cmd->version_;
+    }
     return PostReplyTask(cmd);
 }
 
@@ -422,6 +429,24 @@ int32_t DSchedContinue::PostContinueDataTask(std::shared_ptr<DSchedContinueDataC
     return ERR_OK;
 }
 
+int32_t DSchedContinue::PostContinueDataHeaderTask(std::shared_ptr<DSchedContinueDataHeaderCmd> cmd)
+{
+    DSchedContinueEventType eventType = DSCHED_CONTINUE_DATA_HEADER_EVENT;
+    HILOGI("PostContinueDataHeaderTask %{public}d, continueInfo %{public}s", eventType,
+        continueInfo_.ToString().c_str());
+    if (eventHandler_ == nullptr) {
+        HILOGE("PostContinueDataHeaderTask eventHandler is nullptr");
+        return INVALID_PARAMETERS_ERR;
+    }
+
+    auto msgEvent = AppExecFwk::InnerEvent::Get(eventType, cmd, 0);
+    if (!eventHandler_->SendEvent(msgEvent, 0, AppExecFwk::EventQueue::Priority::IMMEDIATE)) {
+        HILOGE("PostContinueDataHeaderTask eventHandler send event type %{public}d fail", eventType);
+        return CONTINUE_SEND_EVENT_FAILED;
+    }
+    return ERR_OK;
+}
+
 int32_t DSchedContinue::OnNotifyComplete(int32_t missionId, bool isSuccess)
 {
     HILOGI("called");
@@ -527,21 +552,84 @@ int32_t DSchedContinue::ExecuteContinueReq(std::shared_ptr<DistributedWantParams
         QuickStartAbility();
     }
 
-    int32_t ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDevice(peerDeviceId, softbusSessionId_);
+    // the all-connect decision may take long, the rest goes on in ExecuteContinueReqConnected
+    std::weak_ptr<DSchedContinue> weakContinue = shared_from_this();
+    int32_t ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDeviceAsync(peerDeviceId,
+        SERVICE_TYPE_CONTINUE, [weakContinue, wantParams](int32_t result, int32_t sessionId) {
+            auto dContinue = weakContinue.lock();
+            if (dContinue == nullptr) {
+                HILOGW("continue released while connecting, sessionId %{public}d", sessionId);
+                if (result == ERR_OK) {
+                    DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+                }
+                return;
+            }
+            dContinue->PostConnectResultTask(result, sessionId, wantParams);
+        });
     if (ret != ERR_OK) {
         HILOGE("ExecuteContinueReq connect peer device %{public}s failed, ret %{public}d",
             GetAnonymStr(peerDeviceId).c_str(), ret);
         return ret;
     }
+    HILOGI("ExecuteContinueReq end");
+    return ERR_OK;
+}
+
+void DSchedContinue::PostConnectResultTask(int32_t result, int32_t sessionId,
+    std::shared_ptr<DistributedWantParams> wantParams)
+{
+    HILOGI("PostConnectResultTask result %{public}d, sessionId %{public}d, continueInfo %{public}s", result,
+        sessionId, continueInfo_.ToString().c_str());
+    if (eventHandler_ == nullptr) {
+        HILOGE("PostConnectResultTask eventHandler is nullptr");
+        if (result == ERR_OK) {
+            DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+        }
+        return;
+    }
+    auto dContinue = shared_from_this();
+    auto func = [dContinue, result, sessionId, wantParams]() {
+        int32_t ret = result;
+        if (ret != ERR_OK) {
+            HILOGE("ExecuteContinueReq connect peer device failed, ret %{public}d", ret);
+        } else {
+            ret = dContinue->ExecuteContinueReqConnected(sessionId, wantParams);
+        }
+        if (ret != ERR_OK) {
+            dContinue->OnContinueEnd(ret);
+        }
+    };
+    if (!eventHandler_->PostTask(func)) {
+        HILOGE("PostConnectResultTask eventHandler post task fail");
+        if (result == ERR_OK) {
+            DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+        }
+    }
+}
+
+int32_t DSchedContinue::ExecuteContinueReqConnected(int32_t sessionId,
+    std::shared_ptr<DistributedWantParams> wantParams)
+{
+    if (stateMachine_ == nullptr || (stateMachine_->GetStateType() != DSCHED_CONTINUE_SOURCE_START_STATE &&
+        stateMachine_->GetStateType() != DSCHED_CONTINUE_SINK_START_STATE)) {
+        HILOGW("ExecuteContinueReq already ended, drop the late sessionId %{public}d", sessionId);
+        DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+        return ERR_OK;
+    }
+    std::string peerDeviceId = (direction_ == CONTINUE_SOURCE) ?
+        continueInfo_.sinkDeviceId_ : continueInfo_.sourceDeviceId_;
+    softbusSessionId_ = sessionId;
     HILOGI("ExecuteContinueReq peer %{public}s connected, sessionId %{public}d",
         GetAnonymStr(peerDeviceId).c_str(), softbusSessionId_);
 
     auto startCmd = std::make_shared<DSchedContinueStartCmd>();
-    ret = PackStartCmd(startCmd, wantParams);
+    int64_t packBeginUs = DmsLatencyRegistry::GetNowUs();
+    int32_t ret = PackStartCmd(startCmd, wantParams);
     if (ret != ERR_OK) {
         HILOGE("ExecuteContinueReq pack start cmd failed, ret %{public}d", ret);
         return ret;
     }
+    DmsLatencyRegistry::GetInstance().RecordSince(DmsLatencyStage::PACK_START_CMD, packBeginUs);
     ret = SendCommand(startCmd);
     if (ret != ERR_OK) {
         HILOGE("ExecuteContinueReq send start cmd failed, ret %{public}d", ret);
@@ -551,7 +639,7 @@ int32_t DSchedContinue::ExecuteContinueReq(std::shared_ptr<DistributedWantParams
         UpdateState(DSCHED_CONTINUE_DATA_STATE);
         DmsContinueTime::GetInstance().SetDurationEnd(CONTINUE_FIRST_TRANS_TIME, GetTickCount());
     }
-    HILOGI("ExecuteContinueReq end");
+    HILOGI("ExecuteContinueReqConnected end");
     return ERR_OK;
 }
 
@@ -579,8 +667,8 @@ int32_t DSchedContinue::QuickStartAbility()
         HILOGE("QuickStartAbility failed.");
         return INVALID_PARAMETERS_ERR;
     }
-    ContinueSceneSessionHandler::GetInstance().UpdateContinueSessionId(continueInfo_.sinkBundleName_, abilityName);
-    std::string continueSessionId = ContinueSceneSessionHandler::GetInstance().GetContinueSessionId();
+    std::string continueSessionId = ContinueSceneSessionHandler::GetInstance().UpdateContinueSessionId(
+        continueInfo_.sinkBundleName_, abilityName);
     continueInfo_.continueSessionId_ = continueSessionId;
     HILOGI("continueSessionId is %{public}s", continueSessionId.c_str());
 
@@ -698,6 +786,7 @@ int32_t DSchedContinue::ExecuteContinueAbility(int32_t appVersion)
     auto tick = GetTickCount();
     DmsContinueTime::GetInstance().SetDurationEnd(CONTINUE_FIRST_TRANS_TIME, tick);
     DmsContinueTime::GetInstance().SetSaveDataDurationBegin(tick);
+    saveDataBeginUs_ = DmsLatencyRegistry::GetNowUs();
 
     HILOGI("ExecuteContinueAbility call continueAbility begin, continueInfo: %{public}s",
         continueInfo_.ToString().c_str());
@@ -818,6 +907,7 @@ int32_t DSchedContinue::ExecuteContinueSend(std::shared_ptr<ContinueAbilityData>
 
     auto cmd = std::make_shared<DSchedContinueDataCmd>();
     PackDataCmd(cmd, newWant, abilityInfo, callerInfo, accountInfo);
+    SendDataHeaderCmd(*cmd);
     ret = SendCommand(cmd);
     DmsRadar::GetInstance().SaveDataDmsRemoteWant("SendContinueData", ret);
     if (ret != ERR_OK) {
@@ -837,6 +927,8 @@ void DSchedContinue::DurationDumperBeforeStartRemoteAbility()
     DmsContinueTime::GetInstance().SetSaveDataDurationEnd(tick);
     DmsContinueTime::GetInstance().SetDurationBegin(CONTINUE_DATA_TRANS_TIME, tick);
     DmsContinueTime::GetInstance().SetDurationBegin(CONTINUE_START_ABILITY_TIME, tick);
+    DmsLatencyRegistry::GetInstance().RecordSince(DmsLatencyStage::DATA_SAVE, saveDataBeginUs_);
+    saveDataBeginUs_ = 0;
 }
 
 void DSchedContinue::SetCleanMissionFlag(const OHOS::AAFwk::Want& want)
@@ -916,6 +1008,21 @@ int32_t DSchedContinue::PackDataCmd(std::shared_ptr<DSchedContinueDataCmd>& cmd,
     return ERR_OK;
 }
 
+void DSchedContinue::SendDataHeaderCmd(const DSchedContinueDataCmd& dataCmd)
+{
+    if (peerVersion_ < DSCHED_CONTINUE_DATA_HEADER_VERSION) {
+        HILOGI("peer version %{public}d does not support data header", peerVersion_.load());
+        return;
+    }
+    // the sink resolves and checks the target from the header while the want is still in flight
+    auto headerCmd = std::make_shared<DSchedContinueDataHeaderCmd>();
+    headerCmd->FromDataCmd(dataCmd);
+    int32_t ret = SendCommand(headerCmd);
+    if (ret != ERR_OK) {
+        HILOGW("send data header cmd failed, ret %{public}d, sink waits for the data cmd", ret);
+    }
+}
+
 int32_t DSchedContinue::CheckStartPermission(std::shared_ptr<DSchedContinueDataCmd> cmd)
 {
     if (cmd->srcBundleName_ == cmd->dstBundleName_) {
@@ -938,7 +1045,8 @@ int32_t DSchedContinue::ExecuteContinueData(std::shared_ptr<DSchedContinueDataCm
         return INVALID_PARAMETERS_ERR;
     }
 
-    if (UpdateElementInfo(cmd) != ERR_OK) {
+    bool isPrepared = UsePreparedHeader(cmd);
+    if (!isPrepared && UpdateElementInfo(cmd) != ERR_OK) {
         HILOGE("ExecuteContinueData UpdateElementInfo failed.");
     }
     DurationDumperBeforeStartAbility(cmd);
@@ -950,6 +1058,7 @@ int32_t DSchedContinue::ExecuteContinueData(std::shared_ptr<DSchedContinueDataCm
         HILOGE("check deviceId failed");
         return INVALID_REMOTE_PARAMETERS_ERR;
     }
+    // the header only resolves the element early, the permission is always checked on what is started
     int32_t ret = CheckStartPermission(cmd);
     if (ret != ERR_OK) {
         HILOGE("ExecuteContinueData CheckTargetPermission failed!");
@@ -958,18 +1067,23 @@ int32_t DSchedContinue::ExecuteContinueData(std::shared_ptr<DSchedContinueDataCm
 
     OHOS::AAFwk::Want want = cmd->want_;
     UpdateWantForContinueType(want);
-    if (subServiceType_ == CONTINUE_PULL &&
-        !ContinueSceneSessionHandler::GetInstance().GetContinueSessionId().empty()) {
-        int32_t persistentId;
-        if (ContinueSceneSessionHandler::GetInstance().GetPersistentId(persistentId) != ERR_OK) {
-            HILOGE("get persistentId failed, stop start ability");
-            return OnContinueEnd(DMS_GET_WINDOW_FAILED_FROM_SCB);
+    // the session id of this continuation, other pulls may be quick starting at the same time
+    if (subServiceType_ == CONTINUE_PULL && !continueInfo_.continueSessionId_.empty()) {
+        int32_t persistentId = preparedPersistentId_;
+        preparedPersistentId_ = 0;
+        if (persistentId == 0) {
+            if (ContinueSceneSessionHandler::GetInstance().GetPersistentId(persistentId,
+                continueInfo_.continueSessionId_) != ERR_OK) {
+                HILOGE("get persistentId failed, stop start ability");
+                return OnContinueEnd(DMS_GET_WINDOW_FAILED_FROM_SCB);
+            }
+            HILOGI("get persistentId success, persistentId: %{public}d", persistentId);
+            WaitAbilityStateInitial(persistentId);
         }
-        HILOGI("get persistentId success, persistentId: %{public}d", persistentId);
-        WaitAbilityStateInitial(persistentId);
         want.SetParam(DMS_PERSISTENT_ID, persistentId);
 
-        if (ContinueSceneSessionHandler::GetInstance().GetPersistentId(persistentId) != ERR_OK) {
+        if (ContinueSceneSessionHandler::GetInstance().GetPersistentId(persistentId,
+            continueInfo_.continueSessionId_) != ERR_OK) {
             HILOGE("Second get persistentId failed, stop start ability");
             return OnContinueEnd(DMS_GET_WINDOW_FAILED_FROM_SCB);
         }
@@ -984,6 +1098,68 @@ int32_t DSchedContinue::ExecuteContinueData(std::shared_ptr<DSchedContinueDataCm
     return ret;
 }
 
+int32_t DSchedContinue::ExecuteContinueDataHeader(std::shared_ptr<DSchedContinueDataHeaderCmd> cmd)
+{
+    HILOGI("ExecuteContinueDataHeader start, continueInfo: %{public}s", continueInfo_.ToString().c_str());
+    preparedHeader_ = nullptr;
+    preparedPersistentId_ = 0;
+    if (cmd == nullptr) {
+        HILOGE("cmd is null");
+        return INVALID_PARAMETERS_ERR;
+    }
+
+    // failures leave the header unused, the data cmd runs the checks again and reports the result
+    auto resolvedCmd = std::make_shared<DSchedContinueDataHeaderCmd>(*cmd);
+    int32_t ret = UpdateElementInfo(resolvedCmd);
+    if (ret != ERR_OK) {
+        HILOGW("ExecuteContinueDataHeader UpdateElementInfo failed, ret: %{public}d", ret);
+        return ERR_OK;
+    }
+    std::string localDeviceId;
+    std::string deviceId = resolvedCmd->want_.GetElement().GetDeviceID();
+    if (!GetLocalDeviceId(localDeviceId) ||
+        !CheckDeviceIdFromRemote(localDeviceId, deviceId, resolvedCmd->callerInfo_.sourceDeviceId)) {
+        HILOGW("ExecuteContinueDataHeader check deviceId failed");
+        return ERR_OK;
+    }
+    ret = CheckStartPermission(resolvedCmd);
+    if (ret != ERR_OK) {
+        HILOGW("ExecuteContinueDataHeader CheckTargetPermission failed, ret: %{public}d", ret);
+        return ERR_OK;
+    }
+
+    // the quick started ability gets ready while the want is still being received
+    if (subServiceType_ == CONTINUE_PULL && !continueInfo_.continueSessionId_.empty()) {
+        int32_t persistentId = 0;
+        if (ContinueSceneSessionHandler::GetInstance().GetPersistentId(persistentId,
+            continueInfo_.continueSessionId_) == ERR_OK) {
+            WaitAbilityStateInitial(persistentId);
+            preparedPersistentId_ = persistentId;
+        }
+    }
+    preparedHeader_ = cmd;
+    preparedElement_ = resolvedCmd->want_.GetElement();
+    HILOGI("ExecuteContinueDataHeader end");
+    return ERR_OK;
+}
+
+bool DSchedContinue::UsePreparedHeader(std::shared_ptr<DSchedContinueDataCmd> cmd)
+{
+    auto headerCmd = preparedHeader_;
+    preparedHeader_ = nullptr;
+    if (headerCmd == nullptr) {
+        preparedPersistentId_ = 0;
+        return false;
+    }
+    if (!headerCmd->IsHeaderOf(*cmd)) {
+        HILOGW("data cmd does not match the data header, check it again");
+        preparedPersistentId_ = 0;
+        return false;
+    }
+    cmd->want_.SetElement(preparedElement_);
+    return true;
+}
+
 int32_t DSchedContinue::UpdateElementInfo(std::shared_ptr<DSchedContinueDataCmd> cmd)
 {
     std::string srcModuleName = cmd->want_.GetModuleName();
@@ -1088,22 +1264,21 @@ void DSchedContinue::DurationDumperBeforeStartAbility(std::shared_ptr<DSchedCont
         DmsContinueTime::GetInstance().SetDstAbilityName(cmd->want_.GetElement().GetAbilityName());
     }
     DmsContinueTime::GetInstance().SetDurationBegin(CONTINUE_START_ABILITY_TIME, GetTickCount());
+    sinkStartBeginUs_ = DmsLatencyRegistry::GetNowUs();
 }
 
 bool DSchedContinue::WaitAbilityStateInitial(int32_t persistentId)
 {
-    int32_t retryTimeout = GET_ABILITY_STATE_RETRY_TIMES;
-    int32_t err;
-    do {
+    int32_t err = ERR_OK;
+    auto probe = [persistentId, &err]() {
         bool state = false;
         err = AAFwk::AbilityManagerClient::GetInstance()->GetAbilityStateByPersistentId(persistentId, state);
-        if (err == ERR_OK && state) {
-            HILOGI("ability state initial.");
-            return state;
-        }
-        HILOGI("waiting ability state initial...");
-        std::this_thread::sleep_for(std::chrono::milliseconds(GET_ABILITY_STATE_SLEEP_TIME));
-    } while (--retryTimeout > 0);
+        return err == ERR_OK && state;
+    };
+    if (DSchedReadinessWaiter::GetInstance().Wait(persistentId, probe, GET_ABILITY_STATE_TIMEOUT)) {
+        HILOGI("ability state initial.");
+        return true;
+    }
 
     HILOGE("wait timeout, persistentId: %{public}d, errorCode: %{public}d",
            persistentId, err);
@@ -1138,6 +1313,10 @@ int32_t DSchedContinue::ExecuteNotifyComplete(int32_t result)
 
     int32_t ret = 0;
     if (direction_ == CONTINUE_SINK) {
+        if (result == ERR_OK) {
+            DmsLatencyRegistry::GetInstance().RecordSince(DmsLatencyStage::SINK_START, sinkStartBeginUs_);
+        }
+        sinkStartBeginUs_ = 0;
         auto cmd = std::make_shared<DSchedContinueEndCmd>();
         PackEndCmd(cmd, result);
 
@@ -1472,6 +1651,17 @@ void DSchedContinue::OnDataRecv(int32_t command, std::shared_ptr<DSchedDataBuffe
             OnContinueDataCmd(dataCmd);
             break;
         }
+        case DSCHED_CONTINUE_CMD_DATA_HEADER: {
+            auto headerCmd = std::make_shared<DSchedContinueDataHeaderCmd>();
+            ret = headerCmd->Unmarshal(jsonStr);
+            if (ret != ERR_OK) {
+                HILOGE("Unmarshal data header cmd failed, ret: %{public}d", ret);
+                return;
+            }
+            headerCmd->want_.SetBundle(headerCmd->dstBundleName_);
+            PostContinueDataHeaderTask(headerCmd);
+            break;
+        }
         case DSCHED_CONTINUE_CMD_REPLY: {
             auto replyCmd = std::make_shared<DSchedContinueReplyCmd>();
             ret = replyCmd->Unmarshal(jsonStr);
@@ -256,6 +256,14 @@ bool DSchedContinueDataCmd::MarshalInner(cJSON* rootValue)
     cJSON_AddStringToObject(rootValue, "AbilityInfo", abilityInfoStr.c_str());
 
     cJSON_AddNumberToObject(rootValue, "RequestCode", requestCode_);
+    return MarshalCallerAndAccount(rootValue);
+}
+
+bool DSchedContinueDataCmd::MarshalCallerAndAccount(cJSON* rootValue)
+{
+    if (rootValue == nullptr) {
+        return false;
+    }
 
     std::string callerInfoStr;
     if (MarshalCallerInfo(callerInfoStr) != ERR_OK) {
@@ -360,95 +368,85 @@ int32_t DSchedContinueDataCmd::MarshalAccountInfo(std::string &jsonStr)
 
 int32_t DSchedContinueDataCmd::Unmarshal(const std::string &jsonStr)
 {
+    // parsed once, the want parcel makes up most of the string
     cJSON *rootValue = cJSON_Parse(jsonStr.c_str());
     if (rootValue == nullptr) {
         return INVALID_PARAMETERS_ERR;
     }
 
-    cJSON *baseCmd = cJSON_GetObjectItemCaseSensitive(rootValue, "BaseCmd");
-    if (baseCmd == nullptr || !cJSON_IsString(baseCmd) || (baseCmd->valuestring == nullptr)) {
+    if (UnmarshalBaseCmd(rootValue) != ERR_OK || UnmarshalParcel(rootValue) != ERR_OK) {
         cJSON_Delete(rootValue);
         return INVALID_PARAMETERS_ERR;
     }
-    std::string baseCmdStr = baseCmd->valuestring;
-    if (DSchedContinueCmdBase::Unmarshal(baseCmdStr) != ERR_OK) {
+
+    cJSON *requestCode = cJSON_GetObjectItemCaseSensitive(rootValue, "RequestCode");
+    if (requestCode == nullptr || !cJSON_IsNumber(requestCode)) {
         cJSON_Delete(rootValue);
         return INVALID_PARAMETERS_ERR;
     }
+    requestCode_ = requestCode->valueint;
 
-    if (UnmarshalParcel(jsonStr) != ERR_OK) {
+    if (UnmarshalCallerAndAccount(rootValue) != ERR_OK) {
         cJSON_Delete(rootValue);
         return INVALID_PARAMETERS_ERR;
     }
 
-    cJSON *requestCode = cJSON_GetObjectItemCaseSensitive(rootValue, "RequestCode");
-    if (requestCode == nullptr || !cJSON_IsNumber(requestCode)) {
-        cJSON_Delete(rootValue);
+    cJSON_Delete(rootValue);
+    return ERR_OK;
+}
+
+int32_t DSchedContinueDataCmd::UnmarshalBaseCmd(cJSON* rootValue)
+{
+    cJSON *baseCmd = cJSON_GetObjectItemCaseSensitive(rootValue, "BaseCmd");
+    if (baseCmd == nullptr || !cJSON_IsString(baseCmd) || (baseCmd->valuestring == nullptr)) {
+        HILOGE("BaseCmd term is null or not string.");
         return INVALID_PARAMETERS_ERR;
     }
-    requestCode_ = requestCode->valueint;
+    return DSchedContinueCmdBase::Unmarshal(baseCmd->valuestring);
+}
 
+int32_t DSchedContinueDataCmd::UnmarshalCallerAndAccount(cJSON* rootValue)
+{
     cJSON *callerInfoJson = cJSON_GetObjectItemCaseSensitive(rootValue, "CallerInfo");
     if (callerInfoJson == nullptr || !cJSON_IsString(callerInfoJson) || (callerInfoJson->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
+        HILOGE("CallerInfo term is null or not string.");
         return INVALID_PARAMETERS_ERR;
     }
-    std::string callerInfoStr = callerInfoJson->valuestring;
-    if (UnmarshalCallerInfo(callerInfoStr) != ERR_OK) {
-        cJSON_Delete(rootValue);
+    if (UnmarshalCallerInfo(callerInfoJson->valuestring) != ERR_OK) {
         return INVALID_PARAMETERS_ERR;
     }
 
     cJSON *accountInfoJson = cJSON_GetObjectItemCaseSensitive(rootValue, "AccountInfo");
     if (accountInfoJson == nullptr || !cJSON_IsString(accountInfoJson) || (accountInfoJson->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
+        HILOGE("AccountInfo term is null or not string.");
         return INVALID_PARAMETERS_ERR;
     }
-    std::string accountInfoStr = accountInfoJson->valuestring;
-    if (UnmarshalAccountInfo(accountInfoStr) != ERR_OK) {
-        cJSON_Delete(rootValue);
-        return INVALID_PARAMETERS_ERR;
-    }
-
-    cJSON_Delete(rootValue);
-    return ERR_OK;
+    return UnmarshalAccountInfo(accountInfoJson->valuestring);
 }
 
-int32_t DSchedContinueDataCmd::UnmarshalParcel(const std::string &jsonStr)
+int32_t DSchedContinueDataCmd::UnmarshalParcel(cJSON* rootValue)
 {
-    cJSON *rootValue = cJSON_Parse(jsonStr.c_str());
-    if (rootValue == nullptr) {
-        HILOGE("Want and AbilityInfo json string parse to cjson fail.");
-        return INVALID_PARAMETERS_ERR;
-    }
-
     if (!UnmarshalWantParcel(rootValue)) {
-        cJSON_Delete(rootValue);
         return INVALID_PARAMETERS_ERR;
     }
 
     cJSON *abilityInfoStr = cJSON_GetObjectItemCaseSensitive(rootValue, "AbilityInfo");
     if (abilityInfoStr == nullptr || !cJSON_IsString(abilityInfoStr) || (abilityInfoStr->valuestring == nullptr)) {
-        cJSON_Delete(rootValue);
         HILOGE("AbilityInfo term is null or not string.");
         return INVALID_PARAMETERS_ERR;
     }
     Parcel abilityParcel;
     int32_t ret = Base64StrToParcel(abilityInfoStr->valuestring, abilityParcel);
     if (ret != ERR_OK) {
-        cJSON_Delete(rootValue);
         HILOGE("AbilityInfo parcel Base64Str unmarshal fail, ret %{public}d.", ret);
         return INVALID_PARAMETERS_ERR;
     }
     auto abilityInfoPtr = AppExecFwk::CompatibleAbilityInfo::Unmarshalling(abilityParcel);
     if (abilityInfoPtr == nullptr) {
-        cJSON_Delete(rootValue);
         HILOGE("AppExecFwk CompatibleAbilityInfo unmarshalling fail, check return null.");
         return INVALID_PARAMETERS_ERR;
     }
     abilityInfo_ = *abilityInfoPtr;
-
-    cJSON_Delete(rootValue);
     return ERR_OK;
 }
 
@@ -624,6 +622,134 @@ int32_t DSchedContinueDataCmd::UnmarshalAccountInfo(const std::string &jsonStr)
     return ERR_OK;
 }
 
+int32_t DSchedContinueDataHeaderCmd::Marshal(std::string &jsonStr)
+{
+    cJSON *rootValue = cJSON_CreateObject();
+    if (rootValue == nullptr) {
+        return INVALID_PARAMETERS_ERR;
+    }
+
+    std::string baseJsonStr;
+    if (DSchedContinueCmdBase::Marshal(baseJsonStr) != ERR_OK) {
+        cJSON_Delete(rootValue);
+        return INVALID_PARAMETERS_ERR;
+    }
+    cJSON_AddStringToObject(rootValue, "BaseCmd", baseJsonStr.c_str());
+
+    auto element = want_.GetElement();
+    cJSON_AddStringToObject(rootValue, "DeviceId", element.GetDeviceID().c_str());
+    cJSON_AddStringToObject(rootValue, "BundleName", element.GetBundleName().c_str());
+    cJSON_AddStringToObject(rootValue, "AbilityName", element.GetAbilityName().c_str());
+    cJSON_AddStringToObject(rootValue, "ModuleName", element.GetModuleName().c_str());
+    cJSON_AddNumberToObject(rootValue, "WantFlags", want_.GetFlags());
+    cJSON_AddNumberToObject(rootValue, "RequestCode", requestCode_);
+    if (!MarshalCallerAndAccount(rootValue)) {
+        cJSON_Delete(rootValue);
+        return INVALID_PARAMETERS_ERR;
+    }
+
+    char *data = cJSON_Print(rootValue);
+    if (data == nullptr) {
+        cJSON_Delete(rootValue);
+        return INVALID_PARAMETERS_ERR;
+    }
+    jsonStr = std::string(data);
+    cJSON_Delete(rootValue);
+    cJSON_free(data);
+    return ERR_OK;
+}
+
+int32_t DSchedContinueDataHeaderCmd::Unmarshal(const std::string &jsonStr)
+{
+    cJSON *rootValue = cJSON_Parse(jsonStr.c_str());
+    if (rootValue == nullptr) {
+        HILOGE("Data header json string parse to cjson fail.");
+        return INVALID_PARAMETERS_ERR;
+    }
+
+    if (UnmarshalBaseCmd(rootValue) != ERR_OK || UnmarshalElement(rootValue) != ERR_OK) {
+        cJSON_Delete(rootValue);
+        return INVALID_PARAMETERS_ERR;
+    }
+
+    cJSON *requestCode = cJSON_GetObjectItemCaseSensitive(rootValue, "RequestCode");
+    if (requestCode == nullptr || !cJSON_IsNumber(requestCode)) {
+        cJSON_Delete(rootValue);
+        HILOGE("RequestCode term is null or not number.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    requestCode_ = requestCode->valueint;
+
+    if (UnmarshalCallerAndAccount(rootValue) != ERR_OK) {
+        cJSON_Delete(rootValue);
+        return INVALID_PARAMETERS_ERR;
+    }
+
+    cJSON_Delete(rootValue);
+    return ERR_OK;
+}
+
+int32_t DSchedContinueDataHeaderCmd::UnmarshalElement(cJSON* rootValue)
+{
+    const char *strKeys[] = { "DeviceId", "BundleName", "AbilityName", "ModuleName" };
+    std::string strValues[] = { "", "", "", "" };
+    int32_t strLength = sizeof(strKeys) / sizeof(strKeys[0]);
+    for (int32_t i = 0; i < strLength; i++) {
+        cJSON *item = cJSON_GetObjectItemCaseSensitive(rootValue, strKeys[i]);
+        if (item == nullptr || !cJSON_IsString(item) || (item->valuestring == nullptr)) {
+            HILOGE("Data header %{public}s term is null or not string.", strKeys[i]);
+            return INVALID_PARAMETERS_ERR;
+        }
+        strValues[i] = item->valuestring;
+    }
+    want_.SetElementName(strValues[0], strValues[1], strValues[2], strValues[3]);
+
+    cJSON *flags = cJSON_GetObjectItemCaseSensitive(rootValue, "WantFlags");
+    if (flags == nullptr || !cJSON_IsNumber(flags)) {
+        HILOGE("Data header WantFlags term is null or not number.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    want_.SetFlags(static_cast<unsigned int>(flags->valuedouble));
+    return ERR_OK;
+}
+
+void DSchedContinueDataHeaderCmd::FromDataCmd(const DSchedContinueDataCmd &dataCmd)
+{
+    static_cast<DSchedContinueCmdBase &>(*this) = dataCmd;
+    command_ = DSCHED_CONTINUE_CMD_DATA_HEADER;
+
+    // the sink resolves the module the same way from the full want
+    auto element = dataCmd.want_.GetElement();
+    std::string moduleName = element.GetModuleName();
+    if (moduleName.empty()) {
+        moduleName = dataCmd.want_.GetStringParam(OHOS::AAFwk::Want::PARAM_MODULE_NAME);
+    }
+    want_ = OHOS::AAFwk::Want();
+    want_.SetElementName(element.GetDeviceID(), element.GetBundleName(), element.GetAbilityName(), moduleName);
+    want_.SetFlags(dataCmd.want_.GetFlags());
+    requestCode_ = dataCmd.requestCode_;
+    callerInfo_ = dataCmd.callerInfo_;
+    accountInfo_ = dataCmd.accountInfo_;
+}
+
+bool DSchedContinueDataHeaderCmd::IsHeaderOf(const DSchedContinueDataCmd &dataCmd) const
+{
+    DSchedContinueDataHeaderCmd expected;
+    expected.FromDataCmd(dataCmd);
+    return srcDeviceId_ == expected.srcDeviceId_ && dstDeviceId_ == expected.dstDeviceId_ &&
+        srcBundleName_ == expected.srcBundleName_ && dstBundleName_ == expected.dstBundleName_ &&
+        srcDeveloperId_ == expected.srcDeveloperId_ && continueType_ == expected.continueType_ &&
+        sourceMissionId_ == expected.sourceMissionId_ &&
+        want_.GetElement() == expected.want_.GetElement() && want_.GetFlags() == expected.want_.GetFlags() &&
+        requestCode_ == expected.requestCode_ && callerInfo_.uid == expected.callerInfo_.uid &&
+        callerInfo_.accessToken == expected.callerInfo_.accessToken &&
+        callerInfo_.sourceDeviceId == expected.callerInfo_.sourceDeviceId &&
+        callerInfo_.callerAppId == expected.callerInfo_.callerAppId &&
+        accountInfo_.accountType == expected.accountInfo_.accountType &&
+        accountInfo_.activeAccountId == expected.accountInfo_.activeAccountId &&
+        accountInfo_.userId == expected.accountInfo_.userId;
+}
+
 int32_t DSchedContinueReplyCmd::Marshal(std::string &jsonStr)
 {
     cJSON *rootValue = cJSON_CreateObject();
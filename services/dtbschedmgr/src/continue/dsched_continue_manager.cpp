@@ -15,6 +15,7 @@
 
 #include "dsched_continue_manager.h"
 
+#include <algorithm>
 #include <chrono>
 #include <sys/prctl.h>
 
@@ -23,6 +24,7 @@
 #include "continue_scene_session_handler.h"
 #include "dfx/distributed_radar.h"
 #include "distributed_sched_utils.h"
+#include "dsched_continue_prefetcher.h"
 #include "dsched_transport_softbus_adapter.h"
 #include "dtbschedmgr_device_info_storage.h"
 #include "dtbschedmgr_log.h"
@@ -105,9 +107,18 @@ void DSchedContinueManager::UnInit()
     }
 
     DSchedTransportSoftbusAdapter::GetInstance().UnregisterListener(SERVICE_TYPE_CONTINUE, softbusListener_);
-    continues_.clear();
+    {
+        std::lock_guard<std::mutex> continueLock(continueMutex_);
+        continues_.clear();
+    }
     cntSink_ = 0;
     cntSource_ = 0;
+#ifdef DMSFWK_ALL_CONNECT_MGR
+    {
+        std::lock_guard<std::mutex> decisionLock(connectDecisionMutex_);
+        pendingDecisions_.clear();
+    }
+#endif
 
     if (eventHandler_ != nullptr) {
         eventHandler_->GetEventRunner()->Stop();
@@ -126,9 +137,32 @@ void DSchedContinueManager::NotifyAllConnectDecision(std::string peerDeviceId, b
     HILOGI("Notify all connect decision, peerDeviceId %{public}s, isSupport %{public}d.",
         GetAnonymStr(peerDeviceId).c_str(), isSupport);
 #ifdef DMSFWK_ALL_CONNECT_MGR
-    std::lock_guard<std::mutex> decisionLock(connectDecisionMutex_);
-    peerConnectDecision_[peerDeviceId] = isSupport;
-    connectDecisionCond_.notify_all();
+    std::vector<DSchedContinueInfo> pendings;
+    {
+        std::lock_guard<std::mutex> decisionLock(connectDecisionMutex_);
+        auto iter = pendingDecisions_.find(peerDeviceId);
+        if (iter == pendingDecisions_.end()) {
+            HILOGW("No continuation waits for the decision of peerDeviceId %{public}s.",
+                GetAnonymStr(peerDeviceId).c_str());
+            return;
+        }
+        pendings.swap(iter->second);
+        pendingDecisions_.erase(iter);
+    }
+    auto func = [this, pendings, isSupport, peerDeviceId]() {
+        if (!isSupport) {
+            HILOGE("All connect manager refuse bind to PeerDeviceId %{public}s.", GetAnonymStr(peerDeviceId).c_str());
+        }
+        for (const auto &info : pendings) {
+            RemoveTimeout(info);
+            SetTimeOut(info, isSupport ? CONTINUE_TIMEOUT : 0);
+        }
+    };
+    if (eventHandler_ == nullptr) {
+        HILOGE("eventHandler_ is nullptr");
+        return;
+    }
+    eventHandler_->PostTask(func);
 #endif
 }
 
@@ -311,11 +345,9 @@ void DSchedContinueManager::HandleContinueMissionWithBundleName(DSchedContinueIn
         return;
     }
     int32_t subType = CONTINUE_PUSH;
-    if (direction == CONTINUE_SOURCE) {
-        cntSource_++;
-    } else {
-        cntSink_++;
+    if (direction == CONTINUE_SINK) {
         subType = CONTINUE_PULL;
+        DSchedContinuePrefetcher::GetInstance().OnContinueStart(info.sourceDeviceId_);
         if (info.sourceBundleName_.empty()) {
             HILOGW("current sub type is continue pull; but can not get source bundle name from recv cache.");
             std::string firstBundleNamme;
@@ -326,23 +358,26 @@ void DSchedContinueManager::HandleContinueMissionWithBundleName(DSchedContinueIn
             }
         }
     }
+    std::string peerDeviceId = direction == CONTINUE_SOURCE ? info.sinkDeviceId_ : info.sourceDeviceId_;
     {
         std::lock_guard<std::mutex> continueLock(continueMutex_);
         if (!continues_.empty() && continues_.find(info) != continues_.end()) {
             HILOGE("a same continue task is already in progress.");
             return;
         }
+        if (CheckPeerLimit(peerDeviceId) != ERR_OK) {
+            return;
+        }
+        direction == CONTINUE_SOURCE ? cntSource_++ : cntSink_++;
         int32_t currentAccountId = MultiUserManager::GetInstance().GetForegroundUser();
         auto newContinue = std::make_shared<DSchedContinue>(subType, direction, callback, info, currentAccountId);
         newContinue->Init();
         continues_.insert(std::make_pair(info, newContinue));
 #ifdef DMSFWK_ALL_CONNECT_MGR
         {
-            std::unique_lock<std::mutex> decisionLock(connectDecisionMutex_);
-            std::string peerDeviceId = direction == CONTINUE_SOURCE ? info.sinkDeviceId_ : info.sourceDeviceId_;
-            if (peerConnectDecision_.find(peerDeviceId) != peerConnectDecision_.end()) {
-                peerConnectDecision_.erase(peerDeviceId);
-            }
+            // registered before connecting, so a decision made while connecting is not lost
+            std::lock_guard<std::mutex> decisionLock(connectDecisionMutex_);
+            pendingDecisions_[peerDeviceId].push_back(info);
         }
 #endif
         newContinue->OnContinueMission(wantParams);
@@ -355,30 +390,32 @@ void DSchedContinueManager::HandleContinueMissionWithBundleName(DSchedContinueIn
 void DSchedContinueManager::WaitAllConnectDecision(int32_t direction, const DSchedContinueInfo &info, int32_t timeout)
 {
 #ifdef DMSFWK_ALL_CONNECT_MGR
+    // the manager thread is not blocked, other continuations go on while this one waits for its decision;
+    // NotifyAllConnectDecision swaps the decision deadline for the continue timeout
     std::string peerDeviceId = direction == CONTINUE_SOURCE ? info.sinkDeviceId_ : info.sourceDeviceId_;
-    {
-        std::unique_lock<std::mutex> decisionLock(connectDecisionMutex_);
-        connectDecisionCond_.wait_for(decisionLock, std::chrono::seconds(CONNECT_DECISION_WAIT_S),
-            [this, peerDeviceId]() {
-                return peerConnectDecision_.find(peerDeviceId) != peerConnectDecision_.end() &&
-                    peerConnectDecision_.at(peerDeviceId).load();
-            });
-
-        if (peerConnectDecision_.find(peerDeviceId) == peerConnectDecision_.end()) {
-            HILOGE("Not find peerDeviceId %{public}s in peerConnectDecision.", GetAnonymStr(peerDeviceId).c_str());
-            SetTimeOut(info, 0);
-            return;
-        }
-        if (!peerConnectDecision_.at(peerDeviceId).load()) {
-            HILOGE("All connect manager refuse bind to PeerDeviceId %{public}s.", GetAnonymStr(peerDeviceId).c_str());
-            peerConnectDecision_.erase(peerDeviceId);
-            SetTimeOut(info, 0);
-            return;
-        }
-        peerConnectDecision_.erase(peerDeviceId);
+    std::lock_guard<std::mutex> decisionLock(connectDecisionMutex_);
+    auto iter = pendingDecisions_.find(peerDeviceId);
+    if (iter == pendingDecisions_.end() ||
+        std::find(iter->second.begin(), iter->second.end(), info) == iter->second.end()) {
+        HILOGI("decision of peerDeviceId %{public}s already made.", GetAnonymStr(peerDeviceId).c_str());
+        return;
     }
-#endif
+    SetTimeOut(info, CONNECT_DECISION_WAIT_MS);
+#else
     SetTimeOut(info, timeout);
+#endif
+}
+
+void DSchedContinueManager::RemovePendingDecision(const DSchedContinueInfo& info)
+{
+#ifdef DMSFWK_ALL_CONNECT_MGR
+    std::lock_guard<std::mutex> decisionLock(connectDecisionMutex_);
+    for (auto iter = pendingDecisions_.begin(); iter != pendingDecisions_.end();) {
+        auto &infos = iter->second;
+        infos.erase(std::remove(infos.begin(), infos.end(), info), infos.end());
+        iter = infos.empty() ? pendingDecisions_.erase(iter) : std::next(iter);
+    }
+#endif
 }
 
 void DSchedContinueManager::SetTimeOut(const DSchedContinueInfo &info, int32_t timeout)
@@ -496,12 +533,8 @@ void DSchedContinueManager::HandleNotifyCompleteContinuation(const std::u16strin
     bool isSuccess, const std::string &callerBundleName)
 {
     HILOGI("begin, isSuccess %{public}d", isSuccess);
-    auto dContinue = GetDSchedContinueByDevId(devId, missionId);
+    auto dContinue = GetDSchedContinueByDevId(devId, missionId, callerBundleName);
     if (dContinue != nullptr) {
-        if (dContinue->GetContinueInfo().sinkBundleName_ != callerBundleName) {
-            HILOGE("callerBundleName doesn't match the existing continuation");
-            return;
-        }
         dContinue->OnNotifyComplete(missionId, isSuccess);
         HILOGI("end, continue info: %{public}s.", dContinue->GetContinueInfo().ToString().c_str());
     }
@@ -509,10 +542,11 @@ void DSchedContinueManager::HandleNotifyCompleteContinuation(const std::u16strin
 }
 
 std::shared_ptr<DSchedContinue> DSchedContinueManager::GetDSchedContinueByDevId(
-    const std::u16string& devId, int32_t missionId)
+    const std::u16string& devId, int32_t missionId, const std::string& callerBundleName)
 {
     std::string deviceId = Str16ToStr8(devId);
-    HILOGI("begin, deviceId %{public}s, missionId %{public}d", GetAnonymStr(deviceId).c_str(), missionId);
+    HILOGI("begin, deviceId %{public}s, missionId %{public}d, callerBundleName %{public}s",
+        GetAnonymStr(deviceId).c_str(), missionId, callerBundleName.c_str());
     {
         std::lock_guard<std::mutex> continueLock(continueMutex_);
         if (continues_.empty()) {
@@ -520,12 +554,17 @@ std::shared_ptr<DSchedContinue> DSchedContinueManager::GetDSchedContinueByDevId(
             return nullptr;
         }
         for (auto iter = continues_.begin(); iter != continues_.end(); iter++) {
-            if (iter->second != nullptr && deviceId == iter->second->GetContinueInfo().sourceDeviceId_) {
+            if (iter->second == nullptr) {
+                continue;
+            }
+            // several continuations may come from the same source, the sink bundle tells them apart
+            DSchedContinueInfo continueInfo = iter->second->GetContinueInfo();
+            if (deviceId == continueInfo.sourceDeviceId_ && callerBundleName == continueInfo.sinkBundleName_) {
                 return iter->second;
             }
         }
     }
-    HILOGE("source deviceId doesn't match an existing continuation.");
+    HILOGE("source deviceId and callerBundleName don't match an existing continuation.");
     return nullptr;
 }
 
@@ -668,6 +707,7 @@ void DSchedContinueManager::HandleContinueEnd(const DSchedContinueInfo& info)
         return;
     }
     RemoveTimeout(info);
+    RemovePendingDecision(info);
     continues_.erase(info);
     ContinueSceneSessionHandler::GetInstance().ClearContinueSessionId();
 
@@ -774,14 +814,11 @@ void DSchedContinueManager::NotifyContinueDataRecv(int32_t sessionId, int32_t co
 {
     HILOGI("start, parsed cmd %{public}d, sessionId: %{public}d.", command, sessionId);
     std::lock_guard<std::mutex> continueLock(continueMutex_);
-    if (!continues_.empty()) {
-        for (auto iter = continues_.begin(); iter != continues_.end(); iter++) {
-            if (iter->second != nullptr && sessionId == iter->second->GetSessionId()) {
-                HILOGI("sessionId %{public}d exist.", sessionId);
-                iter->second->OnDataRecv(command, dataBuffer);
-                return;
-            }
-        }
+    auto dContinue = FindContinueBySession(sessionId, command, jsonStr);
+    if (dContinue != nullptr) {
+        HILOGI("sessionId %{public}d exist.", sessionId);
+        dContinue->OnDataRecv(command, dataBuffer);
+        return;
     }
 
     if (command == DSCHED_CONTINUE_CMD_START) {
@@ -799,11 +836,17 @@ void DSchedContinueManager::NotifyContinueDataRecv(int32_t sessionId, int32_t co
             HILOGE("CheckContinuationSubType failed, ret: %{public}d", ret);
             return;
         }
+        ret = CheckPeerLimit(direction == CONTINUE_SOURCE ? startCmd->dstDeviceId_ : startCmd->srcDeviceId_);
+        if (ret != ERR_OK) {
+            DmsRadar::GetInstance().SaveDataDmsRemoteWant("NotifyContinueDataRecv", ret);
+            return;
+        }
 
         int32_t currentAccountId = MultiUserManager::GetInstance().GetForegroundUser();
         auto newContinue = std::make_shared<DSchedContinue>(startCmd, sessionId, currentAccountId);
         newContinue->Init();
         continues_.insert(std::make_pair(newContinue->GetContinueInfo(), newContinue));
+        direction == CONTINUE_SOURCE ? cntSource_++ : cntSink_++;
 
         newContinue->OnStartCmd(startCmd->appVersion_);
         HILOGI("end, continue info: %{public}s.", newContinue->GetContinueInfo().ToString().c_str());
@@ -813,6 +856,56 @@ void DSchedContinueManager::NotifyContinueDataRecv(int32_t sessionId, int32_t co
     return;
 }
 
+std::shared_ptr<DSchedContinue> DSchedContinueManager::FindContinueBySession(int32_t sessionId, int32_t command,
+    const std::string& jsonStr)
+{
+    std::vector<std::shared_ptr<DSchedContinue>> sessionContinues;
+    for (auto iter = continues_.begin(); iter != continues_.end(); iter++) {
+        if (iter->second != nullptr && sessionId == iter->second->GetSessionId()) {
+            sessionContinues.push_back(iter->second);
+        }
+    }
+    if (sessionContinues.empty()) {
+        return nullptr;
+    }
+    if (sessionContinues.size() == 1 && command != DSCHED_CONTINUE_CMD_START) {
+        return sessionContinues.front();
+    }
+
+    // all continuations with one peer share its session, the ids in the command tell them apart
+    DSchedContinueCmdBase cmd;
+    if (UnmarshalBaseCmd(jsonStr, cmd) != ERR_OK) {
+        HILOGE("Unmarshal base cmd failed, sessionId: %{public}d.", sessionId);
+        return nullptr;
+    }
+    for (const auto &dContinue : sessionContinues) {
+        DSchedContinueInfo info = dContinue->GetContinueInfo();
+        if (info.sourceDeviceId_ == cmd.srcDeviceId_ && info.sinkDeviceId_ == cmd.dstDeviceId_ &&
+            (info.sourceBundleName_ == cmd.srcBundleName_ || info.sinkBundleName_ == cmd.dstBundleName_)) {
+            return dContinue;
+        }
+    }
+    return nullptr;
+}
+
+int32_t DSchedContinueManager::UnmarshalBaseCmd(const std::string& jsonStr, DSchedContinueCmdBase& cmd)
+{
+    cJSON *rootValue = cJSON_Parse(jsonStr.c_str());
+    if (rootValue == nullptr) {
+        HILOGE("Parse jsonStr error.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    cJSON *baseCmd = cJSON_GetObjectItemCaseSensitive(rootValue, "BaseCmd");
+    if (baseCmd == nullptr || !cJSON_IsString(baseCmd) || (baseCmd->valuestring == nullptr)) {
+        cJSON_Delete(rootValue);
+        HILOGE("Parse base cmd error.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    std::string baseCmdStr = baseCmd->valuestring;
+    cJSON_Delete(rootValue);
+    return cmd.Unmarshal(baseCmdStr);
+}
+
 int32_t DSchedContinueManager::CheckContinuationLimit(const std::string& srcDeviceId,
     const std::string& dstDeviceId, int32_t &direction)
 {
@@ -849,6 +942,22 @@ int32_t DSchedContinueManager::CheckContinuationLimit(const std::string& srcDevi
     return ERR_OK;
 }
 
+int32_t DSchedContinueManager::CheckPeerLimit(const std::string& peerDeviceId)
+{
+    int32_t cntPeer = 0;
+    for (auto iter = continues_.begin(); iter != continues_.end(); iter++) {
+        if (iter->first.sourceDeviceId_ == peerDeviceId || iter->first.sinkDeviceId_ == peerDeviceId) {
+            cntPeer++;
+        }
+    }
+    if (cntPeer >= MAX_CONCURRENT_PER_PEER) {
+        HILOGE("can't deal more than %{public}d continuations with peer %{public}s at the same time.",
+            cntPeer, GetAnonymStr(peerDeviceId).c_str());
+        return CONTINUE_ALREADY_IN_PROGRESS;
+    }
+    return ERR_OK;
+}
+
 int32_t DSchedContinueManager::GetContinueInfo(std::string &srcDeviceId, std::string &dstDeviceId)
 {
     HILOGI("called");
@@ -857,7 +966,14 @@ int32_t DSchedContinueManager::GetContinueInfo(std::string &srcDeviceId, std::st
         HILOGW("No continuation in progress.");
         return ERR_OK;
     }
-    auto dsContinue = continues_.begin()->second;
+    // continues_ is unordered, report the continuation with the smallest info so repeated queries agree
+    auto minIter = continues_.begin();
+    for (auto iter = continues_.begin(); iter != continues_.end(); iter++) {
+        if (iter->first < minIter->first) {
+            minIter = iter;
+        }
+    }
+    auto dsContinue = minIter->second;
     if (dsContinue == nullptr) {
         HILOGE("dContinue is null");
         return INVALID_PARAMETERS_ERR;
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_continue_prefetcher.h"
+
+#include <vector>
+
+#include "distributed_sched_utils.h"
+#include "dsched_transport_softbus_adapter.h"
+#include "dtbschedmgr_log.h"
+#include "parameters.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DSchedContinuePrefetcher";
+const std::string PREFETCH_TIMEOUT_TASK = "ContinuePrefetchTimeout_";
+const std::string PARAM_CONTINUE_PREFETCH = "persist.distributed_scene.continue_prefetch";
+}
+
+IMPLEMENT_SINGLE_INSTANCE(DSchedContinuePrefetcher);
+
+void DSchedContinuePrefetcher::Init()
+{
+    std::shared_ptr<SoftbusListener> softbusListener;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        if (eventHandler_ != nullptr) {
+            return;
+        }
+        isEnabled_ = OHOS::system::GetBoolParameter(PARAM_CONTINUE_PREFETCH, false);
+        HILOGI("Init continue prefetcher, enabled %{public}d.", isEnabled_);
+        auto runner = AppExecFwk::EventRunner::Create("DSchedContinuePrefetch");
+        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+        softbusListener_ = std::make_shared<SoftbusListener>();
+        softbusListener = softbusListener_;
+    }
+    // only the session shutdowns matter here, no data is ever sent with the invalid type
+    DSchedTransportSoftbusAdapter::GetInstance().RegisterListener(SERVICE_TYPE_INVALID, softbusListener);
+}
+
+void DSchedContinuePrefetcher::UnInit()
+{
+    HILOGI("UnInit continue prefetcher.");
+    std::vector<int32_t> readySessions;
+    std::shared_ptr<SoftbusListener> softbusListener;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        if (eventHandler_ != nullptr) {
+            eventHandler_->RemoveAllEvents();
+            eventHandler_ = nullptr;
+        }
+        for (const auto &[networkId, entry] : entries_) {
+            if (entry.state == PrefetchState::READY) {
+                readySessions.push_back(entry.sessionId);
+            }
+        }
+        // a connect still running finds no entry and drops its session itself
+        entries_.clear();
+        softbusListener = softbusListener_;
+        softbusListener_ = nullptr;
+    }
+    if (softbusListener != nullptr) {
+        DSchedTransportSoftbusAdapter::GetInstance().UnregisterListener(SERVICE_TYPE_INVALID, softbusListener);
+    }
+    for (int32_t sessionId : readySessions) {
+        ReleaseSession(sessionId);
+    }
+}
+
+void DSchedContinuePrefetcher::SetEnabled(bool isEnabled)
+{
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        isEnabled_ = isEnabled;
+    }
+    if (!isEnabled) {
+        CancelAll();
+    }
+}
+
+bool DSchedContinuePrefetcher::IsEnabled()
+{
+    std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+    return isEnabled_;
+}
+
+void DSchedContinuePrefetcher::SetBudget(int32_t budget)
+{
+    std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+    budget_ = budget < 0 ? 0 : budget;
+}
+
+void DSchedContinuePrefetcher::SetTimeout(int64_t timeoutMs)
+{
+    std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+    timeoutMs_ = timeoutMs < 0 ? 0 : timeoutMs;
+}
+
+void DSchedContinuePrefetcher::OnFocused(const std::string &networkId, uint16_t bundleNameId)
+{
+    if (networkId.empty()) {
+        return;
+    }
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler;
+    bool needConnect = false;
+    uint64_t generation = 0;
+    int64_t timeoutMs = 0;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        if (!isEnabled_ || eventHandler_ == nullptr) {
+            return;
+        }
+        auto iter = entries_.find(networkId);
+        if (iter != entries_.end()) {
+            // focus moved to another mission of the same peer, keep the session and restart the timer
+            iter->second.bundleNameId = bundleNameId;
+            iter->second.isCanceled = false;
+            iter->second.generation = ++nextGeneration_;
+            generation = iter->second.generation;
+        } else {
+            if (entries_.size() >= static_cast<size_t>(budget_)) {
+                stat_.skippedCount++;
+                HILOGW("Prefetch budget %{public}d used up, skip networkId %{public}s.", budget_,
+                    GetAnonymStr(networkId).c_str());
+                return;
+            }
+            PrefetchEntry entry;
+            entry.bundleNameId = bundleNameId;
+            entry.generation = ++nextGeneration_;
+            generation = entry.generation;
+            entries_[networkId] = entry;
+            stat_.startedCount++;
+            needConnect = true;
+        }
+        eventHandler = eventHandler_;
+        timeoutMs = timeoutMs_;
+    }
+    if (needConnect) {
+        HILOGI("Prefetch continue session, networkId %{public}s, bundleNameId %{public}u.",
+            GetAnonymStr(networkId).c_str(), bundleNameId);
+        eventHandler->PostTask([this, networkId]() {
+            DoPrefetch(networkId);
+        });
+    }
+    eventHandler->PostTask([this, networkId, generation]() {
+        OnTimeout(networkId, generation);
+    }, PREFETCH_TIMEOUT_TASK + std::to_string(generation), timeoutMs);
+}
+
+void DSchedContinuePrefetcher::DoPrefetch(const std::string &networkId)
+{
+    int32_t ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDeviceAsync(networkId, SERVICE_TYPE_CONTINUE,
+        [this, networkId](int32_t result, int32_t sessionId) {
+            OnPrefetchConnected(networkId, result, sessionId);
+        });
+    if (ret != ERR_OK) {
+        OnPrefetchConnected(networkId, ret, 0);
+    }
+}
+
+void DSchedContinuePrefetcher::OnPrefetchConnected(const std::string &networkId, int32_t ret, int32_t sessionId)
+{
+    bool isDropped = false;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        auto iter = entries_.find(networkId);
+        if (ret != ERR_OK) {
+            HILOGE("Prefetch connect fail, ret %{public}d, networkId %{public}s.", ret,
+                GetAnonymStr(networkId).c_str());
+            stat_.failedCount++;
+            if (iter != entries_.end()) {
+                entries_.erase(iter);
+            }
+            return;
+        }
+        if (iter == entries_.end() || iter->second.isCanceled) {
+            if (iter != entries_.end()) {
+                entries_.erase(iter);
+            }
+            isDropped = true;
+        } else {
+            iter->second.state = PrefetchState::READY;
+            iter->second.sessionId = sessionId;
+            stat_.readyCount++;
+        }
+    }
+    if (isDropped) {
+        HILOGI("Prefetch canceled while connecting, networkId %{public}s.", GetAnonymStr(networkId).c_str());
+        ReleaseSession(sessionId);
+        return;
+    }
+    HILOGI("Prefetch ready, networkId %{public}s, sessionId %{public}d.", GetAnonymStr(networkId).c_str(),
+        sessionId);
+}
+
+void DSchedContinuePrefetcher::OnTimeout(const std::string &networkId, uint64_t generation)
+{
+    int32_t sessionId = 0;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        auto iter = entries_.find(networkId);
+        // refocused, canceled or shut down in the meantime
+        if (iter == entries_.end() || iter->second.generation != generation || iter->second.isCanceled) {
+            return;
+        }
+        HILOGI("Prefetch timeout, networkId %{public}s.", GetAnonymStr(networkId).c_str());
+        stat_.timeoutCount++;
+        sessionId = CancelLocked(networkId);
+    }
+    if (sessionId != 0) {
+        ReleaseSession(sessionId);
+    }
+}
+
+void DSchedContinuePrefetcher::OnUnfocused(const std::string &networkId, uint16_t bundleNameId)
+{
+    int32_t sessionId = 0;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        auto iter = entries_.find(networkId);
+        if (iter == entries_.end() || iter->second.isCanceled || iter->second.bundleNameId != bundleNameId) {
+            return;
+        }
+        stat_.canceledCount++;
+        sessionId = CancelLocked(networkId);
+    }
+    if (sessionId != 0) {
+        ReleaseSession(sessionId);
+    }
+}
+
+void DSchedContinuePrefetcher::OnContinueStart(const std::string &networkId)
+{
+    std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+    if (!isEnabled_) {
+        return;
+    }
+    // the continue takes its own session reference, ours is dropped on unfocus or timeout.
+    // An entry whose session shut down is already gone, so that continue binds again and misses.
+    auto iter = entries_.find(networkId);
+    if (iter != entries_.end() && !iter->second.isCanceled && iter->second.state == PrefetchState::READY) {
+        stat_.hitCount++;
+        return;
+    }
+    stat_.missCount++;
+}
+
+void DSchedContinuePrefetcher::Cancel(const std::string &networkId)
+{
+    int32_t sessionId = 0;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        auto iter = entries_.find(networkId);
+        if (iter == entries_.end() || iter->second.isCanceled) {
+            return;
+        }
+        stat_.canceledCount++;
+        sessionId = CancelLocked(networkId);
+    }
+    if (sessionId != 0) {
+        ReleaseSession(sessionId);
+    }
+}
+
+void DSchedContinuePrefetcher::CancelAll()
+{
+    std::vector<int32_t> readySessions;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        std::vector<std::string> networkIds;
+        for (const auto &[networkId, entry] : entries_) {
+            if (!entry.isCanceled) {
+                networkIds.push_back(networkId);
+            }
+        }
+        for (const auto &networkId : networkIds) {
+            stat_.canceledCount++;
+            int32_t sessionId = CancelLocked(networkId);
+            if (sessionId != 0) {
+                readySessions.push_back(sessionId);
+            }
+        }
+    }
+    for (int32_t sessionId : readySessions) {
+        ReleaseSession(sessionId);
+    }
+}
+
+void DSchedContinuePrefetcher::OnShutdown(int32_t sessionId)
+{
+    std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+    for (auto iter = entries_.begin(); iter != entries_.end(); iter++) {
+        if (iter->second.state == PrefetchState::READY && iter->second.sessionId == sessionId) {
+            // the reference went with the session, nothing is left to release
+            HILOGI("Prefetched session %{public}d shutdown, networkId %{public}s.", sessionId,
+                GetAnonymStr(iter->first).c_str());
+            entries_.erase(iter);
+            return;
+        }
+    }
+}
+
+int32_t DSchedContinuePrefetcher::CancelLocked(const std::string &networkId)
+{
+    auto iter = entries_.find(networkId);
+    if (iter == entries_.end()) {
+        return 0;
+    }
+    if (iter->second.state == PrefetchState::CONNECTING) {
+        iter->second.isCanceled = true;
+        return 0;
+    }
+    int32_t sessionId = iter->second.sessionId;
+    entries_.erase(iter);
+    return sessionId;
+}
+
+void DSchedContinuePrefetcher::ReleaseSession(int32_t sessionId)
+{
+    // by session, a continue that reopened a session to the same peer keeps its own
+    HILOGI("Release prefetched session %{public}d.", sessionId);
+    DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(sessionId);
+}
+
+DSchedPrefetchStat DSchedContinuePrefetcher::GetStat()
+{
+    std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+    return stat_;
+}
+
+void DSchedContinuePrefetcher::Dump(std::string &result)
+{
+    std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+    result.append("continue prefetch (").append(isEnabled_ ? "enabled" : "disabled")
+        .append(", budget ").append(std::to_string(budget_))
+        .append(", timeout ").append(std::to_string(timeoutMs_)).append(" ms):\n")
+        .append("  started: ").append(std::to_string(stat_.startedCount))
+        .append(", ready: ").append(std::to_string(stat_.readyCount))
+        .append(", hit: ").append(std::to_string(stat_.hitCount))
+        .append(", miss: ").append(std::to_string(stat_.missCount)).append("\n")
+        .append("  canceled: ").append(std::to_string(stat_.canceledCount))
+        .append(", timeout: ").append(std::to_string(stat_.timeoutCount))
+        .append(", skipped: ").append(std::to_string(stat_.skippedCount))
+        .append(", failed: ").append(std::to_string(stat_.failedCount)).append("\n");
+    for (const auto &[networkId, entry] : entries_) {
+        result.append("  ").append(GetAnonymStr(networkId)).append(": ")
+            .append(entry.state == PrefetchState::READY ? "ready" : "connecting")
+            .append(entry.isCanceled ? ", canceled" : "")
+            .append(", sessionId ").append(std::to_string(entry.sessionId))
+            .append(", bundleNameId ").append(std::to_string(entry.bundleNameId)).append("\n");
+    }
+}
+
+void DSchedContinuePrefetcher::SoftbusListener::OnBind(int32_t socket, PeerSocketInfo info)
+{
+}
+
+void DSchedContinuePrefetcher::SoftbusListener::OnShutdown(int32_t socket, bool isSelfCalled)
+{
+    DSchedContinuePrefetcher::GetInstance().OnShutdown(socket);
+}
+
+void DSchedContinuePrefetcher::SoftbusListener::OnDataRecv(int32_t socket,
+    std::shared_ptr<DSchedDataBuffer> dataBuffer)
+{
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
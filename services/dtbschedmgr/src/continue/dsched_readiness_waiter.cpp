@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_readiness_waiter.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "dtbschedmgr_log.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DSchedReadinessWaiter";
+}
+
+IMPLEMENT_SINGLE_INSTANCE(DSchedReadinessWaiter);
+
+bool DSchedReadinessWaiter::Wait(int32_t missionId, const Probe& probe, int64_t timeoutMs)
+{
+    if (probe == nullptr) {
+        return false;
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    int64_t backoffMs = MIN_BACKOFF_MS;
+    int32_t probeCount = 0;
+    while (true) {
+        // registered before probing, an event between the probe and the wait is not lost
+        auto waiter = AddWaiter(missionId);
+        probeCount++;
+        if (probe()) {
+            RemoveWaiter(waiter);
+            HILOGI("ready after %{public}d probes, missionId: %{public}d.", probeCount, missionId);
+            return true;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            RemoveWaiter(waiter);
+            HILOGE("wait timeout after %{public}d probes, missionId: %{public}d.", probeCount, missionId);
+            return false;
+        }
+        auto wakeTime = std::min(deadline, now + std::chrono::milliseconds(backoffMs));
+        std::future_status status = waiter->promise.get_future().wait_until(wakeTime);
+        RemoveWaiter(waiter);
+        if (status == std::future_status::timeout) {
+            backoffMs = std::min(backoffMs * 2, MAX_BACKOFF_MS);
+        }
+    }
+}
+
+void DSchedReadinessWaiter::Notify(int32_t missionId)
+{
+    std::lock_guard<std::mutex> waiterLock(waiterMutex_);
+    for (auto& waiter : waiters_) {
+        if (waiter->isNotified || (waiter->missionId != ANY_MISSION && waiter->missionId != missionId)) {
+            continue;
+        }
+        waiter->isNotified = true;
+        waiter->promise.set_value();
+    }
+}
+
+std::shared_ptr<DSchedReadinessWaiter::Waiter> DSchedReadinessWaiter::AddWaiter(int32_t missionId)
+{
+    auto waiter = std::make_shared<Waiter>();
+    waiter->missionId = missionId;
+    std::lock_guard<std::mutex> waiterLock(waiterMutex_);
+    waiters_.push_back(waiter);
+    return waiter;
+}
+
+void DSchedReadinessWaiter::RemoveWaiter(const std::shared_ptr<Waiter>& waiter)
+{
+    std::lock_guard<std::mutex> waiterLock(waiterMutex_);
+    waiters_.remove(waiter);
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -49,7 +49,9 @@ int32_t DSchedContinueStateMachine::Execute(const AppExecFwk::InnerEvent::Pointe
     }
 
     auto state = currentState_;
+    tracer_.BeginEvent(event != nullptr ? event->GetInnerEventId() : DmsStateTracer::NO_EVENT);
     int32_t ret = state->Execute(dContinue, event);
+    tracer_.EndEvent();
     if (ret != ERR_OK) {
         HILOGE("DSchedContinueStateMachine currentState: %{public}d excute event %{public}d failed, ret %{public}d",
             state->GetStateType(), event->GetInnerEventId(), ret);
@@ -67,6 +69,9 @@ void DSchedContinueStateMachine::UpdateState(DSchedContinueStateType stateType)
         HILOGI("DSchedContinueStateMachine update state %{public}d", stateType);
     }
     currentState_ = CreateState(stateType);
+    if (currentState_ != nullptr) {
+        tracer_.OnStateChanged(stateType);
+    }
     return;
 }
 
@@ -27,6 +27,7 @@ const std::string TAG = "DSchedContinueDataState";
 DSchedContinueDataState::DSchedContinueDataState(std::shared_ptr<DSchedContinueStateMachine> stateMachine)
     : stateMachine_(stateMachine)
 {
+    memberFuncMap_[DSCHED_CONTINUE_DATA_HEADER_EVENT] = &DSchedContinueDataState::DoContinueDataHeaderTask;
     memberFuncMap_[DSCHED_CONTINUE_DATA_EVENT] = &DSchedContinueDataState::DoContinueDataTask;
     memberFuncMap_[DSCHED_CONTINUE_COMPLETE_EVENT] = &DSchedContinueDataState::DoContinueEndTask;
     memberFuncMap_[DSCHED_CONTINUE_END_EVENT] = &DSchedContinueDataState::DoContinueErrorTask;
@@ -78,6 +79,22 @@ int32_t DSchedContinueDataState::DoContinueDataTask(std::shared_ptr<DSchedContin
     return ret;
 }
 
+int32_t DSchedContinueDataState::DoContinueDataHeaderTask(std::shared_ptr<DSchedContinue> dContinue,
+    const AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (dContinue == nullptr || event == nullptr) {
+        HILOGE("dContinue or event is null");
+        return INVALID_PARAMETERS_ERR;
+    }
+    auto headerCmd = event->GetSharedObject<DSchedContinueDataHeaderCmd>();
+    int32_t ret = dContinue->ExecuteContinueDataHeader(headerCmd);
+    if (ret != ERR_OK) {
+        HILOGW("DSchedContinueDataState ExecuteContinueDataHeader failed, ret: %{public}d", ret);
+    }
+    // the header is only a hint, the data cmd decides how the continuation ends
+    return ERR_OK;
+}
+
 int32_t DSchedContinueDataState::DoContinueErrorTask(std::shared_ptr<DSchedContinue> dContinue,
     const AppExecFwk::InnerEvent::Pointer &event)
 {
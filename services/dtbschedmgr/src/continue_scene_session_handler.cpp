@@ -16,8 +16,8 @@
 #include "continue_scene_session_handler.h"
 
 #include <chrono>
-#include <thread>
 
+#include "dsched_readiness_waiter.h"
 #include "dtbschedmgr_log.h"
 #include "scene_board_judgement.h"
 #include "session_manager_lite.h"
@@ -26,8 +26,7 @@ namespace OHOS {
 namespace DistributedSchedule {
 namespace {
 const std::string TAG = "ContinueSceneSessionHandler";
-constexpr int32_t RETRY_TIMES = 60;
-constexpr int32_t SLEEP_TIME = 50;
+constexpr int64_t GET_SESSION_TIMEOUT = 3000; // ms
 }
 
 IMPLEMENT_SINGLE_INSTANCE(ContinueSceneSessionHandler);
@@ -35,31 +34,37 @@ IMPLEMENT_SINGLE_INSTANCE(ContinueSceneSessionHandler);
 using OHOS::Rosen::SessionManagerLite;
 using OHOS::Rosen::WSError;
 
-void ContinueSceneSessionHandler::UpdateContinueSessionId(const std::string& bundleName, const std::string& abilityName)
+std::string ContinueSceneSessionHandler::UpdateContinueSessionId(const std::string& bundleName,
+    const std::string& abilityName)
 {
     HILOGD("Update continueSessionId, bundleName: %{public}s, abilityName: %{public}s",
         bundleName.c_str(), abilityName.c_str());
     auto now = std::chrono::system_clock::now();
     int64_t timeStamp = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
     std::size_t hash = std::hash<std::string>()(bundleName + abilityName + std::to_string(timeStamp));
+    std::lock_guard<std::mutex> sessionIdLock(sessionIdMutex_);
     continueSessionId_ = std::to_string(hash);
+    return continueSessionId_;
 }
 
 std::string ContinueSceneSessionHandler::GetContinueSessionId() const
 {
+    std::lock_guard<std::mutex> sessionIdLock(sessionIdMutex_);
     return continueSessionId_;
 }
 
 void ContinueSceneSessionHandler::ClearContinueSessionId()
 {
     HILOGI("%{public}s called", __func__);
+    std::lock_guard<std::mutex> sessionIdLock(sessionIdMutex_);
     continueSessionId_.clear();
 }
 
 int32_t ContinueSceneSessionHandler::GetPersistentId(int32_t& persistentId)
 {
     HILOGI("%{public}s called", __func__);
-    if (continueSessionId_.empty()) {
+    std::string continueSessionId = GetContinueSessionId();
+    if (continueSessionId.empty()) {
         HILOGE("continueSessionId is empty.");
         return INVALID_PARAMETERS_ERR;
     }
@@ -68,26 +73,7 @@ int32_t ContinueSceneSessionHandler::GetPersistentId(int32_t& persistentId)
         return INVALID_PARAMETERS_ERR;
     }
 
-    auto sceneSessionManager = SessionManagerLite::GetInstance().GetSceneSessionManagerLiteProxy();
-    if (!sceneSessionManager) {
-        HILOGE("proxy is nullptr.");
-        return INVALID_PARAMETERS_ERR;
-    }
-    
-    int32_t retryTimeout = RETRY_TIMES;
-    AAFwk::MissionInfo missionInfo;
-    do {
-        auto err = sceneSessionManager->GetSessionInfoByContinueSessionId(continueSessionId_, missionInfo);
-        if (err == WSError::WS_OK) {
-            persistentId = missionInfo.id;
-            return ERR_OK;
-        }
-        HILOGE("Get sessionInfo failed, continueSessionId: %{public}s, errorCode: %{public}d",
-            continueSessionId_.c_str(), err);
-        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
-    } while (--retryTimeout >= 0);
-    
-    return INVALID_PARAMETERS_ERR;
+    return GetPersistentId(persistentId, continueSessionId);
 }
 
 int32_t ContinueSceneSessionHandler::GetPersistentId(int32_t& persistentId, std::string &continueSessionId)
@@ -99,20 +85,21 @@ int32_t ContinueSceneSessionHandler::GetPersistentId(int32_t& persistentId, std:
         return INVALID_PARAMETERS_ERR;
     }
 
-    int32_t retryTimeout = RETRY_TIMES;
+    // the session is created by SCB, its mission id is not known before it shows up
     AAFwk::MissionInfo missionInfo;
-    do {
-        auto err = sceneSessionManager->GetSessionInfoByContinueSessionId(continueSessionId, missionInfo);
-        if (err == WSError::WS_OK) {
-            persistentId = missionInfo.id;
-            return ERR_OK;
-        }
+    WSError err = WSError::WS_OK;
+    auto probe = [&sceneSessionManager, &continueSessionId, &missionInfo, &err]() {
+        err = sceneSessionManager->GetSessionInfoByContinueSessionId(continueSessionId, missionInfo);
+        return err == WSError::WS_OK;
+    };
+    if (!DSchedReadinessWaiter::GetInstance().Wait(DSchedReadinessWaiter::ANY_MISSION, probe,
+        GET_SESSION_TIMEOUT)) {
         HILOGE("Get sessionInfo failed, continueSessionId: %{public}s, errorCode: %{public}d",
-               continueSessionId_.c_str(), err);
-        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
-    } while (--retryTimeout >= 0);
-
-    return INVALID_PARAMETERS_ERR;
+            continueSessionId.c_str(), err);
+        return INVALID_PARAMETERS_ERR;
+    }
+    persistentId = missionInfo.id;
+    return ERR_OK;
 }
 
 } // namespace DistributedSchedule
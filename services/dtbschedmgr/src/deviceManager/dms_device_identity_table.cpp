@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "deviceManager/dms_device_identity_table.h"
+
+#include <atomic>
+
+namespace OHOS {
+namespace DistributedSchedule {
+bool DmsDeviceIdentityTable::Update(const DmsDeviceIdentity& identity)
+{
+    if (identity.networkId.empty() || identity.uuid.empty()) {
+        return false;
+    }
+    auto entry = std::make_shared<const DmsDeviceIdentity>(identity);
+    std::lock_guard<std::mutex> autoLock(writeLock_);
+    auto next = std::make_shared<Snapshot>(*Load());
+    auto networkIdIter = next->byNetworkId.find(identity.networkId);
+    if (networkIdIter != next->byNetworkId.end()) {
+        EraseLocked(*next, networkIdIter->second);
+    }
+    auto uuidIter = next->byUuid.find(identity.uuid);
+    if (uuidIter != next->byUuid.end()) {
+        EraseLocked(*next, uuidIter->second);
+    }
+    next->byNetworkId[identity.networkId] = entry;
+    next->byUuid[identity.uuid] = entry;
+    Publish(next);
+    return true;
+}
+
+void DmsDeviceIdentityTable::RemoveByNetworkId(const std::string& networkId)
+{
+    std::lock_guard<std::mutex> autoLock(writeLock_);
+    auto current = Load();
+    auto iter = current->byNetworkId.find(networkId);
+    if (iter == current->byNetworkId.end()) {
+        return;
+    }
+    auto next = std::make_shared<Snapshot>(*current);
+    EraseLocked(*next, iter->second);
+    Publish(next);
+}
+
+void DmsDeviceIdentityTable::Clear()
+{
+    std::lock_guard<std::mutex> autoLock(writeLock_);
+    Publish(std::make_shared<const Snapshot>());
+}
+
+bool DmsDeviceIdentityTable::GetUuidByNetworkId(const std::string& networkId, std::string& uuid) const
+{
+    auto snapshot = Load();
+    auto iter = snapshot->byNetworkId.find(networkId);
+    if (iter == snapshot->byNetworkId.end()) {
+        return false;
+    }
+    uuid = iter->second->uuid;
+    return true;
+}
+
+bool DmsDeviceIdentityTable::GetUdidByNetworkId(const std::string& networkId, std::string& udid) const
+{
+    auto snapshot = Load();
+    auto iter = snapshot->byNetworkId.find(networkId);
+    if (iter == snapshot->byNetworkId.end() || iter->second->udid.empty()) {
+        return false;
+    }
+    udid = iter->second->udid;
+    return true;
+}
+
+bool DmsDeviceIdentityTable::GetNetworkIdByUuid(const std::string& uuid, std::string& networkId) const
+{
+    auto snapshot = Load();
+    auto iter = snapshot->byUuid.find(uuid);
+    if (iter == snapshot->byUuid.end()) {
+        return false;
+    }
+    networkId = iter->second->networkId;
+    return true;
+}
+
+size_t DmsDeviceIdentityTable::Size() const
+{
+    return Load()->byNetworkId.size();
+}
+
+std::shared_ptr<const DmsDeviceIdentityTable::Snapshot> DmsDeviceIdentityTable::Load() const
+{
+    return std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+}
+
+void DmsDeviceIdentityTable::Publish(std::shared_ptr<const Snapshot> snapshot)
+{
+    std::atomic_store_explicit(&snapshot_, std::move(snapshot), std::memory_order_release);
+}
+
+void DmsDeviceIdentityTable::EraseLocked(Snapshot& snapshot, const IdentityPtr& identity)
+{
+    // identity may refer into the map, keep it alive while both of its keys are erased
+    IdentityPtr holder = identity;
+    snapshot.byNetworkId.erase(holder->networkId);
+    snapshot.byUuid.erase(holder->uuid);
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
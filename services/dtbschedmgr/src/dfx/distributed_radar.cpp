@@ -16,12 +16,14 @@
 #include "dfx/distributed_radar.h"
 
 #include "bundle/bundle_manager_internal.h"
+#include "dfx/dms_sys_event_reporter.h"
 #include "dtbschedmgr_device_info_storage.h"
 #include "hisysevent.h"
 
 namespace OHOS {
 namespace DistributedSchedule {
 const std::string TAG = "DmsRadar";
+constexpr int32_t BEHAVIOR_EVENT = static_cast<int32_t>(HiviewDFX::HiSysEvent::EventType::BEHAVIOR);
 IMPLEMENT_SINGLE_INSTANCE(DmsRadar);
 
 bool DmsRadar::RegisterFocusedRes(const std::string& func, int32_t errCode)
@@ -29,10 +31,10 @@ bool DmsRadar::RegisterFocusedRes(const std::string& func, int32_t errCode)
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::DMS_INIT),
@@ -40,10 +42,10 @@ bool DmsRadar::RegisterFocusedRes(const std::string& func, int32_t errCode)
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_START));
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::DMS_INIT),
@@ -64,10 +66,10 @@ bool DmsRadar::RegisterSoftbusCallbackRes(const std::string& func, int32_t errCo
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::DMS_INIT),
@@ -76,10 +78,10 @@ bool DmsRadar::RegisterSoftbusCallbackRes(const std::string& func, int32_t errCo
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_END),
             TO_CALL_PKG, ABILITY_MANAGER_SERVICE);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::DMS_INIT),
@@ -98,10 +100,10 @@ bool DmsRadar::RegisterSoftbusCallbackRes(const std::string& func, int32_t errCo
 
 bool DmsRadar::DmsFocused(const std::string& func, std::string focusMode)
 {
-    int32_t res = HiSysEventWrite(
+    int32_t res = DmsSysEventReporter::GetInstance().Report(
         APP_CONTINUE_DOMAIN,
         APPLICATION_CONTINUE_BEHAVIOR,
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        BEHAVIOR_EVENT,
         ORG_PKG, ORG_PKG_NAME,
         FUNC, func,
         BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_MULTIMODE_FOCUSED),
@@ -121,10 +123,10 @@ bool DmsRadar::NormalFocusedGetAccessTokenIdRes(const std::string& func, int32_t
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_MULTIMODE_FOCUSED),
@@ -132,10 +134,10 @@ bool DmsRadar::NormalFocusedGetAccessTokenIdRes(const std::string& func, int32_t
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             TO_CALL_PKG, BMS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_MULTIMODE_FOCUSED),
@@ -156,10 +158,10 @@ bool DmsRadar::NormalFocusedSendEventRes(const std::string& func, int32_t errCod
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_MULTIMODE_FOCUSED),
@@ -168,10 +170,10 @@ bool DmsRadar::NormalFocusedSendEventRes(const std::string& func, int32_t errCod
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_END),
             TO_CALL_PKG, DSOFTBUS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_MULTIMODE_FOCUSED),
@@ -190,10 +192,10 @@ bool DmsRadar::NormalFocusedSendEventRes(const std::string& func, int32_t errCod
 
 bool DmsRadar::SetFocusedState(const std::string& func)
 {
-    int32_t res = HiSysEventWrite(
+    int32_t res = DmsSysEventReporter::GetInstance().Report(
         APP_CONTINUE_DOMAIN,
         APPLICATION_CONTINUE_BEHAVIOR,
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        BEHAVIOR_EVENT,
         ORG_PKG, ORG_PKG_NAME,
         FUNC, func,
         BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_FOCUSED),
@@ -212,10 +214,10 @@ bool DmsRadar::ChangeStateFocusedGetAccessTokenIdRes(const std::string& func, in
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_FOCUSED),
@@ -223,10 +225,10 @@ bool DmsRadar::ChangeStateFocusedGetAccessTokenIdRes(const std::string& func, in
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             TO_CALL_PKG, BMS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_FOCUSED),
@@ -247,10 +249,10 @@ bool DmsRadar::ChangeStateFocusedSendEventRes(const std::string& func, int32_t e
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_FOCUSED),
@@ -259,10 +261,10 @@ bool DmsRadar::ChangeStateFocusedSendEventRes(const std::string& func, int32_t e
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_END),
             TO_CALL_PKG, DSOFTBUS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_FOCUSED),
@@ -281,10 +283,10 @@ bool DmsRadar::ChangeStateFocusedSendEventRes(const std::string& func, int32_t e
 
 bool DmsRadar::DmsUnfocused(const std::string& func)
 {
-    int32_t res = HiSysEventWrite(
+    int32_t res = DmsSysEventReporter::GetInstance().Report(
         APP_CONTINUE_DOMAIN,
         APPLICATION_CONTINUE_BEHAVIOR,
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        BEHAVIOR_EVENT,
         ORG_PKG, ORG_PKG_NAME,
         FUNC, func,
         BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_UNFOCUSED),
@@ -303,10 +305,10 @@ bool DmsRadar::NormalUnfocusedGetAccessTokenIdRes(const std::string& func, int32
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_UNFOCUSED),
@@ -314,10 +316,10 @@ bool DmsRadar::NormalUnfocusedGetAccessTokenIdRes(const std::string& func, int32
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             TO_CALL_PKG, BMS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_UNFOCUSED),
@@ -338,10 +340,10 @@ bool DmsRadar::NormalUnfocusedSendEventRes(const std::string& func, int32_t errC
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_UNFOCUSED),
@@ -350,10 +352,10 @@ bool DmsRadar::NormalUnfocusedSendEventRes(const std::string& func, int32_t errC
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_END),
             TO_CALL_PKG, DSOFTBUS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::NORMAL_UNFOCUSED),
@@ -372,10 +374,10 @@ bool DmsRadar::NormalUnfocusedSendEventRes(const std::string& func, int32_t errC
 
 bool DmsRadar::RecordTime(const std::string& func)
 {
-    int32_t res = HiSysEventWrite(
+    int32_t res = DmsSysEventReporter::GetInstance().Report(
         APP_CONTINUE_DOMAIN,
         APPLICATION_CONTINUE_BEHAVIOR,
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        BEHAVIOR_EVENT,
         ORG_PKG, ORG_PKG_NAME,
         FUNC, func,
         BIZ_SCENE, static_cast<int32_t>(BizScene::MULTIMODE_UNFOCUSED),
@@ -394,10 +396,10 @@ bool DmsRadar::MultimodeUnfocusedGetAccessTokenIdRes(const std::string& func, in
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::MULTIMODE_UNFOCUSED),
@@ -405,10 +407,10 @@ bool DmsRadar::MultimodeUnfocusedGetAccessTokenIdRes(const std::string& func, in
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             TO_CALL_PKG, BMS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::MULTIMODE_UNFOCUSED),
@@ -429,10 +431,10 @@ bool DmsRadar::MultimodeUnfocusedSendEventRes(const std::string& func, int32_t e
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::MULTIMODE_UNFOCUSED),
@@ -441,10 +443,10 @@ bool DmsRadar::MultimodeUnfocusedSendEventRes(const std::string& func, int32_t e
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_END),
             TO_CALL_PKG, DSOFTBUS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::MULTIMODE_UNFOCUSED),
@@ -463,10 +465,10 @@ bool DmsRadar::MultimodeUnfocusedSendEventRes(const std::string& func, int32_t e
 
 bool DmsRadar::SetUnfocusedState(const std::string& func)
 {
-    int32_t res = HiSysEventWrite(
+    int32_t res = DmsSysEventReporter::GetInstance().Report(
         APP_CONTINUE_DOMAIN,
         APPLICATION_CONTINUE_BEHAVIOR,
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        BEHAVIOR_EVENT,
         ORG_PKG, ORG_PKG_NAME,
         FUNC, func,
         BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_UNFOCUSED),
@@ -485,10 +487,10 @@ bool DmsRadar::ChangeStateUnfocusedGetAccessTokenIdRes(const std::string& func,
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_UNFOCUSED),
@@ -496,10 +498,10 @@ bool DmsRadar::ChangeStateUnfocusedGetAccessTokenIdRes(const std::string& func,
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             TO_CALL_PKG, BMS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_UNFOCUSED),
@@ -520,10 +522,10 @@ bool DmsRadar::ChangeStateUnfocusedSendEventRes(const std::string& func, int32_t
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_UNFOCUSED),
@@ -532,10 +534,10 @@ bool DmsRadar::ChangeStateUnfocusedSendEventRes(const std::string& func, int32_t
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_END),
             TO_CALL_PKG, DSOFTBUS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CHANGE_STATE_UNFOCUSED),
@@ -554,10 +556,10 @@ bool DmsRadar::ChangeStateUnfocusedSendEventRes(const std::string& func, int32_t
 
 bool DmsRadar::RecvFocused(const std::string& func)
 {
-    int32_t res = HiSysEventWrite(
+    int32_t res = DmsSysEventReporter::GetInstance().Report(
         APP_CONTINUE_DOMAIN,
         APPLICATION_CONTINUE_BEHAVIOR,
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        BEHAVIOR_EVENT,
         ORG_PKG, ORG_PKG_NAME,
         FUNC, func,
         BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_FOCUSED),
@@ -578,10 +580,10 @@ bool DmsRadar::FocusedGetBundleName(const std::string& func, int32_t errCode)
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_FOCUSED),
@@ -589,10 +591,10 @@ bool DmsRadar::FocusedGetBundleName(const std::string& func, int32_t errCode)
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             TO_CALL_PKG, DBMS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_FOCUSED),
@@ -613,20 +615,20 @@ bool DmsRadar::NotifyDockFocused(const std::string& func, int32_t errCode)
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_FOCUSED),
             BIZ_STAGE, static_cast<int32_t>(RecvFocused::NOTIFY_DOCK_FOCUSED),
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC));
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_FOCUSED),
@@ -643,10 +645,10 @@ bool DmsRadar::NotifyDockFocused(const std::string& func, int32_t errCode)
 
 bool DmsRadar::RecvUnfocused(const std::string& func)
 {
-    int32_t res = HiSysEventWrite(
+    int32_t res = DmsSysEventReporter::GetInstance().Report(
         APP_CONTINUE_DOMAIN,
         APPLICATION_CONTINUE_BEHAVIOR,
-        HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+        BEHAVIOR_EVENT,
         ORG_PKG, ORG_PKG_NAME,
         FUNC, func,
         BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_UNFOCUSED),
@@ -667,10 +669,10 @@ bool DmsRadar::UnfocusedGetBundleName(const std::string& func, int32_t errCode)
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_UNFOCUSED),
@@ -678,10 +680,10 @@ bool DmsRadar::UnfocusedGetBundleName(const std::string& func, int32_t errCode)
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             TO_CALL_PKG, DBMS_PKG_NAME);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_UNFOCUSED),
@@ -702,20 +704,20 @@ bool DmsRadar::NotifyDockUnfocused(const std::string& func, int32_t errCode)
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_UNFOCUSED),
             BIZ_STAGE, static_cast<int32_t>(RecvUnfocused::NOTIFY_DOCK_UNFOCUSED),
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC));
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::RECV_UNFOCUSED),
@@ -744,10 +746,10 @@ bool DmsRadar::ClickIconDmsContinue(const std::string& func, int32_t errCode, st
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CLICK_ICON),
@@ -759,10 +761,10 @@ bool DmsRadar::ClickIconDmsContinue(const std::string& func, int32_t errCode, st
             LOCAL_APP_VERSION, srcBundleInfo.versionName,
             PEER_APP_VERSION, dstBundleInfo.versionName);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CLICK_ICON),
@@ -787,10 +789,10 @@ bool DmsRadar::ClickIconDmsStartAbility(const std::string& func, int32_t errCode
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CLICK_ICON),
@@ -798,10 +800,10 @@ bool DmsRadar::ClickIconDmsStartAbility(const std::string& func, int32_t errCode
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             TO_CALL_PKG, ABILITY_MANAGER_SERVICE);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CLICK_ICON),
@@ -824,10 +826,10 @@ bool DmsRadar::ClickIconDmsRecvOver(const std::string& func, int32_t errCode)
         errCode == MISSION_NOT_CONTINUE_ACTIVE || errCode == CONTINUE_ON_CONTINUE_FAILED ||
         errCode == CONTINUE_REMOTE_VERSION_MISMATCH) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CLICK_ICON),
@@ -835,10 +837,10 @@ bool DmsRadar::ClickIconDmsRecvOver(const std::string& func, int32_t errCode)
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_END));
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::CLICK_ICON),
@@ -859,10 +861,10 @@ bool DmsRadar::SaveDataDmsContinue(const std::string& func, int32_t errCode)
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::SAVE_DATA),
@@ -871,10 +873,10 @@ bool DmsRadar::SaveDataDmsContinue(const std::string& func, int32_t errCode)
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_START),
             TO_CALL_PKG, ABILITY_MANAGER_SERVICE);
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::SAVE_DATA),
@@ -896,10 +898,10 @@ bool DmsRadar::SaveDataDmsRemoteWant(const std::string& func, int32_t errCode)
     int32_t res = ERR_OK;
     StageRes stageRes = (errCode == ERR_OK) ? StageRes::STAGE_SUCC : StageRes::STAGE_FAIL;
     if (stageRes == StageRes::STAGE_SUCC) {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::SAVE_DATA),
@@ -907,10 +909,10 @@ bool DmsRadar::SaveDataDmsRemoteWant(const std::string& func, int32_t errCode)
             STAGE_RES, static_cast<int32_t>(StageRes::STAGE_SUCC),
             BIZ_STATE, static_cast<int32_t>(BizState::BIZ_STATE_END));
     } else {
-        res = HiSysEventWrite(
+        res = DmsSysEventReporter::GetInstance().Report(
             APP_CONTINUE_DOMAIN,
             APPLICATION_CONTINUE_BEHAVIOR,
-            HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
+            BEHAVIOR_EVENT,
             ORG_PKG, ORG_PKG_NAME,
             FUNC, func,
             BIZ_SCENE, static_cast<int32_t>(BizScene::SAVE_DATA),
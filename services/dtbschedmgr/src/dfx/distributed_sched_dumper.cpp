@@ -17,9 +17,15 @@
 
 #include "accesstoken_kit.h"
 #include "dfx/dms_continue_time_dumper.h"
+#include "dfx/dms_latency_histogram.h"
+#include "dfx/dms_state_trace_recorder.h"
 #include "distributed_sched_service.h"
+#include "dms_component_registry.h"
+#include "dsched_continue_prefetcher.h"
+#include "dsched_resource_lease_manager.h"
 #include "dtbschedmgr_log.h"
 #include "ipc_skeleton.h"
+#include "multi_user_manager.h"
 
 namespace OHOS {
 namespace DistributedSchedule {
@@ -29,7 +35,14 @@ const std::string HIDUMPER_PROCESS_NAME = "hidumper_service";
 const std::string ARGS_HELP = "-h";
 const std::string ARGS_CONNECT_REMOTE_ABILITY = "-connect";
 const std::string ARGS_CONNECT_CONTINUETIME_ABILITY = "-continueTime";
+const std::string ARGS_CONTINUE_BROADCAST = "-broadcast";
+const std::string ARGS_CONTINUE_LATENCY = "-latency";
+const std::string ARGS_RESET = "-reset";
+const std::string ARGS_RESOURCE_LEASE = "-lease";
+const std::string ARGS_STATE_TRACE = "-stateTrace";
+const std::string ARGS_COMPONENTS = "-components";
 constexpr size_t MIN_ARGS_SIZE = 1;
+constexpr size_t RESET_ARGS_SIZE = 2;
 }
 
 bool DistributedSchedDumper::Dump(const std::vector<std::string>& args, std::string& result)
@@ -58,6 +71,41 @@ bool DistributedSchedDumper::Dump(const std::vector<std::string>& args, std::str
             ShowDuration(result);
             return true;
         }
+        // -broadcast
+        if (args[0] == ARGS_CONTINUE_BROADCAST) {
+            ShowContinueBroadcast(result);
+            return true;
+        }
+        // -latency
+        if (args[0] == ARGS_CONTINUE_LATENCY) {
+            ShowLatency(result);
+            return true;
+        }
+        // -lease
+        if (args[0] == ARGS_RESOURCE_LEASE) {
+            ShowResourceLease(result);
+            return true;
+        }
+        // -stateTrace
+        if (args[0] == ARGS_STATE_TRACE) {
+            ShowStateTrace(result);
+            return true;
+        }
+        // -components
+        if (args[0] == ARGS_COMPONENTS) {
+            ShowComponents(result);
+            return true;
+        }
+    }
+    // -latency -reset
+    if (args.size() == RESET_ARGS_SIZE && args[0] == ARGS_CONTINUE_LATENCY && args[1] == ARGS_RESET) {
+        ResetLatency(result);
+        return true;
+    }
+    // -stateTrace -reset
+    if (args.size() == RESET_ARGS_SIZE && args[0] == ARGS_STATE_TRACE && args[1] == ARGS_RESET) {
+        ResetStateTrace(result);
+        return true;
     }
     IllegalInput(result);
     return false;
@@ -92,12 +140,68 @@ void DistributedSchedDumper::ShowDuration(std::string& result)
     DmsContinueTime::GetInstance().ShowInfo(result);
 }
 
+void DistributedSchedDumper::ShowContinueBroadcast(std::string& result)
+{
+    auto sendMgr = MultiUserManager::GetInstance().GetCurrentSendMgr();
+    if (sendMgr != nullptr) {
+        sendMgr->DumpBroadcastInfo(result);
+    }
+    auto recvMgr = MultiUserManager::GetInstance().GetCurrentRecvMgr();
+    if (recvMgr != nullptr) {
+        BroadcastRecvStat stat = recvMgr->GetBroadcastRecvStat();
+        result.append("continue broadcast recv:\n")
+            .append("  received: ").append(std::to_string(stat.recvCount)).append("\n")
+            .append("  suppressed(duplicate): ").append(std::to_string(stat.droppedCount)).append("\n")
+            .append("  suppressed(coalesced): ").append(std::to_string(stat.coalescedCount)).append("\n");
+    }
+    DSchedContinuePrefetcher::GetInstance().Dump(result);
+}
+
+void DistributedSchedDumper::ShowLatency(std::string& result)
+{
+    DmsLatencyRegistry::GetInstance().Dump(result);
+}
+
+void DistributedSchedDumper::ResetLatency(std::string& result)
+{
+    ShowLatency(result);
+    DmsLatencyRegistry::GetInstance().Reset();
+    result.append("continue stage latency reset.\n");
+}
+
+void DistributedSchedDumper::ShowResourceLease(std::string& result)
+{
+    DSchedResourceLeaseManager::GetInstance().Dump(result);
+}
+
+void DistributedSchedDumper::ShowStateTrace(std::string& result)
+{
+    DmsStateTraceRecorder::GetInstance().Dump(result);
+}
+
+void DistributedSchedDumper::ResetStateTrace(std::string& result)
+{
+    ShowStateTrace(result);
+    DmsStateTraceRecorder::GetInstance().Reset();
+    result.append("state machine traces reset.\n");
+}
+
+void DistributedSchedDumper::ShowComponents(std::string& result)
+{
+    DmsComponentRegistry::GetInstance().Dump(result);
+}
+
 void DistributedSchedDumper::ShowHelp(std::string& result)
 {
     result.append("DistributedSched Dump options:\n")
         .append("  [-h] [cmd]...\n")
         .append("cmd maybe one of:\n")
-        .append("  -connect: show all connected remote abilities.\n");
+        .append("  -connect: show all connected remote abilities.\n")
+        .append("  -broadcast: show continue broadcast send and receive statistics.\n")
+        .append("  -latency [-reset]: show continue stage latency percentiles, optionally reset them.\n")
+        .append("  -lease: show all connect resource leases per peer device.\n")
+        .append("  -stateTrace [-reset]: show recent continue/collab state transitions and state dwell time.\n")
+        .append("  -components: show which service components started, their trigger and start cost.\n");
 }
 
 void DistributedSchedDumper::IllegalInput(std::string& result)
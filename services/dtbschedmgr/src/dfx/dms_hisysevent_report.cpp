@@ -17,6 +17,7 @@
 
 #include <string>
 
+#include "dfx/dms_sys_event_reporter.h"
 #include "dtbschedmgr_log.h"
 #include "hilog/log_cpp.h"
 #include "hisysevent.h"
@@ -44,7 +45,9 @@ constexpr const char*  KEY_VERSION = "VERSION";
 
 int DmsHiSysEventReport::ReportBehaviorEvent(const BehaviorEventParam& param)
 {
-    int result = HiSysEventWrite(DOMAIN_NAME, param.eventName, HiSysEvent::EventType::BEHAVIOR,
+    // the calling identity is only valid on the IPC thread, so it is captured here and not by the reporter
+    int result = DmsSysEventReporter::GetInstance().Report(DOMAIN_NAME, param.eventName,
+        static_cast<int32_t>(HiSysEvent::EventType::BEHAVIOR),
         KEY_CALLING_TYPE, param.callingType,
         KEY_CALLING_UID, IPCSkeleton::GetCallingUid(),
         KEY_CALLING_PID, IPCSkeleton::GetCallingRealPid(),
@@ -62,7 +65,8 @@ int DmsHiSysEventReport::ReportBehaviorEvent(const BehaviorEventParam& param)
 
 int DmsHiSysEventReport::ReportFaultEvent(const std::string& eventName, const std::string& errorType)
 {
-    int result = HiSysEventWrite(DOMAIN_NAME, eventName, HiSysEvent::EventType::FAULT,
+    int result = DmsSysEventReporter::GetInstance().Report(DOMAIN_NAME, eventName,
+        static_cast<int32_t>(HiSysEvent::EventType::FAULT),
         KEY_ERROR_TYPE, errorType);
     if (result != 0) {
         HILOGE("hisysevent report failed! ret %{public}d.", result);
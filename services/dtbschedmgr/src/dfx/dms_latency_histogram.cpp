@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/dms_latency_histogram.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr double PERCENTILE_50 = 50.0;
+constexpr double PERCENTILE_90 = 90.0;
+constexpr double PERCENTILE_99 = 99.0;
+constexpr double PERCENTILE_100 = 100.0;
+constexpr uint32_t VALUE_BITS = 64;
+const std::array<std::string, static_cast<size_t>(DmsLatencyStage::STAGE_MAX)> STAGE_NAMES = {
+    "connect", "pack start cmd", "data save", "transfer", "sink start",
+};
+
+uint32_t HighestBit(uint64_t value)
+{
+    return VALUE_BITS - 1 - static_cast<uint32_t>(__builtin_clzll(value));
+}
+}
+
+size_t DmsLatencyHistogram::GetBucketIndex(uint64_t value)
+{
+    value = std::min(value, MAX_TRACKABLE_VALUE);
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+    uint32_t shift = HighestBit(value) - SUB_BUCKET_BITS;
+    uint64_t subBucket = (value >> shift) - SUB_BUCKET_COUNT;
+    return static_cast<size_t>((shift + 1) * SUB_BUCKET_COUNT + subBucket);
+}
+
+uint64_t DmsLatencyHistogram::GetBucketUpperBound(size_t index)
+{
+    if (index < SUB_BUCKET_COUNT) {
+        return static_cast<uint64_t>(index);
+    }
+    uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKET_COUNT) - 1;
+    uint64_t subBucket = static_cast<uint64_t>(index % SUB_BUCKET_COUNT);
+    uint64_t lower = (SUB_BUCKET_COUNT + subBucket) << shift;
+    return lower + (1ull << shift) - 1;
+}
+
+void DmsLatencyHistogram::Record(uint64_t value)
+{
+    buckets_[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    uint64_t currentMax = max_.load(std::memory_order_relaxed);
+    while (value > currentMax && !max_.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+    }
+}
+
+void DmsLatencyHistogram::Reset()
+{
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t DmsLatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t DmsLatencyHistogram::GetMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+uint64_t DmsLatencyHistogram::GetPercentile(double percentile) const
+{
+    std::array<uint64_t, BUCKET_COUNT> counts;
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    percentile = std::clamp(percentile, 0.0, PERCENTILE_100);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / PERCENTILE_100 * static_cast<double>(total)));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        accumulated += counts[i];
+        if (accumulated >= rank) {
+            return std::min(GetBucketUpperBound(i), GetMax());
+        }
+    }
+    return GetMax();
+}
+
+DmsLatencySnapshot DmsLatencyHistogram::GetSnapshot() const
+{
+    DmsLatencySnapshot snapshot;
+    snapshot.count = GetCount();
+    snapshot.p50 = GetPercentile(PERCENTILE_50);
+    snapshot.p90 = GetPercentile(PERCENTILE_90);
+    snapshot.p99 = GetPercentile(PERCENTILE_99);
+    snapshot.max = GetMax();
+    return snapshot;
+}
+
+DmsLatencyRegistry& DmsLatencyRegistry::GetInstance()
+{
+    static auto instance = new DmsLatencyRegistry();
+    return *instance;
+}
+
+int64_t DmsLatencyRegistry::GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void DmsLatencyRegistry::Record(DmsLatencyStage stage, uint64_t latencyUs)
+{
+    if (stage < DmsLatencyStage::CONNECT || stage >= DmsLatencyStage::STAGE_MAX) {
+        return;
+    }
+    histograms_[static_cast<size_t>(stage)].Record(latencyUs);
+}
+
+void DmsLatencyRegistry::RecordSince(DmsLatencyStage stage, int64_t beginUs)
+{
+    if (beginUs <= 0) {
+        return;
+    }
+    int64_t latency = GetNowUs() - beginUs;
+    Record(stage, static_cast<uint64_t>(std::max<int64_t>(latency, 0)));
+}
+
+DmsLatencySnapshot DmsLatencyRegistry::GetSnapshot(DmsLatencyStage stage) const
+{
+    if (stage < DmsLatencyStage::CONNECT || stage >= DmsLatencyStage::STAGE_MAX) {
+        return {};
+    }
+    return histograms_[static_cast<size_t>(stage)].GetSnapshot();
+}
+
+void DmsLatencyRegistry::Reset()
+{
+    for (auto& histogram : histograms_) {
+        histogram.Reset();
+    }
+}
+
+void DmsLatencyRegistry::Dump(std::string& result) const
+{
+    result.append("continue stage latency (us):\n");
+    for (size_t i = 0; i < histograms_.size(); i++) {
+        DmsLatencySnapshot snapshot = histograms_[i].GetSnapshot();
+        result.append("  ").append(STAGE_NAMES[i]).append(": ")
+            .append("count ").append(std::to_string(snapshot.count))
+            .append(", p50 ").append(std::to_string(snapshot.p50))
+            .append(", p90 ").append(std::to_string(snapshot.p90))
+            .append(", p99 ").append(std::to_string(snapshot.p99))
+            .append(", max ").append(std::to_string(snapshot.max)).append("\n");
+    }
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
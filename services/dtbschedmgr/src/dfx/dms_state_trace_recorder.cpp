@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/dms_state_trace_recorder.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::array<std::string, static_cast<size_t>(DmsStateMachineType::TYPE_MAX)> TYPE_NAMES = {
+    "continue", "collab",
+};
+
+std::string GetTypeName(DmsStateMachineType type)
+{
+    if (type < DmsStateMachineType::CONTINUE || type >= DmsStateMachineType::TYPE_MAX) {
+        return "unknown";
+    }
+    return TYPE_NAMES[static_cast<size_t>(type)];
+}
+}
+
+DmsStateTracer::DmsStateTracer(DmsStateMachineType type)
+{
+    trace_.type = type;
+    trace_.traceId = DmsStateTraceRecorder::GetInstance().GenerateTraceId();
+}
+
+DmsStateTracer::~DmsStateTracer()
+{
+    Finish();
+}
+
+void DmsStateTracer::BeginEvent(int32_t eventId)
+{
+    eventId_ = eventId;
+}
+
+void DmsStateTracer::EndEvent()
+{
+    eventId_ = NO_EVENT;
+}
+
+void DmsStateTracer::OnStateChanged(int32_t toState)
+{
+    if (isFinished_) {
+        return;
+    }
+    int64_t nowUs = DmsStateTraceRecorder::GetNowUs();
+    DmsStateTransition transition;
+    transition.fromState = currentState_;
+    transition.toState = toState;
+    transition.eventId = eventId_;
+    transition.timeUs = nowUs;
+    if (currentState_ == NO_STATE) {
+        trace_.beginUs = nowUs;
+    } else {
+        transition.dwellUs = nowUs - enterUs_;
+        DmsStateTraceRecorder::GetInstance().RecordDwell(trace_.type, currentState_, transition.dwellUs);
+    }
+    // a session looping between states keeps its first transitions only
+    if (trace_.transitions.size() < DmsStateTraceRecorder::MAX_TRANSITION_COUNT) {
+        trace_.transitions.push_back(transition);
+    } else {
+        trace_.isTruncated = true;
+    }
+    currentState_ = toState;
+    enterUs_ = nowUs;
+}
+
+void DmsStateTracer::Finish()
+{
+    if (isFinished_) {
+        return;
+    }
+    isFinished_ = true;
+    if (currentState_ == NO_STATE) {
+        return;
+    }
+    int64_t nowUs = DmsStateTraceRecorder::GetNowUs();
+    DmsStateTraceRecorder::GetInstance().RecordDwell(trace_.type, currentState_, nowUs - enterUs_);
+    trace_.endUs = nowUs;
+    DmsStateTraceRecorder::GetInstance().Commit(std::move(trace_));
+}
+
+DmsStateTraceRecorder& DmsStateTraceRecorder::GetInstance()
+{
+    static auto instance = new DmsStateTraceRecorder();
+    return *instance;
+}
+
+int64_t DmsStateTraceRecorder::GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t DmsStateTraceRecorder::GenerateTraceId()
+{
+    std::lock_guard<std::mutex> autoLock(mutex_);
+    return nextTraceId_++;
+}
+
+void DmsStateTraceRecorder::RecordDwell(DmsStateMachineType type, int32_t state, int64_t dwellUs)
+{
+    uint64_t dwell = static_cast<uint64_t>(std::max<int64_t>(dwellUs, 0));
+    std::lock_guard<std::mutex> autoLock(mutex_);
+    DmsStateDwellStat& stat = dwellStats_[{ type, state }];
+    stat.count++;
+    stat.totalUs += dwell;
+    stat.maxUs = std::max(stat.maxUs, dwell);
+}
+
+void DmsStateTraceRecorder::Commit(DmsStateSessionTrace&& trace)
+{
+    std::lock_guard<std::mutex> autoLock(mutex_);
+    traces_.push_back(std::move(trace));
+    while (traces_.size() > MAX_SESSION_COUNT) {
+        traces_.pop_front();
+    }
+}
+
+std::vector<DmsStateSessionTrace> DmsStateTraceRecorder::GetTraces() const
+{
+    std::lock_guard<std::mutex> autoLock(mutex_);
+    return std::vector<DmsStateSessionTrace>(traces_.begin(), traces_.end());
+}
+
+DmsStateDwellStat DmsStateTraceRecorder::GetDwellStat(DmsStateMachineType type, int32_t state) const
+{
+    std::lock_guard<std::mutex> autoLock(mutex_);
+    auto iter = dwellStats_.find({ type, state });
+    if (iter == dwellStats_.end()) {
+        return {};
+    }
+    return iter->second;
+}
+
+void DmsStateTraceRecorder::Reset()
+{
+    std::lock_guard<std::mutex> autoLock(mutex_);
+    traces_.clear();
+    dwellStats_.clear();
+}
+
+void DmsStateTraceRecorder::Dump(std::string& result) const
+{
+    std::lock_guard<std::mutex> autoLock(mutex_);
+    result.append("state dwell time (us):\n");
+    for (const auto& [key, stat] : dwellStats_) {
+        uint64_t avg = stat.count == 0 ? 0 : stat.totalUs / stat.count;
+        result.append("  ").append(GetTypeName(key.first))
+            .append(" state ").append(std::to_string(key.second)).append(": ")
+            .append("count ").append(std::to_string(stat.count))
+            .append(", avg ").append(std::to_string(avg))
+            .append(", max ").append(std::to_string(stat.maxUs)).append("\n");
+    }
+    result.append("recent state machine sessions:\n");
+    for (auto trace = traces_.rbegin(); trace != traces_.rend(); trace++) {
+        result.append("  #").append(std::to_string(trace->traceId)).append(" ")
+            .append(GetTypeName(trace->type)).append(", total ")
+            .append(std::to_string(trace->endUs - trace->beginUs)).append("us")
+            .append(trace->isTruncated ? ", truncated" : "").append("\n");
+        for (const auto& transition : trace->transitions) {
+            result.append("    +").append(std::to_string(transition.timeUs - trace->beginUs)).append("us ")
+                .append(std::to_string(transition.fromState)).append(" -> ")
+                .append(std::to_string(transition.toState))
+                .append(", event ").append(std::to_string(transition.eventId))
+                .append(", dwell ").append(std::to_string(transition.dwellUs)).append("us\n");
+        }
+    }
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/dms_sys_event_reporter.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "dtbschedmgr_log.h"
+#include "hisysevent_c.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DmsSysEventReporter";
+const std::string REPORTER_THREAD_NAME = "DmsSysEventReporter";
+constexpr int32_t REPORTER_THREAD_NICE = 10;
+
+class DmsHiSysEventSink : public IDmsSysEventSink {
+public:
+    void Write(const std::vector<DmsSysEvent>& events) override
+    {
+        for (const auto& event : events) {
+            WriteOne(event);
+        }
+    }
+
+private:
+    void WriteOne(const DmsSysEvent& event)
+    {
+        std::vector<HiSysEventParam> params(event.params.size());
+        for (size_t i = 0; i < event.params.size(); i++) {
+            const DmsSysEventParam& src = event.params[i];
+            HiSysEventParam& dst = params[i];
+            if (strcpy_s(dst.name, sizeof(dst.name), src.name.c_str()) != EOK) {
+                HILOGE("param name too long, event: %{public}s", event.eventName.c_str());
+                return;
+            }
+            dst.arraySize = 0;
+            switch (src.type) {
+                case DmsSysEventParam::Type::INT32:
+                    dst.t = HISYSEVENT_INT32;
+                    dst.v.i32 = static_cast<int32_t>(src.intValue);
+                    break;
+                case DmsSysEventParam::Type::INT64:
+                    dst.t = HISYSEVENT_INT64;
+                    dst.v.i64 = src.intValue;
+                    break;
+                default:
+                    dst.t = HISYSEVENT_STRING;
+                    dst.v.s = const_cast<char*>(src.strValue.c_str());
+                    break;
+            }
+        }
+        int32_t ret = OH_HiSysEvent_Write(event.domain.c_str(), event.eventName.c_str(),
+            static_cast<HiSysEventEventType>(event.eventType), params.data(), params.size());
+        if (ret != ERR_OK) {
+            HILOGE("write %{public}s failed, ret: %{public}d", event.eventName.c_str(), ret);
+        }
+    }
+};
+}
+
+DmsSysEventReporter& DmsSysEventReporter::GetInstance()
+{
+    static auto instance = new DmsSysEventReporter(std::make_shared<DmsHiSysEventSink>());
+    return *instance;
+}
+
+DmsSysEventReporter::DmsSysEventReporter(const std::shared_ptr<IDmsSysEventSink>& sink,
+    size_t capacity, size_t batchSize)
+    : queue_(capacity), batchSize_(batchSize == 0 ? 1 : batchSize), sink_(sink)
+{
+}
+
+DmsSysEventReporter::~DmsSysEventReporter()
+{
+    Stop();
+}
+
+void DmsSysEventReporter::SetSink(const std::shared_ptr<IDmsSysEventSink>& sink)
+{
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    sink_ = sink;
+}
+
+int32_t DmsSysEventReporter::Report(DmsSysEvent&& event)
+{
+    if (event.domain.empty() || event.eventName.empty()) {
+        HILOGE("domain or event name is empty");
+        return INVALID_PARAMETERS_ERR;
+    }
+    if (isStopped_.load()) {
+        HILOGE("reporter stopped, drop %{public}s", event.eventName.c_str());
+        droppedCount_++;
+        return DMS_SYS_EVENT_QUEUE_FULL_ERR;
+    }
+    if (!isRunning_.load()) {
+        std::lock_guard<std::mutex> lock(threadMutex_);
+        StartLocked();
+    }
+    std::string eventName = event.eventName;
+    // count before the push so the reporter thread never sees more popped than pending
+    size_t pending = ++pendingCount_;
+    if (!queue_.Push(std::move(event))) {
+        pendingCount_--;
+        uint64_t dropped = ++droppedCount_;
+        HILOGW("queue full, drop %{public}s, total dropped: %{public}" PRIu64, eventName.c_str(), dropped);
+        return DMS_SYS_EVENT_QUEUE_FULL_ERR;
+    }
+    enqueuedCount_++;
+    if (pending >= batchSize_) {
+        wakeCon_.notify_one();
+    }
+    return ERR_OK;
+}
+
+bool DmsSysEventReporter::Flush(int32_t timeoutMs)
+{
+    uint64_t target = enqueuedCount_.load();
+    std::unique_lock<std::mutex> lock(threadMutex_);
+    if (!isRunning_.load()) {
+        return reportedCount_.load() >= target;
+    }
+    flushRequested_ = true;
+    wakeCon_.notify_one();
+    return drainedCon_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this, target] {
+        return reportedCount_.load() >= target || !isRunning_.load();
+    }) && reportedCount_.load() >= target;
+}
+
+void DmsSysEventReporter::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(threadMutex_);
+        isStopped_ = true;
+        if (!isRunning_.load()) {
+            return;
+        }
+        isRunning_ = false;
+    }
+    wakeCon_.notify_all();
+    if (reporterThread_.joinable()) {
+        reporterThread_.join();
+    }
+    // events queued before the stop are still delivered
+    while (DrainBatch() > 0) {}
+    drainedCon_.notify_all();
+}
+
+uint64_t DmsSysEventReporter::GetReportedCount() const
+{
+    return reportedCount_.load();
+}
+
+uint64_t DmsSysEventReporter::GetDroppedCount() const
+{
+    return droppedCount_.load();
+}
+
+void DmsSysEventReporter::StartLocked()
+{
+    if (isRunning_.load() || isStopped_.load()) {
+        return;
+    }
+    isRunning_ = true;
+    reporterThread_ = std::thread(&DmsSysEventReporter::Run, this);
+}
+
+void DmsSysEventReporter::Run()
+{
+    prctl(PR_SET_NAME, REPORTER_THREAD_NAME.c_str());
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), REPORTER_THREAD_NICE) != 0) {
+        HILOGW("set reporter thread priority failed");
+    }
+    while (isRunning_.load()) {
+        {
+            std::unique_lock<std::mutex> lock(threadMutex_);
+            wakeCon_.wait_for(lock, std::chrono::milliseconds(DRAIN_INTERVAL_MS), [this] {
+                return !isRunning_.load() || flushRequested_.load() || pendingCount_.load() >= batchSize_;
+            });
+            flushRequested_ = false;
+        }
+        while (DrainBatch() > 0) {}
+        std::lock_guard<std::mutex> lock(threadMutex_);
+        drainedCon_.notify_all();
+    }
+}
+
+size_t DmsSysEventReporter::DrainBatch()
+{
+    std::vector<DmsSysEvent> batch;
+    batch.reserve(batchSize_);
+    DmsSysEvent event;
+    while (batch.size() < batchSize_ && queue_.Pop(event)) {
+        batch.push_back(std::move(event));
+    }
+    if (batch.empty()) {
+        return 0;
+    }
+    pendingCount_ -= batch.size();
+    std::shared_ptr<IDmsSysEventSink> sink;
+    {
+        std::lock_guard<std::mutex> lock(sinkMutex_);
+        sink = sink_;
+    }
+    if (sink != nullptr) {
+        sink->Write(batch);
+    }
+    reportedCount_ += batch.size();
+    return batch.size();
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
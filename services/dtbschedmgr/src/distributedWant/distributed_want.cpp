@@ -95,6 +95,18 @@ DistributedWant& DistributedWant::operator=(const DistributedWant& other)
     return *this;
 }
 
+DistributedWant::DistributedWant(DistributedWant&& other)
+    : parameters_(std::move(other.parameters_)), operation_(std::move(other.operation_))
+{
+}
+
+DistributedWant& DistributedWant::operator=(DistributedWant&& other)
+{
+    operation_ = std::move(other.operation_);
+    parameters_ = std::move(other.parameters_);
+    return *this;
+}
+
 DistributedWant::DistributedWant(const AAFwk::Want& want)
 {
     DistributedOperationBuilder builder;
@@ -107,7 +119,7 @@ DistributedWant::DistributedWant(const AAFwk::Want& want)
     builder.WithUri(want.GetUri());
     std::shared_ptr<DistributedOperation> op = builder.build();
     operation_ = *op;
-    std::map<std::string, sptr<AAFwk::IInterface>> data = want.GetParams().GetParams();
+    const std::map<std::string, sptr<AAFwk::IInterface>>& data = want.GetParams().GetParams();
     for (auto it = data.begin(); it != data.end(); it++) {
         auto tp = AAFwk::WantParams::GetDataType(it->second);
         if ((tp == DistributedWantParams::VALUE_TYPE_BOOLEAN) ||
@@ -1056,7 +1068,7 @@ bool DistributedWant::ReadParametersFromParcel(Parcel& parcel)
     if (empty == VALUE_OBJECT) {
         auto params = parcel.ReadParcelable<DistributedWantParams>();
         if (params != nullptr) {
-            parameters_ = *params;
+            parameters_ = std::move(*params);
             delete params;
             params = nullptr;
         } else {
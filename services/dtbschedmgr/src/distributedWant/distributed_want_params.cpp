@@ -165,6 +165,90 @@ DistributedUnsupportedData& DistributedUnsupportedData::operator=(DistributedUns
     return *this;
 }
 
+const DistributedParamMap::Map& DistributedParamMap::Get() const
+{
+    static const Map emptyMap;
+    return map_ == nullptr ? emptyMap : *map_;
+}
+
+DistributedParamMap::Map& DistributedParamMap::Mutable()
+{
+    if (map_ == nullptr) {
+        map_ = std::make_shared<Map>();
+    } else if (map_.use_count() > 1) {
+        map_ = std::make_shared<Map>(*map_);
+    }
+    return *map_;
+}
+
+bool DistributedParamMap::SharesWith(const DistributedParamMap& other) const
+{
+    return map_ != nullptr && map_ == other.map_;
+}
+
+sptr<IInterface>& DistributedParamMap::operator[](const std::string& key)
+{
+    return Mutable()[key];
+}
+
+size_t DistributedParamMap::erase(const std::string& key)
+{
+    if (count(key) == 0) {
+        return 0;
+    }
+    return Mutable().erase(key);
+}
+
+void DistributedParamMap::clear()
+{
+    map_ = nullptr;
+}
+
+DistributedParamMap::const_iterator DistributedParamMap::find(const std::string& key) const
+{
+    return Get().find(key);
+}
+
+size_t DistributedParamMap::count(const std::string& key) const
+{
+    return Get().count(key);
+}
+
+size_t DistributedParamMap::size() const
+{
+    return Get().size();
+}
+
+bool DistributedParamMap::empty() const
+{
+    return Get().empty();
+}
+
+DistributedParamMap::const_iterator DistributedParamMap::begin() const
+{
+    return Get().begin();
+}
+
+DistributedParamMap::const_iterator DistributedParamMap::end() const
+{
+    return Get().end();
+}
+
+DistributedParamMap::const_iterator DistributedParamMap::cbegin() const
+{
+    return Get().cbegin();
+}
+
+DistributedParamMap::const_iterator DistributedParamMap::cend() const
+{
+    return Get().cend();
+}
+
+DistributedParamMap::const_reverse_iterator DistributedParamMap::rbegin() const
+{
+    return Get().rbegin();
+}
+
 std::string DistributedWantParams::BooleanQueryToStr(const sptr<AAFwk::IInterface> iIt)
 {
     AAFwk::IBoolean* obj = AAFwk::IBoolean::Query(iIt);
@@ -310,49 +394,14 @@ template<typename T1, typename T2, typename T3>
 static void SetNewArray(const AAFwk::InterfaceID& id, AAFwk::IArray* orgIArray, sptr<AAFwk::IArray>& ao);
 
 DistributedWantParams::DistributedWantParams(const DistributedWantParams& wantParams)
+    : params_(wantParams.params_)
+{
+}
+
+// like the copy, a move only takes the params, fds and unsupported data stay with the source
+DistributedWantParams::DistributedWantParams(DistributedWantParams&& wantParams) noexcept
+    : params_(std::move(wantParams.params_))
 {
-    params_.clear();
-    NewParams(wantParams, *this);
-}
-// inner use function
-bool DistributedWantParams::NewParams(const DistributedWantParams& source, DistributedWantParams& dest)
-{
-    // Deep copy
-    for (auto it = source.params_.begin(); it != source.params_.end(); it++) {
-        sptr<IInterface> o = it->second;
-        if (AAFwk::IString::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::String::Box(AAFwk::String::Unbox(AAFwk::IString::Query(o)));
-        } else if (AAFwk::IBoolean::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::Boolean::Box(AAFwk::Boolean::Unbox(AAFwk::IBoolean::Query(o)));
-        } else if (AAFwk::IByte::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::Byte::Box(AAFwk::Byte::Unbox(AAFwk::IByte::Query(o)));
-        } else if (AAFwk::IChar::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::Char::Box(AAFwk::Char::Unbox(AAFwk::IChar::Query(o)));
-        } else if (AAFwk::IShort::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::Short::Box(AAFwk::Short::Unbox(AAFwk::IShort::Query(o)));
-        } else if (AAFwk::IInteger::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::Integer::Box(AAFwk::Integer::Unbox(AAFwk::IInteger::Query(o)));
-        } else if (AAFwk::ILong::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::Long::Box(AAFwk::Long::Unbox(AAFwk::ILong::Query(o)));
-        } else if (AAFwk::IFloat::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::Float::Box(AAFwk::Float::Unbox(AAFwk::IFloat::Query(o)));
-        } else if (AAFwk::IDouble::Query(o) != nullptr) {
-            dest.params_[it->first] = AAFwk::Double::Box(AAFwk::Double::Unbox(AAFwk::IDouble::Query(o)));
-        } else if (AAFwk::IRemoteObjectWrap::Query(o) != nullptr) {
-            dest.params_[it->first] =
-                AAFwk::RemoteObjectWrap::Box(AAFwk::RemoteObjectWrap::UnBox(AAFwk::IRemoteObjectWrap::Query(o)));
-        } else if (IDistributedWantParams::Query(o) != nullptr) {
-            DistributedWantParams newDest(DistributedWantParamWrapper::Unbox(IDistributedWantParams::Query(o)));
-            dest.params_[it->first] = DistributedWantParamWrapper::Box(newDest);
-        } else if (AAFwk::IArray::Query(o) != nullptr) {
-            sptr<AAFwk::IArray> destAO = nullptr;
-            if (!NewArrayData(AAFwk::IArray::Query(o), destAO)) {
-                continue;
-            }
-            dest.params_[it->first] = destAO;
-        }
-    }
-    return true;
 }
 
 bool DistributedWantParams::NewArrayData(AAFwk::IArray* source, sptr<AAFwk::IArray>& dest)
@@ -389,14 +438,24 @@ bool DistributedWantParams::NewArrayData(AAFwk::IArray* source, sptr<AAFwk::IArr
 DistributedWantParams& DistributedWantParams::operator=(const DistributedWantParams& other)
 {
     if (this != &other) {
-        params_.clear();
-        NewParams(other, *this);
+        params_ = other.params_;
+    }
+    return *this;
+}
+
+DistributedWantParams& DistributedWantParams::operator=(DistributedWantParams&& other) noexcept
+{
+    if (this != &other) {
+        params_ = std::move(other.params_);
     }
     return *this;
 }
 
 bool DistributedWantParams::operator==(const DistributedWantParams& other)
 {
+    if (params_.SharesWith(other.params_)) {
+        return true;
+    }
     if (this->params_.size() != other.params_.size()) {
         return false;
     }
@@ -501,7 +560,7 @@ sptr<IInterface> DistributedWantParams::GetParam(const std::string& key) const
 
 const std::map<std::string, sptr<IInterface>>& DistributedWantParams::GetParams() const
 {
-    return params_;
+    return params_.Get();
 }
 
 const std::set<std::string> DistributedWantParams::KeySet() const
@@ -1423,12 +1482,11 @@ DistributedWantParams* DistributedWantParams::Unmarshalling(Parcel& parcel)
     return wantParams;
 }
 
-AAFwk::WantParams DistributedWantParams::ToWantParams()
+AAFwk::WantParams DistributedWantParams::ToWantParams() const
 {
     AAFwk::WantParams wantParams;
-    std::map<std::string, sptr<IInterface>> data = GetParams();
-    for (auto it = data.begin(); it != data.end(); it++) {
-        wantParams.SetParam(it->first, it->second);
+    for (const auto& [key, value] : params_) {
+        wantParams.SetParam(key, value);
     }
     return wantParams;
 }
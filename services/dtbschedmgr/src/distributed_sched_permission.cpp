@@ -176,7 +176,7 @@ int32_t DistributedSchedPermission::GetAccountInfo(const std::string& remoteNetw
         HILOGE("remoteNetworkId is empty");
         return ERR_NULL_OBJECT;
     }
-    std::string udid = DnetworkAdapter::GetInstance()->GetUdidByNetworkId(remoteNetworkId);
+    std::string udid = DtbschedmgrDeviceInfoStorage::GetInstance().GetUdidByNetworkId(remoteNetworkId);
     if (udid.empty()) {
         HILOGE("udid is empty");
         return ERR_NULL_OBJECT;
@@ -515,7 +515,7 @@ bool DistributedSchedPermission::VerifyPermission(uint32_t accessToken, const st
 bool DistributedSchedPermission::CheckAccountAccessPermission(const CallerInfo& callerInfo,
     const AccountInfo& accountInfo, const std::string& targetBundleName, bool isNewCollab)
 {
-    std::string udid = DnetworkAdapter::GetInstance()->GetUdidByNetworkId(callerInfo.sourceDeviceId);
+    std::string udid = DtbschedmgrDeviceInfoStorage::GetInstance().GetUdidByNetworkId(callerInfo.sourceDeviceId);
     std::string dstNetworkId;
     if (!DtbschedmgrDeviceInfoStorage::GetInstance().GetLocalDeviceId(dstNetworkId)) {
         HILOGE("GetLocalDeviceId failed");
@@ -712,12 +712,12 @@ bool DistributedSchedPermission::CheckMinApiVersion(const AppExecFwk::AbilityInf
 bool DistributedSchedPermission::CheckDeviceSecurityLevel(const std::string& srcDeviceId,
     const std::string& dstDeviceId) const
 {
-    std::string srcUdid = DnetworkAdapter::GetInstance()->GetUdidByNetworkId(srcDeviceId);
+    std::string srcUdid = DtbschedmgrDeviceInfoStorage::GetInstance().GetUdidByNetworkId(srcDeviceId);
     if (srcUdid.empty()) {
         HILOGE("src udid is empty");
         return false;
     }
-    std::string dstUdid = DnetworkAdapter::GetInstance()->GetUdidByNetworkId(dstDeviceId);
+    std::string dstUdid = DtbschedmgrDeviceInfoStorage::GetInstance().GetUdidByNetworkId(dstDeviceId);
     if (dstUdid.empty()) {
         HILOGE("dst udid is empty");
         return false;
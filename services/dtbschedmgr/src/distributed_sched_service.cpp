@@ -54,12 +54,14 @@
 #include "distributed_sched_permission.h"
 #include "distributed_sched_utils.h"
 #include "dms_callback_task.h"
+#include "dms_component_registry.h"
 #include "dms_constant.h"
 #include "dms_free_install_callback.h"
 #include "dms_token_callback.h"
 #include "dms_version_manager.h"
 #include "dsched_collab_manager.h"
 #include "dsched_continue_manager.h"
+#include "dsched_transport_softbus_adapter.h"
 #include "dtbschedmgr_device_info_storage.h"
 #include "dtbschedmgr_log.h"
 #include "parcel_helper.h"
@@ -79,6 +81,7 @@
 #include "mission/notification/dms_continue_recommend_manager.h"
 #include "mission/notification/dms_continue_recv_manager.h"
 #include "mission/distributed_sched_mission_manager.h"
+#include "mission/dms_kv_store_manager.h"
 #include "mission/dsched_sync_e2e.h"
 #include "mission/wifi_state_listener.h"
 #include "mission/bluetooth_state_listener.h"
@@ -324,12 +327,9 @@ bool DistributedSchedService::Init()
         HILOGW("DtbschedmgrDeviceInfoStorage init failed.");
     }
     InitDataShareManager();
-    InitMissionManager();
-    DSchedCollabManager::GetInstance().Init();
+    RegisterComponents();
+    StartComponents();
     DistributedSchedAdapter::GetInstance().Init();
-    if (SwitchStatusDependency::GetInstance().IsContinueSwitchOn()) {
-        DSchedContinueManager::GetInstance().Init();
-    }
     connectDeathRecipient_ = sptr<IRemoteObject::DeathRecipient>(new ConnectDeathRecipient());
     callerDeathRecipient_ = sptr<IRemoteObject::DeathRecipient>(new CallerDeathRecipient());
     callerDeathRecipientForLocalDevice_ = sptr<IRemoteObject::DeathRecipient>(
@@ -341,6 +341,46 @@ bool DistributedSchedService::Init()
     return true;
 }
 
+void DistributedSchedService::StartComponents()
+{
+    // the channel must listen before any peer can bind, continue and collab start on first use
+    DmsComponentRegistry::GetInstance().Ensure(DMS_COMPONENT_SOFTBUS_CHANNEL, DMS_TRIGGER_SA_START);
+    DmsComponentRegistry::GetInstance().Ensure(DMS_COMPONENT_MISSION, DMS_TRIGGER_SA_START);
+}
+
+void DistributedSchedService::RegisterComponents()
+{
+    auto& registry = DmsComponentRegistry::GetInstance();
+    registry.Register(DMS_COMPONENT_SOFTBUS_CHANNEL, {}, []() {
+        return DSchedTransportSoftbusAdapter::GetInstance().InitChannel() == ERR_OK;
+    });
+    registry.Register(DMS_COMPONENT_MISSION, {}, [this]() {
+        InitMissionManager();
+        return true;
+    });
+    registry.Register(DMS_COMPONENT_CONTINUE, { DMS_COMPONENT_SOFTBUS_CHANNEL }, []() {
+        if (!DataShareManager::GetInstance().IsCurrentContinueSwitchOn()) {
+            HILOGW("continue switch is off.");
+            return false;
+        }
+        DSchedContinueManager::GetInstance().Init();
+        return true;
+    }, []() {
+        DSchedContinueManager::GetInstance().UnInit();
+    });
+    // collab stays up once started, its UnInit releases the channel shared with continue
+    registry.Register(DMS_COMPONENT_COLLAB, { DMS_COMPONENT_SOFTBUS_CHANNEL }, []() {
+        return DSchedCollabManager::GetInstance().Init() == ERR_OK;
+    });
+    DSchedTransportSoftbusAdapter::GetInstance().SetListenerLoader([](int32_t serviceType) {
+        if (serviceType == SERVICE_TYPE_CONTINUE) {
+            DmsComponentRegistry::GetInstance().Ensure(DMS_COMPONENT_CONTINUE, DMS_TRIGGER_PEER_DATA);
+        } else if (serviceType == SERVICE_TYPE_COLLAB) {
+            DmsComponentRegistry::GetInstance().Ensure(DMS_COMPONENT_COLLAB, DMS_TRIGGER_PEER_DATA);
+        }
+    });
+}
+
 void DistributedSchedService::InitMissionManager()
 {
 #ifdef SUPPORT_DISTRIBUTED_MISSION_MANAGER
@@ -348,6 +388,9 @@ void DistributedSchedService::InitMissionManager()
     if (!AddSystemAbilityListener(WINDOW_MANAGER_SERVICE_ID)) {
         HILOGE("Add System Ability Listener failed!");
     }
+    if (!AddSystemAbilityListener(DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID)) {
+        HILOGE("Add kv data service listener failed!");
+    }
     DistributedSchedMissionManager::GetInstance().Init();
     DistributedSchedMissionManager::GetInstance().InitDataStorage();
     InitCommonEventListener();
@@ -361,6 +404,10 @@ void DistributedSchedService::InitMissionManager()
 void DistributedSchedService::OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId)
 {
     HILOGI("OnAddSystemAbility systemAbilityId:%{public}d added!", systemAbilityId);
+    if (systemAbilityId == DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID) {
+        DmsKvStoreManager::GetInstance().OnKvServiceAdded();
+        return;
+    }
     if (missionFocusedListener_ == nullptr) {
         HILOGI("missionFocusedListener_ is nullptr.");
         missionFocusedListener_ = sptr<DistributedMissionFocusedListener>(new DistributedMissionFocusedListener());
@@ -372,6 +419,14 @@ void DistributedSchedService::OnAddSystemAbility(int32_t systemAbilityId, const
     }
 }
 
+void DistributedSchedService::OnRemoveSystemAbility(int32_t systemAbilityId, const std::string& deviceId)
+{
+    HILOGI("OnRemoveSystemAbility systemAbilityId:%{public}d removed!", systemAbilityId);
+    if (systemAbilityId == DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID) {
+        DmsKvStoreManager::GetInstance().OnKvServiceRemoved();
+    }
+}
+
 void DistributedSchedService::RegisterDataShareObserver(const std::string& key)
 {
     HILOGI("RegisterObserver start.");
@@ -390,7 +445,6 @@ void DistributedSchedService::RegisterDataShareObserver(const std::string& key)
                 return;
             }
             sendMgr->OnMissionStatusChanged(missionId, MISSION_EVENT_FOCUSED);
-            DSchedContinueManager::GetInstance().Init();
         } else {
             auto sendMgr = MultiUserManager::GetInstance().GetCurrentSendMgr();
             if (sendMgr == nullptr) {
@@ -404,7 +458,7 @@ void DistributedSchedService::RegisterDataShareObserver(const std::string& key)
                 return;
             }
             recvMgr->OnContinueSwitchOff();
-            DSchedContinueManager::GetInstance().UnInit();
+            DmsComponentRegistry::GetInstance().Stop(DMS_COMPONENT_CONTINUE);
         };
     };
     dataShareManager.RegisterObserver(key, observerCallback);
@@ -463,6 +517,7 @@ void DistributedSchedService::InitCommonEventListener()
 {
     HILOGI("InitCommonEventListener called");
 #ifdef SUPPORT_COMMON_EVENT_SERVICE
+    // publishes the local bundle infos once its kv store is ready
     DmsBmStorage::GetInstance();
     EventFwk::MatchingSkills matchingSkills;
     matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_SCREEN_LOCKED);
@@ -476,10 +531,6 @@ void DistributedSchedService::InitCommonEventListener()
     EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
     auto applyMonitor = std::make_shared<CommonEventListener>(subscribeInfo);
     EventFwk::CommonEventManager::SubscribeCommonEvent(applyMonitor);
-    DmsBmStorage::GetInstance()->UpdateDistributedData();
-    if (DmsKvSyncE2E::GetInstance()->CheckDeviceCfg()) {
-        DmsKvSyncE2E::GetInstance()->PushAndPullData();
-    }
 #endif
 }
 
@@ -1558,6 +1609,7 @@ void DistributedSchedService::NotifyDSchedEventCallbackResult(int32_t resultCode
             HILOGE("Event does not carry specific operation type, eventType %{public}d.", event.dSchedEventType_);
             return;
     }
+    eventHistory_.Record(event);
 }
 
 void DistributedSchedService::NotifyContinuateEventResult(int32_t resultCode, const EventNotify& event)
@@ -1646,8 +1698,22 @@ void DistributedSchedService::RemoteConnectAbilityMappingLocked(const sptr<IRemo
     if (connect == nullptr) {
         return;
     }
-    auto itConnect = distributedConnectAbilityMap_.find(connect);
-    if (itConnect == distributedConnectAbilityMap_.end()) {
+    bool isNewConnect = distributedConnectAbilityMap_.Update(connect,
+        [&](std::list<ConnectAbilitySession>& sessionsList) {
+            for (auto& session : sessionsList) {
+                if (remoteDeviceId == session.GetDestinationDeviceId()) {
+                    session.AddElement(element);
+                    // already added session for remote device
+                    return true;
+                }
+            }
+            // connect to another remote device, add a new session to list
+            auto& session = sessionsList.emplace_back(localDeviceId, remoteDeviceId, callerInfo, targetComponent);
+            session.AddElement(element);
+            HILOGD("add connection success");
+            return true;
+        });
+    if (isNewConnect) {
         // add uid's connect number
         uint32_t number = ++trackingUidMap_[callerInfo.uid];
         HILOGD("uid %{public}d has %{public}u connection(s), targetComponent: %{public}d.",
@@ -1657,18 +1723,6 @@ void DistributedSchedService::RemoteConnectAbilityMappingLocked(const sptr<IRemo
         ReportDistributedComponentChange(callerInfo, DISTRIBUTED_COMPONENT_ADD, IDistributedSched::CONNECT,
             IDistributedSched::CALLER);
     }
-    auto& sessionsList = distributedConnectAbilityMap_[connect];
-    for (auto& session : sessionsList) {
-        if (remoteDeviceId == session.GetDestinationDeviceId()) {
-            session.AddElement(element);
-            // already added session for remote device
-            return;
-        }
-    }
-    // connect to another remote device, add a new session to list
-    auto& session = sessionsList.emplace_back(localDeviceId, remoteDeviceId, callerInfo, targetComponent);
-    session.AddElement(element);
-    HILOGD("add connection success");
 }
 
 int32_t DistributedSchedService::CheckDistributedConnectLocked(const CallerInfo& callerInfo) const
@@ -1712,6 +1766,26 @@ int32_t DistributedSchedService::GetUidLocked(const std::list<ConnectAbilitySess
     return INVALID_CALLER_UID;
 }
 
+std::set<std::string> DistributedSchedService::GetSessionsDeviceIds(
+    const std::list<ConnectAbilitySession>& sessionsList)
+{
+    std::set<std::string> deviceIds;
+    for (const auto& session : sessionsList) {
+        deviceIds.insert(session.GetDestinationDeviceId());
+    }
+    return deviceIds;
+}
+
+std::set<std::string> DistributedSchedService::GetConnectInfoDeviceIds(const ConnectInfo& connectInfo)
+{
+    return { connectInfo.callerInfo.sourceDeviceId };
+}
+
+std::set<std::string> DistributedSchedService::GetCallInfoDeviceIds(const CallInfo& callInfo)
+{
+    return { callInfo.remoteDeviceId };
+}
+
 int32_t DistributedSchedService::ConnectRemoteAbility(const OHOS::AAFwk::Want& want,
     const sptr<IRemoteObject>& connect, int32_t callerUid, int32_t callerPid, uint32_t accessToken)
 {
@@ -1843,31 +1917,19 @@ void DistributedSchedService::ProcessCallerDied(const sptr<IRemoteObject>& conne
 
 void DistributedSchedService::HandleLocalCallerDied(const sptr<IRemoteObject>& connect)
 {
-    {
-        std::lock_guard<std::mutex> autoLock(callerLock_);
-        auto it = callerMap_.find(connect);
-        if (it != callerMap_.end()) {
-            std::list<ConnectAbilitySession> sessionsList = it->second;
-            if (!sessionsList.empty()) {
-                ReportDistributedComponentChange(sessionsList.front().GetCallerInfo(), DISTRIBUTED_COMPONENT_REMOVE,
-                    IDistributedSched::CALL, IDistributedSched::CALLER);
-            }
-            NotifyCollaborateEventWithSessions(sessionsList, DMS_DSCHED_EVENT_FINISH, ERR_OK);
-            callerMap_.erase(it);
-            HILOGI("remove connection success");
-        } else {
-            HILOGW("HandleLocalCallerDied connect not found");
+    std::list<ConnectAbilitySession> sessionsList;
+    if (callerMap_.Erase(connect, &sessionsList)) {
+        if (!sessionsList.empty()) {
+            ReportDistributedComponentChange(sessionsList.front().GetCallerInfo(), DISTRIBUTED_COMPONENT_REMOVE,
+                IDistributedSched::CALL, IDistributedSched::CALLER);
         }
+        NotifyCollaborateEventWithSessions(sessionsList, DMS_DSCHED_EVENT_FINISH, ERR_OK);
+        HILOGI("remove connection success");
+    } else {
+        HILOGW("HandleLocalCallerDied connect not found");
     }
-    {
-        std::lock_guard<std::mutex> autoLock(callLock_);
-        for (auto iter = callMap_.begin(); iter != callMap_.end(); iter++) {
-            if (iter->first == connect) {
-                callMap_.erase(iter);
-                HILOGI("remove callMap_ connect success");
-                break;
-            }
-        }
+    if (callMap_.Erase(connect)) {
+        HILOGI("remove callMap_ connect success");
     }
 }
 
@@ -1961,25 +2023,30 @@ void DistributedSchedService::SaveCallerComponent(const OHOS::AAFwk::Want& want,
         HILOGW("connect is nullptr");
         return;
     }
-    std::lock_guard<std::mutex> autoLock(callerLock_);
-    auto itConnect = callerMap_.find(connect);
-    if (itConnect == callerMap_.end()) {
+    std::string remoteDeviceId = want.GetElement().GetDeviceID();
+    bool isNewSession = false;
+    bool isNewConnect = callerMap_.Update(connect, [&](std::list<ConnectAbilitySession>& sessionsList) {
+        for (auto& session : sessionsList) {
+            if (remoteDeviceId == session.GetDestinationDeviceId()) {
+                session.AddElement(want.GetElement());
+                // already added session for remote device
+                return true;
+            }
+        }
+        // connect to another remote device, add a new session to list
+        auto& session = sessionsList.emplace_back(callerInfo.sourceDeviceId, remoteDeviceId, callerInfo);
+        session.AddElement(want.GetElement());
+        isNewSession = true;
+        return true;
+    });
+    if (isNewConnect) {
         connect->AddDeathRecipient(callerDeathRecipientForLocalDevice_);
         ReportDistributedComponentChange(callerInfo, DISTRIBUTED_COMPONENT_ADD, IDistributedSched::CALL,
             IDistributedSched::CALLER);
     }
-    auto& sessionsList = callerMap_[connect];
-    std::string remoteDeviceId = want.GetElement().GetDeviceID();
-    for (auto& session : sessionsList) {
-        if (remoteDeviceId == session.GetDestinationDeviceId()) {
-            session.AddElement(want.GetElement());
-            // already added session for remote device
-            return;
-        }
+    if (!isNewSession) {
+        return;
     }
-    // connect to another remote device, add a new session to list
-    auto& session = sessionsList.emplace_back(callerInfo.sourceDeviceId, remoteDeviceId, callerInfo);
-    session.AddElement(want.GetElement());
 
     HILOGD("add connection success");
     EventNotify tempEvent;
@@ -1993,78 +2060,64 @@ void DistributedSchedService::RemoveCallerComponent(const sptr<IRemoteObject>& c
         HILOGW("connect is nullptr");
         return;
     }
-    {
-        std::lock_guard<std::mutex> autoLock(callerLock_);
-        auto it = callerMap_.find(connect);
-        if (it != callerMap_.end()) {
-            connect->RemoveDeathRecipient(callerDeathRecipientForLocalDevice_);
-            std::list<ConnectAbilitySession> sessionsList = it->second;
-            if (!sessionsList.empty()) {
-                ReportDistributedComponentChange(sessionsList.front().GetCallerInfo(), DISTRIBUTED_COMPONENT_REMOVE,
-                    IDistributedSched::CALL, IDistributedSched::CALLER);
-            }
-            NotifyCollaborateEventWithSessions(sessionsList, DMS_DSCHED_EVENT_FINISH, ERR_OK);
-            callerMap_.erase(it);
-            HILOGI("remove connection success");
-        } else {
-            HILOGW("RemoveCallerComponent connect not found");
-        }
+    std::list<ConnectAbilitySession> sessionsList;
+    if (callerMap_.Erase(connect, &sessionsList)) {
+        connect->RemoveDeathRecipient(callerDeathRecipientForLocalDevice_);
+        if (!sessionsList.empty()) {
+            ReportDistributedComponentChange(sessionsList.front().GetCallerInfo(), DISTRIBUTED_COMPONENT_REMOVE,
+                IDistributedSched::CALL, IDistributedSched::CALLER);
+        }
+        NotifyCollaborateEventWithSessions(sessionsList, DMS_DSCHED_EVENT_FINISH, ERR_OK);
+        HILOGI("remove connection success");
+    } else {
+        HILOGW("RemoveCallerComponent connect not found");
     }
-    {
-        std::lock_guard<std::mutex> autoLock(callLock_);
-        for (auto iter = callMap_.begin(); iter != callMap_.end(); iter++) {
-            if (iter->first == connect) {
-                callMap_.erase(iter);
-                HILOGI("remove callMap_ connect success");
-                break;
-            }
-        }
+    if (callMap_.Erase(connect)) {
+        HILOGI("remove callMap_ connect success");
     }
 }
 
 void DistributedSchedService::ProcessCalleeOffline(const std::string& deviceId)
 {
-    {
-        std::lock_guard<std::mutex> autoLock(callerLock_);
-        for (auto iter = callerMap_.begin(); iter != callerMap_.end();) {
-            std::list<ConnectAbilitySession>& sessionsList = iter->second;
+    for (const auto& connect : callerMap_.GetConnectsOfDevice(deviceId)) {
+        std::list<ConnectAbilitySession> offlineSessions;
+        bool isRemoved = false;
+        callerMap_.UpdateIfExists(connect, [&deviceId, &offlineSessions, &isRemoved](auto& sessionsList) {
             auto itSession = std::find_if(sessionsList.begin(), sessionsList.end(), [&deviceId](const auto& session) {
                 return session.GetDestinationDeviceId() == deviceId;
             });
-            CallerInfo callerInfo;
             if (itSession != sessionsList.end()) {
-                callerInfo = itSession->GetCallerInfo();
-                for (const auto &element : itSession->GetElementsList()) {
-                    EventNotify tempEvent;
-                    GetCurSrcCollaborateEvent(callerInfo, element, DMS_DSCHED_EVENT_FINISH, ERR_OK, tempEvent);
-                    NotifyDSchedEventCallbackResult(ERR_OK, tempEvent);
-                }
-                sessionsList.erase(itSession);
+                offlineSessions.splice(offlineSessions.end(), sessionsList, itSession);
             }
-
-            if (sessionsList.empty()) {
-                if (iter->first != nullptr) {
-                    iter->first->RemoveDeathRecipient(callerDeathRecipientForLocalDevice_);
-                }
-                ReportDistributedComponentChange(callerInfo, DISTRIBUTED_COMPONENT_REMOVE,
-                    IDistributedSched::CALL, IDistributedSched::CALLER);
-                iter = callerMap_.erase(iter);
-            } else {
-                iter++;
+            isRemoved = sessionsList.empty();
+            return !isRemoved;
+        });
+        CallerInfo callerInfo;
+        for (const auto& session : offlineSessions) {
+            callerInfo = session.GetCallerInfo();
+            for (const auto &element : session.GetElementsList()) {
+                EventNotify tempEvent;
+                GetCurSrcCollaborateEvent(callerInfo, element, DMS_DSCHED_EVENT_FINISH, ERR_OK, tempEvent);
+                NotifyDSchedEventCallbackResult(ERR_OK, tempEvent);
             }
         }
-    }
-    {
-        std::lock_guard<std::mutex> autoLock(callLock_);
-        for (auto iter = callMap_.begin(); iter != callMap_.end();) {
-            if (iter->second.remoteDeviceId == deviceId) {
-                iter = callMap_.erase(iter);
-                HILOGI("remove callMap_ connect success");
-            } else {
-                iter++;
+        if (isRemoved) {
+            if (connect != nullptr) {
+                connect->RemoveDeathRecipient(callerDeathRecipientForLocalDevice_);
             }
+            ReportDistributedComponentChange(callerInfo, DISTRIBUTED_COMPONENT_REMOVE,
+                IDistributedSched::CALL, IDistributedSched::CALLER);
         }
     }
+    for (const auto& connect : callMap_.GetConnectsOfDevice(deviceId)) {
+        callMap_.UpdateIfExists(connect, [&deviceId](const CallInfo& callInfo) {
+            if (callInfo.remoteDeviceId != deviceId) {
+                return true;
+            }
+            HILOGI("remove callMap_ connect success");
+            return false;
+        });
+    }
 }
 
 int32_t DistributedSchedService::SaveConnectToken(const OHOS::AAFwk::Want& want, const sptr<IRemoteObject>& connect)
@@ -2078,11 +2131,8 @@ int32_t DistributedSchedService::SaveConnectToken(const OHOS::AAFwk::Want& want,
         }
         token_.store(tToken);
     }
-    {
-        std::lock_guard<std::mutex> autoLock(callLock_);
-        callMap_[connect] = {tToken, want.GetElement().GetDeviceID()};
-        HILOGI("add connect success");
-    }
+    callMap_.Assign(connect, {tToken, want.GetElement().GetDeviceID()});
+    HILOGI("add connect success");
     return tToken;
 }
 
@@ -2127,10 +2177,7 @@ int32_t DistributedSchedService::StartRemoteAbilityByCall(const OHOS::AAFwk::Wan
 
     int32_t ret = TryStartRemoteAbilityByCall(want, connect, callerInfo);
     if (ret != ERR_OK) {
-        {
-            std::lock_guard<std::mutex> autoLock(callLock_);
-            callMap_.erase(connect);
-        }
+        callMap_.Erase(connect);
         HILOGE("StartRemoteAbilityByCall result is %{public}d", ret);
     }
     return ret;
@@ -2338,59 +2385,56 @@ int32_t DistributedSchedService::GetDistributedComponentList(std::vector<std::st
 
 void DistributedSchedService::GetConnectComponentList(std::vector<std::string>& distributedComponents)
 {
-    {
-        std::lock_guard<std::mutex> autoLock(distributedLock_);
-        for (const auto& iter : distributedConnectAbilityMap_) {
-            if (iter.second.empty()) {
-                continue;
-            }
-            CallerInfo callerInfo = iter.second.front().GetCallerInfo();
-            nlohmann::json componentInfoJson;
-            componentInfoJson[PID_KEY] = callerInfo.pid;
-            componentInfoJson[UID_KEY] = callerInfo.uid;
-            componentInfoJson[BUNDLE_NAME_KEY] =
-                callerInfo.bundleNames.empty() ? std::string() : callerInfo.bundleNames.front();
-            componentInfoJson[COMPONENT_TYPE_KEY] = IDistributedSched::CONNECT;
-            componentInfoJson[DEVICE_TYPE_KEY] = IDistributedSched::CALLER;
-            std::string componentInfo = componentInfoJson.dump();
-            distributedComponents.emplace_back(componentInfo);
-        }
-    }
-    {
-        std::lock_guard<std::mutex> autoLock(connectLock_);
-        for (const auto& iter : connectAbilityMap_) {
-            ConnectInfo connectInfo = iter.second;
-            nlohmann::json componentInfoJson;
-            componentInfoJson[UID_KEY] = BundleManagerInternal::GetUidFromBms(connectInfo.element.GetBundleName());
-            componentInfoJson[BUNDLE_NAME_KEY] = connectInfo.element.GetBundleName();
-            componentInfoJson[COMPONENT_TYPE_KEY] = IDistributedSched::CONNECT;
-            componentInfoJson[DEVICE_TYPE_KEY] = IDistributedSched::CALLEE;
-            std::string componentInfo = componentInfoJson.dump();
-            distributedComponents.emplace_back(componentInfo);
+    distributedConnectAbilityMap_.ForEach([&distributedComponents](const sptr<IRemoteObject>& connect,
+        const std::list<ConnectAbilitySession>& sessionsList) {
+        if (sessionsList.empty()) {
+            return;
         }
+        CallerInfo callerInfo = sessionsList.front().GetCallerInfo();
+        nlohmann::json componentInfoJson;
+        componentInfoJson[PID_KEY] = callerInfo.pid;
+        componentInfoJson[UID_KEY] = callerInfo.uid;
+        componentInfoJson[BUNDLE_NAME_KEY] =
+            callerInfo.bundleNames.empty() ? std::string() : callerInfo.bundleNames.front();
+        componentInfoJson[COMPONENT_TYPE_KEY] = IDistributedSched::CONNECT;
+        componentInfoJson[DEVICE_TYPE_KEY] = IDistributedSched::CALLER;
+        std::string componentInfo = componentInfoJson.dump();
+        distributedComponents.emplace_back(componentInfo);
+    });
+    // the bms query is an ipc, do not make it under a shard lock
+    std::vector<ConnectInfo> connectInfos;
+    connectAbilityMap_.ForEach([&connectInfos](const sptr<IRemoteObject>& connect, const ConnectInfo& connectInfo) {
+        connectInfos.push_back(connectInfo);
+    });
+    for (const auto& connectInfo : connectInfos) {
+        nlohmann::json componentInfoJson;
+        componentInfoJson[UID_KEY] = BundleManagerInternal::GetUidFromBms(connectInfo.element.GetBundleName());
+        componentInfoJson[BUNDLE_NAME_KEY] = connectInfo.element.GetBundleName();
+        componentInfoJson[COMPONENT_TYPE_KEY] = IDistributedSched::CONNECT;
+        componentInfoJson[DEVICE_TYPE_KEY] = IDistributedSched::CALLEE;
+        std::string componentInfo = componentInfoJson.dump();
+        distributedComponents.emplace_back(componentInfo);
     }
 }
 
 void DistributedSchedService::GetCallComponentList(std::vector<std::string>& distributedComponents)
 {
-    {
-        std::lock_guard<std::mutex> autoLock(callerLock_);
-        for (const auto& iter : callerMap_) {
-            if (iter.second.empty()) {
-                continue;
-            }
-            CallerInfo callerInfo = iter.second.front().GetCallerInfo();
-            nlohmann::json componentInfoJson;
-            componentInfoJson[PID_KEY] = callerInfo.pid;
-            componentInfoJson[UID_KEY] = callerInfo.uid;
-            componentInfoJson[BUNDLE_NAME_KEY] =
-                callerInfo.bundleNames.empty() ? std::string() : callerInfo.bundleNames.front();
-            componentInfoJson[COMPONENT_TYPE_KEY] = IDistributedSched::CALL;
-            componentInfoJson[DEVICE_TYPE_KEY] = IDistributedSched::CALLER;
-            std::string componentInfo = componentInfoJson.dump();
-            distributedComponents.emplace_back(componentInfo);
+    callerMap_.ForEach([&distributedComponents](const sptr<IRemoteObject>& connect,
+        const std::list<ConnectAbilitySession>& sessionsList) {
+        if (sessionsList.empty()) {
+            return;
         }
-    }
+        CallerInfo callerInfo = sessionsList.front().GetCallerInfo();
+        nlohmann::json componentInfoJson;
+        componentInfoJson[PID_KEY] = callerInfo.pid;
+        componentInfoJson[UID_KEY] = callerInfo.uid;
+        componentInfoJson[BUNDLE_NAME_KEY] =
+            callerInfo.bundleNames.empty() ? std::string() : callerInfo.bundleNames.front();
+        componentInfoJson[COMPONENT_TYPE_KEY] = IDistributedSched::CALL;
+        componentInfoJson[DEVICE_TYPE_KEY] = IDistributedSched::CALLER;
+        std::string componentInfo = componentInfoJson.dump();
+        distributedComponents.emplace_back(componentInfo);
+    });
     {
         std::lock_guard<std::mutex> autoLock(calleeLock_);
         for (const auto& iter : calleeMap_) {
@@ -2556,25 +2600,23 @@ int32_t DistributedSchedService::ConnectAbilityFromRemote(const OHOS::AAFwk::Wan
 
     HILOGI("ConnectAbilityFromRemote callerType is %{public}d", callerInfo.callerType);
     sptr<IRemoteObject> callbackWrapper = connect;
-    std::map<sptr<IRemoteObject>, ConnectInfo>::iterator itConnect;
+    bool isConnected = false;
     if (callerInfo.callerType == CALLER_TYPE_HARMONY) {
-        std::lock_guard<std::mutex> autoLock(connectLock_);
-        itConnect = connectAbilityMap_.find(connect);
-        if (itConnect != connectAbilityMap_.end()) {
-            callbackWrapper = itConnect->second.callbackWrapper;
+        ConnectInfo connectInfo;
+        isConnected = connectAbilityMap_.Find(connect, connectInfo);
+        if (isConnected) {
+            callbackWrapper = connectInfo.callbackWrapper;
         } else {
             callbackWrapper = new AbilityConnectionWrapperStub(connect);
         }
     }
     int32_t errCode = DistributedSchedAdapter::GetInstance().ConnectAbility(want, callbackWrapper, this);
     HILOGI("[PerformanceTest] ConnectAbilityFromRemote end");
-    if (errCode == ERR_OK) {
-        std::lock_guard<std::mutex> autoLock(connectLock_);
-        if (itConnect == connectAbilityMap_.end()) {
-            ConnectInfo connectInfo {callerInfo, callbackWrapper, want.GetElement()};
+    if (errCode == ERR_OK && !isConnected) {
+        ConnectInfo connectInfo {callerInfo, callbackWrapper, want.GetElement()};
+        if (connectAbilityMap_.Emplace(connect, connectInfo)) {
             ReportDistributedComponentChange(connectInfo, DISTRIBUTED_COMPONENT_ADD,
                 IDistributedSched::CONNECT, IDistributedSched::CALLEE);
-            connectAbilityMap_.emplace(connect, connectInfo);
         }
     }
     return errCode;
@@ -2604,26 +2646,22 @@ int32_t DistributedSchedService::DisconnectRemoteAbility(const sptr<IRemoteObjec
     }
 
     std::list<ConnectAbilitySession> sessionsList;
-    {
-        std::lock_guard<std::mutex> autoLock(distributedLock_);
-        auto it = distributedConnectAbilityMap_.find(connect);
-        if (it != distributedConnectAbilityMap_.end()) {
-            sessionsList = it->second;
-            int32_t uid = GetUidLocked(sessionsList);
+    if (distributedConnectAbilityMap_.Erase(connect, &sessionsList)) {
+        {
+            std::lock_guard<std::mutex> autoLock(distributedLock_);
             // also decrease number when erase connect
-            DecreaseConnectLocked(uid);
-            connect->RemoveDeathRecipient(connectDeathRecipient_);
-            if (!sessionsList.empty()) {
-                ReportDistributedComponentChange(sessionsList.front().GetCallerInfo(), DISTRIBUTED_COMPONENT_REMOVE,
-                    IDistributedSched::CONNECT, IDistributedSched::CALLER);
-            }
-            distributedConnectAbilityMap_.erase(it);
-            HILOGI("remove connection success");
-        } else {
+            DecreaseConnectLocked(GetUidLocked(sessionsList));
+        }
+        connect->RemoveDeathRecipient(connectDeathRecipient_);
+        if (!sessionsList.empty()) {
+            ReportDistributedComponentChange(sessionsList.front().GetCallerInfo(), DISTRIBUTED_COMPONENT_REMOVE,
+                IDistributedSched::CONNECT, IDistributedSched::CALLER);
+        }
+        HILOGI("remove connection success");
+    } else {
 #ifdef DMSFWK_INTERACTIVE_ADAPTER
-            return DisconnectRemoteAbilityAdapter(connect, callerUid, accessToken);
+        return DisconnectRemoteAbilityAdapter(connect, callerUid, accessToken);
 #endif // DMSFWK_INTERACTIVE_ADAPTER
-        }
     }
     if (!sessionsList.empty()) {
         for (const auto& session : sessionsList) {
@@ -2657,20 +2695,14 @@ int32_t DistributedSchedService::DisconnectAbilityFromRemote(const sptr<IRemoteO
     }
 
     sptr<IRemoteObject> callbackWrapper = connect;
-    {
-        std::lock_guard<std::mutex> autoLock(connectLock_);
-        auto itConnect = connectAbilityMap_.find(connect);
-        if (itConnect != connectAbilityMap_.end()) {
-            callbackWrapper = itConnect->second.callbackWrapper;
-            ReportDistributedComponentChange(itConnect->second, DISTRIBUTED_COMPONENT_REMOVE,
-                IDistributedSched::CONNECT, IDistributedSched::CALLEE);
-            connectAbilityMap_.erase(itConnect);
-        } else {
-            if (!IPCSkeleton::IsLocalCalling()) {
-                HILOGE("DisconnectAbilityFromRemote connect not found");
-                return INVALID_REMOTE_PARAMETERS_ERR;
-            }
-        }
+    ConnectInfo connectInfo;
+    if (connectAbilityMap_.Erase(connect, &connectInfo)) {
+        callbackWrapper = connectInfo.callbackWrapper;
+        ReportDistributedComponentChange(connectInfo, DISTRIBUTED_COMPONENT_REMOVE,
+            IDistributedSched::CONNECT, IDistributedSched::CALLEE);
+    } else if (!IPCSkeleton::IsLocalCalling()) {
+        HILOGE("DisconnectAbilityFromRemote connect not found");
+        return INVALID_REMOTE_PARAMETERS_ERR;
     }
     int32_t result = DistributedSchedAdapter::GetInstance().DisconnectAbility(callbackWrapper);
     HILOGD("[PerformanceTest] DisconnectAbilityFromRemote end");
@@ -2681,75 +2713,88 @@ int32_t DistributedSchedService::NotifyProcessDiedFromRemote(const CallerInfo& c
 {
     HILOGI("NotifyProcessDiedFromRemote called");
     int32_t errCode = ERR_OK;
-    {
-        std::lock_guard<std::mutex> autoLock(connectLock_);
-        for (auto iter = connectAbilityMap_.begin(); iter != connectAbilityMap_.end();) {
-            ConnectInfo& connectInfo = iter->second;
-            if (callerInfo.sourceDeviceId == connectInfo.callerInfo.sourceDeviceId
-                && callerInfo.uid == connectInfo.callerInfo.uid
-                && callerInfo.pid == connectInfo.callerInfo.pid
-                && callerInfo.callerType == connectInfo.callerInfo.callerType) {
-                HILOGI("NotifyProcessDiedFromRemote erase connection success");
-                int32_t ret = DistributedSchedAdapter::GetInstance().DisconnectAbility(connectInfo.callbackWrapper);
-                if (ret != ERR_OK) {
-                    errCode = ret;
-                }
-                ReportDistributedComponentChange(connectInfo, DISTRIBUTED_COMPONENT_REMOVE,
-                    IDistributedSched::CONNECT, IDistributedSched::CALLEE);
-                iter = connectAbilityMap_.erase(iter);
-            } else {
-                iter++;
+    // the died process can only hold connects from its own device
+    for (const auto& connect : connectAbilityMap_.GetConnectsOfDevice(callerInfo.sourceDeviceId)) {
+        ConnectInfo connectInfo;
+        bool isErased = false;
+        connectAbilityMap_.UpdateIfExists(connect, [&callerInfo, &connectInfo, &isErased](const ConnectInfo& info) {
+            isErased = callerInfo.sourceDeviceId == info.callerInfo.sourceDeviceId
+                && callerInfo.uid == info.callerInfo.uid
+                && callerInfo.pid == info.callerInfo.pid
+                && callerInfo.callerType == info.callerInfo.callerType;
+            if (isErased) {
+                connectInfo = info;
             }
+            return !isErased;
+        });
+        if (!isErased) {
+            continue;
+        }
+        HILOGI("NotifyProcessDiedFromRemote erase connection success");
+        int32_t ret = DistributedSchedAdapter::GetInstance().DisconnectAbility(connectInfo.callbackWrapper);
+        if (ret != ERR_OK) {
+            errCode = ret;
         }
+        ReportDistributedComponentChange(connectInfo, DISTRIBUTED_COMPONENT_REMOVE,
+            IDistributedSched::CONNECT, IDistributedSched::CALLEE);
     }
     return errCode;
 }
 
 void DistributedSchedService::RemoveConnectAbilityInfo(const std::string& deviceId)
 {
-    {
-        std::lock_guard<std::mutex> autoLock(distributedLock_);
-        for (auto iter = distributedConnectAbilityMap_.begin(); iter != distributedConnectAbilityMap_.end();) {
-            std::list<ConnectAbilitySession>& sessionsList = iter->second;
-            int32_t uid = GetUidLocked(sessionsList);
-            auto itSession = std::find_if(sessionsList.begin(), sessionsList.end(), [&deviceId](const auto& session) {
-                return session.GetDestinationDeviceId() == deviceId;
-            });
-            CallerInfo callerInfo;
-            if (itSession != sessionsList.end()) {
-                NotifyDeviceOfflineToAppLocked(iter->first, *itSession);
-                callerInfo = itSession->GetCallerInfo();
-                sessionsList.erase(itSession);
-            }
-
-            if (sessionsList.empty()) {
-                if (iter->first != nullptr) {
-                    iter->first->RemoveDeathRecipient(connectDeathRecipient_);
+    // only the connects indexed under the device are visited, each under its own shard lock
+    for (const auto& connect : distributedConnectAbilityMap_.GetConnectsOfDevice(deviceId)) {
+        std::list<ConnectAbilitySession> offlineSessions;
+        int32_t uid = INVALID_CALLER_UID;
+        bool isRemoved = false;
+        distributedConnectAbilityMap_.UpdateIfExists(connect,
+            [&deviceId, &offlineSessions, &uid, &isRemoved](auto& sessionsList) {
+                uid = GetUidLocked(sessionsList);
+                auto itSession = std::find_if(sessionsList.begin(), sessionsList.end(),
+                    [&deviceId](const auto& session) { return session.GetDestinationDeviceId() == deviceId; });
+                if (itSession != sessionsList.end()) {
+                    offlineSessions.splice(offlineSessions.end(), sessionsList, itSession);
                 }
-                DecreaseConnectLocked(uid);
-                ReportDistributedComponentChange(callerInfo, DISTRIBUTED_COMPONENT_REMOVE,
-                    IDistributedSched::CONNECT, IDistributedSched::CALLER);
-                iter = distributedConnectAbilityMap_.erase(iter);
-            } else {
-                iter++;
-            }
+                isRemoved = sessionsList.empty();
+                return !isRemoved;
+            });
+        CallerInfo callerInfo;
+        for (const auto& session : offlineSessions) {
+            NotifyDeviceOfflineToAppLocked(connect, session);
+            callerInfo = session.GetCallerInfo();
         }
+        if (!isRemoved) {
+            continue;
+        }
+        if (connect != nullptr) {
+            connect->RemoveDeathRecipient(connectDeathRecipient_);
+        }
+        {
+            std::lock_guard<std::mutex> autoLock(distributedLock_);
+            DecreaseConnectLocked(uid);
+        }
+        ReportDistributedComponentChange(callerInfo, DISTRIBUTED_COMPONENT_REMOVE,
+            IDistributedSched::CONNECT, IDistributedSched::CALLER);
     }
 
-    {
-        std::lock_guard<std::mutex> autoLock(connectLock_);
-        for (auto iter = connectAbilityMap_.begin(); iter != connectAbilityMap_.end();) {
-            ConnectInfo& connectInfo = iter->second;
-            if (deviceId == connectInfo.callerInfo.sourceDeviceId) {
-                DistributedSchedAdapter::GetInstance().DisconnectAbility(connectInfo.callbackWrapper);
-                ReportDistributedComponentChange(connectInfo, DISTRIBUTED_COMPONENT_REMOVE,
-                    IDistributedSched::CONNECT, IDistributedSched::CALLEE);
-                connectAbilityMap_.erase(iter++);
-                HILOGI("ProcessDeviceOffline erase connection success");
-            } else {
-                iter++;
+    for (const auto& connect : connectAbilityMap_.GetConnectsOfDevice(deviceId)) {
+        ConnectInfo connectInfo;
+        bool isErased = false;
+        connectAbilityMap_.UpdateIfExists(connect, [&deviceId, &connectInfo, &isErased](const ConnectInfo& info) {
+            isErased = deviceId == info.callerInfo.sourceDeviceId;
+            if (isErased) {
+                connectInfo = info;
             }
+            return !isErased;
+        });
+        if (!isErased) {
+            continue;
         }
+        DistributedSchedAdapter::GetInstance().DisconnectAbility(connectInfo.callbackWrapper);
+        ReportDistributedComponentChange(connectInfo, DISTRIBUTED_COMPONENT_REMOVE,
+            IDistributedSched::CONNECT, IDistributedSched::CALLEE);
+        HILOGI("ProcessDeviceOffline erase connection success");
     }
 }
 
@@ -2826,46 +2871,40 @@ void DistributedSchedService::ProcessConnectDied(const sptr<IRemoteObject>& conn
         return;
     }
 
+    std::list<ConnectAbilitySession> connectSessionsList;
+    if (!distributedConnectAbilityMap_.Find(connect, connectSessionsList) || connectSessionsList.empty()) {
+        return;
+    }
+    CallerInfo callerInfo = connectSessionsList.front().GetCallerInfo();
+    // to reduce the number of communications between devices, clean all the died process's connections
+    auto removed = distributedConnectAbilityMap_.EraseIf([&callerInfo](const sptr<IRemoteObject>& iterConnect,
+        const std::list<ConnectAbilitySession>& sessionsList) {
+        return !sessionsList.empty() && sessionsList.front().IsSameCaller(callerInfo);
+    });
     std::list<ProcessDiedNotifyInfo> notifyList;
-    {
-        std::lock_guard<std::mutex> autoLock(distributedLock_);
-        auto it = distributedConnectAbilityMap_.find(connect);
-        if (it == distributedConnectAbilityMap_.end()) {
-            return;
+    std::set<std::string> processedDeviceSet;
+    for (const auto& [iterConnect, sessionsList] : removed) {
+        for (const auto& session : sessionsList) {
+            std::string remoteDeviceId = session.GetDestinationDeviceId();
+            TargetComponent targetComponent = session.GetTargetComponent();
+            // the same session can connect different types component on the same device
+            std::string key = remoteDeviceId + std::to_string(static_cast<int32_t>(targetComponent));
+            // just notify one time for same remote device
+            auto [_, isSuccess] = processedDeviceSet.emplace(key);
+            if (isSuccess) {
+                ProcessDiedNotifyInfo notifyInfo = { remoteDeviceId, callerInfo, targetComponent };
+                notifyList.push_back(notifyInfo);
+            }
         }
-        std::list<ConnectAbilitySession>& connectSessionsList = it->second;
-        if (connectSessionsList.empty()) {
-            return;
+        {
+            std::lock_guard<std::mutex> autoLock(distributedLock_);
+            DecreaseConnectLocked(callerInfo.uid);
         }
-        CallerInfo callerInfo = connectSessionsList.front().GetCallerInfo();
-        std::set<std::string> processedDeviceSet;
-        // to reduce the number of communications between devices, clean all the died process's connections
-        for (auto iter = distributedConnectAbilityMap_.begin(); iter != distributedConnectAbilityMap_.end();) {
-            std::list<ConnectAbilitySession>& sessionsList = iter->second;
-            if (!sessionsList.empty() && sessionsList.front().IsSameCaller(callerInfo)) {
-                for (const auto& session : sessionsList) {
-                    std::string remoteDeviceId = session.GetDestinationDeviceId();
-                    TargetComponent targetComponent = session.GetTargetComponent();
-                    // the same session can connect different types component on the same device
-                    std::string key = remoteDeviceId + std::to_string(static_cast<int32_t>(targetComponent));
-                    // just notify one time for same remote device
-                    auto [_, isSuccess] = processedDeviceSet.emplace(key);
-                    if (isSuccess) {
-                        ProcessDiedNotifyInfo notifyInfo = { remoteDeviceId, callerInfo, targetComponent };
-                        notifyList.push_back(notifyInfo);
-                    }
-                }
-                DecreaseConnectLocked(callerInfo.uid);
-                if (iter->first != nullptr) {
-                    iter->first->RemoveDeathRecipient(connectDeathRecipient_);
-                }
-                ReportDistributedComponentChange(callerInfo, DISTRIBUTED_COMPONENT_REMOVE,
-                    IDistributedSched::CONNECT, IDistributedSched::CALLER);
-                iter = distributedConnectAbilityMap_.erase(iter);
-            } else {
-                iter++;
-            }
+        if (iterConnect != nullptr) {
+            iterConnect->RemoveDeathRecipient(connectDeathRecipient_);
         }
+        ReportDistributedComponentChange(callerInfo, DISTRIBUTED_COMPONENT_REMOVE,
+            IDistributedSched::CONNECT, IDistributedSched::CALLER);
     }
     NotifyProcessDiedAll(notifyList);
 }
@@ -2913,7 +2952,7 @@ void ConnectAbilitySession::AddElement(const AppExecFwk::ElementName& element)
     elementsList_.emplace_back(element);
 }
 
-bool ConnectAbilitySession::IsSameCaller(const CallerInfo& callerInfo)
+bool ConnectAbilitySession::IsSameCaller(const CallerInfo& callerInfo) const
 {
     return (callerInfo.uid == callerInfo_.uid &&
             callerInfo.pid == callerInfo_.pid &&
@@ -2923,14 +2962,14 @@ bool ConnectAbilitySession::IsSameCaller(const CallerInfo& callerInfo)
 
 void DistributedSchedService::DumpConnectInfo(std::string& info)
 {
-    std::lock_guard<std::mutex> autoLock(distributedLock_);
     info += "connected remote abilities:\n";
-    if (!distributedConnectAbilityMap_.empty()) {
-        for (const auto& distributedConnect : distributedConnectAbilityMap_) {
-            const std::list<ConnectAbilitySession> sessionsList = distributedConnect.second;
-            DumpSessionsLocked(sessionsList, info);
-        }
-    } else {
+    bool isEmpty = true;
+    distributedConnectAbilityMap_.ForEach([this, &info, &isEmpty](const sptr<IRemoteObject>& connect,
+        const std::list<ConnectAbilitySession>& sessionsList) {
+        isEmpty = false;
+        DumpSessionsLocked(sessionsList, info);
+    });
+    if (isEmpty) {
         info += "  <none info>\n";
     }
 }
@@ -3175,6 +3214,31 @@ int32_t DistributedSchedService::GetDSchedEventInfo(const DSchedEventType &type,
     return ERR_OK;
 }
 
+int32_t DistributedSchedService::QueryDSchedEventInfo(const DSchedEventQuery &query, std::vector<EventNotify> &events,
+    uint64_t &nextCursor)
+{
+    DSchedEventQuery callerQuery = query;
+    if (!CheckCallingUid()) {
+        // an app only sees the events of its own bundle
+        int32_t callingUid = IPCSkeleton::GetCallingUid();
+        std::string callingBundleName;
+        if (!BundleManagerInternal::GetSpecifyBundleNameFromBms(callingUid, callingBundleName)) {
+            HILOGE("Get specify bundle name for from Bms fail, uid %{public}d.", callingUid);
+            return INVALID_PARAMETERS_ERR;
+        }
+        if (!callerQuery.bundleName_.empty() && callerQuery.bundleName_ != callingBundleName) {
+            HILOGE("uid %{public}d can not query the events of %{public}s.", callingUid,
+                callerQuery.bundleName_.c_str());
+            return DMS_PERMISSION_DENIED;
+        }
+        callerQuery.bundleName_ = callingBundleName;
+    }
+    int32_t ret = eventHistory_.Query(callerQuery, events, nextCursor);
+    HILOGI("QueryDSchedEventInfo end, eventType %{public}d, cursor %{public}" PRIu64 ", events size %{public}zu, "
+        "next cursor %{public}" PRIu64 ".", query.type_, query.cursor_, events.size(), nextCursor);
+    return ret;
+}
+
 bool DistributedSchedService::CheckCallingUid()
 {
     // never allow non-system uid for distributed request
@@ -3223,9 +3287,8 @@ void DistributedSchedService::GetCollaborateEventInfo(int32_t callingUid, std::v
 void DistributedSchedService::GetCollaborateEventsByCallers(int32_t callingUid, const std::string &callingBundleName,
     std::vector<EventNotify> &events)
 {
-    std::lock_guard<std::mutex> autoLock(callerLock_);
-    for (const auto &iter : callerMap_) {
-        for (const auto &connectSession : iter.second) {
+    callerMap_.ForEach([&](const sptr<IRemoteObject>& connect, const std::list<ConnectAbilitySession>& sessionsList) {
+        for (const auto &connectSession : sessionsList) {
             auto bundleNames = connectSession.GetCallerInfo().bundleNames;
             if (callingUid != DEFAULT_REQUEST_CODE && callingUid != connectSession.GetCallerInfo().uid &&
                 std::count(bundleNames.begin(), bundleNames.end(), callingBundleName) == 0) {
@@ -3241,7 +3304,7 @@ void DistributedSchedService::GetCollaborateEventsByCallers(int32_t callingUid,
                 events.emplace_back(tempEvent);
             }
         }
-    }
+    });
 }
 
 void DistributedSchedService::GetCollaborateEventsByCallees(int32_t callingUid, const std::string &callingBundleName,
@@ -3664,14 +3727,11 @@ int32_t DistributedSchedService::NotifyStateChangedFromRemote(int32_t abilitySta
 {
     HILOGD("Get connectToken = %{private}s", GetAnonymStr(std::to_string(connectToken)).c_str());
     sptr<IRemoteObject> connect;
-    {
-        std::lock_guard<std::mutex> autoLock(callLock_);
-        for (auto iter = callMap_.begin(); iter != callMap_.end(); iter++) {
-            if (iter->second.connectToken == connectToken) {
-                connect = iter->first;
-                break;
-            }
-        }
+    DSchedConnectionRegistry<CallInfo>::Entry entry;
+    if (callMap_.FindIf([connectToken](const sptr<IRemoteObject>& iterConnect, const CallInfo& callInfo) {
+        return callInfo.connectToken == connectToken;
+    }, entry)) {
+        connect = entry.first;
         HILOGD("get connect success");
     }
     if (connect == nullptr) {
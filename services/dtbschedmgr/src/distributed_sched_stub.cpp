@@ -32,10 +32,12 @@
 #include "distributed_sched_service.h"
 #include "distributed_sched_types.h"
 #include "distributed_sched_utils.h"
+#include "dms_component_registry.h"
 #include "dms_constant.h"
 #include "dms_version_manager.h"
 #include "dsched_collab_manager.h"
 #include "dsched_continue_manager.h"
+#include "dsched_event_codec.h"
 #include "dsched_transport_softbus_adapter.h"
 #include "dtbschedmgr_log.h"
 #include "dtbschedmgr_device_info_storage.h"
@@ -73,6 +75,7 @@ const std::string DMS_UID_SPEC_BUNDLE_NAME = "dmsCallerUidBundleName";
 constexpr int32_t QOS_THRESHOLD_VERSION = 5;
 constexpr int32_t NEW_COLLAB_THRESHOLD_VERSION = 5;
 const int DEFAULT_REQUEST_CODE = -1;
+constexpr uint32_t DSCHED_EVENT_LISTENER_MAX_NUM = 16;
 }
 
 DistributedSchedStub::DistributedSchedStub()
@@ -94,12 +97,16 @@ void DistributedSchedStub::InitExtendedLocalFuncsInner()
 #ifdef SUPPORT_DISTRIBUTED_MISSION_MANAGER
     localFuncsMap_[static_cast<uint32_t>(IDSchedInterfaceCode::REGISTER_DSCHED_EVENT_LISTENER)] =
         &DistributedSchedStub::RegisterDSchedEventListenerInner;
+    localFuncsMap_[static_cast<uint32_t>(IDSchedInterfaceCode::REGISTER_DSCHED_EVENT_LISTENERS)] =
+        &DistributedSchedStub::RegisterDSchedEventListenersInner;
     localFuncsMap_[static_cast<uint32_t>(IDSchedInterfaceCode::UNREGISTER_DSCHED_EVENT_LISTENER)] =
         &DistributedSchedStub::UnRegisterDSchedEventListenerInner;
     localFuncsMap_[static_cast<uint32_t>(IDSchedInterfaceCode::GET_CONTINUE_INFO)] =
         &DistributedSchedStub::GetContinueInfoInner;
     localFuncsMap_[static_cast<uint32_t>(IDSchedInterfaceCode::GET_DSCHED_EVENT_INFO)] =
         &DistributedSchedStub::GetDSchedEventInfoInner;
+    localFuncsMap_[static_cast<uint32_t>(IDSchedInterfaceCode::QUERY_DSCHED_EVENT_INFO)] =
+        &DistributedSchedStub::QueryDSchedEventInfoInner;
 #endif
 }
 
@@ -603,6 +610,7 @@ int32_t DistributedSchedStub::ContinueMissionInner(MessageParcel& data, MessageP
         if ((!isFreeInstall && IsUsingQos(remoteDeviceId)) ||
             (isFreeInstall && IsRemoteInstall(remoteDeviceId, sourceBundleName))) {
             DSchedTransportSoftbusAdapter::GetInstance().SetCallingTokenId(IPCSkeleton::GetCallingTokenID());
+            DmsComponentRegistry::GetInstance().Ensure(DMS_COMPONENT_CONTINUE, DMS_TRIGGER_CONTINUE_MISSION);
             result = DSchedContinueManager::GetInstance().ContinueMission(srcDevId, dstDevId, missionId, callback,
                 *wantParams);
             HILOGI("result = %{public}d", result);
@@ -667,6 +675,7 @@ int32_t DistributedSchedStub::ContinueMissionOfBundleNameInner(MessageParcel& da
         if ((!isFreeInstall && IsUsingQos(remoteDeviceId)) ||
             (isFreeInstall && IsRemoteInstall(remoteDeviceId, bundleName))) {
             DSchedTransportSoftbusAdapter::GetInstance().SetCallingTokenId(IPCSkeleton::GetCallingTokenID());
+            DmsComponentRegistry::GetInstance().Ensure(DMS_COMPONENT_CONTINUE, DMS_TRIGGER_CONTINUE_MISSION);
             result = DSchedContinueManager::GetInstance().ContinueMission(
                 DSchedContinueInfo(srcDevId, srcBundleName, dstDevId, bundleName, continueType),
                 callback, *wantParams);
@@ -711,6 +720,7 @@ int32_t DistributedSchedStub::GetSinkCollabVersionInner(MessageParcel& data, Mes
     dSchedCollabInfo.srcInfo_.accessToken_ = static_cast<int32_t>(callerAccessToken);
  
     DSchedTransportSoftbusAdapter::GetInstance().SetCallingTokenId(callerAccessToken);
+    DmsComponentRegistry::GetInstance().Ensure(DMS_COMPONENT_COLLAB, DMS_TRIGGER_COLLAB_MISSION);
     int32_t result = DSchedCollabManager::GetInstance().GetSinkCollabVersion(dSchedCollabInfo);
     HILOGI("result = %{public}d", result);
     PARCEL_WRITE_REPLY_NOERROR(reply, Int32, result);
@@ -760,6 +770,7 @@ int32_t DistributedSchedStub::CollabMissionInner(MessageParcel& data, MessagePar
     dSchedCollabInfo.collabToken_ = collabToken;
  
     DSchedTransportSoftbusAdapter::GetInstance().SetCallingTokenId(callerAccessToken);
+    DmsComponentRegistry::GetInstance().Ensure(DMS_COMPONENT_COLLAB, DMS_TRIGGER_COLLAB_MISSION);
     int32_t result = DSchedCollabManager::GetInstance().CollabMission(dSchedCollabInfo);
     HILOGI("result = %{public}d", result);
     PARCEL_WRITE_REPLY_NOERROR(reply, Int32, result);
@@ -916,7 +927,8 @@ int32_t DistributedSchedStub::NotifyCompleteContinuationInner(MessageParcel& dat
     bool continuationResult = false;
     PARCEL_READ_HELPER(data, Bool, continuationResult);
     std::string callerBundleName = data.ReadString();
-    auto dContinue = DSchedContinueManager::GetInstance().GetDSchedContinueByDevId(devId, sessionId);
+    auto dContinue = DSchedContinueManager::GetInstance().GetDSchedContinueByDevId(devId, sessionId,
+        callerBundleName);
     if (dContinue != nullptr) {
         DSchedContinueManager::GetInstance().NotifyCompleteContinuation(devId, sessionId, continuationResult,
             callerBundleName);
@@ -1187,7 +1199,7 @@ int32_t DistributedSchedStub::GetRemoteMissionSnapshotInfoInner(MessageParcel& d
         return ERR_NULL_OBJECT;
     }
     PARCEL_WRITE_HELPER(reply, Parcelable, missionSnapshotPtr.get());
-    std::string uuid = DnetworkAdapter::GetInstance()->GetUuidByNetworkId(networkId);
+    std::string uuid = DtbschedmgrDeviceInfoStorage::GetInstance().GetUuidByNetworkId(networkId);
     if (uuid.empty()) {
         HILOGE("uuid is empty!");
         return ERR_NULL_OBJECT;
@@ -1241,6 +1253,40 @@ int32_t DistributedSchedStub::RegisterDSchedEventListenerInner(MessageParcel& da
     PARCEL_WRITE_REPLY_NOERROR(reply, Int32, result);
 }
 
+int32_t DistributedSchedStub::RegisterDSchedEventListenersInner(MessageParcel& data, MessageParcel& reply)
+{
+    HILOGI("[PerformanceTest] called, IPC end = %{public}" PRId64, GetTickCount());
+    if (!CheckCallingUid()) {
+        HILOGW("request DENIED!");
+        return DMS_PERMISSION_DENIED;
+    }
+    uint32_t size = 0;
+    PARCEL_READ_HELPER(data, Uint32, size);
+    if (size == 0 || size > DSCHED_EVENT_LISTENER_MAX_NUM) {
+        HILOGE("invalid listeners size: %{public}u", size);
+        return INVALID_PARAMETERS_ERR;
+    }
+    std::vector<std::pair<DSchedEventType, sptr<IRemoteObject>>> listeners;
+    for (uint32_t i = 0; i < size; i++) {
+        DSchedEventType type = static_cast<DSchedEventType>(data.ReadUint8());
+        sptr<IRemoteObject> dSchedEventListener = data.ReadRemoteObject();
+        if (dSchedEventListener == nullptr) {
+            HILOGW("read IRemoteObject failed!");
+            return ERR_FLATTEN_OBJECT;
+        }
+        listeners.emplace_back(type, dSchedEventListener);
+    }
+    // every listener is registered, the first failure is replied
+    int32_t result = ERR_OK;
+    for (const auto& listener : listeners) {
+        int32_t ret = RegisterDSchedEventListener(listener.first, listener.second);
+        if (ret != ERR_OK && result == ERR_OK) {
+            result = ret;
+        }
+    }
+    PARCEL_WRITE_REPLY_NOERROR(reply, Int32, result);
+}
+
 int32_t DistributedSchedStub::UnRegisterDSchedEventListenerInner(MessageParcel& data, MessageParcel& reply)
 {
     HILOGI("[PerformanceTest] called, IPC end = %{public}" PRId64, GetTickCount());
@@ -1304,6 +1350,34 @@ int32_t DistributedSchedStub::GetDSchedEventInfoInner(MessageParcel& data, Messa
     return result;
 }
 
+int32_t DistributedSchedStub::QueryDSchedEventInfoInner(MessageParcel& data, MessageParcel& reply)
+{
+    HILOGI("[PerformanceTest] called, IPC end = %{public}" PRId64, GetTickCount());
+    DSchedEventQuery query;
+    query.type_ = static_cast<DSchedEventType>(data.ReadInt32());
+    PARCEL_READ_HELPER(data, String, query.bundleName_);
+    PARCEL_READ_HELPER(data, String, query.networkId_);
+    PARCEL_READ_HELPER(data, Int64, query.beginTime_);
+    PARCEL_READ_HELPER(data, Int64, query.endTime_);
+    PARCEL_READ_HELPER(data, Uint64, query.cursor_);
+    PARCEL_READ_HELPER(data, Uint32, query.pageSize_);
+    std::vector<EventNotify> eventInfos;
+    uint64_t nextCursor = 0;
+    int32_t result = QueryDSchedEventInfo(query, eventInfos, nextCursor);
+    PARCEL_WRITE_HELPER(reply, Int32, result);
+    if (result != ERR_OK) {
+        return ERR_OK;
+    }
+    std::vector<uint8_t> buffer;
+    if (DSchedEventCodec::Encode(eventInfos, buffer) != ERR_OK) {
+        HILOGE("Encode Dms event page failed!");
+        return DMS_WRITE_FILE_FAILED_ERR;
+    }
+    PARCEL_WRITE_HELPER(reply, Uint64, nextCursor);
+    PARCEL_WRITE_HELPER(reply, UInt8Vector, buffer);
+    return ERR_OK;
+}
+
 int32_t DistributedSchedStub::RegisterOnListenerInner(MessageParcel& data, MessageParcel& reply)
 {
     if (!DistributedSchedPermission::GetInstance().IsFoundationCall()) {
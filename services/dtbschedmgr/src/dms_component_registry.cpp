@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_component_registry.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "dtbschedmgr_log.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DmsComponentRegistry";
+const std::string TRIGGER_DEPENDENCY_PREFIX = "dependency of ";
+}
+
+DmsComponentRegistry& DmsComponentRegistry::GetInstance()
+{
+    static auto instance = new DmsComponentRegistry();
+    return *instance;
+}
+
+int64_t DmsComponentRegistry::GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int32_t DmsComponentRegistry::Register(const std::string& name, const std::vector<std::string>& deps,
+    InitFunc init, UnInitFunc unInit)
+{
+    if (name.empty()) {
+        HILOGE("component name is empty.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    std::lock_guard<std::recursive_mutex> lock(componentMutex_);
+    if (components_.find(name) != components_.end()) {
+        HILOGW("component %{public}s already registered.", name.c_str());
+        return INVALID_PARAMETERS_ERR;
+    }
+    Component component;
+    component.info.name = name;
+    component.info.deps = deps;
+    component.init = std::move(init);
+    component.unInit = std::move(unInit);
+    components_.emplace(name, std::move(component));
+    return ERR_OK;
+}
+
+bool DmsComponentRegistry::Ensure(const std::string& name, const std::string& trigger)
+{
+    std::lock_guard<std::recursive_mutex> lock(componentMutex_);
+    auto iter = components_.find(name);
+    if (iter == components_.end()) {
+        HILOGE("component %{public}s not registered.", name.c_str());
+        return false;
+    }
+    Component& component = iter->second;
+    if (component.info.state == DmsComponentState::STARTED) {
+        return true;
+    }
+    if (component.info.state == DmsComponentState::STARTING) {
+        HILOGE("component %{public}s depends on itself.", name.c_str());
+        return false;
+    }
+    component.info.state = DmsComponentState::STARTING;
+    for (const auto& dep : component.info.deps) {
+        if (!Ensure(dep, TRIGGER_DEPENDENCY_PREFIX + name)) {
+            HILOGE("start dependency %{public}s of component %{public}s failed.", dep.c_str(), name.c_str());
+            component.info.state = DmsComponentState::FAILED;
+            return false;
+        }
+    }
+    int64_t beginUs = GetNowUs();
+    bool ret = component.init == nullptr || component.init();
+    component.info.startCostUs = std::max<int64_t>(GetNowUs() - beginUs, 0);
+    component.info.trigger = trigger;
+    if (!ret) {
+        HILOGW("component %{public}s not started, trigger %{public}s.", name.c_str(), trigger.c_str());
+        component.info.state = DmsComponentState::FAILED;
+        return false;
+    }
+    component.info.state = DmsComponentState::STARTED;
+    component.info.startCount++;
+    startOrder_.emplace_back(name);
+    HILOGI("component %{public}s started, trigger %{public}s, cost %{public}" PRId64 " us.", name.c_str(),
+        trigger.c_str(), component.info.startCostUs);
+    return true;
+}
+
+void DmsComponentRegistry::Stop(const std::string& name)
+{
+    std::lock_guard<std::recursive_mutex> lock(componentMutex_);
+    auto iter = components_.find(name);
+    if (iter == components_.end()) {
+        HILOGE("component %{public}s not registered.", name.c_str());
+        return;
+    }
+    if (iter->second.info.state != DmsComponentState::STARTED) {
+        iter->second.info.state = DmsComponentState::REGISTERED;
+        return;
+    }
+    for (auto& [otherName, other] : components_) {
+        const auto& deps = other.info.deps;
+        if (other.info.state == DmsComponentState::STARTED &&
+            std::find(deps.begin(), deps.end(), name) != deps.end()) {
+            Stop(otherName);
+        }
+    }
+    if (iter->second.unInit != nullptr) {
+        iter->second.unInit();
+    }
+    iter->second.info.state = DmsComponentState::REGISTERED;
+    startOrder_.erase(std::remove(startOrder_.begin(), startOrder_.end(), name), startOrder_.end());
+    HILOGI("component %{public}s stopped.", name.c_str());
+}
+
+bool DmsComponentRegistry::IsStarted(const std::string& name) const
+{
+    std::lock_guard<std::recursive_mutex> lock(componentMutex_);
+    auto iter = components_.find(name);
+    return iter != components_.end() && iter->second.info.state == DmsComponentState::STARTED;
+}
+
+std::vector<std::string> DmsComponentRegistry::GetStartedComponents() const
+{
+    std::lock_guard<std::recursive_mutex> lock(componentMutex_);
+    return startOrder_;
+}
+
+bool DmsComponentRegistry::GetComponentInfo(const std::string& name, DmsComponentInfo& info) const
+{
+    std::lock_guard<std::recursive_mutex> lock(componentMutex_);
+    auto iter = components_.find(name);
+    if (iter == components_.end()) {
+        return false;
+    }
+    info = iter->second.info;
+    return true;
+}
+
+void DmsComponentRegistry::Dump(std::string& result) const
+{
+    std::lock_guard<std::recursive_mutex> lock(componentMutex_);
+    result.append("dms components:\n");
+    for (const auto& [name, component] : components_) {
+        const DmsComponentInfo& info = component.info;
+        result.append("  ").append(name).append(": ").append(GetStateName(info.state));
+        if (!info.trigger.empty()) {
+            result.append(", trigger ").append(info.trigger)
+                .append(", cost ").append(std::to_string(info.startCostUs)).append(" us")
+                .append(", starts ").append(std::to_string(info.startCount));
+        }
+        if (!info.deps.empty()) {
+            result.append(", deps");
+            for (const auto& dep : info.deps) {
+                result.append(" ").append(dep);
+            }
+        }
+        result.append("\n");
+    }
+    result.append("start order:");
+    for (const auto& name : startOrder_) {
+        result.append(" ").append(name);
+    }
+    result.append("\n");
+}
+
+void DmsComponentRegistry::Reset()
+{
+    std::lock_guard<std::recursive_mutex> lock(componentMutex_);
+    components_.clear();
+    startOrder_.clear();
+}
+
+const char* DmsComponentRegistry::GetStateName(DmsComponentState state)
+{
+    switch (state) {
+        case DmsComponentState::REGISTERED:
+            return "not started";
+        case DmsComponentState::STARTING:
+            return "starting";
+        case DmsComponentState::STARTED:
+            return "started";
+        case DmsComponentState::FAILED:
+            return "failed";
+        default:
+            return "unknown";
+    }
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_event_codec.h"
+
+#include <array>
+#include <iterator>
+#include <unordered_map>
+
+#include "dtbschedmgr_log.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DSchedEventCodec";
+constexpr uint32_t VARINT_SHIFT = 7;
+constexpr uint8_t VARINT_PAYLOAD_MASK = 0x7f;
+constexpr uint8_t VARINT_MORE_FLAG = 0x80;
+constexpr uint32_t VARINT_MAX_BYTES = 10;
+constexpr uint32_t INT64_SIGN_SHIFT = 63;
+constexpr size_t EVENT_STRING_FIELD_NUM = 9;
+// result, string indexes, type, state and time take one byte at least
+constexpr size_t EVENT_MIN_ENCODED_SIZE = EVENT_STRING_FIELD_NUM + 4;
+const std::array<std::string EventNotify::*, EVENT_STRING_FIELD_NUM> EVENT_STRING_FIELDS = {
+    &EventNotify::srcNetworkId_,
+    &EventNotify::dstNetworkId_,
+    &EventNotify::srcBundleName_,
+    &EventNotify::srcModuleName_,
+    &EventNotify::srcAbilityName_,
+    &EventNotify::destBundleName_,
+    &EventNotify::destModuleName_,
+    &EventNotify::destAbilityName_,
+    &EventNotify::developerId_,
+};
+}
+
+int32_t DSchedEventCodec::Encode(const std::vector<EventNotify>& events, std::vector<uint8_t>& buffer)
+{
+    std::vector<const std::string*> strings;
+    std::unordered_map<std::string, uint64_t> stringIndexes;
+    std::vector<uint64_t> recordIndexes;
+    recordIndexes.reserve(events.size() * EVENT_STRING_FIELD_NUM);
+    for (const auto& event : events) {
+        for (auto field : EVENT_STRING_FIELDS) {
+            const std::string& value = event.*field;
+            auto result = stringIndexes.emplace(value, strings.size());
+            if (result.second) {
+                strings.emplace_back(&result.first->first);
+            }
+            recordIndexes.emplace_back(result.first->second);
+        }
+    }
+
+    buffer.clear();
+    buffer.emplace_back(CODEC_VERSION);
+    WriteVarint(strings.size(), buffer);
+    for (const auto* value : strings) {
+        WriteVarint(value->size(), buffer);
+        buffer.insert(buffer.end(), value->begin(), value->end());
+    }
+    WriteVarint(events.size(), buffer);
+    size_t indexPos = 0;
+    for (const auto& event : events) {
+        WriteVarint(ZigZagEncode(event.eventResult_), buffer);
+        for (size_t i = 0; i < EVENT_STRING_FIELD_NUM; i++) {
+            WriteVarint(recordIndexes[indexPos++], buffer);
+        }
+        WriteVarint(ZigZagEncode(event.dSchedEventType_), buffer);
+        WriteVarint(static_cast<uint64_t>(event.state_), buffer);
+        WriteVarint(ZigZagEncode(event.eventTime_), buffer);
+    }
+    return ERR_OK;
+}
+
+int32_t DSchedEventCodec::Decode(const std::vector<uint8_t>& buffer, std::vector<EventNotify>& events)
+{
+    if (buffer.empty() || buffer[0] != CODEC_VERSION) {
+        HILOGE("unsupported event buffer, size %{public}zu.", buffer.size());
+        return INVALID_PARAMETERS_ERR;
+    }
+    size_t offset = 1;
+    uint64_t stringNum = 0;
+    // every string takes one length byte at least
+    if (!ReadVarint(buffer, offset, stringNum) || stringNum > buffer.size() - offset) {
+        HILOGE("invalid string num.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    std::vector<std::string> strings;
+    strings.reserve(stringNum);
+    for (uint64_t i = 0; i < stringNum; i++) {
+        uint64_t length = 0;
+        if (!ReadVarint(buffer, offset, length) || length > buffer.size() - offset) {
+            HILOGE("invalid string length.");
+            return INVALID_PARAMETERS_ERR;
+        }
+        strings.emplace_back(buffer.begin() + offset, buffer.begin() + offset + length);
+        offset += length;
+    }
+
+    uint64_t eventNum = 0;
+    if (!ReadVarint(buffer, offset, eventNum) || eventNum > (buffer.size() - offset) / EVENT_MIN_ENCODED_SIZE) {
+        HILOGE("invalid event num.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    std::vector<EventNotify> decodedEvents(eventNum);
+    for (auto& event : decodedEvents) {
+        uint64_t value = 0;
+        if (!ReadVarint(buffer, offset, value)) {
+            return INVALID_PARAMETERS_ERR;
+        }
+        event.eventResult_ = static_cast<int32_t>(ZigZagDecode(value));
+        for (auto field : EVENT_STRING_FIELDS) {
+            if (!ReadVarint(buffer, offset, value) || value >= strings.size()) {
+                HILOGE("invalid string index.");
+                return INVALID_PARAMETERS_ERR;
+            }
+            event.*field = strings[value];
+        }
+        if (!ReadVarint(buffer, offset, value)) {
+            return INVALID_PARAMETERS_ERR;
+        }
+        int64_t type = ZigZagDecode(value);
+        if (!ReadVarint(buffer, offset, value) || type < DMS_UNKNOW || type > DMS_ALL ||
+            value > DMS_DSCHED_EVENT_FINISH) {
+            HILOGE("invalid event type or state.");
+            return INVALID_PARAMETERS_ERR;
+        }
+        event.dSchedEventType_ = static_cast<DSchedEventType>(type);
+        event.state_ = static_cast<DSchedEventState>(value);
+        if (!ReadVarint(buffer, offset, value)) {
+            return INVALID_PARAMETERS_ERR;
+        }
+        event.eventTime_ = ZigZagDecode(value);
+    }
+    events.insert(events.end(), std::make_move_iterator(decodedEvents.begin()),
+        std::make_move_iterator(decodedEvents.end()));
+    return ERR_OK;
+}
+
+void DSchedEventCodec::WriteVarint(uint64_t value, std::vector<uint8_t>& buffer)
+{
+    while (value > VARINT_PAYLOAD_MASK) {
+        buffer.emplace_back(static_cast<uint8_t>(value & VARINT_PAYLOAD_MASK) | VARINT_MORE_FLAG);
+        value >>= VARINT_SHIFT;
+    }
+    buffer.emplace_back(static_cast<uint8_t>(value));
+}
+
+bool DSchedEventCodec::ReadVarint(const std::vector<uint8_t>& buffer, size_t& offset, uint64_t& value)
+{
+    value = 0;
+    for (uint32_t i = 0; i < VARINT_MAX_BYTES && offset < buffer.size(); i++) {
+        uint8_t byte = buffer[offset++];
+        value |= static_cast<uint64_t>(byte & VARINT_PAYLOAD_MASK) << (VARINT_SHIFT * i);
+        if ((byte & VARINT_MORE_FLAG) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t DSchedEventCodec::ZigZagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> INT64_SIGN_SHIFT);
+}
+
+int64_t DSchedEventCodec::ZigZagDecode(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_event_history.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "dtbschedmgr_log.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DSchedEventHistory";
+}
+
+DSchedEventHistory::DSchedEventHistory(size_t capacity) : capacity_(std::max<size_t>(capacity, 1))
+{
+}
+
+void DSchedEventHistory::Record(const EventNotify& event)
+{
+    EventNotify record = event;
+    record.eventTime_ = GetNowMs();
+    std::lock_guard<std::mutex> lock(historyMutex_);
+    if (records_.size() < capacity_) {
+        records_.emplace_back(std::move(record));
+    } else {
+        records_[head_] = std::move(record);
+        head_ = (head_ + 1) % capacity_;
+    }
+    nextSeq_++;
+}
+
+int32_t DSchedEventHistory::Query(const DSchedEventQuery& query, std::vector<EventNotify>& events,
+    uint64_t& nextCursor) const
+{
+    nextCursor = 0;
+    if (query.type_ != DMS_CONTINUE && query.type_ != DMS_COLLABORATION && query.type_ != DMS_ALL) {
+        HILOGE("not support event type %{public}d.", query.type_);
+        return INVALID_PARAMETERS_ERR;
+    }
+    uint32_t pageSize = query.pageSize_ == 0 ? DEFAULT_PAGE_SIZE : std::min(query.pageSize_, MAX_PAGE_SIZE);
+    std::lock_guard<std::mutex> lock(historyMutex_);
+    uint64_t lastSeq = nextSeq_ - 1;
+    if (records_.empty() || query.cursor_ >= lastSeq) {
+        return ERR_OK;
+    }
+    uint64_t oldestSeq = nextSeq_ - records_.size();
+    uint32_t found = 0;
+    for (uint64_t seq = std::max(query.cursor_ + 1, oldestSeq); seq <= lastSeq; seq++) {
+        const EventNotify& event = records_[(head_ + (seq - oldestSeq)) % capacity_];
+        if (!IsMatch(query, event)) {
+            continue;
+        }
+        if (found == pageSize) {
+            // one more match is left, the events skipped before it did not match
+            nextCursor = seq - 1;
+            break;
+        }
+        events.emplace_back(event);
+        found++;
+    }
+    return ERR_OK;
+}
+
+size_t DSchedEventHistory::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(historyMutex_);
+    return records_.size();
+}
+
+void DSchedEventHistory::Clear()
+{
+    std::lock_guard<std::mutex> lock(historyMutex_);
+    records_.clear();
+    head_ = 0;
+}
+
+bool DSchedEventHistory::IsMatch(const DSchedEventQuery& query, const EventNotify& event)
+{
+    if (query.type_ != DMS_ALL && query.type_ != event.dSchedEventType_) {
+        return false;
+    }
+    if (!query.bundleName_.empty() && query.bundleName_ != event.srcBundleName_ &&
+        query.bundleName_ != event.destBundleName_) {
+        return false;
+    }
+    if (!query.networkId_.empty() && query.networkId_ != event.srcNetworkId_ &&
+        query.networkId_ != event.dstNetworkId_) {
+        return false;
+    }
+    if (query.beginTime_ != 0 && event.eventTime_ < query.beginTime_) {
+        return false;
+    }
+    if (query.endTime_ != 0 && event.eventTime_ > query.endTime_) {
+        return false;
+    }
+    return true;
+}
+
+int64_t DSchedEventHistory::GetNowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -155,23 +155,16 @@ void DtbschedmgrDeviceInfoStorage::RegisterUuidNetworkIdMap(const std::string& n
         HILOGE("GetUuidByNetworkId return an empty uuid!");
         return;
     }
-    {
-        std::lock_guard<std::mutex> autoLock(uuidNetworkIdLock_);
-        uuidNetworkIdMap_[uuid] = networkId;
+    std::string udid = DnetworkAdapter::GetInstance()->GetUdidByNetworkId(networkId);
+    if (udid.empty()) {
+        HILOGW("GetUdidByNetworkId return an empty udid, networkId: %{public}s", GetAnonymStr(networkId).c_str());
     }
+    identityTable_.Update({ networkId, uuid, udid });
 }
 
 void DtbschedmgrDeviceInfoStorage::UnregisterUuidNetworkIdMap(const std::string& networkId)
 {
-    std::string uuid = DnetworkAdapter::GetInstance()->GetUuidByNetworkId(networkId);
-    if (uuid.empty()) {
-        HILOGE("GetUuidByNetworkId return an empty uuid");
-        return;
-    }
-    {
-        std::lock_guard<std::mutex> autoLock(uuidNetworkIdLock_);
-        uuidNetworkIdMap_.erase(uuid);
-    }
+    identityTable_.RemoveByNetworkId(networkId);
 }
 
 void DtbschedmgrDeviceInfoStorage::GetDeviceIdSet(std::set<std::string>& deviceIdSet)
@@ -323,18 +316,11 @@ std::string DtbschedmgrDeviceInfoStorage::GetUuidByNetworkId(const std::string&
         HILOGW("GetUuidByNetworkId networkId empty!");
         return "";
     }
-    {
-        std::lock_guard<std::mutex> autoLock(uuidNetworkIdLock_);
-        auto iter = uuidNetworkIdMap_.begin();
-        while (iter != uuidNetworkIdMap_.end()) {
-            if (iter->second == networkId) {
-                return iter->first;
-            } else {
-                ++iter;
-            }
-        }
+    std::string uuid;
+    if (identityTable_.GetUuidByNetworkId(networkId, uuid)) {
+        return uuid;
     }
-    std::string uuid = DnetworkAdapter::GetInstance()->GetUuidByNetworkId(networkId);
+    uuid = DnetworkAdapter::GetInstance()->GetUuidByNetworkId(networkId);
     return uuid;
 }
 
@@ -344,7 +330,11 @@ std::string DtbschedmgrDeviceInfoStorage::GetUdidByNetworkId(const std::string&
         HILOGW("GetUdidByNetworkId networkId empty!");
         return "";
     }
-    std::string udid = DnetworkAdapter::GetInstance()->GetUdidByNetworkId(networkId);
+    std::string udid;
+    if (identityTable_.GetUdidByNetworkId(networkId, udid)) {
+        return udid;
+    }
+    udid = DnetworkAdapter::GetInstance()->GetUdidByNetworkId(networkId);
     return udid;
 }
 
@@ -354,14 +344,9 @@ std::string DtbschedmgrDeviceInfoStorage::GetNetworkIdByUuid(const std::string&
         HILOGW("GetNetworkIdByUuid uuid empty!");
         return "";
     }
-    {
-        std::lock_guard<std::mutex> autoLock(uuidNetworkIdLock_);
-        auto iter = uuidNetworkIdMap_.find(uuid);
-        if (iter != uuidNetworkIdMap_.end()) {
-            return iter->second;
-        }
-        return "";
-    }
+    std::string networkId;
+    identityTable_.GetNetworkIdByUuid(uuid, networkId);
+    return networkId;
 }
 
 void DtbschedmgrDeviceInfoStorage::DeviceOnlineNotify(const std::shared_ptr<DmsDeviceInfo> devInfo)
@@ -422,6 +407,18 @@ void DtbschedmgrDeviceInfoStorage::DeviceOfflineNotify(const std::string& networ
 void DtbschedmgrDeviceInfoStorage::OnDeviceInfoChanged(const std::string& deviceId)
 {
     HILOGI("OnDeviceInfoChanged called");
+    if (networkIdMgrHandler_ != nullptr) {
+        auto refreshIdentity = [this, deviceId]() {
+            std::string uuid;
+            // only devices already online are tracked, the rest are added by DeviceOnlineNotify
+            if (identityTable_.GetUuidByNetworkId(deviceId, uuid)) {
+                RegisterUuidNetworkIdMap(deviceId);
+            }
+        };
+        if (!networkIdMgrHandler_->PostTask(refreshIdentity)) {
+            HILOGE("OnDeviceInfoChanged handler postTask failed");
+        }
+    }
     if (!MultiUserManager::GetInstance().CheckRegSoftbusListener() &&
         DistributedHardware::DeviceManager::GetInstance().IsSameAccount(deviceId)) {
         HILOGI("DMSContinueRecvMgr need init");
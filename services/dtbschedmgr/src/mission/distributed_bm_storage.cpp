@@ -23,6 +23,7 @@
 #include "dtbschedmgr_device_info_storage.h"
 #include "dtbschedmgr_log.h"
 #include "mission/distributed_sched_mission_manager.h"
+#include "mission/dms_kv_store_manager.h"
 #include "mission/dsched_sync_e2e.h"
 
 using namespace OHOS::DistributedKv;
@@ -33,9 +34,8 @@ namespace {
 const std::string TAG = "DmsBmDataStorage";
 const std::string BMS_KV_BASE_DIR = "/data/service/el1/public/database/DistributedSchedule";
 const std::string PUBLIC_RECORDS = "publicRecords";
+const std::string PUBLISH_LOCAL_DATA_TASK = "PublishLocalData";
 const int32_t EL1 = 1;
-const int32_t MAX_TIMES = 600;              // 1min
-const int32_t SLEEP_INTERVAL = 100 * 1000;  // 100ms
 const int32_t FLAGS = AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES |
                       AppExecFwk::ApplicationFlag::GET_APPLICATION_INFO_WITH_DISABLE |
                       AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_DISABLE;
@@ -47,13 +47,24 @@ std::mutex DmsBmStorage::mutex_;
 DmsBmStorage::DmsBmStorage()
 {
     HILOGD("called.");
-    TryTwice([this] { return GetKvStore(); });
+    auto runner = AppExecFwk::EventRunner::Create("DmsBmStoragePublish");
+    publishHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    // the store outlives this instance, its opener does not refer to it
+    DmsKvStoreManager::GetInstance().RegisterStore(storeId_.storeId, GetKvStore);
+    // the store is still opening at sa start, local bundle infos are published once it is ready
+    storeListenerId_ = DmsKvStoreManager::GetInstance().AddStoreListener(storeId_.storeId,
+        [this](const std::shared_ptr<SingleKvStore> &kvStore) { OnKvStoreChanged(kvStore); });
     HILOGD("end.");
 }
 
 DmsBmStorage::~DmsBmStorage()
 {
     HILOGD("called.");
+    DmsKvStoreManager::GetInstance().RemoveStoreListener(storeListenerId_);
+    if (publishHandler_ != nullptr) {
+        publishHandler_->RemoveAllEvents();
+        publishHandler_ = nullptr;
+    }
     dataManager_.CloseKvStore(appId_, storeId_);
     HILOGD("end.");
 }
@@ -616,25 +627,44 @@ std::string DmsBmStorage::DeviceAndNameToKey(const std::string &udid, const std:
 bool DmsBmStorage::CheckKvStore()
 {
     HILOGD("called.");
+    std::shared_ptr<SingleKvStore> kvStore;
+    if (DmsKvStoreManager::GetInstance().GetKvStore(storeId_.storeId, kvStore) != ERR_OK) {
+        return false;
+    }
     std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-    if (kvStorePtr_ != nullptr) {
-        return true;
+    if (kvStorePtr_ != kvStore) {
+        kvStorePtr_ = kvStore;
     }
-    int32_t tryTimes = MAX_TIMES;
-    while (tryTimes > 0) {
-        Status status = GetKvStore();
-        if (status == Status::SUCCESS && kvStorePtr_ != nullptr) {
-            return true;
-        }
-        HILOGW("CheckKvStore, Times: %{public}d", tryTimes);
-        usleep(SLEEP_INTERVAL);
-        tryTimes--;
+    return true;
+}
+
+void DmsBmStorage::OnKvStoreChanged(const std::shared_ptr<SingleKvStore> &kvStore)
+{
+    if (kvStore == nullptr) {
+        HILOGW("kvDataService removed, wait for the store to be opened again.");
+        return;
+    }
+    // the publish queries bms for every bundle, keep it off the kv store manager's thread
+    if (publishHandler_ == nullptr) {
+        HILOGE("publishHandler is null.");
+        return;
+    }
+    publishHandler_->RemoveTask(PUBLISH_LOCAL_DATA_TASK);
+    if (!publishHandler_->PostTask([this]() { PublishLocalData(); }, PUBLISH_LOCAL_DATA_TASK)) {
+        HILOGE("post publish local data task failed.");
     }
-    HILOGD("end.");
-    return kvStorePtr_ != nullptr;
 }
 
-Status DmsBmStorage::GetKvStore()
+void DmsBmStorage::PublishLocalData()
+{
+    HILOGI("kvStore ready, publish local bundle infos.");
+    UpdateDistributedData();
+    if (DmsKvSyncE2E::GetInstance()->CheckDeviceCfg()) {
+        DmsKvSyncE2E::GetInstance()->PushAndPullData();
+    }
+}
+
+Status DmsBmStorage::GetKvStore(std::shared_ptr<SingleKvStore>& kvStore)
 {
     HILOGI("called.");
     Options options = {
@@ -652,28 +682,20 @@ Status DmsBmStorage::GetKvStore()
             .autoSync = true
         },
     };
-    Status status = dataManager_.GetSingleKvStore(options, appId_, storeId_, kvStorePtr_);
+    const AppId appId {DMS_BM_APP_ID};
+    const StoreId storeId {DISTRIBUTE_BM_STORE_ID};
+    DistributedKvDataManager dataManager;
+    Status status = dataManager.GetSingleKvStore(options, appId, storeId, kvStore);
     if (status == Status::SUCCESS) {
         HILOGI("get kvStore success");
     } else if (status == DistributedKv::Status::STORE_META_CHANGED) {
         HILOGE("This db meta changed, remove and rebuild it");
-        dataManager_.DeleteKvStore(appId_, storeId_, BMS_KV_BASE_DIR + appId_.appId);
+        dataManager.DeleteKvStore(appId, storeId, BMS_KV_BASE_DIR + appId.appId);
     }
     HILOGI("end.");
     return status;
 }
 
-void DmsBmStorage::TryTwice(const std::function<Status()> &func) const
-{
-    HILOGD("called.");
-    Status status = func();
-    if (status == Status::IPC_ERROR) {
-        status = func();
-        HILOGW("distribute database ipc error and try to call again, result = %{public}d", status);
-    }
-    HILOGD("end.");
-}
-
 bool DmsBmStorage::GetLastBundleNameId(uint16_t &bundleNameId)
 {
     HILOGI("call.");
@@ -15,7 +15,6 @@
 
 #include "mission/distributed_data_storage.h"
 
-#include <thread>
 #include <unistd.h>
 
 #include "datetime_ex.h"
@@ -28,6 +27,7 @@
 #include "dtbschedmgr_device_info_storage.h"
 #include "dtbschedmgr_log.h"
 #include "mission/distributed_sched_mission_manager.h"
+#include "mission/dms_kv_store_manager.h"
 
 using namespace std;
 using namespace OHOS::DistributedKv;
@@ -39,8 +39,6 @@ const string TAG = "DistributedDataStorage";
 const string APP_ID = "DistributedSchedule";
 const string STORE_ID = "SnapshotInfoDataStorage";
 const string KVDB_PATH = "/data/service/el1/public/database/DistributedSchedule";
-constexpr int32_t RETRY_TIMES_WAIT_KV_DATA = 30;
-constexpr int32_t RETRY_TIMES_GET_KVSTORE = 5;
 }
 
 DistributedDataStorage::DistributedDataStorage()
@@ -59,87 +57,59 @@ bool DistributedDataStorage::Init()
         shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create("dmsDataStorageHandler");
         dmsDataStorageHandler_ = make_shared<AppExecFwk::EventHandler>(runner);
     }
-    int32_t ret = InitKvDataService();
-    if (!ret) {
-        HILOGE("InitKvDataService failed!");
+    if (storeListenerId_ != 0) {
+        HILOGD("already listening to the kvStore.");
+        return true;
+    }
+    // the store is opened in the background once the kv data service is up
+    DmsKvStoreManager::GetInstance().RegisterStore(STORE_ID, GetKvStore);
+    storeListenerId_ = DmsKvStoreManager::GetInstance().AddStoreListener(STORE_ID,
+        [this](const shared_ptr<SingleKvStore>& kvStore) { OnKvStoreChanged(kvStore); });
+    if (storeListenerId_ == 0) {
+        HILOGE("add kvStore listener failed!");
         return false;
     }
     return true;
 }
 
-bool DistributedDataStorage::InitKvDataService()
+void DistributedDataStorage::OnKvStoreChanged(const shared_ptr<SingleKvStore>& kvStore)
 {
-    auto waitTask = [this]() {
-        if (!WaitKvDataService()) {
-            HILOGE("get kvDataService failed!");
+    {
+        unique_lock<shared_mutex> writeLock(initLock_);
+        if (kvStorePtr_ == kvStore) {
             return;
         }
-        InitDistributedDataStorage();
-        distributedDataChangeListener_ = make_unique<DistributedDataChangeListener>();
-        SubscribeDistributedDataStorage();
-    };
-    if (!dmsDataStorageHandler_->PostTask(waitTask)) {
-        HILOGE("post task failed!");
-        return false;
+        kvStorePtr_ = kvStore;
     }
-    return true;
+    if (kvStore == nullptr) {
+        HILOGW("kvDataService removed, kvStore released.");
+        return;
+    }
+    HILOGI("kvStore ready.");
+    AddKvDataServiceDeathRecipient();
+    distributedDataChangeListener_ = make_unique<DistributedDataChangeListener>();
+    SubscribeDistributedDataStorage();
 }
 
-bool DistributedDataStorage::WaitKvDataService()
+void DistributedDataStorage::AddKvDataServiceDeathRecipient()
 {
     auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (samgrProxy == nullptr) {
         HILOGE("get samgrProxy failed!");
-        return false;
+        return;
     }
-    int32_t retryTimes = RETRY_TIMES_WAIT_KV_DATA;
-    do {
-        auto kvDataSvr = samgrProxy->CheckSystemAbility(DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID);
-        if (kvDataSvr != nullptr) {
-            IPCObjectProxy* proxy = reinterpret_cast<IPCObjectProxy*>(kvDataSvr.GetRefPtr());
-            if (proxy != nullptr && !proxy->IsObjectDead()) {
-                HILOGI("get service success!");
-                proxy->AddDeathRecipient(kvStoreDeathRecipient_);
-                return true;
-            }
-        }
-        HILOGD("waiting for service...");
-        this_thread::sleep_for(1s);
-        if (--retryTimes <= 0) {
-            HILOGE("waiting service timeout(30)s.");
-            return false;
-        }
-    } while (true);
-    return false;
-}
-
-void DistributedDataStorage::InitDistributedDataStorage()
-{
-    int64_t begin = GetTickCount();
-    unique_lock<shared_mutex> writeLock(initLock_);
-    bool result = TryGetKvStore();
-    int64_t end = GetTickCount();
-    HILOGI("TryGetKvStore %{public}s, spend %{public}" PRId64 " ms", result ? "success" : "failed", end - begin);
-}
-
-bool DistributedDataStorage::TryGetKvStore()
-{
-    int32_t retryTimes = 0;
-    while (retryTimes < RETRY_TIMES_GET_KVSTORE) {
-        if (GetKvStore() == Status::SUCCESS && kvStorePtr_ != nullptr) {
-            return true;
-        }
-        HILOGD("retry get kvstore...");
-        this_thread::sleep_for(500ms);
-        retryTimes++;
+    auto kvDataSvr = samgrProxy->CheckSystemAbility(DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID);
+    if (kvDataSvr == nullptr) {
+        HILOGW("kvDataService not found!");
+        return;
     }
-    if (kvStorePtr_ == nullptr) {
-        return false;
+    IPCObjectProxy* proxy = reinterpret_cast<IPCObjectProxy*>(kvDataSvr.GetRefPtr());
+    if (proxy != nullptr && !proxy->IsObjectDead()) {
+        proxy->AddDeathRecipient(kvStoreDeathRecipient_);
     }
-    return true;
 }
 
-Status DistributedDataStorage::GetKvStore()
+Status DistributedDataStorage::GetKvStore(shared_ptr<SingleKvStore>& kvStore)
 {
     Options options = {
         .createIfMissing = true,
@@ -150,9 +120,15 @@ Status DistributedDataStorage::GetKvStore()
         .kvStoreType = KvStoreType::SINGLE_VERSION,
         .baseDir = KVDB_PATH
     };
-    Status status = dataManager_.GetSingleKvStore(options, appId_, storeId_, kvStorePtr_);
+    AppId appId;
+    appId.appId = APP_ID;
+    StoreId storeId;
+    storeId.storeId = STORE_ID;
+    DistributedKvDataManager dataManager;
+    Status status = dataManager.GetSingleKvStore(options, appId, storeId, kvStore);
     if (status != Status::SUCCESS) {
         HILOGE("GetSingleKvStore failed, status = %{public}d.", status);
+        return status;
     }
     HILOGI("GetSingleKvStore success!");
     return status;
@@ -189,6 +165,10 @@ void DistributedDataStorage::NotifyRemoteDied(const wptr<IRemoteObject>& remote)
 bool DistributedDataStorage::Stop()
 {
     HILOGD("begin.");
+    if (storeListenerId_ != 0) {
+        DmsKvStoreManager::GetInstance().RemoveStoreListener(storeListenerId_);
+        storeListenerId_ = 0;
+    }
     dmsDataStorageHandler_ = nullptr;
     bool ret = UninitDistributedDataStorage();
     if (!ret) {
@@ -220,6 +200,7 @@ bool DistributedDataStorage::UninitDistributedDataStorage()
             return false;
         }
         kvStorePtr_ = nullptr;
+        DmsKvStoreManager::GetInstance().ResetStore(STORE_ID);
     }
     status = dataManager_.DeleteKvStore(appId_, storeId_, KVDB_PATH);
     if (status != Status::SUCCESS) {
@@ -361,36 +342,59 @@ bool DistributedDataStorage::FuzzyDeleteInnerLocked(const string& networkId)
 }
 
 bool DistributedDataStorage::Query(const string& networkId, int32_t missionId, Value& value) const
+{
+    auto task = QueryAsync(networkId, missionId, GetQueryDeadline());
+    if (task == nullptr) {
+        return false;
+    }
+    Status status = task->Wait(value);
+    if (status != Status::SUCCESS) {
+        HILOGE("Query networkId: %{public}s, missionId: %{public}d fail, status = %{public}d.",
+            GetAnonymStr(networkId).c_str(), missionId, status);
+        return false;
+    }
+    HILOGI("Query networkId: %{public}s, missionId: %{public}d success.", GetAnonymStr(networkId).c_str(), missionId);
+    return true;
+}
+
+shared_ptr<DistributedDataQueryTask> DistributedDataStorage::QueryAsync(const string& networkId, int32_t missionId,
+    chrono::steady_clock::time_point deadline, DistributedDataQueryTask::Callback callback) const
 {
     if (networkId.empty()) {
         HILOGW("networkId is empty!");
-        return false;
+        return nullptr;
     }
     if (missionId < 0) {
         HILOGW("missionId is invalid!");
-        return false;
+        return nullptr;
     }
+    bool hasCallback = callback != nullptr;
+    auto task = make_shared<DistributedDataQueryTask>(deadline, std::move(callback));
     {
         shared_lock<shared_mutex> readLock(initLock_);
-        bool ret = QueryInnerLocked(networkId, missionId, value);
-        if (!ret) {
+        if (!QueryInnerLocked(networkId, missionId, task)) {
             HILOGE("Query networkId: %{public}s, missionId: %{public}d fail.",
                 GetAnonymStr(networkId).c_str(), missionId);
-            return false;
+            return nullptr;
         }
     }
-    HILOGI("Query networkId: %{public}s, missionId: %{public}d success.", GetAnonymStr(networkId).c_str(), missionId);
-    return true;
+    // a waiting caller enforces the deadline in Wait, only callbacks need the timer
+    if (hasCallback) {
+        ScheduleQueryDeadline(task);
+    }
+    return task;
 }
 
-bool DistributedDataStorage::QueryInnerLocked(const string& networkId, int32_t missionId, Value& value) const
+chrono::steady_clock::time_point DistributedDataStorage::GetQueryDeadline() const
+{
+    return chrono::steady_clock::now() + chrono::seconds(waittingTime_);
+}
+
+bool DistributedDataStorage::QueryInnerLocked(const string& networkId, int32_t missionId,
+    const shared_ptr<DistributedDataQueryTask>& task) const
 {
     HILOGD("called.");
     int64_t begin = GetTickCount();
-    if (kvStorePtr_ == nullptr) {
-        HILOGW("kvStorePtr is null!");
-        return false;
-    }
     string uuid = DtbschedmgrDeviceInfoStorage::GetInstance().GetUuidByNetworkId(networkId);
     if (uuid.empty()) {
         HILOGW("uuid is empty!");
@@ -398,32 +402,103 @@ bool DistributedDataStorage::QueryInnerLocked(const string& networkId, int32_t m
     }
     Key key;
     GenerateKey(uuid, missionId, key);
-    std::promise<OHOS::DistributedKv::Status> resultStatusSignal;
-    kvStorePtr_->Get(key, networkId,
-        [&value, &resultStatusSignal](Status innerStatus, Value innerValue) {
-            HILOGI("The get, result = %{public}d", innerStatus);
-            if (innerStatus == Status::SUCCESS) {
-                value = innerValue;
-            }
-            resultStatusSignal.set_value(innerStatus);
-        });
-    Status status = GetResultSatus(resultStatusSignal);
-    HILOGI("[PerformanceTest] Get Snapshot spend %{public}" PRId64 " ms", GetTickCount() - begin);
-    if (status != Status::SUCCESS) {
-        HILOGE("kvStorePtr Get failed! status = %{public}d.", status);
+    // the callback owns the task, it may run after the caller gave up waiting
+    return GetFromKvStoreLocked(key, networkId, [task, begin](Status innerStatus, Value&& innerValue) {
+        HILOGI("The get, result = %{public}d", innerStatus);
+        HILOGI("[PerformanceTest] Get Snapshot spend %{public}" PRId64 " ms", GetTickCount() - begin);
+        task->Complete(innerStatus, std::move(innerValue));
+    });
+}
+
+bool DistributedDataStorage::GetFromKvStoreLocked(const Key& key, const string& networkId,
+    const function<void(Status, Value&&)>& onResult) const
+{
+    if (kvStorePtr_ == nullptr) {
+        HILOGW("kvStorePtr is null!");
         return false;
     }
+    kvStorePtr_->Get(key, networkId, [onResult](Status innerStatus, Value innerValue) {
+        onResult(innerStatus, std::move(innerValue));
+    });
     return true;
 }
 
-Status DistributedDataStorage::GetResultSatus(std::promise<OHOS::DistributedKv::Status> &resultStatusSignal) const
+void DistributedDataStorage::ScheduleQueryDeadline(const shared_ptr<DistributedDataQueryTask>& task) const
 {
-    auto future = resultStatusSignal.get_future();
-    if (future.wait_for(std::chrono::seconds(waittingTime_)) == std::future_status::ready) {
-        Status status = future.get();
-        return status;
+    if (dmsDataStorageHandler_ == nullptr) {
+        HILOGW("dmsDataStorageHandler is null, query has no deadline timer!");
+        return;
+    }
+    int64_t delay = chrono::duration_cast<chrono::milliseconds>(task->GetDeadline() -
+        chrono::steady_clock::now()).count();
+    weak_ptr<DistributedDataQueryTask> weakTask = task;
+    auto timeoutTask = [weakTask]() {
+        auto queryTask = weakTask.lock();
+        if (queryTask != nullptr && queryTask->Complete(Status::TIME_OUT, Value())) {
+            HILOGW("Query snapshot timeout.");
+        }
+    };
+    if (!dmsDataStorageHandler_->PostTask(timeoutTask, delay > 0 ? delay : 0)) {
+        HILOGW("post query deadline failed!");
     }
-    return Status::ERROR;
+}
+
+bool DistributedDataQueryTask::Complete(Status status, Value&& value)
+{
+    return CompleteInner(status, std::move(value), true);
+}
+
+bool DistributedDataQueryTask::Cancel()
+{
+    return CompleteInner(Status::ERROR, Value(), false);
+}
+
+bool DistributedDataQueryTask::CompleteInner(Status status, Value&& value, bool notify)
+{
+    Callback callback;
+    {
+        lock_guard<mutex> autoLock(lock_);
+        if (isDone_) {
+            return false;
+        }
+        isDone_ = true;
+        status_ = status;
+        value_ = std::move(value);
+        callback = std::move(callback_);
+        callback_ = nullptr;
+    }
+    doneCondition_.notify_all();
+    // status_ and value_ never change once done
+    if (notify && callback != nullptr) {
+        callback(status_, value_);
+    }
+    return true;
+}
+
+Status DistributedDataQueryTask::Wait(Value& value)
+{
+    {
+        unique_lock<mutex> autoLock(lock_);
+        if (doneCondition_.wait_until(autoLock, deadline_, [this]() { return isDone_; })) {
+            value = value_;
+            return status_;
+        }
+    }
+    CompleteInner(Status::TIME_OUT, Value(), true);
+    lock_guard<mutex> autoLock(lock_);
+    value = value_;
+    return status_;
+}
+
+bool DistributedDataQueryTask::IsDone() const
+{
+    lock_guard<mutex> autoLock(lock_);
+    return isDone_;
+}
+
+chrono::steady_clock::time_point DistributedDataQueryTask::GetDeadline() const
+{
+    return deadline_;
 }
 
 void DistributedDataStorage::GenerateKey(const string& uuid, int32_t missionId, Key& key)
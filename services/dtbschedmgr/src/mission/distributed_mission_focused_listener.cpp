@@ -19,6 +19,7 @@
 
 #include "continue/dsched_continue_manager.h"
 #include "dfx/distributed_radar.h"
+#include "dsched_readiness_waiter.h"
 #include "dtbschedmgr_log.h"
 #include "ipc_skeleton.h"
 #include "mission/notification/dms_continue_send_manager.h"
@@ -82,6 +83,7 @@ void DistributedMissionFocusedListener::UnInit()
 void DistributedMissionFocusedListener::OnMissionCreated(int32_t missionId)
 {
     HILOGD("OnMissionCreated, missionId = %{public}d", missionId);
+    DSchedReadinessWaiter::GetInstance().Notify(missionId);
 }
 
 void DistributedMissionFocusedListener::OnMissionDestroyed(int32_t missionId)
@@ -118,11 +120,13 @@ void DistributedMissionFocusedListener::OnMissionSnapshotChanged(int32_t mission
 void DistributedMissionFocusedListener::OnMissionMovedToFront(int32_t missionId)
 {
     HILOGD("OnMissionMovedToFront, missionId = %{public}d", missionId);
+    DSchedReadinessWaiter::GetInstance().Notify(missionId);
 }
 
 void DistributedMissionFocusedListener::OnMissionFocused(int32_t missionId)
 {
     HILOGD("OnMissionFocused, missionId = %{public}d", missionId);
+    DSchedReadinessWaiter::GetInstance().Notify(missionId);
     int32_t callingUid = IPCSkeleton::GetCallingUid();
     if (!MultiUserManager::GetInstance().IsCallerForeground(callingUid)) {
         HILOGW("Current process is not foreground. callingUid = %{public}d", callingUid);
@@ -232,38 +232,73 @@ int32_t DistributedSchedMissionManager::RemoveSnapshotInfo(const std::string& de
 
 int32_t DistributedSchedMissionManager::GetRemoteMissionSnapshotInfo(const std::string& networkId, int32_t missionId,
     std::unique_ptr<AAFwk::MissionSnapshot>& missionSnapshot)
+{
+    std::map<int32_t, std::unique_ptr<AAFwk::MissionSnapshot>> missionSnapshots;
+    int32_t ret = GetRemoteMissionSnapshotInfos(networkId, { missionId }, missionSnapshots);
+    if (ret != ERR_NONE) {
+        return ret;
+    }
+    missionSnapshot = std::move(missionSnapshots[missionId]);
+    return ERR_NONE;
+}
+
+int32_t DistributedSchedMissionManager::GetRemoteMissionSnapshotInfos(const std::string& networkId,
+    const std::vector<int32_t>& missionIds, std::map<int32_t, std::unique_ptr<AAFwk::MissionSnapshot>>& missionSnapshots)
 {
     std::string uuid = DtbschedmgrDeviceInfoStorage::GetInstance().GetUuidByNetworkId(networkId);
     if (uuid.empty()) {
         HILOGE("uuid is empty!");
         return INVALID_PARAMETERS_ERR;
     }
-    std::unique_ptr<Snapshot> snapshotPtr = DequeueCachedSnapshotInfo(uuid, missionId);
-    if (snapshotPtr != nullptr) {
-        HILOGI("Get snapshot from cache success, uuid: %{public}s, missionId: %{public}d.",
-            GetAnonymStr(uuid).c_str(), missionId);
-        SnapshotConverter::ConvertToMissionSnapshot(*snapshotPtr, missionSnapshot);
-        return ERR_NONE;
-    }
-    if (distributedDataStorage_ == nullptr) {
-        HILOGE("DistributedDataStorage is null!");
-        return ERR_NULL_OBJECT;
+    // issue every cache miss first so the reads overlap, then wait against one shared deadline
+    std::chrono::steady_clock::time_point deadline;
+    if (distributedDataStorage_ != nullptr) {
+        deadline = distributedDataStorage_->GetQueryDeadline();
     }
-    DistributedKv::Value value;
-    bool ret = distributedDataStorage_->Query(networkId, missionId, value);
-    if (!ret) {
-        HILOGE("DistributedDataStorage query failed!");
-        return INVALID_PARAMETERS_ERR;
+    std::map<int32_t, std::shared_ptr<DistributedDataQueryTask>> tasks;
+    int32_t errCode = INVALID_PARAMETERS_ERR;
+    for (int32_t missionId : missionIds) {
+        if (missionSnapshots.count(missionId) != 0 || tasks.count(missionId) != 0) {
+            continue;
+        }
+        std::unique_ptr<Snapshot> snapshotPtr = DequeueCachedSnapshotInfo(uuid, missionId);
+        if (snapshotPtr != nullptr) {
+            auto& missionSnapshot = missionSnapshots[missionId];
+            missionSnapshot = std::make_unique<AAFwk::MissionSnapshot>();
+            SnapshotConverter::ConvertToMissionSnapshot(*snapshotPtr, missionSnapshot);
+            continue;
+        }
+        if (distributedDataStorage_ == nullptr) {
+            HILOGE("DistributedDataStorage is null!");
+            errCode = ERR_NULL_OBJECT;
+            continue;
+        }
+        auto task = distributedDataStorage_->QueryAsync(networkId, missionId, deadline);
+        if (task == nullptr) {
+            HILOGW("query missionId: %{public}d failed!", missionId);
+            continue;
+        }
+        tasks[missionId] = task;
     }
-    snapshotPtr = Snapshot::Create(value.Data());
-    if (snapshotPtr == nullptr) {
-        HILOGE("snapshot create failed!");
-        return ERR_NULL_OBJECT;
+    for (auto& [missionId, task] : tasks) {
+        DistributedKv::Value value;
+        if (task->Wait(value) != DistributedKv::Status::SUCCESS) {
+            HILOGW("wait missionId: %{public}d failed!", missionId);
+            continue;
+        }
+        std::unique_ptr<Snapshot> snapshotPtr = Snapshot::Create(value.Data());
+        if (snapshotPtr == nullptr) {
+            HILOGW("snapshot create failed, missionId: %{public}d!", missionId);
+            errCode = ERR_NULL_OBJECT;
+            continue;
+        }
+        auto& missionSnapshot = missionSnapshots[missionId];
+        missionSnapshot = std::make_unique<AAFwk::MissionSnapshot>();
+        SnapshotConverter::ConvertToMissionSnapshot(*snapshotPtr, missionSnapshot);
     }
-    HILOGI("Get snapshot from DistributedDB success, uuid: %{public}s, missionId: %{public}d.",
-        GetAnonymStr(uuid).c_str(), missionId);
-    SnapshotConverter::ConvertToMissionSnapshot(*snapshotPtr, missionSnapshot);
-    return ERR_NONE;
+    HILOGI("Get %{public}zu of %{public}zu snapshots, uuid: %{public}s.", missionSnapshots.size(),
+        missionIds.size(), GetAnonymStr(uuid).c_str());
+    return missionSnapshots.empty() ? errCode : ERR_NONE;
 }
 
 void DistributedSchedMissionManager::DeviceOnlineNotify(const std::string& networkId)
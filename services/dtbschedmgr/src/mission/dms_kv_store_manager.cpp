@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mission/dms_kv_store_manager.h"
+
+#include <vector>
+
+#include "iservice_registry.h"
+#include "system_ability_definition.h"
+
+#include "dtbschedmgr_log.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DmsKvStoreManager";
+const std::string KV_STORE_OPEN_TASK = "DmsKvStoreOpen_";
+}
+
+IMPLEMENT_SINGLE_INSTANCE(DmsKvStoreManager);
+
+void DmsKvStoreManager::RegisterStore(const std::string& storeId, const DmsKvStoreManager::Opener& opener)
+{
+    if (storeId.empty() || opener == nullptr) {
+        HILOGE("invalid store, storeId: %{public}s.", storeId.c_str());
+        return;
+    }
+    bool isProbeNeeded = false;
+    {
+        std::lock_guard<std::mutex> storeLock(storeMutex_);
+        if (stores_.count(storeId) != 0) {
+            HILOGD("store %{public}s already registered.", storeId.c_str());
+            return;
+        }
+        auto& entry = stores_[storeId];
+        entry.opener = opener;
+        if (isServiceReady_) {
+            StartOpenLocked(storeId, entry);
+        } else {
+            isProbeNeeded = true;
+        }
+    }
+    // the added notification may have come before the listener was registered with samgr
+    if (isProbeNeeded && ProbeKvService()) {
+        OnKvServiceAdded();
+    }
+}
+
+int32_t DmsKvStoreManager::GetKvStore(const std::string& storeId,
+    std::shared_ptr<DistributedKv::SingleKvStore>& kvStore)
+{
+    bool isProbeNeeded = false;
+    {
+        std::lock_guard<std::mutex> storeLock(storeMutex_);
+        auto iter = stores_.find(storeId);
+        if (iter == stores_.end()) {
+            HILOGE("store %{public}s not registered.", storeId.c_str());
+            return DMS_KV_STORE_NOT_READY;
+        }
+        auto& entry = iter->second;
+        if (entry.state == StoreState::READY) {
+            kvStore = entry.kvStore;
+            return ERR_OK;
+        }
+        if (entry.state == StoreState::NOT_READY) {
+            if (isServiceReady_) {
+                // the last open round gave up, try again in the background
+                StartOpenLocked(storeId, entry);
+            } else {
+                isProbeNeeded = true;
+            }
+        }
+    }
+    if (isProbeNeeded && ProbeKvService()) {
+        OnKvServiceAdded();
+    }
+    HILOGW("store %{public}s not ready.", storeId.c_str());
+    return DMS_KV_STORE_NOT_READY;
+}
+
+DmsKvStoreManager::StoreState DmsKvStoreManager::GetStoreState(const std::string& storeId)
+{
+    std::lock_guard<std::mutex> storeLock(storeMutex_);
+    auto iter = stores_.find(storeId);
+    return iter == stores_.end() ? StoreState::NOT_READY : iter->second.state;
+}
+
+int32_t DmsKvStoreManager::AddStoreListener(const std::string& storeId,
+    const DmsKvStoreManager::StoreListener& listener)
+{
+    if (listener == nullptr) {
+        return 0;
+    }
+    int32_t listenerId = 0;
+    {
+        std::lock_guard<std::mutex> listenerLock(listenerMutex_);
+        listenerId = ++nextListenerId_;
+        listeners_[listenerId] = { storeId, listener };
+    }
+    std::lock_guard<std::mutex> storeLock(storeMutex_);
+    auto iter = stores_.find(storeId);
+    if (iter != stores_.end() && iter->second.state == StoreState::READY && eventHandler_ != nullptr) {
+        eventHandler_->PostTask([this, listenerId]() { NotifyListener(listenerId); });
+    }
+    return listenerId;
+}
+
+void DmsKvStoreManager::RemoveStoreListener(int32_t listenerId)
+{
+    std::unique_lock<std::mutex> listenerLock(listenerMutex_);
+    listeners_.erase(listenerId);
+    // only waits for this listener, others keep running
+    listenerCond_.wait(listenerLock, [this, listenerId]() {
+        return runningListeners_.find(listenerId) == runningListeners_.end();
+    });
+}
+
+void DmsKvStoreManager::ResetStore(const std::string& storeId)
+{
+    std::lock_guard<std::mutex> storeLock(storeMutex_);
+    auto iter = stores_.find(storeId);
+    if (iter == stores_.end()) {
+        return;
+    }
+    iter->second.state = StoreState::NOT_READY;
+    iter->second.generation++;
+    iter->second.kvStore = nullptr;
+}
+
+void DmsKvStoreManager::OnKvServiceAdded()
+{
+    HILOGI("kv data service added.");
+    std::lock_guard<std::mutex> storeLock(storeMutex_);
+    isServiceReady_ = true;
+    for (auto& [storeId, entry] : stores_) {
+        if (entry.state == StoreState::NOT_READY) {
+            StartOpenLocked(storeId, entry);
+        }
+    }
+}
+
+void DmsKvStoreManager::OnKvServiceRemoved()
+{
+    HILOGI("kv data service removed.");
+    std::vector<std::string> closedStores;
+    {
+        std::lock_guard<std::mutex> storeLock(storeMutex_);
+        isServiceReady_ = false;
+        for (auto& [storeId, entry] : stores_) {
+            if (entry.state == StoreState::READY) {
+                closedStores.push_back(storeId);
+            }
+            entry.state = StoreState::NOT_READY;
+            entry.generation++;
+            entry.kvStore = nullptr;
+        }
+    }
+    for (const auto& storeId : closedStores) {
+        NotifyListeners(storeId, nullptr);
+    }
+}
+
+bool DmsKvStoreManager::ProbeKvService()
+{
+    if (serviceProbe_ != nullptr) {
+        return serviceProbe_();
+    }
+    auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (samgrProxy == nullptr) {
+        HILOGE("get samgrProxy failed!");
+        return false;
+    }
+    return samgrProxy->CheckSystemAbility(DISTRIBUTED_KV_DATA_SERVICE_ABILITY_ID) != nullptr;
+}
+
+void DmsKvStoreManager::StartOpenLocked(const std::string& storeId, DmsKvStoreManager::StoreEntry& entry)
+{
+    entry.state = StoreState::OPENING;
+    entry.openTimes = 0;
+    entry.generation++;
+    PostOpenLocked(storeId, entry.generation, 0);
+}
+
+void DmsKvStoreManager::PostOpenLocked(const std::string& storeId, uint64_t generation, int64_t delayMs)
+{
+    if (eventHandler_ == nullptr) {
+        auto runner = AppExecFwk::EventRunner::Create("DmsKvStoreManager");
+        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    auto func = [this, storeId, generation]() {
+        OpenStore(storeId, generation);
+    };
+    eventHandler_->PostTask(func, KV_STORE_OPEN_TASK + storeId, delayMs);
+}
+
+void DmsKvStoreManager::OpenStore(const std::string& storeId, uint64_t generation)
+{
+    Opener opener;
+    {
+        std::lock_guard<std::mutex> storeLock(storeMutex_);
+        auto iter = stores_.find(storeId);
+        if (iter == stores_.end() || iter->second.generation != generation) {
+            return;
+        }
+        opener = iter->second.opener;
+    }
+    // the ipc to the kv data service runs without any lock held
+    std::shared_ptr<DistributedKv::SingleKvStore> kvStore;
+    DistributedKv::Status status = opener(kvStore);
+    {
+        std::lock_guard<std::mutex> storeLock(storeMutex_);
+        auto iter = stores_.find(storeId);
+        if (iter == stores_.end() || iter->second.generation != generation) {
+            HILOGW("store %{public}s reset while opening, result dropped.", storeId.c_str());
+            return;
+        }
+        auto& entry = iter->second;
+        if (status != DistributedKv::Status::SUCCESS || kvStore == nullptr) {
+            entry.openTimes++;
+            HILOGW("open store %{public}s failed, status: %{public}d, times: %{public}d.", storeId.c_str(),
+                static_cast<int32_t>(status), entry.openTimes);
+            if (entry.openTimes < MAX_OPEN_TIMES) {
+                PostOpenLocked(storeId, generation, OPEN_RETRY_INTERVAL_MS);
+            } else {
+                entry.state = StoreState::NOT_READY;
+            }
+            return;
+        }
+        entry.state = StoreState::READY;
+        entry.kvStore = kvStore;
+        HILOGI("store %{public}s ready after %{public}d failed opens.", storeId.c_str(), entry.openTimes);
+    }
+    NotifyListeners(storeId, kvStore);
+}
+
+void DmsKvStoreManager::NotifyListeners(const std::string& storeId,
+    const std::shared_ptr<DistributedKv::SingleKvStore>& kvStore)
+{
+    std::vector<int32_t> listenerIds;
+    {
+        std::lock_guard<std::mutex> listenerLock(listenerMutex_);
+        for (const auto& [listenerId, entry] : listeners_) {
+            if (entry.storeId == storeId) {
+                listenerIds.push_back(listenerId);
+            }
+        }
+    }
+    for (auto listenerId : listenerIds) {
+        RunListener(listenerId, kvStore);
+    }
+}
+
+void DmsKvStoreManager::RunListener(int32_t listenerId, const std::shared_ptr<DistributedKv::SingleKvStore>& kvStore)
+{
+    StoreListener listener;
+    {
+        std::lock_guard<std::mutex> listenerLock(listenerMutex_);
+        auto iter = listeners_.find(listenerId);
+        if (iter == listeners_.end()) {
+            return;
+        }
+        listener = iter->second.listener;
+        runningListeners_.insert(listenerId);
+    }
+    listener(kvStore);
+    {
+        std::lock_guard<std::mutex> listenerLock(listenerMutex_);
+        runningListeners_.erase(runningListeners_.find(listenerId));
+    }
+    listenerCond_.notify_all();
+}
+
+void DmsKvStoreManager::NotifyListener(int32_t listenerId)
+{
+    std::string storeId;
+    {
+        std::lock_guard<std::mutex> listenerLock(listenerMutex_);
+        auto listenerIter = listeners_.find(listenerId);
+        if (listenerIter == listeners_.end()) {
+            return;
+        }
+        storeId = listenerIter->second.storeId;
+    }
+    std::shared_ptr<DistributedKv::SingleKvStore> kvStore;
+    {
+        std::lock_guard<std::mutex> storeLock(storeMutex_);
+        auto storeIter = stores_.find(storeId);
+        if (storeIter == stores_.end() || storeIter->second.state != StoreState::READY) {
+            return;
+        }
+        kvStore = storeIter->second.kvStore;
+    }
+    RunListener(listenerId, kvStore);
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
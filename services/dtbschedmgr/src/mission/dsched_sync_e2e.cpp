@@ -21,6 +21,7 @@
 #include <parameter.h>
 
 #include "config_policy_utils.h"
+#include "mission/dms_kv_store_manager.h"
 #include "parameters.h"
 #include "securec.h"
 
@@ -29,9 +30,7 @@ namespace DistributedSchedule {
 namespace {
 const std::string TAG = "DmsKvSyncE2E";
 const std::string BMS_KV_BASE_DIR = "/data/service/el1/public/database/DistributedSchedule";
-const int32_t SLEEP_INTERVAL = 100 * 1000;  // 100ms
 const int32_t EL1 = 1;
-const int32_t MAX_TIMES = 600;              // 1min
 const char DETERMINE_DEVICE_TYPE_KEY[] = "persist.distributed_scene.sys_settings_data_sync";
 static const int32_t FORBID_SEND_FORBID_RECV = 0;
 static const int32_t ALLOW_SEND_ALLOW_RECV = 1;
@@ -47,7 +46,7 @@ std::mutex DmsKvSyncE2E::mutex_;
 DmsKvSyncE2E::DmsKvSyncE2E()
 {
     HILOGD("called.");
-    TryTwice([this] { return GetKvStore(); });
+    DmsKvStoreManager::GetInstance().RegisterStore(storeId_.storeId, GetKvStore);
     HILOGD("end.");
 }
 
@@ -320,25 +319,18 @@ bool DmsKvSyncE2E::IsSynchronized(const std::string &networkId)
 bool DmsKvSyncE2E::CheckKvStore()
 {
     HILOGD("called.");
-    std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
-    if (kvStorePtr_ != nullptr) {
-        return true;
+    std::shared_ptr<SingleKvStore> kvStore;
+    if (DmsKvStoreManager::GetInstance().GetKvStore(storeId_.storeId, kvStore) != ERR_OK) {
+        return false;
     }
-    int32_t tryTimes = MAX_TIMES;
-    while (tryTimes > 0) {
-        Status status = GetKvStore();
-        if (status == Status::SUCCESS && kvStorePtr_ != nullptr) {
-            return true;
-        }
-        HILOGW("CheckKvStore, Times: %{public}d", tryTimes);
-        usleep(SLEEP_INTERVAL);
-        tryTimes--;
+    std::lock_guard<std::mutex> lock(kvStorePtrMutex_);
+    if (kvStorePtr_ != kvStore) {
+        kvStorePtr_ = kvStore;
     }
-    HILOGD("end.");
-    return kvStorePtr_ != nullptr;
+    return true;
 }
 
-Status DmsKvSyncE2E::GetKvStore()
+Status DmsKvSyncE2E::GetKvStore(std::shared_ptr<SingleKvStore>& kvStore)
 {
     HILOGD("called.");
     Options options = {
@@ -356,28 +348,20 @@ Status DmsKvSyncE2E::GetKvStore()
             .autoSync = true
         },
     };
-    Status status = dataManager_.GetSingleKvStore(options, appId_, storeId_, kvStorePtr_);
+    const AppId appId {DMS_BM_APP_ID};
+    const StoreId storeId {DISTRIBUTE_BM_STORE_ID};
+    DistributedKvDataManager dataManager;
+    Status status = dataManager.GetSingleKvStore(options, appId, storeId, kvStore);
     if (status == Status::SUCCESS) {
         HILOGD("get kvStore success");
     } else if (status == DistributedKv::Status::STORE_META_CHANGED) {
         HILOGE("This db meta changed, remove and rebuild it");
-        dataManager_.DeleteKvStore(appId_, storeId_, BMS_KV_BASE_DIR + appId_.appId);
+        dataManager.DeleteKvStore(appId, storeId, BMS_KV_BASE_DIR + appId.appId);
     }
     HILOGD("end.");
     return status;
 }
 
-void DmsKvSyncE2E::TryTwice(const std::function<Status()> &func) const
-{
-    HILOGD("called.");
-    Status status = func();
-    if (status != Status::SUCCESS) {
-        status = func();
-        HILOGW("error and try to call again, result = %{public}d", status);
-    }
-    HILOGD("end.");
-}
-
 DmsKvSyncCB::DmsKvSyncCB()
 {
     HILOGD("create");
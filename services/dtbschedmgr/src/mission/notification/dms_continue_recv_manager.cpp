@@ -24,6 +24,7 @@
 #include "dfx/distributed_ue.h"
 #include "distributed_sched_utils.h"
 #include "distributed_sched_adapter.h"
+#include "dsched_continue_prefetcher.h"
 #include "dtbschedmgr_device_info_storage.h"
 #include "dtbschedmgr_log.h"
 #include "mission/dsched_sync_e2e.h"
@@ -33,6 +34,7 @@
 #include "softbus_adapter/softbus_adapter.h"
 #include "switch_status_dependency.h"
 #include "os_account_manager.h"
+#include "parameters.h"
 
 namespace OHOS {
 namespace DistributedSchedule {
@@ -49,6 +51,7 @@ const std::string TAG = "DMSContinueRecvMgr";
 const std::string DBMS_RETRY_TASK = "retry_on_boradcast_task";
 const std::u16string DESCRIPTOR = u"ohos.aafwk.RemoteOnListener";
 const std::string QUICK_START_CONFIGURATION = "_ContinueQuickStart";
+const std::string PARAM_BROADCAST_DEDUP_WINDOW = "persist.distributed_scene.continue_broadcast_dedup_ms";
 }
 
 DMSContinueRecvMgr::~DMSContinueRecvMgr()
@@ -61,6 +64,9 @@ void DMSContinueRecvMgr::Init(int32_t accountId)
 {
     HILOGI("Init start. accountId: %{public}d.", accountId);
     accountId_ = accountId;
+    SetBroadcastDedupWindow(OHOS::system::GetIntParameter(PARAM_BROADCAST_DEDUP_WINDOW,
+        DEFAULT_BROADCAST_DEDUP_WINDOW));
+    DSchedContinuePrefetcher::GetInstance().Init();
     if (eventHandler_ != nullptr) {
         HILOGI("Already inited, end.");
         return;
@@ -88,6 +94,10 @@ void DMSContinueRecvMgr::UnInit()
     } else {
         HILOGE("eventHandler_ is nullptr");
     }
+    {
+        std::lock_guard<std::mutex> broadcastLock(broadcastMutex_);
+        pendingBroadcast_.clear();
+    }
     HILOGI("UnInit end");
 }
 
@@ -125,6 +135,10 @@ void DMSContinueRecvMgr::NotifyDataRecv(std::string& senderNetworkId,
     if (type == DMS_UNFOCUSED_TYPE) {
         state = INACTIVE;
     }
+    if (IsDuplicateBroadcast(senderNetworkId, bundleNameId, continueTypeId, state)) {
+        HILOGW("duplicate broadcast within %{public}d ms, drop it.", dedupWindow_.load());
+        return;
+    }
     PostOnBroadcastBusiness(senderNetworkId, bundleNameId, continueTypeId, state);
     HILOGI("NotifyDataRecv end");
 }
@@ -243,14 +257,70 @@ void DMSContinueRecvMgr::PostOnBroadcastBusiness(const std::string& senderNetwor
 {
     HILOGI("accountId: %{public}d.", accountId_);
     auto feedfunc = [this, senderNetworkId, bundleNameId, continueTypeId, state, retry]() mutable {
+        {
+            std::lock_guard<std::mutex> broadcastLock(broadcastMutex_);
+            pendingBroadcast_.erase(senderNetworkId);
+        }
         DealOnBroadcastBusiness(senderNetworkId, bundleNameId, continueTypeId, state, retry);
     };
-    if (eventHandler_ != nullptr) {
-        eventHandler_->RemoveTask(DBMS_RETRY_TASK);
-        eventHandler_->PostTask(feedfunc, DBMS_RETRY_TASK, delay);
-    } else {
+    if (eventHandler_ == nullptr) {
         HILOGE("eventHandler_ is nullptr");
+        return;
+    }
+    // one task name per sender, so a burst from the same peer collapses to its latest state.
+    std::string taskName = DBMS_RETRY_TASK + senderNetworkId;
+    {
+        std::lock_guard<std::mutex> broadcastLock(broadcastMutex_);
+        if (!pendingBroadcast_.insert(senderNetworkId).second) {
+            broadcastStat_.coalescedCount++;
+            HILOGI("pending broadcast of sender %{public}s superseded.", GetAnonymStr(senderNetworkId).c_str());
+        }
     }
+    eventHandler_->RemoveTask(taskName);
+    eventHandler_->PostTask(feedfunc, taskName, delay);
+}
+
+bool DMSContinueRecvMgr::IsDuplicateBroadcast(const std::string& senderNetworkId, uint16_t bundleNameId,
+    uint8_t continueTypeId, const int32_t state)
+{
+    int64_t now = GetTickCount();
+    std::lock_guard<std::mutex> broadcastLock(broadcastMutex_);
+    broadcastStat_.recvCount++;
+    auto iter = lastBroadcast_.find(senderNetworkId);
+    if (iter != lastBroadcast_.end() && iter->second.bundleNameId == bundleNameId &&
+        iter->second.continueTypeId == continueTypeId && iter->second.state == state &&
+        now - iter->second.recvTime < dedupWindow_.load()) {
+        broadcastStat_.droppedCount++;
+        return true;
+    }
+    BroadcastRecord &record = lastBroadcast_[senderNetworkId];
+    record.bundleNameId = bundleNameId;
+    record.continueTypeId = continueTypeId;
+    record.state = state;
+    record.recvTime = now;
+    return false;
+}
+
+void DMSContinueRecvMgr::ClearBroadcastRecord(const std::string& senderNetworkId)
+{
+    std::lock_guard<std::mutex> broadcastLock(broadcastMutex_);
+    if (senderNetworkId.empty()) {
+        lastBroadcast_.clear();
+        return;
+    }
+    lastBroadcast_.erase(senderNetworkId);
+}
+
+void DMSContinueRecvMgr::SetBroadcastDedupWindow(int32_t windowMs)
+{
+    HILOGI("broadcast dedup window: %{public}d ms.", windowMs);
+    dedupWindow_.store(windowMs < 0 ? 0 : windowMs);
+}
+
+BroadcastRecvStat DMSContinueRecvMgr::GetBroadcastRecvStat()
+{
+    std::lock_guard<std::mutex> broadcastLock(broadcastMutex_);
+    return broadcastStat_;
 }
 
 int32_t DMSContinueRecvMgr::RetryPostBroadcast(const std::string& senderNetworkId,
@@ -320,6 +390,9 @@ int32_t DMSContinueRecvMgr::DealOnBroadcastBusiness(const std::string& senderNet
 {
     HILOGI("start, senderNetworkId: %{public}s, bundleNameId: %{public}u, state: %{public}d. accountId: %{public}d.",
         GetAnonymStr(senderNetworkId).c_str(), bundleNameId, state, accountId_);
+    if (state == INACTIVE) {
+        DSchedContinuePrefetcher::GetInstance().OnUnfocused(senderNetworkId, bundleNameId);
+    }
     DmsBundleInfo distributedBundleInfo;
     if (!DmsBmStorage::GetInstance()->GetDistributedBundleInfo(senderNetworkId, bundleNameId,
         distributedBundleInfo)) {
@@ -364,6 +437,9 @@ int32_t DMSContinueRecvMgr::DealOnBroadcastBusiness(const std::string& senderNet
     if (ret != ERR_OK) {
         return ret;
     }
+    if (state == ACTIVE) {
+        DSchedContinuePrefetcher::GetInstance().OnFocused(senderNetworkId, bundleNameId);
+    }
     HILOGI("DealOnBroadcastBusiness end");
     return ERR_OK;
 }
@@ -502,6 +578,8 @@ void DMSContinueRecvMgr::OnDeviceScreenOff()
 {
     HILOGI("OnDeviceScreenOff called. accountId: %{public}d.", accountId_);
     isScreenOn.store(false);
+    ClearBroadcastRecord();
+    DSchedContinuePrefetcher::GetInstance().CancelAll();
     auto func = [this]() {
         std::string senderNetworkId;
         std::string bundleName;
@@ -571,6 +649,8 @@ void DMSContinueRecvMgr::FindToNotifyRecvBroadcast(const std::string& senderNetw
 void DMSContinueRecvMgr::OnContinueSwitchOff()
 {
     HILOGI("accountId: %{public}d.", accountId_);
+    ClearBroadcastRecord();
+    DSchedContinuePrefetcher::GetInstance().CancelAll();
     auto func = [this]() {
         std::string senderNetworkId;
         std::string bundleName;
@@ -602,6 +682,8 @@ void DMSContinueRecvMgr::OnContinueSwitchOff()
 void DMSContinueRecvMgr::OnUserSwitch()
 {
     HILOGI("OnUserSwitch start. accountId: %{public}d.", accountId_);
+    ClearBroadcastRecord();
+    DSchedContinuePrefetcher::GetInstance().CancelAll();
     std::string senderNetworkId;
     std::string bundleName;
     std::string continueType;
@@ -632,6 +714,8 @@ void DMSContinueRecvMgr::NotifyDeviceOffline(const std::string& networkId)
         return;
     }
     HILOGI("NotifyDeviceOffline begin. networkId: %{public}s.", GetAnonymStr(networkId).c_str());
+    ClearBroadcastRecord(networkId);
+    DSchedContinuePrefetcher::GetInstance().Cancel(networkId);
     std::string localNetworkId;
     if (!DtbschedmgrDeviceInfoStorage::GetInstance().GetLocalDeviceId(localNetworkId)) {
         HILOGE("Get local networkId failed");
@@ -672,6 +756,7 @@ void DMSContinueRecvMgr::NotifyPackageRemoved(const std::string& sinkBundleName)
         return;
     }
     HILOGI("NotifyPackageRemoved begin. sinkBundleName: %{public}s.", sinkBundleName.c_str());
+    ClearBroadcastRecord();
     std::string senderNetworkId;
     std::string bundleName;
     std::string continueType;
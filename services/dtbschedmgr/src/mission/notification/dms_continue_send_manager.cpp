@@ -39,6 +39,7 @@ constexpr int32_t FOCUS_TIMEOUT_DELAY_TIME = 60000;
 constexpr int32_t SCREEN_LOCK_DELAY_TIME = 10000;
 constexpr int64_t SCREEN_LOCK_EVENT_INTERVAL = 500; // determines whether normal unfocused or locked
 const std::string TIMEOUT_UNFOCUSED_TASK = "timeout_unfocused_task";
+const std::string BROADCAST_FLUSH_TASK = "continue_broadcast_flush_task";
 }
 
 void DMSContinueSendMgr::Init(int32_t currentUserId)
@@ -61,6 +62,14 @@ void DMSContinueSendMgr::Init(int32_t currentUserId)
         strategyMap_[MISSION_EVENT_TIMEOUT] = std::make_shared<SendStrategyTimeout>(shared_from_this());
         strategyMap_[MISSION_EVENT_MMI] = std::make_shared<SendStrategyMMI>(shared_from_this());
 
+        sendScheduler_ = std::make_shared<DmsContinueSendScheduler>(
+            [this](const ContinueBroadcastInfo& info) {
+                uint16_t bundleNameId = info.bundleNameId;
+                uint8_t continueTypeId = info.continueTypeId;
+                SendSoftbusEvent(bundleNameId, continueTypeId, info.sendType);
+            },
+            []() { return GetTickCount(); });
+
         eventThread_ = std::thread(&DMSContinueSendMgr::StartEvent, this);
         std::unique_lock<std::mutex> lock(eventMutex_);
         eventCon_.wait(lock, [this] {
@@ -94,6 +103,9 @@ DMSContinueSendMgr::~DMSContinueSendMgr()
 void DMSContinueSendMgr::UnInit()
 {
     HILOGI("UnInit start");
+    if (sendScheduler_ != nullptr) {
+        sendScheduler_->Reset();
+    }
     CHECK_POINTER_RETURN(eventHandler_, "eventHandler_");
     if (eventHandler_->GetEventRunner() != nullptr) {
         eventHandler_->GetEventRunner()->Stop();
@@ -215,7 +227,7 @@ void DMSContinueSendMgr::SendContinueBroadcast(const MissionStatus& status, Miss
         return;
     }
 
-    SendSoftbusEvent(bundleNameId, continueTypeId, sendType);
+    ScheduleBroadcast({ status.missionId, bundleNameId, continueTypeId, sendType });
     HILOGI("end");
     return;
 }
@@ -280,6 +292,42 @@ void DMSContinueSendMgr::SendSoftbusEvent(uint16_t& bundleNameId, uint8_t& conti
     SoftbusAdapter::GetInstance().SendSoftbusEvent(buffer);
 }
 
+void DMSContinueSendMgr::ScheduleBroadcast(const ContinueBroadcastInfo& info)
+{
+    if (sendScheduler_ == nullptr) {
+        uint16_t bundleNameId = info.bundleNameId;
+        uint8_t continueTypeId = info.continueTypeId;
+        SendSoftbusEvent(bundleNameId, continueTypeId, info.sendType);
+        return;
+    }
+    PostBroadcastFlush(sendScheduler_->Submit(info));
+}
+
+void DMSContinueSendMgr::PostBroadcastFlush(int64_t delay)
+{
+    if (delay == DmsContinueSendScheduler::NO_FLUSH) {
+        return;
+    }
+    CHECK_POINTER_RETURN(sendScheduler_, "sendScheduler_");
+    if (eventHandler_ == nullptr) {
+        HILOGW("eventHandler_ is nullptr, flush broadcast directly");
+        sendScheduler_->Flush();
+        return;
+    }
+    auto func = [this]() {
+        CHECK_POINTER_RETURN(sendScheduler_, "sendScheduler_");
+        PostBroadcastFlush(sendScheduler_->Flush());
+    };
+    eventHandler_->RemoveTask(BROADCAST_FLUSH_TASK);
+    eventHandler_->PostTask(func, BROADCAST_FLUSH_TASK, delay);
+}
+
+void DMSContinueSendMgr::DumpBroadcastInfo(std::string& result)
+{
+    CHECK_POINTER_RETURN(sendScheduler_, "sendScheduler_");
+    sendScheduler_->Dump(result);
+}
+
 void DMSContinueSendMgr::SendContinueBroadcastAfterDelay(int32_t missionId)
 {
     CHECK_POINTER_RETURN(eventHandler_, "eventHandler_");
@@ -354,7 +402,7 @@ int32_t DMSContinueSendMgr::SendScreenLockedEvent(uint8_t type)
         return DMS_PERMISSION_DENIED;
     }
 
-    SendSoftbusEvent(bundleNameId, continueTypeId, type);
+    ScheduleBroadcast({ status.missionId, bundleNameId, continueTypeId, type });
     HILOGI("end");
     return ERR_OK;
 }
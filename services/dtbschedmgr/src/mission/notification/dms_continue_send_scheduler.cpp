@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mission/notification/dms_continue_send_scheduler.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+#include "dtbschedmgr_log.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DmsContinueSendScheduler";
+}
+
+DmsContinueSendScheduler::DmsContinueSendScheduler(const Sender& sender, const Clock& clock)
+    : sender_(sender), clock_(clock)
+{
+    lastRefillTime_ = clock_ != nullptr ? clock_() : 0;
+}
+
+void DmsContinueSendScheduler::SetConfig(int64_t coalesceWindow, int64_t minInterval, uint32_t burst)
+{
+    HILOGI("coalesceWindow: %{public}" PRId64 ", minInterval: %{public}" PRId64 ", burst: %{public}u",
+        coalesceWindow, minInterval, burst);
+    std::lock_guard<std::mutex> lock(mutex_);
+    coalesceWindow_ = std::max<int64_t>(coalesceWindow, 0);
+    minInterval_ = std::max<int64_t>(minInterval, 0);
+    burst_ = std::max<uint32_t>(burst, 1);
+    tokens_ = burst_;
+    lastRefillTime_ = clock_ != nullptr ? clock_() : 0;
+}
+
+int64_t DmsContinueSendScheduler::Submit(const ContinueBroadcastInfo& info)
+{
+    if (clock_ == nullptr) {
+        HILOGE("clock is null");
+        return NO_FLUSH;
+    }
+    int64_t now = clock_();
+    std::lock_guard<std::mutex> lock(mutex_);
+    stat_.submittedCount++;
+    auto iter = std::find_if(pending_.begin(), pending_.end(), [&info](const PendingBroadcast& item) {
+        return item.info.missionId == info.missionId;
+    });
+    PendingBroadcast pending;
+    pending.info = info;
+    pending.firstSubmitTime = now;
+    if (iter != pending_.end()) {
+        // keep the original submit time so a flapping mission can not postpone its broadcast forever
+        pending.firstSubmitTime = iter->firstSubmitTime;
+        pending.isCoalesced = true;
+        pending_.erase(iter);
+        stat_.coalescedCount++;
+        HILOGI("missionId %{public}d coalesced, sendType: %{public}u", info.missionId, info.sendType);
+    }
+    pending_.push_back(pending);
+    return NextFlushDelayLocked(now);
+}
+
+int64_t DmsContinueSendScheduler::Flush()
+{
+    if (clock_ == nullptr) {
+        HILOGE("clock is null");
+        return NO_FLUSH;
+    }
+    int64_t now = clock_();
+    std::vector<ContinueBroadcastInfo> toSend;
+    int64_t delay = NO_FLUSH;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        RefillTokensLocked(now);
+        while (!pending_.empty()) {
+            PendingBroadcast& head = pending_.front();
+            if (now - head.firstSubmitTime < coalesceWindow_) {
+                break;
+            }
+            if (head.isCoalesced && lastSentInfo_ == head.info) {
+                // the burst ended where it started, peers still hold this state
+                stat_.unchangedCount++;
+                pending_.pop_front();
+                continue;
+            }
+            if (tokens_ == 0) {
+                if (!head.isThrottled) {
+                    head.isThrottled = true;
+                    stat_.throttledCount++;
+                }
+                break;
+            }
+            tokens_--;
+            lastSentInfo_ = head.info;
+            toSend.push_back(head.info);
+            stat_.sentCount++;
+            pending_.pop_front();
+        }
+        delay = NextFlushDelayLocked(now);
+    }
+    if (sender_ != nullptr) {
+        for (const auto& info : toSend) {
+            sender_(info);
+        }
+    }
+    return delay;
+}
+
+void DmsContinueSendScheduler::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+    lastSentInfo_ = ContinueBroadcastInfo();
+    tokens_ = burst_;
+    lastRefillTime_ = clock_ != nullptr ? clock_() : 0;
+}
+
+ContinueBroadcastStat DmsContinueSendScheduler::GetStat()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stat_;
+}
+
+void DmsContinueSendScheduler::Dump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    result.append("continue broadcast send:\n")
+        .append("  submitted: ").append(std::to_string(stat_.submittedCount)).append("\n")
+        .append("  sent: ").append(std::to_string(stat_.sentCount)).append("\n")
+        .append("  suppressed(coalesced): ").append(std::to_string(stat_.coalescedCount)).append("\n")
+        .append("  suppressed(unchanged): ").append(std::to_string(stat_.unchangedCount)).append("\n")
+        .append("  throttled: ").append(std::to_string(stat_.throttledCount)).append("\n")
+        .append("  pending: ").append(std::to_string(pending_.size())).append("\n");
+}
+
+void DmsContinueSendScheduler::RefillTokensLocked(int64_t now)
+{
+    if (minInterval_ == 0) {
+        tokens_ = burst_;
+        lastRefillTime_ = now;
+        return;
+    }
+    if (now <= lastRefillTime_) {
+        return;
+    }
+    int64_t newTokens = (now - lastRefillTime_) / minInterval_;
+    if (newTokens <= 0) {
+        return;
+    }
+    if (newTokens >= static_cast<int64_t>(burst_ - tokens_)) {
+        tokens_ = burst_;
+        lastRefillTime_ = now;
+        return;
+    }
+    tokens_ += static_cast<uint32_t>(newTokens);
+    lastRefillTime_ += newTokens * minInterval_;
+}
+
+int64_t DmsContinueSendScheduler::NextFlushDelayLocked(int64_t now)
+{
+    if (pending_.empty()) {
+        return NO_FLUSH;
+    }
+    int64_t flushTime = pending_.front().firstSubmitTime + coalesceWindow_;
+    if (tokens_ == 0) {
+        flushTime = std::max(flushTime, lastRefillTime_ + minInterval_);
+    }
+    return std::max<int64_t>(flushTime - now, 0);
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -16,7 +16,7 @@
 
 #include "adapter/mmi_adapter.h"
 #include "datashare_manager.h"
-#include "dsched_continue_manager.h"
+#include "dms_component_registry.h"
 #include "distributed_sched_service.h"
 #include "distributed_sched_utils.h"
 #include "dtbschedmgr_log.h"
@@ -146,12 +146,11 @@ void MultiUserManager::OnUserSwitched(int32_t accountId)
     }
     if (DataShareManager::GetInstance().IsCurrentContinueSwitchOn()) {
         newSendMgr->OnDeviceOnline();
-        DSchedContinueManager::GetInstance().Init();
     } else {
         newRecvMgr->OnContinueSwitchOff();
         HILOGI("ICurrentContinueSwitch is off, %{public}d", DataShareManager::GetInstance()
             .IsCurrentContinueSwitchOn());
-        DSchedContinueManager::GetInstance().UnInit();
+        DmsComponentRegistry::GetInstance().Stop(DMS_COMPONENT_CONTINUE);
     };
     UserSwitchedOnRegisterListenerCache();
     DmsContinueConditionMgr::GetInstance().OnUserSwitched(accountId);
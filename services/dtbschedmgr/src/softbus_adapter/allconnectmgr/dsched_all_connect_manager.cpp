@@ -18,6 +18,7 @@
 #include <dlfcn.h>
 
 #include "distributed_sched_utils.h"
+#include "dsched_resource_lease_manager.h"
 #include "dsched_transport_softbus_adapter.h"
 #include "dtbschedmgr_log.h"
 
@@ -26,6 +27,8 @@ namespace DistributedSchedule {
 namespace {
 const std::string TAG = "DSchedAllConnectManager";
 constexpr int32_t CONNECT_DECISION_WAIT_S = 60;
+constexpr int64_t CONNECT_DECISION_REUSE_MS = 3000;
+const std::string APPLY_TIMEOUT_TASK = "AllConnectApplyTimeout_";
 }
 
 IMPLEMENT_SINGLE_INSTANCE(DSchedAllConnectManager);
@@ -45,11 +48,17 @@ ServiceCollaborationManager_CommunicationRequestInfo DSchedAllConnectManager::co
     .maxWaitTime = 0,
     .dataType = "DATA_TYPE_BYTES",
 };
-std::queue<std::string> DSchedAllConnectManager::peerConnectCbQueue_;
+const std::array<DSchedAllConnectManager::ApplyResultFunc, DSchedAllConnectManager::MAX_APPLY_REQUEST>
+    DSchedAllConnectManager::APPLY_RESULT_FUNCS =
+    MakeApplyResultFuncs(std::make_integer_sequence<int32_t, DSchedAllConnectManager::MAX_APPLY_REQUEST>());
 
 int32_t DSchedAllConnectManager::InitAllConnectManager()
 {
     HILOGI("Init bind manager.");
+    if (eventHandler_ == nullptr) {
+        auto runner = AppExecFwk::EventRunner::Create("DSchedAllConnectManager");
+        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
     int32_t ret = GetServiceCollaborationManagerProxy();
     if (ret != ERR_OK) {
         HILOGE("GetServiceCollaborationManagerProxy fail, ret %{public}d.", ret);
@@ -187,6 +196,9 @@ int32_t DSchedAllConnectManager::PublishServiceState(const std::string &peerNetw
         return INVALID_PARAMETERS_ERR;
     }
 
+    if (state == SCM_IDLE) {
+        InvalidateConnectDecision(peerNetworkId);
+    }
     int32_t ret = allConnectMgrApi_.ServiceCollaborationManager_PublishServiceState(peerNetworkId.c_str(),
         DMS_BIND_MGR_SRV_NAME, extraInfo.c_str(), state);
     if (ret != ERR_OK) {
@@ -195,64 +207,174 @@ int32_t DSchedAllConnectManager::PublishServiceState(const std::string &peerNetw
     return ret;
 }
 
-int32_t DSchedAllConnectManager::ApplyAdvanceResource(const std::string &peerNetworkId,
-    ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets)
+int32_t DSchedAllConnectManager::ApplyAdvanceResourceAsync(const std::string &peerNetworkId,
+    ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets, const AllConnectApplyCallback &callback)
 {
-    int32_t ret = ERR_OK;
+    HILOGI("Apply advance resource enter, peerNetworkId %{public}s.", GetAnonymStr(peerNetworkId).c_str());
+    if (callback == nullptr) {
+        HILOGE("Apply advance resource callback is null.");
+        return INVALID_PARAMETERS_ERR;
+    }
     {
         std::lock_guard<std::mutex> autoLock(allConnectMgrLock_);
-        HILOGI("Apply advance resource enter, peerNetworkId %{public}s.", GetAnonymStr(peerNetworkId).c_str());
         if (allConnectMgrApi_.ServiceCollaborationManager_ApplyAdvancedResource == nullptr) {
             HILOGE("Dms all connect manager ApplyAdvancedResource api is null.");
+            callback(ERR_OK);
             return ERR_OK;
         }
+    }
 
-        peerConnectCbQueue_.push(peerNetworkId);
+    bool isReused = false;
+    int32_t requestId = -1;
+    uint64_t seq = 0;
+    {
+        std::lock_guard<std::mutex> requestLock(applyRequestMutex_);
+        if (IsDecisionReusableLocked(peerNetworkId)) {
+            HILOGI("Reuse all connect decision, peerNetworkId %{public}s.", GetAnonymStr(peerNetworkId).c_str());
+            isReused = true;
+        } else {
+            for (int32_t i = 0; i < MAX_APPLY_REQUEST; i++) {
+                if (applyRequests_[i].inUse && applyRequests_[i].peerNetworkId == peerNetworkId) {
+                    HILOGI("Join in flight apply request %{public}d, peerNetworkId %{public}s.", i,
+                        GetAnonymStr(peerNetworkId).c_str());
+                    applyRequests_[i].callbacks.push_back(callback);
+                    return ERR_OK;
+                }
+            }
+            requestId = AllocApplyRequestLocked(peerNetworkId, callback);
+            if (requestId < 0) {
+                HILOGE("Too many apply requests in flight, peerNetworkId %{public}s.",
+                    GetAnonymStr(peerNetworkId).c_str());
+                return DMS_CONNECT_APPLY_BUSY_FAILED;
+            }
+            seq = applyRequests_[requestId].seq;
+        }
+    }
+    if (isReused) {
+        callback(ERR_OK);
+        return ERR_OK;
+    }
+
+    // the arbiter may answer before Apply returns, OnApplyResult never takes allConnectMgrLock_
+    PostApplyTimeout(requestId, seq);
+    int32_t ret = ERR_OK;
+    {
+        std::lock_guard<std::mutex> autoLock(allConnectMgrLock_);
         ServiceCollaborationManager_Callback applyScmCbApi = {
             .OnStop = &DSchedAllConnectManager::OnStop,
-            .ApplyResult = &DSchedAllConnectManager::ApplyResult,
+            .ApplyResult = APPLY_RESULT_FUNCS[requestId],
         };
-        ret = allConnectMgrApi_.ServiceCollaborationManager_ApplyAdvancedResource(peerNetworkId.c_str(),
+        ret = allConnectMgrApi_.ServiceCollaborationManager_ApplyAdvancedResource == nullptr ? INVALID_PARAMETERS_ERR :
+            allConnectMgrApi_.ServiceCollaborationManager_ApplyAdvancedResource(peerNetworkId.c_str(),
             DMS_BIND_MGR_SRV_NAME, &reqInfoSets, &applyScmCbApi);
-        if (ret != ERR_OK) {
-            HILOGE("Dms all connect manager apply advanced resource fail, ret %{public}d.", ret);
-            return ret;
-        }
     }
-
-    ret = WaitAllConnectApplyCb(peerNetworkId);
     if (ret != ERR_OK) {
-        HILOGE("Wait all connect manager apply callback fail, ret %{public}d.", ret);
+        HILOGE("Dms all connect manager apply advanced resource fail, ret %{public}d.", ret);
+        FinishApplyRequest(requestId, seq, ret, true);
     }
     return ret;
 }
 
-int32_t DSchedAllConnectManager::WaitAllConnectApplyCb(const std::string &peerNetworkId)
+bool DSchedAllConnectManager::IsDecisionReusableLocked(const std::string &peerNetworkId)
 {
-    std::unique_lock<std::mutex> decisionLock(connectDecisionMutex_);
-    connectDecisionCond_.wait_for(decisionLock, std::chrono::seconds(CONNECT_DECISION_WAIT_S),
-        [this, peerNetworkId]() {
-            return peerConnectDecision_.find(peerNetworkId) != peerConnectDecision_.end();
-        });
-
-    if (peerConnectDecision_.find(peerNetworkId) == peerConnectDecision_.end()) {
-        HILOGE("Not find peerNetworkId %{public}s in peerConnectDecision.", GetAnonymStr(peerNetworkId).c_str());
-        return DMS_CONNECT_APPLY_TIMEOUT_FAILED;
-    }
-    int32_t ret = peerConnectDecision_.at(peerNetworkId).load() ? ERR_OK : DMS_CONNECT_APPLY_REJECT_FAILED;
-    HILOGI("Wait all connect apply decision callback end, peerNetworkId %{public}s, isSupport %{public}d.",
-        GetAnonymStr(peerNetworkId).c_str(), peerConnectDecision_.at(peerNetworkId).load());
-    peerConnectDecision_.erase(peerNetworkId);
-    return ret;
+    auto iter = peerConnectDecision_.find(peerNetworkId);
+    if (iter == peerConnectDecision_.end()) {
+        return false;
+    }
+    if (std::chrono::steady_clock::now() - iter->second > std::chrono::milliseconds(CONNECT_DECISION_REUSE_MS)) {
+        peerConnectDecision_.erase(iter);
+        return false;
+    }
+    return true;
 }
 
-void DSchedAllConnectManager::NotifyAllConnectDecision(const std::string &peerNetworkId, bool isSupport)
+int32_t DSchedAllConnectManager::AllocApplyRequestLocked(const std::string &peerNetworkId,
+    const AllConnectApplyCallback &callback)
 {
-    HILOGI("Notify all connect decision, peerNetworkId %{public}s, isSupport %{public}d.",
-        GetAnonymStr(peerNetworkId).c_str(), isSupport);
-    std::lock_guard<std::mutex> decisionLock(connectDecisionMutex_);
-    peerConnectDecision_[peerNetworkId] = isSupport;
-    connectDecisionCond_.notify_all();
+    for (int32_t i = 0; i < MAX_APPLY_REQUEST; i++) {
+        ApplyRequest &request = applyRequests_[i];
+        if (request.inUse) {
+            continue;
+        }
+        request.inUse = true;
+        request.seq = ++applySeq_;
+        request.peerNetworkId = peerNetworkId;
+        request.callbacks = { callback };
+        return i;
+    }
+    return -1;
+}
+
+void DSchedAllConnectManager::PostApplyTimeout(int32_t requestId, uint64_t seq)
+{
+    if (eventHandler_ == nullptr) {
+        HILOGW("Event handler is null, apply request %{public}d has no timeout.", requestId);
+        return;
+    }
+    auto func = [this, requestId, seq]() {
+        HILOGE("Apply request %{public}d timeout.", requestId);
+        FinishApplyRequest(requestId, seq, DMS_CONNECT_APPLY_TIMEOUT_FAILED);
+    };
+    eventHandler_->PostTask(func, APPLY_TIMEOUT_TASK + std::to_string(seq),
+        static_cast<int64_t>(CONNECT_DECISION_WAIT_S) * 1000);
+}
+
+void DSchedAllConnectManager::FinishApplyRequest(int32_t requestId, uint64_t seq, int32_t result, bool skipIssuer)
+{
+    if (requestId < 0 || requestId >= MAX_APPLY_REQUEST) {
+        return;
+    }
+    std::vector<AllConnectApplyCallback> callbacks;
+    std::string peerNetworkId;
+    {
+        std::lock_guard<std::mutex> requestLock(applyRequestMutex_);
+        ApplyRequest &request = applyRequests_[requestId];
+        if (!request.inUse || request.seq != seq) {
+            return;
+        }
+        callbacks.swap(request.callbacks);
+        peerNetworkId = std::move(request.peerNetworkId);
+        request.inUse = false;
+        if (result == ERR_OK) {
+            peerConnectDecision_[peerNetworkId] = std::chrono::steady_clock::now();
+        } else {
+            peerConnectDecision_.erase(peerNetworkId);
+        }
+    }
+    if (eventHandler_ != nullptr) {
+        eventHandler_->RemoveTask(APPLY_TIMEOUT_TASK + std::to_string(seq));
+    }
+    HILOGI("Notify all connect decision, peerNetworkId %{public}s, result %{public}d, waiters %{public}zu.",
+        GetAnonymStr(peerNetworkId).c_str(), result, callbacks.size());
+    for (size_t i = skipIssuer ? 1 : 0; i < callbacks.size(); i++) {
+        callbacks[i](result);
+    }
+}
+
+int32_t DSchedAllConnectManager::OnApplyResult(int32_t requestId, int32_t errorcode, int32_t result,
+    const char *reason)
+{
+    HILOGI("Apply result start, requestId %{public}d, errorcode %{public}d, result %{public}s, reason %{public}s.",
+        requestId, errorcode, result == ServiceCollaborationManagerResultCode::PASS ? "PASS" : "REJECT",
+        reason == nullptr ? "" : reason);
+    uint64_t seq = 0;
+    {
+        std::lock_guard<std::mutex> requestLock(applyRequestMutex_);
+        if (requestId < 0 || requestId >= MAX_APPLY_REQUEST || !applyRequests_[requestId].inUse) {
+            HILOGW("Apply request %{public}d is not in flight.", requestId);
+            return ERR_OK;
+        }
+        seq = applyRequests_[requestId].seq;
+    }
+    FinishApplyRequest(requestId, seq, result == ServiceCollaborationManagerResultCode::PASS ?
+        ERR_OK : DMS_CONNECT_APPLY_REJECT_FAILED);
+    return ERR_OK;
+}
+
+void DSchedAllConnectManager::InvalidateConnectDecision(const std::string &peerNetworkId)
+{
+    std::lock_guard<std::mutex> requestLock(applyRequestMutex_);
+    peerConnectDecision_.erase(peerNetworkId);
 }
 
 void DSchedAllConnectManager::GetResourceRequest(ServiceCollaborationManager_ResourceRequestInfoSets &reqInfoSets)
@@ -268,29 +390,48 @@ int32_t DSchedAllConnectManager::OnStop(const char *peerNetworkId)
 {
     HILOGI("OnStop, when other task prepare to seize bind, disconnect DMS bind with peerNetworkId %{public}s.",
         GetAnonymStr(peerNetworkId).c_str());
+    DSchedAllConnectManager::GetInstance().InvalidateConnectDecision(peerNetworkId);
     int32_t sessionId = -1;
     if (!DSchedTransportSoftbusAdapter::GetInstance().GetSessionIdByDeviceId(peerNetworkId, sessionId)) {
         HILOGW("Not find any sessionId by peerNetworkId %{public}s.", GetAnonymStr(peerNetworkId).c_str());
+        // no session to shut down, but a lease in its idle grace period still holds the resources
+        DSchedResourceLeaseManager::GetInstance().Revoke(peerNetworkId);
         return ERR_OK;
     }
+    // the shutdown revokes the lease of the peer
     DSchedTransportSoftbusAdapter::GetInstance().OnShutdown(sessionId, false);
     return ERR_OK;
 }
 
 int32_t DSchedAllConnectManager::ApplyResult(int32_t errorcode, int32_t result, const char *reason)
 {
-    HILOGI("Apply result start, errorcode %{public}d, result %{public}s, reason %{public}s.",
-        errorcode, result == ServiceCollaborationManagerResultCode::PASS ? "PASS" : "REJECT", reason);
-
-    bool isSupport = result == ServiceCollaborationManagerResultCode::PASS ? true : false;
-    if (peerConnectCbQueue_.empty()) {
-        HILOGE("Apply result start, peerConnectCbQueue is empty.");
+    // lifecycle callback without a request id, only unambiguous while a single request is in flight
+    DSchedAllConnectManager &manager = DSchedAllConnectManager::GetInstance();
+    int32_t requestId = -1;
+    {
+        std::lock_guard<std::mutex> requestLock(manager.applyRequestMutex_);
+        for (int32_t i = 0; i < MAX_APPLY_REQUEST; i++) {
+            if (!manager.applyRequests_[i].inUse) {
+                continue;
+            }
+            if (requestId >= 0) {
+                HILOGE("Apply result without request id while several requests in flight, ignore.");
+                return ERR_OK;
+            }
+            requestId = i;
+        }
+    }
+    if (requestId < 0) {
+        HILOGE("Apply result start, no apply request in flight.");
         return ERR_OK;
     }
-    std::string peerNetworkId = peerConnectCbQueue_.front();
-    DSchedAllConnectManager::GetInstance().NotifyAllConnectDecision(peerNetworkId, isSupport);
-    peerConnectCbQueue_.pop();
-    return ERR_OK;
+    return manager.OnApplyResult(requestId, errorcode, result, reason);
+}
+
+template<int32_t REQUEST_ID>
+int32_t DSchedAllConnectManager::ApplyResultForRequest(int32_t errorcode, int32_t result, const char *reason)
+{
+    return DSchedAllConnectManager::GetInstance().OnApplyResult(REQUEST_ID, errorcode, result, reason);
 }
 } // namespace DistributedSchedule
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
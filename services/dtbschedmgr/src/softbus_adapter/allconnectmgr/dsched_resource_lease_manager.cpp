@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_resource_lease_manager.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "distributed_sched_utils.h"
+#include "dsched_all_connect_manager.h"
+#include "dtbschedmgr_log.h"
+#include "parameters.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DSchedResourceLeaseManager";
+const std::string LEASE_RELEASE_TASK = "ResourceLeaseRelease_";
+const std::string PARAM_LEASE_IDLE_GRACE = "persist.distributed_scene.resource_lease_idle_grace_ms";
+}
+
+IMPLEMENT_SINGLE_INSTANCE(DSchedResourceLeaseManager);
+
+void DSchedResourceLeaseManager::Init()
+{
+    HILOGI("Init resource lease manager.");
+    SetIdleGracePeriod(OHOS::system::GetIntParameter(PARAM_LEASE_IDLE_GRACE, DEFAULT_IDLE_GRACE_MS));
+    std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+    if (eventHandler_ == nullptr) {
+        auto runner = AppExecFwk::EventRunner::Create("DSchedResourceLease");
+        eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+}
+
+void DSchedResourceLeaseManager::UnInit()
+{
+    HILOGI("UnInit resource lease manager.");
+    std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+    if (eventHandler_ != nullptr) {
+        eventHandler_->RemoveAllEvents();
+        eventHandler_ = nullptr;
+    }
+    leases_.clear();
+}
+
+int32_t DSchedResourceLeaseManager::AcquireAsync(const std::string &peerNetworkId, DSchedServiceType type,
+    const ResourceLeaseCallback &callback)
+{
+    if (callback == nullptr) {
+        HILOGE("Acquire resource lease callback is null.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    bool isReused = false;
+    {
+        std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+        auto iter = leases_.find(peerNetworkId);
+        if (iter != leases_.end() && iter->second.isHeld) {
+            ResourceLease &lease = iter->second;
+            lease.stat.reused++;
+            AddRefLocked(lease, type);
+            HILOGI("Reuse resource lease, peerNetworkId %{public}s, refCount %{public}d.",
+                GetAnonymStr(peerNetworkId).c_str(), lease.stat.refCount);
+            isReused = true;
+        }
+    }
+    if (isReused) {
+        callback(ERR_OK);
+        return ERR_OK;
+    }
+
+    // concurrent first acquirers of one peer join a single application in DSchedAllConnectManager
+    ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets;
+    DSchedAllConnectManager::GetInstance().GetResourceRequest(reqInfoSets);
+    int32_t ret = DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync(peerNetworkId, reqInfoSets,
+        [this, peerNetworkId, type, callback](int32_t result) {
+            PostNegotiateResult(peerNetworkId, type, result, callback);
+        });
+    if (ret != ERR_OK) {
+        HILOGE("Apply advance resource fail, ret %{public}d, peerNetworkId %{public}s.",
+            ret, GetAnonymStr(peerNetworkId).c_str());
+    }
+    return ret;
+}
+
+void DSchedResourceLeaseManager::AddRefLocked(ResourceLease &lease, DSchedServiceType type)
+{
+    lease.generation = ++nextGeneration_;
+    lease.stat.refCount++;
+    if (type == SERVICE_TYPE_COLLAB) {
+        lease.stat.collabAcquired++;
+    } else {
+        lease.stat.continueAcquired++;
+    }
+}
+
+void DSchedResourceLeaseManager::PostNegotiateResult(const std::string &peerNetworkId, DSchedServiceType type,
+    int32_t result, const ResourceLeaseCallback &callback)
+{
+    // the answer comes on the arbiter thread or inline under the all-connect lock, so nothing that publishes
+    // or connects may run here
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler;
+    {
+        std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+        eventHandler = eventHandler_;
+    }
+    auto func = [this, peerNetworkId, type, result, callback]() {
+        OnNegotiateResult(peerNetworkId, type, result, callback);
+    };
+    if (eventHandler == nullptr || !eventHandler->PostTask(func)) {
+        HILOGE("Post negotiate result fail, peerNetworkId %{public}s.", GetAnonymStr(peerNetworkId).c_str());
+        callback(INVALID_PARAMETERS_ERR);
+    }
+}
+
+void DSchedResourceLeaseManager::OnNegotiateResult(const std::string &peerNetworkId, DSchedServiceType type,
+    int32_t result, const ResourceLeaseCallback &callback)
+{
+    if (result != ERR_OK) {
+        HILOGE("Negotiate resource lease fail, ret %{public}d, peerNetworkId %{public}s.",
+            result, GetAnonymStr(peerNetworkId).c_str());
+        callback(result);
+        return;
+    }
+    bool isNegotiated = false;
+    {
+        std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+        ResourceLease &lease = leases_[peerNetworkId];
+        if (!lease.isHeld) {
+            lease.isHeld = true;
+            lease.stat.negotiated++;
+            isNegotiated = true;
+        } else {
+            lease.stat.reused++;
+        }
+        AddRefLocked(lease, type);
+        HILOGI("Acquire resource lease, peerNetworkId %{public}s, refCount %{public}d.",
+            GetAnonymStr(peerNetworkId).c_str(), lease.stat.refCount);
+    }
+    if (isNegotiated) {
+        int32_t ret = DSchedAllConnectManager::GetInstance().PublishServiceState(peerNetworkId, "", SCM_PREPARE);
+        if (ret != ERR_OK) {
+            HILOGE("Publish prepare state fail, ret %{public}d, peerNetworkId %{public}s.",
+                ret, GetAnonymStr(peerNetworkId).c_str());
+        }
+    }
+    callback(ERR_OK);
+}
+
+void DSchedResourceLeaseManager::Release(const std::string &peerNetworkId)
+{
+    bool isHeld = false;
+    uint64_t generation = 0;
+    int64_t idleGraceMs = 0;
+    {
+        std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+        auto iter = leases_.find(peerNetworkId);
+        if (iter == leases_.end() || !iter->second.isHeld || iter->second.stat.refCount <= 0) {
+            HILOGW("No resource lease held, peerNetworkId %{public}s.", GetAnonymStr(peerNetworkId).c_str());
+        } else {
+            ResourceLease &lease = iter->second;
+            lease.stat.refCount--;
+            lease.stat.released++;
+            HILOGI("Release resource lease, peerNetworkId %{public}s, refCount %{public}d.",
+                GetAnonymStr(peerNetworkId).c_str(), lease.stat.refCount);
+            if (lease.stat.refCount > 0) {
+                return;
+            }
+            lease.generation = ++nextGeneration_;
+            isHeld = true;
+            generation = lease.generation;
+            idleGraceMs = idleGraceMs_;
+        }
+    }
+    if (!isHeld) {
+        DSchedAllConnectManager::GetInstance().PublishServiceState(peerNetworkId, "", SCM_IDLE);
+        return;
+    }
+    PostIdleRelease(peerNetworkId, generation, idleGraceMs);
+}
+
+void DSchedResourceLeaseManager::PostIdleRelease(const std::string &peerNetworkId, uint64_t generation,
+    int64_t idleGraceMs)
+{
+    std::shared_ptr<AppExecFwk::EventHandler> eventHandler;
+    {
+        std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+        eventHandler = eventHandler_;
+    }
+    if (eventHandler == nullptr || idleGraceMs <= 0) {
+        OnIdleRelease(peerNetworkId, generation);
+        return;
+    }
+    auto func = [this, peerNetworkId, generation]() {
+        OnIdleRelease(peerNetworkId, generation);
+    };
+    if (!eventHandler->PostTask(func, LEASE_RELEASE_TASK + std::to_string(generation), idleGraceMs)) {
+        HILOGE("Post idle release fail, release now, peerNetworkId %{public}s.",
+            GetAnonymStr(peerNetworkId).c_str());
+        OnIdleRelease(peerNetworkId, generation);
+    }
+}
+
+void DSchedResourceLeaseManager::OnIdleRelease(const std::string &peerNetworkId, uint64_t generation)
+{
+    {
+        std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+        auto iter = leases_.find(peerNetworkId);
+        // reacquired or revoked in the meantime
+        if (iter == leases_.end() || !iter->second.isHeld || iter->second.generation != generation ||
+            iter->second.stat.refCount > 0) {
+            return;
+        }
+        iter->second.isHeld = false;
+    }
+    HILOGI("Resource lease idle, peerNetworkId %{public}s.", GetAnonymStr(peerNetworkId).c_str());
+    int32_t ret = DSchedAllConnectManager::GetInstance().PublishServiceState(peerNetworkId, "", SCM_IDLE);
+    if (ret != ERR_OK) {
+        HILOGE("Publish idle state fail, ret %{public}d, peerNetworkId %{public}s.",
+            ret, GetAnonymStr(peerNetworkId).c_str());
+    }
+}
+
+void DSchedResourceLeaseManager::Revoke(const std::string &peerNetworkId)
+{
+    {
+        std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+        auto iter = leases_.find(peerNetworkId);
+        if (iter != leases_.end()) {
+            ResourceLease &lease = iter->second;
+            HILOGI("Revoke resource lease, peerNetworkId %{public}s, refCount %{public}d.",
+                GetAnonymStr(peerNetworkId).c_str(), lease.stat.refCount);
+            lease.isHeld = false;
+            lease.generation = ++nextGeneration_;
+            lease.stat.refCount = 0;
+        }
+    }
+    int32_t ret = DSchedAllConnectManager::GetInstance().PublishServiceState(peerNetworkId, "", SCM_IDLE);
+    if (ret != ERR_OK) {
+        HILOGE("Publish idle state fail, ret %{public}d, peerNetworkId %{public}s.",
+            ret, GetAnonymStr(peerNetworkId).c_str());
+    }
+}
+
+void DSchedResourceLeaseManager::SetIdleGracePeriod(int64_t idleGraceMs)
+{
+    HILOGI("resource lease idle grace: %{public}" PRId64 " ms.", idleGraceMs);
+    std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+    idleGraceMs_ = std::clamp<int64_t>(idleGraceMs, 0, MAX_IDLE_GRACE_MS);
+}
+
+int64_t DSchedResourceLeaseManager::GetIdleGracePeriod()
+{
+    std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+    return idleGraceMs_;
+}
+
+DSchedResourceLeaseStat DSchedResourceLeaseManager::GetLeaseStat(const std::string &peerNetworkId)
+{
+    std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+    auto iter = leases_.find(peerNetworkId);
+    return iter == leases_.end() ? DSchedResourceLeaseStat() : iter->second.stat;
+}
+
+void DSchedResourceLeaseManager::Dump(std::string &result)
+{
+    std::lock_guard<std::mutex> leaseLock(leaseMutex_);
+    result.append("resource lease (idle grace ").append(std::to_string(idleGraceMs_)).append(" ms):\n");
+    for (const auto &[peerNetworkId, lease] : leases_) {
+        result.append("  ").append(GetAnonymStr(peerNetworkId)).append(": ")
+            .append(lease.isHeld ? "held" : "idle")
+            .append(", ref ").append(std::to_string(lease.stat.refCount))
+            .append(", continue ").append(std::to_string(lease.stat.continueAcquired))
+            .append(", collab ").append(std::to_string(lease.stat.collabAcquired))
+            .append(", negotiated ").append(std::to_string(lease.stat.negotiated))
+            .append(", reused ").append(std::to_string(lease.stat.reused))
+            .append(", released ").append(std::to_string(lease.stat.released)).append("\n");
+    }
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
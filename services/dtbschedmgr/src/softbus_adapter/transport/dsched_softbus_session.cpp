@@ -19,6 +19,7 @@
 
 #include "distributed_sched_adapter.h"
 #include "distributed_sched_utils.h"
+#include "dms_log_limiter.h"
 #include "dsched_transport_softbus_adapter.h"
 #include "dtbschedmgr_log.h"
 #include "session.h"
@@ -76,7 +77,7 @@ bool DSchedSoftbusSession::OnDisconnect()
 
 int32_t DSchedSoftbusSession::OnBytesReceived(std::shared_ptr<DSchedDataBuffer> buffer)
 {
-    HILOGD("called");
+    HILOGD_LIMITED("called");
     if (buffer == nullptr) {
         HILOGE("buffer is null");
         return INVALID_PARAMETERS_ERR;
@@ -87,7 +88,7 @@ int32_t DSchedSoftbusSession::OnBytesReceived(std::shared_ptr<DSchedDataBuffer>
 
 int32_t DSchedSoftbusSession::SendData(std::shared_ptr<DSchedDataBuffer> buffer, int32_t dataType)
 {
-    HILOGD("called");
+    HILOGD_LIMITED("called");
     if (buffer == nullptr) {
         HILOGE("buffer is null");
         return INVALID_PARAMETERS_ERR;
@@ -127,7 +128,7 @@ void DSchedSoftbusSession::PackRecvData(std::shared_ptr<DSchedDataBuffer> buffer
         return;
     }
     bufferSize = static_cast<uint64_t>(buffer->Size());
-    HILOGD("pack recv data Assemble, size: %" PRIu64", dataLen: %{public}d, totalLen: %{public}d, nowTime: "
+    HILOGD_LIMITED("pack recv data Assemble, size: %" PRIu64", dataLen: %{public}d, totalLen: %{public}d, nowTime: "
         "%" PRId64" start", bufferSize, headerPara.dataLen, headerPara.totalLen, GetNowTimeStampUs());
     if (headerPara.fragFlag == FRAG_START_END) {
         AssembleNoFrag(buffer, headerPara);
@@ -135,7 +136,7 @@ void DSchedSoftbusSession::PackRecvData(std::shared_ptr<DSchedDataBuffer> buffer
         AssembleFrag(buffer, headerPara);
     }
     bufferSize = static_cast<uint64_t>(buffer->Size());
-    HILOGD("pack recv data Assemble, size: %" PRIu64", dataLen: %{public}d, totalLen: %{public}d, nowTime: "
+    HILOGD_LIMITED("pack recv data Assemble, size: %" PRIu64", dataLen: %{public}d, totalLen: %{public}d, nowTime: "
         "%" PRId64" end", bufferSize, headerPara.dataLen, headerPara.totalLen, GetNowTimeStampUs());
 }
 
@@ -333,7 +334,8 @@ int32_t DSchedSoftbusSession::UnPackSendData(std::shared_ptr<DSchedDataBuffer> b
         HILOGE("GetSessionOption get maxSendSize failed, ret: %{public}d, session: %{public}d", ret, sessionId_);
         return ret;
     }
-    HILOGD("GetSessionOption get max SendBytes size: %{public}u, session: %{public}d", maxSendSize, sessionId_);
+    HILOGD_LIMITED("GetSessionOption get max SendBytes size: %{public}u, session: %{public}d", maxSendSize,
+        sessionId_);
 
     if (buffer->Size() <= maxSendSize) {
         return UnPackStartEndData(buffer, dataType);
@@ -352,7 +354,7 @@ int32_t DSchedSoftbusSession::UnPackSendData(std::shared_ptr<DSchedDataBuffer> b
         }
         SetHeadParaDataLen(headPara, totalLen, offset, maxSendSize);
         bufferSize = static_cast<uint64_t>(buffer->Size());
-        HILOGD("size: %" PRIu64", dataLen: %{public}d, totalLen: %{public}d, nowTime: %" PRId64" start:",
+        HILOGD_LIMITED("size: %" PRIu64", dataLen: %{public}d, totalLen: %{public}d, nowTime: %" PRId64" start:",
             bufferSize, headPara.dataLen, headPara.totalLen, GetNowTimeStampUs());
 
         auto unpackData = std::make_shared<DSchedDataBuffer>(headPara.dataLen + BINARY_HEADER_FRAG_LEN);
@@ -379,7 +381,8 @@ int32_t DSchedSoftbusSession::UnPackSendData(std::shared_ptr<DSchedDataBuffer> b
             HILOGE("GetSessionOption get maxSendSize failed, ret: %{public}d, session: %{public}d", ret, sessionId_);
             return ret;
         }
-        HILOGD("GetSessionOption get next SendBytes size: %{public}u, session: %{public}d", maxSendSize, sessionId_);
+        HILOGD_LIMITED("GetSessionOption get next SendBytes size: %{public}u, session: %{public}d", maxSendSize,
+            sessionId_);
     }
     return ERR_OK;
 }
@@ -15,10 +15,16 @@
 
 #include "dsched_transport_softbus_adapter.h"
 
+#include <sys/prctl.h>
+#include <thread>
+
+#include "dfx/dms_latency_histogram.h"
 #include "distributed_sched_utils.h"
+#include "dms_log_limiter.h"
 #include "dsched_all_connect_manager.h"
 #include "dsched_collab_manager.h"
 #include "dsched_continue_manager.h"
+#include "dsched_resource_lease_manager.h"
 #include "dtbschedmgr_device_info_storage.h"
 #include "dtbschedmgr_log.h"
 #include "mission/wifi_state_adapter.h"
@@ -32,6 +38,7 @@ namespace DistributedSchedule {
 namespace {
 const std::string TAG = "DSchedTransportSoftbusAdapter";
 constexpr int32_t INVALID_SESSION_ID = -1;
+const std::string DSCHED_CONNECT_THREAD = "DSchedConnect";
 }
 
 IMPLEMENT_SINGLE_INSTANCE(DSchedTransportSoftbusAdapter);
@@ -75,6 +82,10 @@ DSchedTransportSoftbusAdapter::~DSchedTransportSoftbusAdapter()
 int32_t DSchedTransportSoftbusAdapter::InitChannel()
 {
     HILOGI("start init channel");
+    if (serverSocket_ > 0) {
+        HILOGI("channel already inited, server socket: %{public}d", serverSocket_);
+        return ERR_OK;
+    }
     int32_t ret = ERR_OK;
 #ifdef DMSFWK_ALL_CONNECT_MGR
     ret = DSchedAllConnectManager::GetInstance().InitAllConnectManager();
@@ -82,6 +93,7 @@ int32_t DSchedTransportSoftbusAdapter::InitChannel()
         HILOGE("Init all connect manager fail, ret: %{public}d.", ret);
         isAllConnectExist_ = false;
     }
+    DSchedResourceLeaseManager::GetInstance().Init();
 #endif
 
     serverSocket_ = CreateServerSocket();
@@ -113,40 +125,75 @@ int32_t DSchedTransportSoftbusAdapter::CreateServerSocket()
     return socket;
 }
 
-int32_t DSchedTransportSoftbusAdapter::ConnectDevice(const std::string &peerDeviceId,
-    int32_t &sessionId, DSchedServiceType type)
+int32_t DSchedTransportSoftbusAdapter::ConnectDeviceAsync(const std::string &peerDeviceId,
+    DSchedServiceType type, const ConnectCallback &callback)
 {
     HILOGI("try to connect peer: %{public}s.", GetAnonymStr(peerDeviceId).c_str());
+    if (callback == nullptr) {
+        HILOGE("connect callback is null.");
+        return INVALID_PARAMETERS_ERR;
+    }
+    int32_t sessionId = INVALID_SESSION_ID;
     {
         std::lock_guard<std::mutex> sessionLock(sessionMutex_);
-        if (!sessions_.empty()) {
-            for (auto iter = sessions_.begin(); iter != sessions_.end(); iter++) {
-                if (iter->second != nullptr && peerDeviceId == iter->second->GetPeerDeviceId()) {
-                    HILOGI("peer device already connected");
-                    iter->second->OnConnect();
-                    sessionId = iter->first;
+        for (auto iter = sessions_.begin(); iter != sessions_.end(); iter++) {
+            if (iter->second != nullptr && peerDeviceId == iter->second->GetPeerDeviceId()) {
+                HILOGI("peer device already connected");
+                iter->second->OnConnect();
+                sessionId = iter->first;
 #ifdef DMSFWK_ALL_CONNECT_MGR
-                    NotifyConnectDecision(peerDeviceId, type);
+                NotifyConnectDecision(peerDeviceId, type);
 #endif
-                    return ERR_OK;
-                }
+                break;
             }
         }
     }
-    int32_t ret = ERR_OK;
-    if (IsNeedAllConnect(type)) {
-        HILOGI("waiting all connect decision");
-        ret = DecisionByAllConnect(peerDeviceId, type);
-        if (ret != ERR_OK) {
-            HILOGE("decision fail, ret: %{public}d", ret);
-            return ret;
-        }
+    if (sessionId != INVALID_SESSION_ID) {
+        callback(ERR_OK, sessionId);
+        return ERR_OK;
     }
-    ret = AddNewPeerSession(peerDeviceId, sessionId, type);
+    int64_t connectBeginUs = DmsLatencyRegistry::GetNowUs();
+    if (!IsNeedAllConnect(type)) {
+        ConnectNewSession(peerDeviceId, type, connectBeginUs, callback);
+        return ERR_OK;
+    }
+    HILOGI("waiting all connect decision");
+    int32_t ret = DecisionByAllConnect(peerDeviceId, type,
+        [this, peerDeviceId, type, connectBeginUs, callback](int32_t result) {
+            if (result != ERR_OK) {
+                HILOGE("decision fail, ret: %{public}d", result);
+                callback(result, INVALID_SESSION_ID);
+                return;
+            }
+            PostConnectNewSession(peerDeviceId, type, connectBeginUs, callback);
+        });
+    if (ret != ERR_OK) {
+        HILOGE("decision fail, ret: %{public}d", ret);
+    }
+    return ret;
+}
+
+void DSchedTransportSoftbusAdapter::ConnectNewSession(const std::string &peerDeviceId, DSchedServiceType type,
+    int64_t connectBeginUs, const ConnectCallback &callback)
+{
+    int32_t sessionId = INVALID_SESSION_ID;
+    int32_t ret = AddNewPeerSession(peerDeviceId, sessionId, type);
     if (ret != ERR_OK || sessionId <= 0) {
         HILOGE("Add new peer connect session fail, ret: %{public}d, sessionId: %{public}d.", ret, sessionId);
+    } else {
+        DmsLatencyRegistry::GetInstance().RecordSince(DmsLatencyStage::CONNECT, connectBeginUs);
     }
-    return ret;
+    callback(ret, sessionId);
+}
+
+void DSchedTransportSoftbusAdapter::PostConnectNewSession(const std::string &peerDeviceId, DSchedServiceType type,
+    int64_t connectBeginUs, const ConnectCallback &callback)
+{
+    // Bind blocks until the peer answers, keep it off the lease event handler so peers connect in parallel
+    std::thread([this, peerDeviceId, type, connectBeginUs, callback]() {
+        prctl(PR_SET_NAME, DSCHED_CONNECT_THREAD.c_str());
+        ConnectNewSession(peerDeviceId, type, connectBeginUs, callback);
+    }).detach();
 }
 
 void DSchedTransportSoftbusAdapter::NotifyConnectDecision(const std::string &peerDeviceId, DSchedServiceType type)
@@ -162,25 +209,27 @@ void DSchedTransportSoftbusAdapter::NotifyConnectDecision(const std::string &pee
     }
 }
 
-int32_t DSchedTransportSoftbusAdapter::DecisionByAllConnect(const std::string &peerDeviceId, DSchedServiceType type)
+int32_t DSchedTransportSoftbusAdapter::DecisionByAllConnect(const std::string &peerDeviceId, DSchedServiceType type,
+    const std::function<void(int32_t result)> &callback)
 {
 #ifdef DMSFWK_ALL_CONNECT_MGR
-    ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets;
-    DSchedAllConnectManager::GetInstance().GetResourceRequest(reqInfoSets);
-    int32_t ret = DSchedAllConnectManager::GetInstance().ApplyAdvanceResource(peerDeviceId, reqInfoSets);
+    int32_t ret = DSchedResourceLeaseManager::GetInstance().AcquireAsync(peerDeviceId, type,
+        [this, peerDeviceId, type, callback](int32_t result) {
+            NotifyConnectDecision(peerDeviceId, type);
+            if (result != ERR_OK) {
+                HILOGE("Acquire resource lease fail, ret: %{public}d.", result);
+            }
+            callback(result);
+        });
     if (ret != ERR_OK) {
-        HILOGE("Apply advance resource fail, ret: %{public}d.", ret);
+        HILOGE("Acquire resource lease fail, ret: %{public}d.", ret);
         NotifyConnectDecision(peerDeviceId, type);
-        return ret;
-    }
-    NotifyConnectDecision(peerDeviceId, type);
-    ret = DSchedAllConnectManager::GetInstance().PublishServiceState(peerDeviceId, "", SCM_PREPARE);
-    if (ret != ERR_OK) {
-        HILOGE("Publish prepare state fail, ret %{public}d, peerDeviceId %{public}s.",
-            ret, GetAnonymStr(peerDeviceId).c_str());
     }
-#endif
+    return ret;
+#else
+    callback(ERR_OK);
     return ERR_OK;
+#endif
 }
 
 bool DSchedTransportSoftbusAdapter::IsNeedAllConnect(DSchedServiceType type)
@@ -204,11 +253,7 @@ int32_t DSchedTransportSoftbusAdapter::AddNewPeerSession(const std::string &peer
     if (sessionId <= 0) {
         HILOGE("create socket failed, sessionId: %{public}d.", sessionId);
 #ifdef DMSFWK_ALL_CONNECT_MGR
-        ret = DSchedAllConnectManager::GetInstance().PublishServiceState(peerDeviceId, "", SCM_IDLE);
-        if (ret != ERR_OK) {
-            HILOGE("Publish idle state fail, ret %{public}d, peerDeviceId %{public}s, sessionId %{public}d.",
-                ret, GetAnonymStr(peerDeviceId).c_str(), sessionId);
-        }
+        DSchedResourceLeaseManager::GetInstance().Revoke(peerDeviceId);
 #endif
         return REMOTE_DEVICE_BIND_ABILITY_ERR;
     }
@@ -300,7 +345,7 @@ void DSchedTransportSoftbusAdapter::DisconnectDevice(const std::string &peerDevi
     if (sessionId != 0 && sessions_[sessionId] != nullptr && sessions_[sessionId]->OnDisconnect()) {
         HILOGI("peer %{public}s shutdown, socket sessionId: %{public}d.",
             GetAnonymStr(sessions_[sessionId]->GetPeerDeviceId()).c_str(), sessionId);
-        ShutdownSession(peerDeviceId, sessionId);
+        ShutdownSession(peerDeviceId, sessionId, true);
         sessions_.erase(sessionId);
         NotifyListenersSessionShutdown(sessionId, true);
     }
@@ -308,14 +353,35 @@ void DSchedTransportSoftbusAdapter::DisconnectDevice(const std::string &peerDevi
     return;
 }
 
-void DSchedTransportSoftbusAdapter::ShutdownSession(const std::string &peerDeviceId, int32_t sessionId)
+void DSchedTransportSoftbusAdapter::DisconnectSession(int32_t sessionId)
+{
+    HILOGI("try to disconnect socket sessionId: %{public}d.", sessionId);
+    std::lock_guard<std::mutex> sessionLock(sessionMutex_);
+    auto iter = sessions_.find(sessionId);
+    if (iter == sessions_.end() || iter->second == nullptr) {
+        HILOGW("socket sessionId %{public}d already shutdown.", sessionId);
+        return;
+    }
+    if (iter->second->OnDisconnect()) {
+        std::string peerDeviceId = iter->second->GetPeerDeviceId();
+        HILOGI("peer %{public}s shutdown, socket sessionId: %{public}d.", GetAnonymStr(peerDeviceId).c_str(),
+            sessionId);
+        ShutdownSession(peerDeviceId, sessionId, true);
+        sessions_.erase(iter);
+        NotifyListenersSessionShutdown(sessionId, true);
+    }
+}
+
+void DSchedTransportSoftbusAdapter::ShutdownSession(const std::string &peerDeviceId, int32_t sessionId,
+    bool isIdle)
 {
     Shutdown(sessionId);
 #ifdef DMSFWK_ALL_CONNECT_MGR
-    int32_t ret = DSchedAllConnectManager::GetInstance().PublishServiceState(peerDeviceId, "", SCM_IDLE);
-    if (ret != ERR_OK) {
-        HILOGE("Publish idle state fail, ret %{public}d, peerDeviceId %{public}s, sessionId %{public}d.",
-            ret, GetAnonymStr(peerDeviceId).c_str(), sessionId);
+    // an idle disconnect keeps the resources for the lease grace period, anything else gives them back now
+    if (isIdle) {
+        DSchedResourceLeaseManager::GetInstance().Release(peerDeviceId);
+    } else {
+        DSchedResourceLeaseManager::GetInstance().Revoke(peerDeviceId);
     }
 #endif
 }
@@ -392,6 +458,7 @@ int32_t DSchedTransportSoftbusAdapter::ReleaseChannel()
     serverSocket_ = 0;
 
 #ifdef DMSFWK_ALL_CONNECT_MGR
+    DSchedResourceLeaseManager::GetInstance().UnInit();
     int32_t ret = DSchedAllConnectManager::GetInstance().UninitAllConnectManager();
     if (ret != ERR_OK) {
         HILOGE("Uninit all connect manager fail, ret: %{public}d.", ret);
@@ -408,7 +475,12 @@ int32_t DSchedTransportSoftbusAdapter::SendData(int32_t sessionId, int32_t dataT
         HILOGE("error, invalid session id %{public}d", sessionId);
         return INVALID_SESSION_ID;
     }
-    return sessions_[sessionId]->SendData(dataBuffer, dataType);
+    int64_t sendBeginUs = DmsLatencyRegistry::GetNowUs();
+    int32_t ret = sessions_[sessionId]->SendData(dataBuffer, dataType);
+    if (ret == ERR_OK) {
+        DmsLatencyRegistry::GetInstance().RecordSince(DmsLatencyStage::TRANSFER, sendBeginUs);
+    }
+    return ret;
 }
 
 int32_t DSchedTransportSoftbusAdapter::SendBytesBySoftbus(int32_t sessionId,
@@ -428,7 +500,7 @@ void DSchedTransportSoftbusAdapter::OnBytes(int32_t sessionId, const void *data,
         HILOGE("error, dataLen: %{public}d, session id: %{public}d", dataLen, sessionId);
         return;
     }
-    HILOGD("start, sessionId: %{public}d", sessionId);
+    HILOGD_LIMITED("start, sessionId: %{public}d", sessionId);
     {
         std::lock_guard<std::mutex> sessionLock(sessionMutex_);
         if (!sessions_.count(sessionId) || sessions_[sessionId] == nullptr) {
@@ -443,13 +515,14 @@ void DSchedTransportSoftbusAdapter::OnBytes(int32_t sessionId, const void *data,
         }
         sessions_[sessionId]->OnBytesReceived(buffer);
     }
-    HILOGD("end, session id: %{public}d", sessionId);
+    HILOGD_LIMITED("end, session id: %{public}d", sessionId);
     return;
 }
 
 void DSchedTransportSoftbusAdapter::OnDataReady(int32_t sessionId, std::shared_ptr<DSchedDataBuffer> dataBuffer,
     uint32_t dataType)
 {
+    LoadListenerIfAbsent(dataType);
     std::lock_guard<std::mutex> listenerMapLock(listenerMutex_);
     if (listeners_.empty()) {
         HILOGE("no listener has registered");
@@ -467,6 +540,27 @@ void DSchedTransportSoftbusAdapter::OnDataReady(int32_t sessionId, std::shared_p
     return;
 }
 
+void DSchedTransportSoftbusAdapter::SetListenerLoader(ListenerLoader loader)
+{
+    std::lock_guard<std::mutex> listenerMapLock(listenerMutex_);
+    listenerLoader_ = std::move(loader);
+}
+
+void DSchedTransportSoftbusAdapter::LoadListenerIfAbsent(uint32_t dataType)
+{
+    ListenerLoader loader;
+    {
+        std::lock_guard<std::mutex> listenerMapLock(listenerMutex_);
+        if (listenerLoader_ == nullptr || listeners_.find(static_cast<int32_t>(dataType)) != listeners_.end()) {
+            return;
+        }
+        loader = listenerLoader_;
+    }
+    // the loaded service registers its listener, so the lock must not be held here
+    HILOGI("no listener of type %{public}u, load it", dataType);
+    loader(static_cast<int32_t>(dataType));
+}
+
 void DSchedTransportSoftbusAdapter::RegisterListener(int32_t serviceType, std::shared_ptr<IDataListener> listener)
 {
     HILOGI("start, service type: %{public}d", serviceType);
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "dsched_continue_concurrency_test.h"
+
+#include <unordered_set>
+
+#include "dsched_continue_event.h"
+#include "dtbschedmgr_log.h"
+#include "string_ex.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string LOCAL_DEVICEID = "localdeviceid";
+const std::string PEER_DEVICEID = "peerdeviceid";
+const std::string OTHER_PEER_DEVICEID = "otherpeerdeviceid";
+const std::string BUNDLE_NAME_A = "com.example.a";
+const std::string BUNDLE_NAME_B = "com.example.b";
+const std::string BUNDLE_NAME_C = "com.example.c";
+constexpr int32_t SHARED_SESSION_ID = 10;
+constexpr int32_t ACCOUNT_ID = 100;
+constexpr int32_t REPEAT_QUERY_NUM = 3;
+
+std::shared_ptr<DSchedContinueStartCmd> MakeStartCmd(const std::string& bundleName)
+{
+    auto startCmd = std::make_shared<DSchedContinueStartCmd>();
+    startCmd->srcDeviceId_ = PEER_DEVICEID;
+    startCmd->srcBundleName_ = bundleName;
+    startCmd->dstDeviceId_ = LOCAL_DEVICEID;
+    startCmd->dstBundleName_ = bundleName;
+    startCmd->direction_ = CONTINUE_SOURCE;
+    return startCmd;
+}
+
+// what the peer puts on the shared session for the continuation of bundleName
+std::string MarshalEndCmd(const std::string& bundleName)
+{
+    DSchedContinueEndCmd endCmd;
+    endCmd.command_ = DSCHED_CONTINUE_CMD_END;
+    endCmd.srcDeviceId_ = PEER_DEVICEID;
+    endCmd.srcBundleName_ = bundleName;
+    endCmd.dstDeviceId_ = LOCAL_DEVICEID;
+    endCmd.dstBundleName_ = bundleName;
+    endCmd.result_ = ERR_OK;
+    std::string jsonStr;
+    EXPECT_EQ(endCmd.Marshal(jsonStr), ERR_OK);
+    return jsonStr;
+}
+
+std::string MarshalStartCmd(const std::string& bundleName)
+{
+    auto startCmd = MakeStartCmd(bundleName);
+    startCmd->command_ = DSCHED_CONTINUE_CMD_START;
+    std::string jsonStr;
+    EXPECT_EQ(startCmd->Marshal(jsonStr), ERR_OK);
+    return jsonStr;
+}
+
+std::shared_ptr<DSchedContinue> AddSinkContinue(const std::string& bundleName)
+{
+    auto dContinue = std::make_shared<DSchedContinue>(MakeStartCmd(bundleName), SHARED_SESSION_ID, ACCOUNT_ID);
+    DSchedContinueManager::GetInstance().continues_[dContinue->GetContinueInfo()] = dContinue;
+    return dContinue;
+}
+}
+
+void DSchedContinueConcurrencyTest::SetUpTestCase()
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest::SetUpTestCase" << std::endl;
+}
+
+void DSchedContinueConcurrencyTest::TearDownTestCase()
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest::TearDownTestCase" << std::endl;
+}
+
+void DSchedContinueConcurrencyTest::SetUp()
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest::SetUp" << std::endl;
+    DSchedContinueManager::GetInstance().continues_.clear();
+}
+
+void DSchedContinueConcurrencyTest::TearDown()
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest::TearDown" << std::endl;
+    DSchedContinueManager::GetInstance().continues_.clear();
+}
+
+/**
+ * @tc.name: ContinueInfoKey_001
+ * @tc.desc: continue infos are keyed field by field, concatenated ids no longer collide
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueConcurrencyTest, ContinueInfoKey_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest ContinueInfoKey_001 begin" << std::endl;
+    DSchedContinueInfo info(LOCAL_DEVICEID, "ab", PEER_DEVICEID, "c", "");
+    DSchedContinueInfo shifted(LOCAL_DEVICEID, "a", PEER_DEVICEID, "bc", "");
+    EXPECT_FALSE(info == shifted);
+    EXPECT_TRUE(info < shifted || shifted < info);
+
+    DSchedContinueInfo sameKey(LOCAL_DEVICEID, "ab", PEER_DEVICEID, "c", "continueType");
+    EXPECT_TRUE(info == sameKey);
+    EXPECT_EQ(DSchedContinueInfoHash()(info), DSchedContinueInfoHash()(sameKey));
+
+    std::unordered_set<DSchedContinueInfo, DSchedContinueInfoHash> keys = { info, shifted, sameKey };
+    EXPECT_EQ(keys.size(), 2u);
+    DTEST_LOG << "DSchedContinueConcurrencyTest ContinueInfoKey_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: FindContinueBySession_001
+ * @tc.desc: interleaved commands of continuations sharing one session reach their own continuation
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueConcurrencyTest, FindContinueBySession_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest FindContinueBySession_001 begin" << std::endl;
+    auto& manager = DSchedContinueManager::GetInstance();
+    auto continueA = AddSinkContinue(BUNDLE_NAME_A);
+    auto continueB = AddSinkContinue(BUNDLE_NAME_B);
+    ASSERT_EQ(manager.continues_.size(), 2u);
+
+    std::string endCmdA = MarshalEndCmd(BUNDLE_NAME_A);
+    std::string endCmdB = MarshalEndCmd(BUNDLE_NAME_B);
+    for (const auto& jsonStr : { endCmdB, endCmdA, endCmdB, endCmdA }) {
+        auto expected = (jsonStr == endCmdA) ? continueA : continueB;
+        EXPECT_EQ(manager.FindContinueBySession(SHARED_SESSION_ID, DSCHED_CONTINUE_CMD_END, jsonStr), expected);
+    }
+    EXPECT_EQ(manager.FindContinueBySession(SHARED_SESSION_ID, DSCHED_CONTINUE_CMD_END,
+        MarshalEndCmd(BUNDLE_NAME_C)), nullptr);
+    EXPECT_EQ(manager.FindContinueBySession(SHARED_SESSION_ID, DSCHED_CONTINUE_CMD_END, "invalid"), nullptr);
+    EXPECT_EQ(manager.FindContinueBySession(SHARED_SESSION_ID + 1, DSCHED_CONTINUE_CMD_END, endCmdA), nullptr);
+    DTEST_LOG << "DSchedContinueConcurrencyTest FindContinueBySession_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: FindContinueBySession_002
+ * @tc.desc: a session with one continuation routes without parsing, a new start command is not taken by it
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueConcurrencyTest, FindContinueBySession_002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest FindContinueBySession_002 begin" << std::endl;
+    auto& manager = DSchedContinueManager::GetInstance();
+    auto continueA = AddSinkContinue(BUNDLE_NAME_A);
+    EXPECT_EQ(manager.FindContinueBySession(SHARED_SESSION_ID, DSCHED_CONTINUE_CMD_END, "invalid"), continueA);
+
+    EXPECT_EQ(manager.FindContinueBySession(SHARED_SESSION_ID, DSCHED_CONTINUE_CMD_START,
+        MarshalStartCmd(BUNDLE_NAME_B)), nullptr);
+    EXPECT_EQ(manager.FindContinueBySession(SHARED_SESSION_ID, DSCHED_CONTINUE_CMD_START,
+        MarshalStartCmd(BUNDLE_NAME_A)), continueA);
+    DTEST_LOG << "DSchedContinueConcurrencyTest FindContinueBySession_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: CheckPeerLimit_001
+ * @tc.desc: continuations are limited per peer, other peers are not affected
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueConcurrencyTest, CheckPeerLimit_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest CheckPeerLimit_001 begin" << std::endl;
+    auto& manager = DSchedContinueManager::GetInstance();
+    EXPECT_EQ(manager.CheckPeerLimit(PEER_DEVICEID), ERR_OK);
+    for (int32_t i = 0; i < MAX_CONCURRENT_PER_PEER; i++) {
+        DSchedContinueInfo info(PEER_DEVICEID, BUNDLE_NAME_A + std::to_string(i), LOCAL_DEVICEID,
+            BUNDLE_NAME_A + std::to_string(i), "");
+        manager.continues_[info] = nullptr;
+    }
+    EXPECT_EQ(manager.CheckPeerLimit(PEER_DEVICEID), CONTINUE_ALREADY_IN_PROGRESS);
+    EXPECT_EQ(manager.CheckPeerLimit(OTHER_PEER_DEVICEID), ERR_OK);
+    DTEST_LOG << "DSchedContinueConcurrencyTest CheckPeerLimit_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: GetDSchedContinueByDevId_001
+ * @tc.desc: a completion from one peer reaches the continuation of the caller bundle, not the first one found
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueConcurrencyTest, GetDSchedContinueByDevId_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest GetDSchedContinueByDevId_001 begin" << std::endl;
+    auto& manager = DSchedContinueManager::GetInstance();
+    auto continueA = AddSinkContinue(BUNDLE_NAME_A);
+    auto continueB = AddSinkContinue(BUNDLE_NAME_B);
+    std::u16string peerDevId = Str8ToStr16(PEER_DEVICEID);
+    for (const auto& bundleName : { BUNDLE_NAME_B, BUNDLE_NAME_A, BUNDLE_NAME_B, BUNDLE_NAME_A }) {
+        auto expected = (bundleName == BUNDLE_NAME_A) ? continueA : continueB;
+        EXPECT_EQ(manager.GetDSchedContinueByDevId(peerDevId, SHARED_SESSION_ID, bundleName), expected);
+    }
+    EXPECT_EQ(manager.GetDSchedContinueByDevId(peerDevId, SHARED_SESSION_ID, BUNDLE_NAME_C), nullptr);
+    EXPECT_EQ(manager.GetDSchedContinueByDevId(Str8ToStr16(OTHER_PEER_DEVICEID), SHARED_SESSION_ID,
+        BUNDLE_NAME_A), nullptr);
+    DTEST_LOG << "DSchedContinueConcurrencyTest GetDSchedContinueByDevId_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: GetContinueInfo_001
+ * @tc.desc: with several continuations in progress the smallest continue info is reported
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueConcurrencyTest, GetContinueInfo_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinueConcurrencyTest GetContinueInfo_001 begin" << std::endl;
+    auto& manager = DSchedContinueManager::GetInstance();
+    auto continueA = AddSinkContinue(BUNDLE_NAME_A);
+    auto startCmd = MakeStartCmd(BUNDLE_NAME_B);
+    startCmd->srcDeviceId_ = OTHER_PEER_DEVICEID;
+    auto otherContinue = std::make_shared<DSchedContinue>(startCmd, SHARED_SESSION_ID, ACCOUNT_ID);
+    manager.continues_[otherContinue->GetContinueInfo()] = otherContinue;
+    AddSinkContinue(BUNDLE_NAME_C);
+    ASSERT_TRUE(otherContinue->GetContinueInfo() < continueA->GetContinueInfo());
+
+    for (int32_t i = 0; i < REPEAT_QUERY_NUM; i++) {
+        std::string srcDeviceId;
+        std::string dstDeviceId;
+        EXPECT_EQ(manager.GetContinueInfo(srcDeviceId, dstDeviceId), ERR_OK);
+        EXPECT_EQ(srcDeviceId, OTHER_PEER_DEVICEID);
+        EXPECT_EQ(dstDeviceId, LOCAL_DEVICEID);
+    }
+    DTEST_LOG << "DSchedContinueConcurrencyTest GetContinueInfo_001 end" << std::endl;
+}
+}
+}
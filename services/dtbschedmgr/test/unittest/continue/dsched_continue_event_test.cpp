@@ -15,6 +15,8 @@
 
 #include "dsched_continue_event_test.h"
 
+#include <chrono>
+
 #include "distributed_sched_utils.h"
 #include "dsched_continue_event.h"
 #include "dtbschedmgr_log.h"
@@ -25,6 +27,40 @@ using namespace testing::ext;
 
 namespace OHOS {
 namespace DistributedSchedule {
+namespace {
+constexpr size_t WANT_PAYLOAD_SIZES[] = { 0, 64 * 1024, 256 * 1024, 1024 * 1024 };
+
+void FillDataCmd(DSchedContinueDataCmd& cmd, size_t payloadSize)
+{
+    cmd.version_ = 2;
+    cmd.serviceType_ = 0;
+    cmd.subServiceType_ = 0;
+    cmd.command_ = DSCHED_CONTINUE_CMD_DATA;
+    cmd.srcDeviceId_ = "srcDevice";
+    cmd.srcBundleName_ = "com.test.bundle";
+    cmd.dstDeviceId_ = "dstDevice";
+    cmd.dstBundleName_ = "com.test.bundle";
+    cmd.continueType_ = "continueType";
+    cmd.sourceMissionId_ = 1;
+    cmd.want_.SetElementName("dstDevice", "com.test.bundle", "MainAbility");
+    cmd.want_.SetParam(OHOS::AAFwk::Want::PARAM_MODULE_NAME, std::string("entry"));
+    cmd.want_.SetFlags(OHOS::AAFwk::Want::FLAG_ABILITY_CONTINUATION);
+    cmd.want_.SetParam("payload", std::string(payloadSize, 'a'));
+    cmd.requestCode_ = -1;
+    cmd.callerInfo_.uid = 100;
+    cmd.callerInfo_.accessToken = 200;
+    cmd.callerInfo_.extraInfoJson["accessTokenID"] = 200;
+    cmd.callerInfo_.sourceDeviceId = "srcDevice";
+    cmd.callerInfo_.callerAppId = "appId";
+    cmd.accountInfo_.accountType = 1;
+    cmd.accountInfo_.userId = 100;
+}
+
+int64_t GetElapsedUs(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+}
 
 void DSchedContinueEventTest::SetUpTestCase()
 {
@@ -351,5 +387,124 @@ HWTEST_F(DSchedContinueEventTest, DSchedContinueEventTest_011_1, TestSize.Level0
     cJSON_Delete(rootValue);
     DTEST_LOG << "DSchedContinueEventTest DSchedContinueEventTest_008_1 end ret:" << ret << std::endl;
 }
+
+/**
+ * @tc.name: DSchedContinueEventTest_012_1
+ * @tc.desc: DSchedContinueDataHeaderCmd carries what the sink checks before the want arrives
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueEventTest, DSchedContinueEventTest_012_1, TestSize.Level0)
+{
+    DTEST_LOG << "DSchedContinueEventTest DSchedContinueEventTest_012_1 begin" << std::endl;
+    DSchedContinueDataCmd dataCmd;
+    FillDataCmd(dataCmd, 0);
+    DSchedContinueDataHeaderCmd headerCmd;
+    headerCmd.FromDataCmd(dataCmd);
+    EXPECT_EQ(headerCmd.command_, DSCHED_CONTINUE_CMD_DATA_HEADER);
+    EXPECT_EQ(headerCmd.want_.GetModuleName(), "entry");
+
+    std::string cmdStr;
+    EXPECT_EQ(headerCmd.Marshal(cmdStr), ERR_OK);
+    DSchedContinueDataHeaderCmd recvCmd;
+    EXPECT_EQ(recvCmd.Unmarshal(cmdStr), ERR_OK);
+    EXPECT_EQ(recvCmd.srcBundleName_, dataCmd.srcBundleName_);
+    EXPECT_EQ(recvCmd.want_.GetElement().GetAbilityName(), "MainAbility");
+    EXPECT_EQ(recvCmd.want_.GetModuleName(), "entry");
+    EXPECT_EQ(recvCmd.want_.GetFlags(), OHOS::AAFwk::Want::FLAG_ABILITY_CONTINUATION);
+    EXPECT_EQ(recvCmd.callerInfo_.accessToken, dataCmd.callerInfo_.accessToken);
+    EXPECT_EQ(recvCmd.accountInfo_.userId, dataCmd.accountInfo_.userId);
+    EXPECT_TRUE(recvCmd.IsHeaderOf(dataCmd));
+
+    EXPECT_EQ(recvCmd.Unmarshal("test"), INVALID_PARAMETERS_ERR);
+    cJSON *rootValue = cJSON_Parse(cmdStr.c_str());
+    ASSERT_NE(rootValue, nullptr);
+    cJSON_DeleteItemFromObject(rootValue, "WantFlags");
+    char *data = cJSON_Print(rootValue);
+    cJSON_Delete(rootValue);
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(recvCmd.Unmarshal(std::string(data)), INVALID_PARAMETERS_ERR);
+    cJSON_free(data);
+    DTEST_LOG << "DSchedContinueEventTest DSchedContinueEventTest_012_1 end" << std::endl;
+}
+
+/**
+ * @tc.name: DSchedContinueEventTest_013_1
+ * @tc.desc: DSchedContinueDataHeaderCmd IsHeaderOf rejects a data cmd the header was not made from
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueEventTest, DSchedContinueEventTest_013_1, TestSize.Level0)
+{
+    DTEST_LOG << "DSchedContinueEventTest DSchedContinueEventTest_013_1 begin" << std::endl;
+    DSchedContinueDataCmd dataCmd;
+    FillDataCmd(dataCmd, 0);
+    DSchedContinueDataHeaderCmd headerCmd;
+    headerCmd.FromDataCmd(dataCmd);
+
+    DSchedContinueDataCmd otherCmd;
+    FillDataCmd(otherCmd, 0);
+    otherCmd.want_.SetElementName("dstDevice", "com.test.bundle", "OtherAbility");
+    EXPECT_FALSE(headerCmd.IsHeaderOf(otherCmd));
+
+    FillDataCmd(otherCmd, 0);
+    otherCmd.want_.SetParam(OHOS::AAFwk::Want::PARAM_MODULE_NAME, std::string("feature"));
+    EXPECT_FALSE(headerCmd.IsHeaderOf(otherCmd));
+
+    FillDataCmd(otherCmd, 0);
+    otherCmd.callerInfo_.accessToken = 0;
+    EXPECT_FALSE(headerCmd.IsHeaderOf(otherCmd));
+
+    FillDataCmd(otherCmd, 0);
+    otherCmd.accountInfo_.userId = 101;
+    EXPECT_FALSE(headerCmd.IsHeaderOf(otherCmd));
+
+    FillDataCmd(otherCmd, 0);
+    otherCmd.want_.SetFlags(0);
+    EXPECT_FALSE(headerCmd.IsHeaderOf(otherCmd));
+
+    FillDataCmd(otherCmd, 0);
+    otherCmd.want_.SetParam("payload", std::string("changed"));
+    EXPECT_TRUE(headerCmd.IsHeaderOf(otherCmd));
+    DTEST_LOG << "DSchedContinueEventTest DSchedContinueEventTest_013_1 end" << std::endl;
+}
+
+/**
+ * @tc.name: DSchedContinueEventTest_014_1
+ * @tc.desc: the data header stays the same size as the want grows, the sink can start on it early
+ * @tc.type: PERF
+ */
+HWTEST_F(DSchedContinueEventTest, DSchedContinueEventTest_014_1, TestSize.Level0)
+{
+    DTEST_LOG << "DSchedContinueEventTest DSchedContinueEventTest_014_1 begin" << std::endl;
+    size_t headerSize = 0;
+    for (size_t payloadSize : WANT_PAYLOAD_SIZES) {
+        DSchedContinueDataCmd dataCmd;
+        FillDataCmd(dataCmd, payloadSize);
+        DSchedContinueDataHeaderCmd headerCmd;
+        headerCmd.FromDataCmd(dataCmd);
+        std::string headerStr;
+        std::string dataStr;
+        ASSERT_EQ(headerCmd.Marshal(headerStr), ERR_OK);
+        ASSERT_EQ(dataCmd.Marshal(dataStr), ERR_OK);
+
+        auto begin = std::chrono::steady_clock::now();
+        DSchedContinueDataHeaderCmd recvHeader;
+        EXPECT_EQ(recvHeader.Unmarshal(headerStr), ERR_OK);
+        int64_t headerUs = GetElapsedUs(begin);
+        begin = std::chrono::steady_clock::now();
+        DSchedContinueDataCmd recvData;
+        EXPECT_EQ(recvData.Unmarshal(dataStr), ERR_OK);
+        int64_t dataUs = GetElapsedUs(begin);
+        EXPECT_TRUE(recvHeader.IsHeaderOf(recvData));
+        DTEST_LOG << "payload " << payloadSize << "B: header " << headerStr.size() << "B " << headerUs <<
+            "us, data " << dataStr.size() << "B " << dataUs << "us" << std::endl;
+
+        if (headerSize == 0) {
+            headerSize = headerStr.size();
+        }
+        EXPECT_EQ(headerStr.size(), headerSize);
+        EXPECT_GT(dataStr.size(), payloadSize);
+    }
+    DTEST_LOG << "DSchedContinueEventTest DSchedContinueEventTest_014_1 end" << std::endl;
+}
 }
 }
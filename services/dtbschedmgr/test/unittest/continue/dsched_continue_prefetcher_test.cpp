@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_continue_prefetcher_test.h"
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "dtbschedmgr_log.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string PEER_NETWORK_ID = "prefetchPeerNetworkId";
+const std::string OTHER_NETWORK_ID = "prefetchOtherNetworkId";
+constexpr uint16_t BUNDLE_NAME_ID = 7;
+constexpr uint16_t OTHER_BUNDLE_NAME_ID = 8;
+// softbus bind of a new session, later connects to the same peer only take a reference
+constexpr int32_t BIND_DELAY_MS = 100;
+constexpr int64_t SHORT_TIMEOUT_MS = 100;
+
+struct FakeSession {
+    std::string peerDeviceId;
+    int32_t refCount = 0;
+};
+
+// loopback session table standing in for the softbus sessions of the adapter
+std::mutex g_sessionMutex;
+std::map<int32_t, FakeSession> g_sessions;
+int32_t g_nextSessionId = 1;
+int32_t g_bindCount = 0;
+
+int32_t FindSessionLocked(const std::string &peerDeviceId)
+{
+    for (const auto &[sessionId, session] : g_sessions) {
+        if (session.peerDeviceId == peerDeviceId) {
+            return sessionId;
+        }
+    }
+    return 0;
+}
+
+int32_t FakeConnectDeviceAsync(const std::string &peerDeviceId, DSchedServiceType type,
+    const DSchedTransportSoftbusAdapter::ConnectCallback &callback)
+{
+    int32_t sessionId = 0;
+    {
+        std::lock_guard<std::mutex> sessionLock(g_sessionMutex);
+        sessionId = FindSessionLocked(peerDeviceId);
+        if (sessionId != 0) {
+            g_sessions[sessionId].refCount++;
+        }
+    }
+    if (sessionId == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(BIND_DELAY_MS));
+        std::lock_guard<std::mutex> sessionLock(g_sessionMutex);
+        g_bindCount++;
+        sessionId = g_nextSessionId++;
+        g_sessions[sessionId] = { peerDeviceId, 1 };
+    }
+    callback(ERR_OK, sessionId);
+    return ERR_OK;
+}
+
+void ConnectDevice(const std::string &peerDeviceId, int32_t &sessionId)
+{
+    DSchedTransportSoftbusAdapter::GetInstance().ConnectDeviceAsync(peerDeviceId, SERVICE_TYPE_CONTINUE,
+        [&sessionId](int32_t result, int32_t connectedSessionId) {
+            sessionId = connectedSessionId;
+        });
+}
+
+// the adapter tells its listeners once the session is gone, whoever closed it
+void ShutdownFakeSession(int32_t sessionId, bool isRefDropped)
+{
+    {
+        std::lock_guard<std::mutex> sessionLock(g_sessionMutex);
+        auto iter = g_sessions.find(sessionId);
+        if (iter == g_sessions.end() || (isRefDropped && --iter->second.refCount > 0)) {
+            return;
+        }
+        g_sessions.erase(iter);
+    }
+    DSchedContinuePrefetcher::GetInstance().OnShutdown(sessionId);
+}
+
+void FakeDisconnectDevice(const std::string &peerDeviceId)
+{
+    int32_t sessionId = 0;
+    {
+        std::lock_guard<std::mutex> sessionLock(g_sessionMutex);
+        sessionId = FindSessionLocked(peerDeviceId);
+    }
+    ShutdownFakeSession(sessionId, true);
+}
+
+void FakeDisconnectSession(int32_t sessionId)
+{
+    ShutdownFakeSession(sessionId, true);
+}
+
+int32_t GetSessionRef(const std::string &peerDeviceId)
+{
+    std::lock_guard<std::mutex> sessionLock(g_sessionMutex);
+    int32_t sessionId = FindSessionLocked(peerDeviceId);
+    return sessionId == 0 ? 0 : g_sessions[sessionId].refCount;
+}
+
+int32_t GetSessionRef(int32_t sessionId)
+{
+    std::lock_guard<std::mutex> sessionLock(g_sessionMutex);
+    auto iter = g_sessions.find(sessionId);
+    return iter == g_sessions.end() ? 0 : iter->second.refCount;
+}
+
+void WaitPrefetchIdle()
+{
+    auto eventHandler = DSchedContinuePrefetcher::GetInstance().eventHandler_;
+    if (eventHandler == nullptr) {
+        return;
+    }
+    std::promise<void> done;
+    eventHandler->PostTask([&done]() {
+        done.set_value();
+    });
+    done.get_future().wait();
+}
+
+// the focus broadcast arrives, the user taps the icon a moment later, and the
+// sink pays the time from the tap to a usable session
+int64_t MeasureClickToStart(const std::string &peerDeviceId, int32_t &sessionId)
+{
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    prefetcher.OnFocused(peerDeviceId, BUNDLE_NAME_ID);
+    std::this_thread::sleep_for(std::chrono::milliseconds(BIND_DELAY_MS * 2));
+    auto begin = std::chrono::steady_clock::now();
+    prefetcher.OnContinueStart(peerDeviceId);
+    ConnectDevice(peerDeviceId, sessionId);
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+int32_t GetPrefetchedSession(const std::string &peerDeviceId)
+{
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    std::lock_guard<std::mutex> prefetchLock(prefetcher.prefetchMutex_);
+    auto iter = prefetcher.entries_.find(peerDeviceId);
+    return iter == prefetcher.entries_.end() ? 0 : iter->second.sessionId;
+}
+}
+
+void DSchedContinuePrefetcherTest::SetUpTestCase()
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest::SetUpTestCase" << std::endl;
+    adapterMock_ = std::make_shared<DSchedTransportSoftbusAdapterMock>();
+    DSchedTransportSoftbusAdapterMock::adapterMock = adapterMock_;
+}
+
+void DSchedContinuePrefetcherTest::TearDownTestCase()
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest::TearDownTestCase" << std::endl;
+    DSchedTransportSoftbusAdapterMock::adapterMock = nullptr;
+    adapterMock_ = nullptr;
+}
+
+void DSchedContinuePrefetcherTest::SetUp()
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest::SetUp" << std::endl;
+    {
+        std::lock_guard<std::mutex> sessionLock(g_sessionMutex);
+        g_sessions.clear();
+        g_bindCount = 0;
+    }
+    ON_CALL(*adapterMock_, ConnectDeviceAsync(_, _, _)).WillByDefault(Invoke(FakeConnectDeviceAsync));
+    ON_CALL(*adapterMock_, DisconnectDevice(_)).WillByDefault(Invoke(FakeDisconnectDevice));
+    ON_CALL(*adapterMock_, DisconnectSession(_)).WillByDefault(Invoke(FakeDisconnectSession));
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    prefetcher.Init();
+    prefetcher.SetEnabled(true);
+    prefetcher.SetBudget(DSchedContinuePrefetcher::DEFAULT_BUDGET);
+    prefetcher.SetTimeout(DSchedContinuePrefetcher::DEFAULT_TIMEOUT_MS);
+    prefetcher.stat_ = DSchedPrefetchStat();
+}
+
+void DSchedContinuePrefetcherTest::TearDown()
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest::TearDown" << std::endl;
+    WaitPrefetchIdle();
+    DSchedContinuePrefetcher::GetInstance().UnInit();
+    Mock::VerifyAndClearExpectations(adapterMock_.get());
+}
+
+/**
+ * @tc.name: OnFocused_001
+ * @tc.desc: nothing is prefetched while the prefetcher is disabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinuePrefetcherTest, OnFocused_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest OnFocused_001 begin" << std::endl;
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    prefetcher.SetEnabled(false);
+    EXPECT_CALL(*adapterMock_, ConnectDeviceAsync(_, _, _)).Times(0);
+    prefetcher.OnFocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    WaitPrefetchIdle();
+    EXPECT_EQ(prefetcher.GetStat().startedCount, 0u);
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 0);
+    DTEST_LOG << "DSchedContinuePrefetcherTest OnFocused_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: OnFocused_002
+ * @tc.desc: focus opens the session once, unfocus of another bundle keeps it, unfocus of the bundle drops it
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinuePrefetcherTest, OnFocused_002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest OnFocused_002 begin" << std::endl;
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    EXPECT_CALL(*adapterMock_, ConnectDeviceAsync(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE, _)).Times(1);
+    prefetcher.OnFocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    prefetcher.OnFocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    WaitPrefetchIdle();
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 1);
+    EXPECT_EQ(prefetcher.GetStat().readyCount, 1u);
+
+    prefetcher.OnUnfocused(PEER_NETWORK_ID, OTHER_BUNDLE_NAME_ID);
+    WaitPrefetchIdle();
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 1);
+
+    prefetcher.OnUnfocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    WaitPrefetchIdle();
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 0);
+    EXPECT_EQ(prefetcher.GetStat().canceledCount, 1u);
+    DTEST_LOG << "DSchedContinuePrefetcherTest OnFocused_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: Budget_001
+ * @tc.desc: peers beyond the budget are skipped
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinuePrefetcherTest, Budget_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest Budget_001 begin" << std::endl;
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    prefetcher.SetBudget(1);
+    prefetcher.OnFocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    prefetcher.OnFocused(OTHER_NETWORK_ID, BUNDLE_NAME_ID);
+    WaitPrefetchIdle();
+    DSchedPrefetchStat stat = prefetcher.GetStat();
+    EXPECT_EQ(stat.startedCount, 1u);
+    EXPECT_EQ(stat.skippedCount, 1u);
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 1);
+    EXPECT_EQ(GetSessionRef(OTHER_NETWORK_ID), 0);
+
+    prefetcher.Cancel(PEER_NETWORK_ID);
+    prefetcher.OnFocused(OTHER_NETWORK_ID, BUNDLE_NAME_ID);
+    WaitPrefetchIdle();
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 0);
+    EXPECT_EQ(GetSessionRef(OTHER_NETWORK_ID), 1);
+    DTEST_LOG << "DSchedContinuePrefetcherTest Budget_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Timeout_001
+ * @tc.desc: a prefetch nobody uses is released after the timeout
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinuePrefetcherTest, Timeout_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest Timeout_001 begin" << std::endl;
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    prefetcher.SetTimeout(SHORT_TIMEOUT_MS);
+    prefetcher.OnFocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    WaitPrefetchIdle();
+    std::this_thread::sleep_for(std::chrono::milliseconds(SHORT_TIMEOUT_MS * 3));
+    WaitPrefetchIdle();
+    EXPECT_EQ(prefetcher.GetStat().timeoutCount, 1u);
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 0);
+    DTEST_LOG << "DSchedContinuePrefetcherTest Timeout_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Cancel_001
+ * @tc.desc: a cancel arriving while the session is being opened drops it once the connect returns
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinuePrefetcherTest, Cancel_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest Cancel_001 begin" << std::endl;
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    EXPECT_CALL(*adapterMock_, DisconnectSession(_)).Times(1);
+    prefetcher.OnFocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    std::this_thread::sleep_for(std::chrono::milliseconds(BIND_DELAY_MS / 2));
+    prefetcher.CancelAll();
+    WaitPrefetchIdle();
+    DSchedPrefetchStat stat = prefetcher.GetStat();
+    EXPECT_EQ(stat.canceledCount, 1u);
+    EXPECT_EQ(stat.readyCount, 0u);
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 0);
+    EXPECT_TRUE(prefetcher.entries_.empty());
+    DTEST_LOG << "DSchedContinuePrefetcherTest Cancel_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: ClickToStart_001
+ * @tc.desc: loopback click-to-start latency with and without prefetch, the tap reuses the prefetched session
+ * @tc.type: PERF
+ */
+HWTEST_F(DSchedContinuePrefetcherTest, ClickToStart_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest ClickToStart_001 begin" << std::endl;
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    prefetcher.SetEnabled(false);
+    int32_t coldSessionId = 0;
+    int64_t coldUs = MeasureClickToStart(PEER_NETWORK_ID, coldSessionId);
+    EXPECT_EQ(g_bindCount, 1);
+    DSchedTransportSoftbusAdapter::GetInstance().DisconnectDevice(PEER_NETWORK_ID);
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 0);
+
+    prefetcher.SetEnabled(true);
+    int32_t warmSessionId = 0;
+    int64_t warmUs = MeasureClickToStart(PEER_NETWORK_ID, warmSessionId);
+    DTEST_LOG << "click to start without prefetch " << coldUs << "us, with prefetch " << warmUs << "us" << std::endl;
+
+    // the prefetcher bound the session on focus, the continue only took a reference on it
+    EXPECT_EQ(g_bindCount, 2);
+    EXPECT_EQ(warmSessionId, GetPrefetchedSession(PEER_NETWORK_ID));
+    EXPECT_EQ(GetSessionRef(warmSessionId), 2);
+    EXPECT_EQ(prefetcher.GetStat().hitCount, 1u);
+    EXPECT_LT(warmUs, coldUs);
+
+    // the prefetch reference goes with the unfocus broadcast, the continue keeps its own
+    prefetcher.OnUnfocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    EXPECT_EQ(GetSessionRef(warmSessionId), 1);
+    DSchedTransportSoftbusAdapter::GetInstance().DisconnectDevice(PEER_NETWORK_ID);
+    EXPECT_EQ(GetSessionRef(PEER_NETWORK_ID), 0);
+    DTEST_LOG << "DSchedContinuePrefetcherTest ClickToStart_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: OnShutdown_001
+ * @tc.desc: a prefetched session shut down by the peer is forgotten, the session of the next continue is left alone
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinuePrefetcherTest, OnShutdown_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinuePrefetcherTest OnShutdown_001 begin" << std::endl;
+    auto &prefetcher = DSchedContinuePrefetcher::GetInstance();
+    // longer than the bind, the entry must still be there when the session goes
+    prefetcher.SetTimeout(SHORT_TIMEOUT_MS * 3);
+    prefetcher.OnFocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    WaitPrefetchIdle();
+    int32_t prefetchedSessionId = GetPrefetchedSession(PEER_NETWORK_ID);
+    ASSERT_NE(prefetchedSessionId, 0);
+    ShutdownFakeSession(prefetchedSessionId, false);
+    EXPECT_TRUE(prefetcher.entries_.empty());
+
+    prefetcher.OnContinueStart(PEER_NETWORK_ID);
+    int32_t sessionId = 0;
+    ConnectDevice(PEER_NETWORK_ID, sessionId);
+    EXPECT_NE(sessionId, prefetchedSessionId);
+    EXPECT_EQ(prefetcher.GetStat().hitCount, 0u);
+    EXPECT_EQ(prefetcher.GetStat().missCount, 1u);
+
+    EXPECT_CALL(*adapterMock_, DisconnectDevice(_)).Times(0);
+    EXPECT_CALL(*adapterMock_, DisconnectSession(_)).Times(0);
+    prefetcher.OnUnfocused(PEER_NETWORK_ID, BUNDLE_NAME_ID);
+    prefetcher.Cancel(PEER_NETWORK_ID);
+    prefetcher.CancelAll();
+    std::this_thread::sleep_for(std::chrono::milliseconds(SHORT_TIMEOUT_MS * 5));
+    WaitPrefetchIdle();
+    EXPECT_EQ(prefetcher.GetStat().timeoutCount, 0u);
+    EXPECT_EQ(GetSessionRef(sessionId), 1);
+    ShutdownFakeSession(sessionId, true);
+    DTEST_LOG << "DSchedContinuePrefetcherTest OnShutdown_001 end" << std::endl;
+}
+}
+}
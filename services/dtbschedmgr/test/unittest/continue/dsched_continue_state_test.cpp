@@ -518,6 +518,76 @@ HWTEST_F(DSchedContinueDataStateTest, SinkDoContinueDataTask002, TestSize.Level3
     DTEST_LOG << "DSchedContinueDataStateTest SinkDoContinueDataTask002 end" << std::endl;
 }
 
+ /**
+ * @tc.name: SinkDoContinueDataHeaderTask001
+ * @tc.desc: a data header failing the sink checks does not end the continuation, the data cmd decides
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueDataStateTest, SinkDoContinueDataHeaderTask001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinueDataStateTest SinkDoContinueDataHeaderTask001 begin" << std::endl;
+    ASSERT_NE(dataStateTest_, nullptr);
+    EXPECT_CALL(*mockStateTest_, GetLocalDeviceId(_)).WillRepeatedly(Return(true));
+    auto data = std::make_shared<DSchedContinueDataCmd>();
+    data->dstBundleName_ = "com.test.notinstalled";
+    auto header = std::make_shared<DSchedContinueDataHeaderCmd>();
+    header->FromDataCmd(*data);
+
+    // the bundle of the header is not in the bundle storage, so UpdateElementInfo fails
+    std::shared_ptr<DSchedContinue> dContinue = CreateObject();
+    usleep(WAITTIME);
+    int32_t ret = dataStateTest_->Execute(dContinue,
+        AppExecFwk::InnerEvent::Get(DSCHED_CONTINUE_DATA_HEADER_EVENT, header, 0));
+    EXPECT_EQ(ret, ERR_OK);
+    EXPECT_EQ(dContinue->preparedHeader_, nullptr);
+    EXPECT_FALSE(dContinue->UsePreparedHeader(data));
+
+    // the data cmd runs the full path and ends the same way as without a header
+    std::shared_ptr<DSchedContinue> noHeaderContinue = CreateObject();
+    usleep(WAITTIME);
+    int32_t noHeaderRet = dataStateTest_->Execute(noHeaderContinue,
+        AppExecFwk::InnerEvent::Get(DSCHED_CONTINUE_DATA_EVENT, std::make_shared<DSchedContinueDataCmd>(*data), 0));
+    ret = dataStateTest_->Execute(dContinue, AppExecFwk::InnerEvent::Get(DSCHED_CONTINUE_DATA_EVENT, data, 0));
+    EXPECT_EQ(ret, noHeaderRet);
+    DTEST_LOG << "DSchedContinueDataStateTest SinkDoContinueDataHeaderTask001 end" << std::endl;
+}
+
+ /**
+ * @tc.name: SinkDoContinueDataHeaderTask002
+ * @tc.desc: a data cmd matching the prepared header is still permission checked on its own caller info
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedContinueDataStateTest, SinkDoContinueDataHeaderTask002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedContinueDataStateTest SinkDoContinueDataHeaderTask002 begin" << std::endl;
+    ASSERT_NE(dataStateTest_, nullptr);
+    EXPECT_CALL(*mockStateTest_, GetLocalDeviceId(_)).WillRepeatedly(Return(true));
+    auto data = std::make_shared<DSchedContinueDataCmd>();
+    data->srcBundleName_ = "com.test.demo";
+    data->dstBundleName_ = "com.test.demo";
+    auto header = std::make_shared<DSchedContinueDataHeaderCmd>();
+    header->FromDataCmd(*data);
+    // the header does not carry these, the data cmd differs from what the header was checked with
+    data->callerInfo_.bundleNames.push_back("com.test.other");
+    data->accountInfo_.groupIdList.push_back("groupId");
+    ASSERT_TRUE(header->IsHeaderOf(*data));
+
+    std::shared_ptr<DSchedContinue> noHeaderContinue = CreateObject();
+    usleep(WAITTIME);
+    int32_t noHeaderRet = dataStateTest_->Execute(noHeaderContinue,
+        AppExecFwk::InnerEvent::Get(DSCHED_CONTINUE_DATA_EVENT, std::make_shared<DSchedContinueDataCmd>(*data), 0));
+
+    std::shared_ptr<DSchedContinue> dContinue = CreateObject();
+    usleep(WAITTIME);
+    dContinue->preparedHeader_ = header;
+    dContinue->preparedElement_ = data->want_.GetElement();
+    int32_t ret = dataStateTest_->Execute(dContinue, AppExecFwk::InnerEvent::Get(DSCHED_CONTINUE_DATA_EVENT, data, 0));
+    EXPECT_EQ(dContinue->preparedHeader_, nullptr);
+    EXPECT_NE(ret, ERR_OK);
+    EXPECT_EQ(ret, noHeaderRet);
+    DTEST_LOG << "DSchedContinueDataStateTest SinkDoContinueDataHeaderTask002 end" << std::endl;
+}
+
  /**
  * @tc.name: SinkDoContinueEndTask001
  * @tc.desc: DoContinueEndTask
@@ -354,7 +354,7 @@ HWTEST_F(DSchedContinueTest, DSchedContinueTest_007_1, TestSize.Level0)
 
 /**
  * @tc.name: DSchedContinueTest_008_1
- * @tc.desc: ExecuteContinueReq
+ * @tc.desc: ExecuteContinueReq, the connect result is handled on the continue event handler
  * @tc.type: FUNC
  */
 HWTEST_F(DSchedContinueTest, DSchedContinueTest_008_1, TestSize.Level0)
@@ -372,7 +372,7 @@ HWTEST_F(DSchedContinueTest, DSchedContinueTest_008_1, TestSize.Level0)
 
     auto wantParams = std::make_shared<DistributedWantParams>();
     int32_t ret = conti->ExecuteContinueReq(wantParams);
-    EXPECT_NE(ret, ERR_OK);
+    EXPECT_EQ(ret, ERR_OK);
 
     DTEST_LOG << "DSchedContinueTest DSchedContinueTest_008_1 end ret:" << ret << std::endl;
     usleep(WAITTIME);
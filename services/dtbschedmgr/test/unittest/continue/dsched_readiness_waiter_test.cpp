@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_readiness_waiter_test.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dtbschedmgr_log.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr int32_t MISSION_ID = 101;
+constexpr int32_t OTHER_MISSION_ID = 102;
+constexpr int64_t WAIT_TIMEOUT_MS = 2000;
+constexpr int64_t SHORT_TIMEOUT_MS = 100;
+// between two fallback probes, which run at 150 ms and 310 ms
+constexpr int64_t STATE_CHANGE_MS = 200;
+constexpr int64_t NEXT_PROBE_MS = 310;
+constexpr int64_t NOISE_INTERVAL_MS = 5;
+
+int64_t GetElapsedMs(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// stands in for the ability manager, ability states change at controlled times
+class FakeAbilityManager {
+public:
+    ~FakeAbilityManager()
+    {
+        Join();
+    }
+
+    int32_t GetAbilityStateByPersistentId(int32_t persistentId, bool& state)
+    {
+        probeCount_++;
+        std::lock_guard<std::mutex> stateLock(stateMutex_);
+        state = states_[persistentId];
+        return ERR_OK;
+    }
+
+    // with isNotify the change is reported to the mission listener as well
+    void ChangeStateAfter(int32_t persistentId, int64_t delayMs, bool isNotify)
+    {
+        threads_.emplace_back([this, persistentId, delayMs, isNotify]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+            {
+                std::lock_guard<std::mutex> stateLock(stateMutex_);
+                states_[persistentId] = true;
+            }
+            if (isNotify) {
+                DSchedReadinessWaiter::GetInstance().Notify(persistentId);
+            }
+        });
+    }
+
+    void NotifyRepeatedly(int32_t persistentId, int64_t intervalMs, int64_t durationMs)
+    {
+        threads_.emplace_back([persistentId, intervalMs, durationMs]() {
+            for (int64_t passed = 0; passed < durationMs; passed += intervalMs) {
+                DSchedReadinessWaiter::GetInstance().Notify(persistentId);
+                std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+            }
+        });
+    }
+
+    void Join()
+    {
+        for (auto& thread : threads_) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        threads_.clear();
+    }
+
+    int32_t GetProbeCount()
+    {
+        return probeCount_.load();
+    }
+
+    DSchedReadinessWaiter::Probe MakeProbe(int32_t persistentId)
+    {
+        return [this, persistentId]() {
+            bool state = false;
+            return GetAbilityStateByPersistentId(persistentId, state) == ERR_OK && state;
+        };
+    }
+
+private:
+    std::mutex stateMutex_;
+    std::map<int32_t, bool> states_;
+    std::atomic<int32_t> probeCount_ { 0 };
+    std::vector<std::thread> threads_;
+};
+}
+
+void DSchedReadinessWaiterTest::SetUpTestCase()
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest::SetUpTestCase" << std::endl;
+}
+
+void DSchedReadinessWaiterTest::TearDownTestCase()
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest::TearDownTestCase" << std::endl;
+}
+
+void DSchedReadinessWaiterTest::SetUp()
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest::SetUp" << std::endl;
+}
+
+void DSchedReadinessWaiterTest::TearDown()
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest::TearDown" << std::endl;
+    EXPECT_TRUE(DSchedReadinessWaiter::GetInstance().waiters_.empty());
+}
+
+/**
+ * @tc.name: Wait_001
+ * @tc.desc: an ability already initial is reported after one probe
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedReadinessWaiterTest, Wait_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_001 begin" << std::endl;
+    FakeAbilityManager abilityMgr;
+    abilityMgr.ChangeStateAfter(MISSION_ID, 0, false);
+    abilityMgr.Join();
+    EXPECT_TRUE(DSchedReadinessWaiter::GetInstance().Wait(MISSION_ID, abilityMgr.MakeProbe(MISSION_ID),
+        WAIT_TIMEOUT_MS));
+    EXPECT_EQ(abilityMgr.GetProbeCount(), 1);
+    EXPECT_FALSE(DSchedReadinessWaiter::GetInstance().Wait(MISSION_ID, nullptr, WAIT_TIMEOUT_MS));
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Wait_002
+ * @tc.desc: a state change event wakes the waiter before its next fallback probe
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedReadinessWaiterTest, Wait_002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_002 begin" << std::endl;
+    FakeAbilityManager abilityMgr;
+    auto begin = std::chrono::steady_clock::now();
+    abilityMgr.ChangeStateAfter(MISSION_ID, STATE_CHANGE_MS, true);
+    EXPECT_TRUE(DSchedReadinessWaiter::GetInstance().Wait(MISSION_ID, abilityMgr.MakeProbe(MISSION_ID),
+        WAIT_TIMEOUT_MS));
+    int64_t elapsedMs = GetElapsedMs(begin);
+    DTEST_LOG << "ready after " << elapsedMs << "ms, " << abilityMgr.GetProbeCount() << " probes" << std::endl;
+    EXPECT_GE(elapsedMs, STATE_CHANGE_MS);
+    EXPECT_LT(elapsedMs, NEXT_PROBE_MS);
+    abilityMgr.Join();
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: Wait_003
+ * @tc.desc: without an event the change is picked up by the backoff probes
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedReadinessWaiterTest, Wait_003, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_003 begin" << std::endl;
+    FakeAbilityManager abilityMgr;
+    auto begin = std::chrono::steady_clock::now();
+    abilityMgr.ChangeStateAfter(MISSION_ID, STATE_CHANGE_MS, false);
+    EXPECT_TRUE(DSchedReadinessWaiter::GetInstance().Wait(MISSION_ID, abilityMgr.MakeProbe(MISSION_ID),
+        WAIT_TIMEOUT_MS));
+    int64_t elapsedMs = GetElapsedMs(begin);
+    DTEST_LOG << "ready after " << elapsedMs << "ms, " << abilityMgr.GetProbeCount() << " probes" << std::endl;
+    EXPECT_GE(elapsedMs, NEXT_PROBE_MS);
+    abilityMgr.Join();
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_003 end" << std::endl;
+}
+
+/**
+ * @tc.name: Wait_004
+ * @tc.desc: events of other missions do not trigger probes, the wait ends at the timeout
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedReadinessWaiterTest, Wait_004, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_004 begin" << std::endl;
+    FakeAbilityManager abilityMgr;
+    auto begin = std::chrono::steady_clock::now();
+    abilityMgr.NotifyRepeatedly(OTHER_MISSION_ID, NOISE_INTERVAL_MS, SHORT_TIMEOUT_MS);
+    EXPECT_FALSE(DSchedReadinessWaiter::GetInstance().Wait(MISSION_ID, abilityMgr.MakeProbe(MISSION_ID),
+        SHORT_TIMEOUT_MS));
+    EXPECT_GE(GetElapsedMs(begin), SHORT_TIMEOUT_MS);
+    // probes at 0, 10, 30, 70 ms and at the deadline
+    EXPECT_LE(abilityMgr.GetProbeCount(), 5);
+    abilityMgr.Join();
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_004 end" << std::endl;
+}
+
+/**
+ * @tc.name: Wait_005
+ * @tc.desc: a wait for any mission is woken by the event of the mission that shows up
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedReadinessWaiterTest, Wait_005, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_005 begin" << std::endl;
+    FakeAbilityManager abilityMgr;
+    auto begin = std::chrono::steady_clock::now();
+    abilityMgr.ChangeStateAfter(OTHER_MISSION_ID, STATE_CHANGE_MS, true);
+    EXPECT_TRUE(DSchedReadinessWaiter::GetInstance().Wait(DSchedReadinessWaiter::ANY_MISSION,
+        abilityMgr.MakeProbe(OTHER_MISSION_ID), WAIT_TIMEOUT_MS));
+    EXPECT_LT(GetElapsedMs(begin), NEXT_PROBE_MS);
+    abilityMgr.Join();
+    DTEST_LOG << "DSchedReadinessWaiterTest Wait_005 end" << std::endl;
+}
+}
+}
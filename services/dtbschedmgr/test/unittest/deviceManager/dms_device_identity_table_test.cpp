@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_device_identity_table_test.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr int32_t DEVICE_NUM = 16;
+constexpr int32_t READER_NUM = 4;
+constexpr int32_t CHURN_ROUNDS = 2000;
+
+DmsDeviceIdentity MakeIdentity(int32_t index)
+{
+    std::string suffix = std::to_string(index);
+    return { "networkId" + suffix, "uuid" + suffix, "udid" + suffix };
+}
+}
+
+void DmsDeviceIdentityTableTest::SetUpTestCase()
+{
+    DTEST_LOG << "DmsDeviceIdentityTableTest::SetUpTestCase" << std::endl;
+}
+
+void DmsDeviceIdentityTableTest::TearDownTestCase()
+{
+    DTEST_LOG << "DmsDeviceIdentityTableTest::TearDownTestCase" << std::endl;
+}
+
+void DmsDeviceIdentityTableTest::SetUp()
+{
+    DTEST_LOG << "DmsDeviceIdentityTableTest::SetUp" << std::endl;
+}
+
+void DmsDeviceIdentityTableTest::TearDown()
+{
+    DTEST_LOG << "DmsDeviceIdentityTableTest::TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: testUpdate001
+ * @tc.desc: test all three ids are found in both directions after update
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsDeviceIdentityTableTest, testUpdate001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsDeviceIdentityTableTest testUpdate001 begin" << std::endl;
+    DmsDeviceIdentityTable table;
+    EXPECT_FALSE(table.Update({ "", "uuid", "udid" }));
+    EXPECT_FALSE(table.Update({ "networkId", "", "udid" }));
+    EXPECT_TRUE(table.Update(MakeIdentity(0)));
+    EXPECT_TRUE(table.Update({ "networkId1", "uuid1", "" }));
+
+    std::string value;
+    EXPECT_TRUE(table.GetUuidByNetworkId("networkId0", value));
+    EXPECT_EQ(value, "uuid0");
+    EXPECT_TRUE(table.GetUdidByNetworkId("networkId0", value));
+    EXPECT_EQ(value, "udid0");
+    EXPECT_TRUE(table.GetNetworkIdByUuid("uuid0", value));
+    EXPECT_EQ(value, "networkId0");
+    EXPECT_FALSE(table.GetUdidByNetworkId("networkId1", value));
+    EXPECT_FALSE(table.GetUuidByNetworkId("networkId2", value));
+    EXPECT_EQ(table.Size(), 2u);
+    DTEST_LOG << "DmsDeviceIdentityTableTest testUpdate001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testUpdate002
+ * @tc.desc: test a new networkId for a known uuid replaces the old entry in both indexes
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsDeviceIdentityTableTest, testUpdate002, TestSize.Level3)
+{
+    DTEST_LOG << "DmsDeviceIdentityTableTest testUpdate002 begin" << std::endl;
+    DmsDeviceIdentityTable table;
+    EXPECT_TRUE(table.Update({ "oldNetworkId", "uuid", "udid" }));
+    EXPECT_TRUE(table.Update({ "newNetworkId", "uuid", "udid" }));
+
+    std::string value;
+    EXPECT_FALSE(table.GetUuidByNetworkId("oldNetworkId", value));
+    EXPECT_TRUE(table.GetNetworkIdByUuid("uuid", value));
+    EXPECT_EQ(value, "newNetworkId");
+    EXPECT_EQ(table.Size(), 1u);
+
+    EXPECT_TRUE(table.Update({ "newNetworkId", "otherUuid", "udid" }));
+    EXPECT_FALSE(table.GetNetworkIdByUuid("uuid", value));
+    EXPECT_TRUE(table.GetUuidByNetworkId("newNetworkId", value));
+    EXPECT_EQ(value, "otherUuid");
+    EXPECT_EQ(table.Size(), 1u);
+    DTEST_LOG << "DmsDeviceIdentityTableTest testUpdate002 end" << std::endl;
+}
+
+/**
+ * @tc.name: testRemoveByNetworkId001
+ * @tc.desc: test remove and clear retire every index of the entry
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsDeviceIdentityTableTest, testRemoveByNetworkId001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsDeviceIdentityTableTest testRemoveByNetworkId001 begin" << std::endl;
+    DmsDeviceIdentityTable table;
+    for (int32_t i = 0; i < DEVICE_NUM; i++) {
+        EXPECT_TRUE(table.Update(MakeIdentity(i)));
+    }
+    table.RemoveByNetworkId("networkId0");
+    table.RemoveByNetworkId("unknownNetworkId");
+    std::string value;
+    EXPECT_FALSE(table.GetUuidByNetworkId("networkId0", value));
+    EXPECT_FALSE(table.GetNetworkIdByUuid("uuid0", value));
+    EXPECT_EQ(table.Size(), static_cast<size_t>(DEVICE_NUM - 1));
+
+    table.Clear();
+    EXPECT_FALSE(table.GetUuidByNetworkId("networkId1", value));
+    EXPECT_EQ(table.Size(), 0u);
+    DTEST_LOG << "DmsDeviceIdentityTableTest testRemoveByNetworkId001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testConcurrentAccess001
+ * @tc.desc: test readers always see a consistent entry while devices go on and off line
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsDeviceIdentityTableTest, testConcurrentAccess001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsDeviceIdentityTableTest testConcurrentAccess001 begin" << std::endl;
+    DmsDeviceIdentityTable table;
+    // the even devices stay online for the whole test
+    for (int32_t i = 0; i < DEVICE_NUM; i += 2) {
+        table.Update(MakeIdentity(i));
+    }
+    std::atomic<bool> stop = false;
+    std::atomic<int32_t> mismatch = 0;
+    std::vector<std::thread> readers;
+    for (int32_t r = 0; r < READER_NUM; r++) {
+        readers.emplace_back([&table, &stop, &mismatch]() {
+            std::string uuid;
+            std::string networkId;
+            while (!stop.load()) {
+                for (int32_t i = 0; i < DEVICE_NUM; i++) {
+                    DmsDeviceIdentity expect = MakeIdentity(i);
+                    bool found = table.GetUuidByNetworkId(expect.networkId, uuid);
+                    if ((found && uuid != expect.uuid) || (i % 2 == 0 && !found)) {
+                        mismatch++;
+                    }
+                    if (table.GetNetworkIdByUuid(expect.uuid, networkId) && networkId != expect.networkId) {
+                        mismatch++;
+                    }
+                }
+            }
+        });
+    }
+    for (int32_t round = 0; round < CHURN_ROUNDS; round++) {
+        for (int32_t i = 1; i < DEVICE_NUM; i += 2) {
+            table.Update(MakeIdentity(i));
+        }
+        for (int32_t i = 1; i < DEVICE_NUM; i += 2) {
+            table.RemoveByNetworkId(MakeIdentity(i).networkId);
+        }
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(mismatch.load(), 0);
+    EXPECT_EQ(table.Size(), static_cast<size_t>(DEVICE_NUM / 2));
+    DTEST_LOG << "DmsDeviceIdentityTableTest testConcurrentAccess001 end" << std::endl;
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -14,6 +14,9 @@
  */
 
 #include "distributed_sched_dumper_test.h"
+
+#include "dfx/dms_latency_histogram.h"
+#include "dfx/dms_state_trace_recorder.h"
 #include "distributed_sched_test_util.h"
 #include "test_log.h"
 
@@ -226,6 +229,59 @@ HWTEST_F(DistributedSchedDumperTest, Dump_0010, TestSize.Level3)
     DTEST_LOG << "DistributedSchedDumperTest Dump_0010 end" << std::endl;
 }
 
+/**
+ * @tc.name: Dump_0011
+ * @tc.desc: dump and reset continue stage latency
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedSchedDumperTest, Dump_0011, TestSize.Level3)
+{
+    DTEST_LOG << "DistributedSchedDumperTest Dump_0011 begin" << std::endl;
+    DistributedSchedUtil::MockProcess(HIDUMPER_PROCESS_NAME);
+    DmsLatencyRegistry::GetInstance().Record(DmsLatencyStage::CONNECT, 1000);
+    std::vector<std::string> args = { "-latency" };
+    std::string result = "";
+    bool res = DistributedSchedDumper::Dump(args, result);
+    EXPECT_TRUE(res);
+    EXPECT_NE(result.find("connect: count 1"), std::string::npos);
+
+    args = { "-latency", "-reset" };
+    res = DistributedSchedDumper::Dump(args, result);
+    EXPECT_TRUE(res);
+    EXPECT_EQ(DmsLatencyRegistry::GetInstance().GetSnapshot(DmsLatencyStage::CONNECT).count, 0u);
+
+    args = { "-latency", "-all" };
+    res = DistributedSchedDumper::Dump(args, result);
+    EXPECT_FALSE(res);
+    DTEST_LOG << "DistributedSchedDumperTest Dump_0011 end" << std::endl;
+}
+
+/**
+ * @tc.name: Dump_0012
+ * @tc.desc: dump and reset state machine traces
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedSchedDumperTest, Dump_0012, TestSize.Level3)
+{
+    DTEST_LOG << "DistributedSchedDumperTest Dump_0012 begin" << std::endl;
+    DistributedSchedUtil::MockProcess(HIDUMPER_PROCESS_NAME);
+    {
+        DmsStateTracer tracer(DmsStateMachineType::CONTINUE);
+        tracer.OnStateChanged(0);
+    }
+    std::vector<std::string> args = { "-stateTrace" };
+    std::string result = "";
+    bool res = DistributedSchedDumper::Dump(args, result);
+    EXPECT_TRUE(res);
+    EXPECT_NE(result.find("continue state 0: count 1"), std::string::npos);
+
+    args = { "-stateTrace", "-reset" };
+    res = DistributedSchedDumper::Dump(args, result);
+    EXPECT_TRUE(res);
+    EXPECT_TRUE(DmsStateTraceRecorder::GetInstance().GetTraces().empty());
+    DTEST_LOG << "DistributedSchedDumperTest Dump_0012 end" << std::endl;
+}
+
 /**
  * @tc.name: CanDump_001
  * @tc.desc: CanDump
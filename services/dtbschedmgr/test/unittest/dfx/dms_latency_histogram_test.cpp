@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_latency_histogram_test.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr uint64_t SAMPLE_COUNT = 100;
+constexpr int32_t THREAD_NUM = 8;
+constexpr uint64_t RECORD_PER_THREAD = 10000;
+constexpr uint64_t RELATIVE_ERROR_DIVISOR = DmsLatencyHistogram::SUB_BUCKET_COUNT;
+}
+
+void DmsLatencyHistogramTest::SetUpTestCase()
+{
+    DTEST_LOG << "DmsLatencyHistogramTest::SetUpTestCase" << std::endl;
+}
+
+void DmsLatencyHistogramTest::TearDownTestCase()
+{
+    DTEST_LOG << "DmsLatencyHistogramTest::TearDownTestCase" << std::endl;
+}
+
+void DmsLatencyHistogramTest::SetUp()
+{
+    DTEST_LOG << "DmsLatencyHistogramTest::SetUp" << std::endl;
+}
+
+void DmsLatencyHistogramTest::TearDown()
+{
+    DmsLatencyRegistry::GetInstance().Reset();
+    DTEST_LOG << "DmsLatencyHistogramTest::TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: testGetBucketIndex001
+ * @tc.desc: test small values are exact and larger values share log-linear buckets
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLatencyHistogramTest, testGetBucketIndex001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsLatencyHistogramTest testGetBucketIndex001 begin" << std::endl;
+    for (uint64_t value = 0; value < DmsLatencyHistogram::SUB_BUCKET_COUNT * 2; value++) {
+        EXPECT_EQ(DmsLatencyHistogram::GetBucketIndex(value), value);
+        EXPECT_EQ(DmsLatencyHistogram::GetBucketUpperBound(value), value);
+    }
+    EXPECT_EQ(DmsLatencyHistogram::GetBucketIndex(32), DmsLatencyHistogram::GetBucketIndex(33));
+    EXPECT_NE(DmsLatencyHistogram::GetBucketIndex(33), DmsLatencyHistogram::GetBucketIndex(34));
+    EXPECT_EQ(DmsLatencyHistogram::GetBucketUpperBound(DmsLatencyHistogram::GetBucketIndex(32)), 33u);
+    EXPECT_EQ(DmsLatencyHistogram::GetBucketIndex(DmsLatencyHistogram::MAX_TRACKABLE_VALUE),
+        DmsLatencyHistogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(DmsLatencyHistogram::GetBucketIndex(UINT64_MAX), DmsLatencyHistogram::BUCKET_COUNT - 1);
+    DTEST_LOG << "DmsLatencyHistogramTest testGetBucketIndex001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testGetBucketUpperBound001
+ * @tc.desc: test every value falls in a bucket whose bound is within the relative error
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLatencyHistogramTest, testGetBucketUpperBound001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsLatencyHistogramTest testGetBucketUpperBound001 begin" << std::endl;
+    size_t lastIndex = 0;
+    for (uint64_t value = 1; value <= DmsLatencyHistogram::MAX_TRACKABLE_VALUE; value = value * 3 / 2 + 1) {
+        size_t index = DmsLatencyHistogram::GetBucketIndex(value);
+        uint64_t upper = DmsLatencyHistogram::GetBucketUpperBound(index);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(upper - value, value / RELATIVE_ERROR_DIVISOR);
+        EXPECT_GE(index, lastIndex);
+        lastIndex = index;
+    }
+    for (size_t index = 1; index < DmsLatencyHistogram::BUCKET_COUNT; index++) {
+        uint64_t lower = DmsLatencyHistogram::GetBucketUpperBound(index - 1) + 1;
+        EXPECT_EQ(DmsLatencyHistogram::GetBucketIndex(lower), index);
+    }
+    DTEST_LOG << "DmsLatencyHistogramTest testGetBucketUpperBound001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testGetPercentile001
+ * @tc.desc: test percentiles of a uniform distribution
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLatencyHistogramTest, testGetPercentile001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsLatencyHistogramTest testGetPercentile001 begin" << std::endl;
+    DmsLatencyHistogram histogram;
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0u);
+    for (uint64_t value = 1; value <= SAMPLE_COUNT; value++) {
+        histogram.Record(value);
+    }
+    DmsLatencySnapshot snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(snapshot.count, SAMPLE_COUNT);
+    EXPECT_EQ(snapshot.max, SAMPLE_COUNT);
+    EXPECT_GE(snapshot.p50, 50u);
+    EXPECT_LE(snapshot.p50, 50u + 50u / RELATIVE_ERROR_DIVISOR);
+    EXPECT_GE(snapshot.p90, 90u);
+    EXPECT_LE(snapshot.p90, 90u + 90u / RELATIVE_ERROR_DIVISOR);
+    EXPECT_GE(snapshot.p99, 99u);
+    EXPECT_LE(snapshot.p99, SAMPLE_COUNT);
+
+    histogram.Reset();
+    snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_EQ(snapshot.max, 0u);
+    EXPECT_EQ(snapshot.p99, 0u);
+    DTEST_LOG << "DmsLatencyHistogramTest testGetPercentile001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testRecord001
+ * @tc.desc: test concurrent recording loses no sample
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLatencyHistogramTest, testRecord001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsLatencyHistogramTest testRecord001 begin" << std::endl;
+    auto histogram = std::make_unique<DmsLatencyHistogram>();
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < THREAD_NUM; i++) {
+        threads.emplace_back([&histogram, i]() {
+            for (uint64_t j = 0; j < RECORD_PER_THREAD; j++) {
+                histogram->Record(j * THREAD_NUM + static_cast<uint64_t>(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    uint64_t total = RECORD_PER_THREAD * THREAD_NUM;
+    EXPECT_EQ(histogram->GetCount(), total);
+    EXPECT_EQ(histogram->GetMax(), total - 1);
+    EXPECT_EQ(histogram->GetPercentile(100.0), total - 1);
+    DTEST_LOG << "DmsLatencyHistogramTest testRecord001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testRegistry001
+ * @tc.desc: test registry keeps one histogram per stage and resets them
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsLatencyHistogramTest, testRegistry001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsLatencyHistogramTest testRegistry001 begin" << std::endl;
+    DmsLatencyRegistry& registry = DmsLatencyRegistry::GetInstance();
+    registry.Reset();
+    registry.Record(DmsLatencyStage::CONNECT, 1000);
+    registry.Record(DmsLatencyStage::CONNECT, 3000);
+    registry.RecordSince(DmsLatencyStage::TRANSFER, DmsLatencyRegistry::GetNowUs());
+    registry.RecordSince(DmsLatencyStage::SINK_START, 0);
+    registry.Record(DmsLatencyStage::STAGE_MAX, 1000);
+
+    EXPECT_EQ(registry.GetSnapshot(DmsLatencyStage::CONNECT).count, 2u);
+    EXPECT_EQ(registry.GetSnapshot(DmsLatencyStage::CONNECT).max, 3000u);
+    EXPECT_EQ(registry.GetSnapshot(DmsLatencyStage::TRANSFER).count, 1u);
+    EXPECT_EQ(registry.GetSnapshot(DmsLatencyStage::SINK_START).count, 0u);
+    EXPECT_EQ(registry.GetSnapshot(DmsLatencyStage::STAGE_MAX).count, 0u);
+
+    std::string result;
+    registry.Dump(result);
+    EXPECT_NE(result.find("connect: count 2"), std::string::npos);
+
+    registry.Reset();
+    EXPECT_EQ(registry.GetSnapshot(DmsLatencyStage::CONNECT).count, 0u);
+    DTEST_LOG << "DmsLatencyHistogramTest testRegistry001 end" << std::endl;
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_state_trace_recorder_test.h"
+
+#include <memory>
+#include <unistd.h>
+
+#include "dsched_collab.h"
+#include "dsched_continue.h"
+#include "dtbschedmgr_log.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr int64_t DWELL_TIME_US = 10000;
+constexpr int32_t EXTRA_SESSION_NUM = 5;
+constexpr int32_t INVALID_STATE = 100;
+constexpr int32_t ERR_RESULT = -1;
+
+// only the state machine is set up, Init would also start the event thread of the session
+std::shared_ptr<DSchedContinue> CreateContinue(int32_t direction)
+{
+    sptr<IRemoteObject> callback = nullptr;
+    DSchedContinueInfo continueInfo;
+    auto dContinue = std::make_shared<DSchedContinue>(CONTINUE_PUSH, direction, callback, continueInfo);
+    dContinue->stateMachine_ = std::make_shared<DSchedContinueStateMachine>(dContinue);
+    return dContinue;
+}
+
+std::shared_ptr<DSchedCollab> CreateCollab(int32_t direction)
+{
+    DSchedCollabInfo info;
+    info.direction_ = direction;
+    auto dCollab = std::make_shared<DSchedCollab>("", info);
+    dCollab->stateMachine_ = std::make_shared<DSchedCollabStateMachine>(dCollab);
+    return dCollab;
+}
+}
+
+void DmsStateTraceRecorderTest::SetUpTestCase()
+{
+    DTEST_LOG << "DmsStateTraceRecorderTest::SetUpTestCase" << std::endl;
+}
+
+void DmsStateTraceRecorderTest::TearDownTestCase()
+{
+    DTEST_LOG << "DmsStateTraceRecorderTest::TearDownTestCase" << std::endl;
+}
+
+void DmsStateTraceRecorderTest::SetUp()
+{
+    DmsStateTraceRecorder::GetInstance().Reset();
+    DTEST_LOG << "DmsStateTraceRecorderTest::SetUp" << std::endl;
+}
+
+void DmsStateTraceRecorderTest::TearDown()
+{
+    DmsStateTraceRecorder::GetInstance().Reset();
+    DTEST_LOG << "DmsStateTraceRecorderTest::TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: testContinueSourceTrace001
+ * @tc.desc: test a continue source session is recorded with the event behind every transition
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsStateTraceRecorderTest, testContinueSourceTrace001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsStateTraceRecorderTest testContinueSourceTrace001 begin" << std::endl;
+    auto dContinue = CreateContinue(CONTINUE_SOURCE);
+    dContinue->UpdateState(DSCHED_CONTINUE_SOURCE_START_STATE);
+    int32_t ret = dContinue->stateMachine_->Execute(AppExecFwk::InnerEvent::Get(DSCHED_CONTINUE_DATA_EVENT));
+    EXPECT_EQ(ret, CONTINUE_STATE_MACHINE_INVALID_STATE);
+    ret = dContinue->stateMachine_->Execute(AppExecFwk::InnerEvent::Get(DSCHED_CONTINUE_END_EVENT,
+        std::make_shared<int32_t>(ERR_RESULT), 0));
+    EXPECT_EQ(ret, ERR_OK);
+    EXPECT_EQ(dContinue->stateMachine_->GetStateType(), DSCHED_CONTINUE_SOURCE_END_STATE);
+    EXPECT_TRUE(DmsStateTraceRecorder::GetInstance().GetTraces().empty());
+    dContinue = nullptr;
+
+    auto traces = DmsStateTraceRecorder::GetInstance().GetTraces();
+    ASSERT_EQ(traces.size(), 1u);
+    const DmsStateSessionTrace& trace = traces[0];
+    EXPECT_EQ(trace.type, DmsStateMachineType::CONTINUE);
+    EXPECT_FALSE(trace.isTruncated);
+    ASSERT_EQ(trace.transitions.size(), 2u);
+    EXPECT_EQ(trace.transitions[0].fromState, DmsStateTracer::NO_STATE);
+    EXPECT_EQ(trace.transitions[0].toState, DSCHED_CONTINUE_SOURCE_START_STATE);
+    EXPECT_EQ(trace.transitions[0].eventId, DmsStateTracer::NO_EVENT);
+    EXPECT_EQ(trace.transitions[1].fromState, DSCHED_CONTINUE_SOURCE_START_STATE);
+    EXPECT_EQ(trace.transitions[1].toState, DSCHED_CONTINUE_SOURCE_END_STATE);
+    EXPECT_EQ(trace.transitions[1].eventId, DSCHED_CONTINUE_END_EVENT);
+    EXPECT_GE(trace.endUs, trace.transitions[1].timeUs);
+
+    DmsStateDwellStat stat = DmsStateTraceRecorder::GetInstance().GetDwellStat(DmsStateMachineType::CONTINUE,
+        DSCHED_CONTINUE_SOURCE_START_STATE);
+    EXPECT_EQ(stat.count, 1u);
+    stat = DmsStateTraceRecorder::GetInstance().GetDwellStat(DmsStateMachineType::CONTINUE,
+        DSCHED_CONTINUE_SOURCE_END_STATE);
+    EXPECT_EQ(stat.count, 1u);
+    DTEST_LOG << "DmsStateTraceRecorderTest testContinueSourceTrace001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testCollabSinkTrace001
+ * @tc.desc: test a collab sink session and the dwell time of the state it waited in
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsStateTraceRecorderTest, testCollabSinkTrace001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsStateTraceRecorderTest testCollabSinkTrace001 begin" << std::endl;
+    auto dCollab = CreateCollab(COLLAB_SINK);
+    dCollab->UpdateState(SINK_GET_VERSION_STATE);
+    int32_t ret = dCollab->stateMachine_->Execute(AppExecFwk::InnerEvent::Get(GET_SINK_VERSION_EVENT));
+    EXPECT_EQ(ret, ERR_OK);
+    EXPECT_EQ(dCollab->stateMachine_->GetStateType(), SINK_START_STATE);
+    usleep(DWELL_TIME_US);
+    EXPECT_TRUE(DmsStateTraceRecorder::GetInstance().GetTraces().empty());
+    dCollab = nullptr;
+
+    auto traces = DmsStateTraceRecorder::GetInstance().GetTraces();
+    ASSERT_EQ(traces.size(), 1u);
+    EXPECT_EQ(traces[0].type, DmsStateMachineType::COLLAB);
+    ASSERT_EQ(traces[0].transitions.size(), 2u);
+    EXPECT_EQ(traces[0].transitions[1].fromState, SINK_GET_VERSION_STATE);
+    EXPECT_EQ(traces[0].transitions[1].toState, SINK_START_STATE);
+    EXPECT_EQ(traces[0].transitions[1].eventId, GET_SINK_VERSION_EVENT);
+    EXPECT_GE(traces[0].endUs - traces[0].transitions[1].timeUs, DWELL_TIME_US);
+
+    DmsStateDwellStat stat = DmsStateTraceRecorder::GetInstance().GetDwellStat(DmsStateMachineType::COLLAB,
+        SINK_START_STATE);
+    EXPECT_EQ(stat.count, 1u);
+    EXPECT_GE(stat.maxUs, static_cast<uint64_t>(DWELL_TIME_US));
+    EXPECT_EQ(DmsStateTraceRecorder::GetInstance().GetDwellStat(DmsStateMachineType::CONTINUE,
+        SINK_START_STATE).count, 0u);
+    DTEST_LOG << "DmsStateTraceRecorderTest testCollabSinkTrace001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testInvalidState001
+ * @tc.desc: test a state the machine cannot create is not recorded
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsStateTraceRecorderTest, testInvalidState001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsStateTraceRecorderTest testInvalidState001 begin" << std::endl;
+    auto dCollab = CreateCollab(COLLAB_SOURCE);
+    dCollab->UpdateState(static_cast<CollabStateType>(INVALID_STATE));
+    dCollab = nullptr;
+    EXPECT_TRUE(DmsStateTraceRecorder::GetInstance().GetTraces().empty());
+
+    auto dContinue = CreateContinue(CONTINUE_SINK);
+    dContinue->UpdateState(DSCHED_CONTINUE_SINK_START_STATE);
+    dContinue->UpdateState(static_cast<DSchedContinueStateType>(INVALID_STATE));
+    dContinue = nullptr;
+    auto traces = DmsStateTraceRecorder::GetInstance().GetTraces();
+    ASSERT_EQ(traces.size(), 1u);
+    EXPECT_EQ(traces[0].transitions.size(), 1u);
+    DTEST_LOG << "DmsStateTraceRecorderTest testInvalidState001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testBoundedTraces001
+ * @tc.desc: test only the latest sessions and the first transitions of a session are kept
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsStateTraceRecorderTest, testBoundedTraces001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsStateTraceRecorderTest testBoundedTraces001 begin" << std::endl;
+    auto dCollab = CreateCollab(COLLAB_SOURCE);
+    dCollab->UpdateState(SOURCE_START_STATE);
+    for (size_t i = 0; i < DmsStateTraceRecorder::MAX_TRANSITION_COUNT; i++) {
+        dCollab->UpdateState(i % 2 == 0 ? SOURCE_WAIT_RESULT_STATE : SOURCE_START_STATE);
+    }
+    dCollab = nullptr;
+    auto traces = DmsStateTraceRecorder::GetInstance().GetTraces();
+    ASSERT_EQ(traces.size(), 1u);
+    EXPECT_TRUE(traces[0].isTruncated);
+    EXPECT_EQ(traces[0].transitions.size(), DmsStateTraceRecorder::MAX_TRANSITION_COUNT);
+    uint64_t firstTraceId = traces[0].traceId;
+
+    for (size_t i = 0; i < DmsStateTraceRecorder::MAX_SESSION_COUNT + EXTRA_SESSION_NUM; i++) {
+        CreateContinue(CONTINUE_SINK)->UpdateState(DSCHED_CONTINUE_SINK_START_STATE);
+    }
+    traces = DmsStateTraceRecorder::GetInstance().GetTraces();
+    ASSERT_EQ(traces.size(), DmsStateTraceRecorder::MAX_SESSION_COUNT);
+    EXPECT_GT(traces.front().traceId, firstTraceId + EXTRA_SESSION_NUM);
+    EXPECT_LT(traces.front().traceId, traces.back().traceId);
+    EXPECT_EQ(DmsStateTraceRecorder::GetInstance().GetDwellStat(DmsStateMachineType::CONTINUE,
+        DSCHED_CONTINUE_SINK_START_STATE).count, DmsStateTraceRecorder::MAX_SESSION_COUNT + EXTRA_SESSION_NUM);
+    DTEST_LOG << "DmsStateTraceRecorderTest testBoundedTraces001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testDump001
+ * @tc.desc: test dump shows the dwell statistics and the recent sessions
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsStateTraceRecorderTest, testDump001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsStateTraceRecorderTest testDump001 begin" << std::endl;
+    auto dCollab = CreateCollab(COLLAB_SINK);
+    dCollab->UpdateState(SINK_GET_VERSION_STATE);
+    EXPECT_EQ(dCollab->stateMachine_->Execute(AppExecFwk::InnerEvent::Get(GET_SINK_VERSION_EVENT)), ERR_OK);
+    dCollab = nullptr;
+    std::string result;
+    DmsStateTraceRecorder::GetInstance().Dump(result);
+    EXPECT_NE(result.find("collab state " + std::to_string(SINK_GET_VERSION_STATE) + ": count 1"),
+        std::string::npos);
+    EXPECT_NE(result.find("collab, total"), std::string::npos);
+    EXPECT_NE(result.find("event " + std::to_string(GET_SINK_VERSION_EVENT)), std::string::npos);
+
+    DmsStateTraceRecorder::GetInstance().Reset();
+    result.clear();
+    DmsStateTraceRecorder::GetInstance().Dump(result);
+    EXPECT_EQ(result.find("collab"), std::string::npos);
+    DTEST_LOG << "DmsStateTraceRecorderTest testDump001 end" << std::endl;
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
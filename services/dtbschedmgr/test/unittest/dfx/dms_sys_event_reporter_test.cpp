@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_sys_event_reporter_test.h"
+
+#include <chrono>
+
+#include "dtbschedmgr_log.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TEST_DOMAIN = "APP_CONTINUE";
+const std::string TEST_EVENT = "APPLICATION_CONTINUE_BEHAVIOR";
+constexpr int32_t TEST_EVENT_TYPE = 4;
+constexpr int32_t FLUSH_TIMEOUT = 3000;
+constexpr size_t SMALL_CAPACITY = 4;
+}
+
+void CaptureSysEventSink::Write(const std::vector<DmsSysEvent>& events)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    isEntered_ = true;
+    con_.notify_all();
+    con_.wait(lock, [this] { return !isBlocked_; });
+    events_.insert(events_.end(), events.begin(), events.end());
+}
+
+void CaptureSysEventSink::Block()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    isBlocked_ = true;
+    isEntered_ = false;
+}
+
+void CaptureSysEventSink::Release()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    isBlocked_ = false;
+    con_.notify_all();
+}
+
+bool CaptureSysEventSink::WaitEntered(int32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return con_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return isEntered_; });
+}
+
+void DmsSysEventReporterTest::SetUpTestCase()
+{
+    DTEST_LOG << "DmsSysEventReporterTest::SetUpTestCase" << std::endl;
+}
+
+void DmsSysEventReporterTest::TearDownTestCase()
+{
+    DTEST_LOG << "DmsSysEventReporterTest::TearDownTestCase" << std::endl;
+}
+
+void DmsSysEventReporterTest::SetUp()
+{
+    sink_ = std::make_shared<CaptureSysEventSink>();
+    DTEST_LOG << "DmsSysEventReporterTest::SetUp" << std::endl;
+}
+
+void DmsSysEventReporterTest::TearDown()
+{
+    sink_->Release();
+    DTEST_LOG << "DmsSysEventReporterTest::TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: testReport001
+ * @tc.desc: test Report with empty domain or event name
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsSysEventReporterTest, testReport001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsSysEventReporterTest testReport001 begin" << std::endl;
+    DmsSysEventReporter reporter(sink_);
+    EXPECT_EQ(reporter.Report("", TEST_EVENT, TEST_EVENT_TYPE), INVALID_PARAMETERS_ERR);
+    EXPECT_EQ(reporter.Report(TEST_DOMAIN, "", TEST_EVENT_TYPE), INVALID_PARAMETERS_ERR);
+    EXPECT_TRUE(reporter.Flush(FLUSH_TIMEOUT));
+    EXPECT_TRUE(sink_->events_.empty());
+    EXPECT_EQ(reporter.GetDroppedCount(), 0u);
+    DTEST_LOG << "DmsSysEventReporterTest testReport001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testReport002
+ * @tc.desc: test events reach the sink in order with all fields
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsSysEventReporterTest, testReport002, TestSize.Level3)
+{
+    DTEST_LOG << "DmsSysEventReporterTest testReport002 begin" << std::endl;
+    DmsSysEventReporter reporter(sink_);
+    int64_t beginTime = 1234567890123;
+    std::string func = "testReport002";
+    EXPECT_EQ(reporter.Report(TEST_DOMAIN, TEST_EVENT, TEST_EVENT_TYPE, "FUNC", func, "BIZ_STAGE", 1,
+        "BEGIN_TIME", beginTime, "ORG_PKG", "dms"), ERR_OK);
+    EXPECT_EQ(reporter.Report(TEST_DOMAIN, TEST_EVENT, TEST_EVENT_TYPE, "BIZ_STAGE", 2), ERR_OK);
+    EXPECT_TRUE(reporter.Flush(FLUSH_TIMEOUT));
+
+    ASSERT_EQ(sink_->events_.size(), 2u);
+    const DmsSysEvent& first = sink_->events_[0];
+    EXPECT_EQ(first.domain, TEST_DOMAIN);
+    EXPECT_EQ(first.eventName, TEST_EVENT);
+    EXPECT_EQ(first.eventType, TEST_EVENT_TYPE);
+    ASSERT_EQ(first.params.size(), 4u);
+    EXPECT_EQ(first.params[0].name, "FUNC");
+    EXPECT_EQ(first.params[0].type, DmsSysEventParam::Type::STRING);
+    EXPECT_EQ(first.params[0].strValue, func);
+    EXPECT_EQ(first.params[1].type, DmsSysEventParam::Type::INT32);
+    EXPECT_EQ(first.params[1].intValue, 1);
+    EXPECT_EQ(first.params[2].type, DmsSysEventParam::Type::INT64);
+    EXPECT_EQ(first.params[2].intValue, beginTime);
+    EXPECT_EQ(first.params[3].strValue, "dms");
+    EXPECT_EQ(sink_->events_[1].params[0].intValue, 2);
+    EXPECT_EQ(reporter.GetReportedCount(), 2u);
+    DTEST_LOG << "DmsSysEventReporterTest testReport002 end" << std::endl;
+}
+
+/**
+ * @tc.name: testReport003
+ * @tc.desc: test events are dropped and counted when the queue is full
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsSysEventReporterTest, testReport003, TestSize.Level3)
+{
+    DTEST_LOG << "DmsSysEventReporterTest testReport003 begin" << std::endl;
+    DmsSysEventReporter reporter(sink_, SMALL_CAPACITY, 1);
+    sink_->Block();
+    EXPECT_EQ(reporter.Report(TEST_DOMAIN, TEST_EVENT, TEST_EVENT_TYPE, "INDEX", 0), ERR_OK);
+    ASSERT_TRUE(sink_->WaitEntered(FLUSH_TIMEOUT));
+
+    for (int32_t i = 1; i <= static_cast<int32_t>(SMALL_CAPACITY); i++) {
+        EXPECT_EQ(reporter.Report(TEST_DOMAIN, TEST_EVENT, TEST_EVENT_TYPE, "INDEX", i), ERR_OK);
+    }
+    EXPECT_EQ(reporter.Report(TEST_DOMAIN, TEST_EVENT, TEST_EVENT_TYPE, "INDEX", 100),
+        DMS_SYS_EVENT_QUEUE_FULL_ERR);
+    EXPECT_EQ(reporter.Report(TEST_DOMAIN, TEST_EVENT, TEST_EVENT_TYPE, "INDEX", 101),
+        DMS_SYS_EVENT_QUEUE_FULL_ERR);
+    EXPECT_EQ(reporter.GetDroppedCount(), 2u);
+
+    sink_->Release();
+    EXPECT_TRUE(reporter.Flush(FLUSH_TIMEOUT));
+    ASSERT_EQ(sink_->events_.size(), SMALL_CAPACITY + 1);
+    for (size_t i = 0; i < sink_->events_.size(); i++) {
+        EXPECT_EQ(sink_->events_[i].params[0].intValue, static_cast<int64_t>(i));
+    }
+    DTEST_LOG << "DmsSysEventReporterTest testReport003 end" << std::endl;
+}
+
+/**
+ * @tc.name: testStop001
+ * @tc.desc: test Stop delivers queued events and rejects new ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsSysEventReporterTest, testStop001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsSysEventReporterTest testStop001 begin" << std::endl;
+    DmsSysEventReporter reporter(sink_);
+    EXPECT_EQ(reporter.Report(TEST_DOMAIN, TEST_EVENT, TEST_EVENT_TYPE, "INDEX", 0), ERR_OK);
+    reporter.Stop();
+    EXPECT_EQ(sink_->events_.size(), 1u);
+    EXPECT_EQ(reporter.Report(TEST_DOMAIN, TEST_EVENT, TEST_EVENT_TYPE, "INDEX", 1),
+        DMS_SYS_EVENT_QUEUE_FULL_ERR);
+    EXPECT_EQ(reporter.GetDroppedCount(), 1u);
+    DTEST_LOG << "DmsSysEventReporterTest testStop001 end" << std::endl;
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
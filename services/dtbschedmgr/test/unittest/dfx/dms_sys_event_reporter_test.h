@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMSFWK_BASE_DMS_SYS_EVENT_REPORTER_TEST_H
+#define OHOS_DMSFWK_BASE_DMS_SYS_EVENT_REPORTER_TEST_H
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "dfx/dms_sys_event_reporter.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+class CaptureSysEventSink : public IDmsSysEventSink {
+public:
+    void Write(const std::vector<DmsSysEvent>& events) override;
+    void Block();
+    void Release();
+    bool WaitEntered(int32_t timeoutMs);
+
+    std::vector<DmsSysEvent> events_;
+
+private:
+    std::mutex mutex_;
+    std::condition_variable con_;
+    bool isBlocked_ = false;
+    bool isEntered_ = false;
+};
+
+class DmsSysEventReporterTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<CaptureSysEventSink> sink_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMSFWK_BASE_DMS_SYS_EVENT_REPORTER_TEST_H
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 
 #define private public
@@ -39,6 +40,30 @@ using namespace OHOS;
 using namespace AAFwk;
 using namespace DistributedSchedule;
 using OHOS::Parcel;
+namespace {
+constexpr int32_t BENCHMARK_ROUNDS = 100;
+constexpr int32_t NESTED_DEPTH = 3;
+
+// key count params on every level, one nested params per level down to depth
+DistributedWantParams MakeNestedParams(int32_t keyCount, int32_t depth)
+{
+    DistributedWantParams params;
+    for (int32_t i = 0; i < keyCount; i++) {
+        params.SetParam("string" + std::to_string(i), String::Box("value" + std::to_string(i)));
+        params.SetParam("int" + std::to_string(i), Integer::Box(i));
+    }
+    if (depth > 0) {
+        params.SetParam("nested", DistributedWantParamWrapper::Box(MakeNestedParams(keyCount, depth - 1)));
+    }
+    return params;
+}
+
+int64_t GetElapsedUs(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+}
+
 class DistributedWantParamsBaseTest : public testing::Test {
 public:
     DistributedWantParamsBaseTest()
@@ -1290,4 +1315,127 @@ HWTEST_F(DistributedWantParamsBaseTest, ReadUnsupportedData_0002, Function | Med
     delete[] bufferP;
     DTEST_LOG << "DistributedWantParamsBaseTest ReadUnsupportedData_0002 end" << std::endl;
 }
- 
\ No newline at end of file
+
+/**
+ * @tc.number: DistributedWantParams_CopyOnWrite_0100
+ * @tc.name: copy on write
+ * @tc.desc: Test a copy shares the params until one side is modified.
+ */
+HWTEST_F(DistributedWantParamsBaseTest, DistributedWantParams_CopyOnWrite_0100, Function | MediumTest | Level3)
+{
+    DTEST_LOG << "DistributedWantParamsBaseTest DistributedWantParams_CopyOnWrite_0100 begin" << std::endl;
+    DistributedWantParams source = MakeNestedParams(4, 1);
+    DistributedWantParams copy(source);
+    EXPECT_TRUE(copy.params_.SharesWith(source.params_));
+    EXPECT_TRUE(copy == source);
+
+    copy.Remove("absent");
+    EXPECT_TRUE(copy.params_.SharesWith(source.params_));
+
+    copy.SetParam("string0", String::Box("changed"));
+    copy.Remove("int1");
+    EXPECT_FALSE(copy.params_.SharesWith(source.params_));
+    EXPECT_EQ(String::Unbox(IString::Query(source.GetParam("string0"))), "value0");
+    EXPECT_EQ(String::Unbox(IString::Query(copy.GetParam("string0"))), "changed");
+    EXPECT_TRUE(source.HasParam("int1"));
+    EXPECT_FALSE(copy.HasParam("int1"));
+    EXPECT_EQ(copy.GetParam("nested"), source.GetParam("nested"));
+
+    DistributedWantParams assigned;
+    assigned = source;
+    assigned.params_.clear();
+    EXPECT_TRUE(assigned.IsEmpty());
+    EXPECT_EQ(source.Size(), 9);
+    DTEST_LOG << "DistributedWantParamsBaseTest DistributedWantParams_CopyOnWrite_0100 end" << std::endl;
+}
+
+/**
+ * @tc.number: DistributedWantParams_CopyOnWrite_0200
+ * @tc.name: copy on write
+ * @tc.desc: Test boxing moves the params and unboxing shares them with the wrapper.
+ */
+HWTEST_F(DistributedWantParamsBaseTest, DistributedWantParams_CopyOnWrite_0200, Function | MediumTest | Level3)
+{
+    DTEST_LOG << "DistributedWantParamsBaseTest DistributedWantParams_CopyOnWrite_0200 begin" << std::endl;
+    DistributedWantParams inner = MakeNestedParams(2, 0);
+    DistributedWantParams expected(inner);
+    sptr<IDistributedWantParams> boxed = DistributedWantParamWrapper::Box(std::move(inner));
+    ASSERT_NE(boxed, nullptr);
+    EXPECT_TRUE(inner.IsEmpty());
+
+    DistributedWantParams unboxed = DistributedWantParamWrapper::Unbox(boxed);
+    auto wrapper = static_cast<DistributedWantParamWrapper*>(boxed.GetRefPtr());
+    EXPECT_TRUE(unboxed.params_.SharesWith(wrapper->wantParams_.params_));
+    EXPECT_TRUE(unboxed == expected);
+
+    unboxed.SetParam("int0", Integer::Box(100));
+    EXPECT_FALSE(unboxed.params_.SharesWith(wrapper->wantParams_.params_));
+    EXPECT_TRUE(wrapper->wantParams_ == expected);
+    DTEST_LOG << "DistributedWantParamsBaseTest DistributedWantParams_CopyOnWrite_0200 end" << std::endl;
+}
+
+/**
+ * @tc.number: DistributedWantParams_Conversion_0100
+ * @tc.name: ToWantParams/Marshalling
+ * @tc.desc: Test a shared copy converts and marshals the same as the source.
+ */
+HWTEST_F(DistributedWantParamsBaseTest, DistributedWantParams_Conversion_0100, Function | MediumTest | Level3)
+{
+    DTEST_LOG << "DistributedWantParamsBaseTest DistributedWantParams_Conversion_0100 begin" << std::endl;
+    DistributedWantParams source = MakeNestedParams(8, NESTED_DEPTH);
+    DistributedWantParams copy(source);
+    WantParams sourceWantParams = source.ToWantParams();
+    WantParams copyWantParams = copy.ToWantParams();
+    EXPECT_EQ(sourceWantParams.Size(), source.Size());
+    EXPECT_TRUE(sourceWantParams == copyWantParams);
+    for (const auto& [key, value] : source.GetParams()) {
+        EXPECT_EQ(sourceWantParams.GetParam(key), value);
+    }
+
+    Parcel sourceParcel;
+    Parcel copyParcel;
+    EXPECT_TRUE(source.Marshalling(sourceParcel));
+    EXPECT_TRUE(copy.Marshalling(copyParcel));
+    ASSERT_EQ(sourceParcel.GetDataSize(), copyParcel.GetDataSize());
+    std::unique_ptr<DistributedWantParams> unmarshalled(DistributedWantParams::Unmarshalling(copyParcel));
+    ASSERT_NE(unmarshalled, nullptr);
+    EXPECT_TRUE(*unmarshalled == source);
+    DTEST_LOG << "DistributedWantParamsBaseTest DistributedWantParams_Conversion_0100 end" << std::endl;
+}
+
+/**
+ * @tc.number: DistributedWantParams_Benchmark_0100
+ * @tc.name: copy, box and unbox cost
+ * @tc.desc: Test the conversion cost of nested params against the key count.
+ */
+HWTEST_F(DistributedWantParamsBaseTest, DistributedWantParams_Benchmark_0100, Function | MediumTest | Level3)
+{
+    DTEST_LOG << "DistributedWantParamsBaseTest DistributedWantParams_Benchmark_0100 begin" << std::endl;
+    for (int32_t keyCount : { 4, 16, 64, 256 }) {
+        DistributedWantParams source = MakeNestedParams(keyCount, NESTED_DEPTH);
+        int64_t copyUs = 0;
+        int64_t boxUs = 0;
+        int64_t toWantParamsUs = 0;
+        for (int32_t round = 0; round < BENCHMARK_ROUNDS; round++) {
+            auto begin = std::chrono::steady_clock::now();
+            DistributedWantParams copy(source);
+            copy.SetParam("round", Integer::Box(round));
+            copyUs += GetElapsedUs(begin);
+
+            begin = std::chrono::steady_clock::now();
+            DistributedWantParams unboxed =
+                DistributedWantParamWrapper::Unbox(DistributedWantParamWrapper::Box(std::move(copy)));
+            boxUs += GetElapsedUs(begin);
+            EXPECT_EQ(unboxed.Size(), source.Size() + 1);
+
+            begin = std::chrono::steady_clock::now();
+            WantParams wantParams = source.ToWantParams();
+            toWantParamsUs += GetElapsedUs(begin);
+            EXPECT_EQ(wantParams.Size(), source.Size());
+        }
+        DTEST_LOG << "keys " << keyCount << ", depth " << NESTED_DEPTH << ": copy+set " <<
+            copyUs / BENCHMARK_ROUNDS << "us, box+unbox " << boxUs / BENCHMARK_ROUNDS << "us, to want params " <<
+            toWantParamsUs / BENCHMARK_ROUNDS << "us" << std::endl;
+    }
+    DTEST_LOG << "DistributedWantParamsBaseTest DistributedWantParams_Benchmark_0100 end" << std::endl;
+}
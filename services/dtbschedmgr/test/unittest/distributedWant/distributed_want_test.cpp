@@ -3929,5 +3929,40 @@ HWTEST_F(DistributedWantBaseTest, ReadFromJson_test_002, TestSize.Level3)
     EXPECT_EQ(want.FromString(str), nullptr);
     GTEST_LOG_(INFO) << "ReadFromJson_test_002 end";
 }
+
+/**
+ * @tc.number: Move_test_001
+ * @tc.name: DistributedWant(DistributedWant&&)
+ * @tc.desc: Test a moved want keeps the operation and params and converts like a copy.
+ */
+HWTEST_F(DistributedWantBaseTest, Move_test_001, TestSize.Level3)
+{
+    GTEST_LOG_(INFO) << "Move_test_001 start";
+    Want want;
+    want.SetElementName("deviceId", "bundleName", "abilityName");
+    want.SetParam("intKey", 1);
+    want.SetParam("stringKey", std::string("value"));
+    DistributedWant source(want);
+    DistributedWant copy(source);
+    EXPECT_TRUE(copy.parameters_.params_.SharesWith(source.parameters_.params_));
+
+    DistributedWant moved(std::move(source));
+    EXPECT_TRUE(source.GetParams().IsEmpty());
+    EXPECT_TRUE(moved.parameters_ == copy.parameters_);
+    EXPECT_EQ(moved.GetElement().GetBundleName(), "bundleName");
+
+    std::shared_ptr<Want> movedWant = moved.ToWant();
+    std::shared_ptr<Want> copyWant = copy.ToWant();
+    ASSERT_NE(movedWant, nullptr);
+    ASSERT_NE(copyWant, nullptr);
+    EXPECT_EQ(movedWant->GetIntParam("intKey", 0), 1);
+    EXPECT_EQ(movedWant->GetStringParam("stringKey"), "value");
+    EXPECT_EQ(movedWant->GetParams().Size(), copyWant->GetParams().Size());
+
+    DistributedWant assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.GetParams().Size(), copy.GetParams().Size());
+    GTEST_LOG_(INFO) << "Move_test_001 end";
+}
 }  // namespace DistributedSchedule
 }  // namespace OHOS
\ No newline at end of file
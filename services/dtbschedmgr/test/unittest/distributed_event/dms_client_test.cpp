@@ -17,6 +17,7 @@
 #include "ability_manager_errors.h"
 #include "distributed_parcel_helper.h"
 #include "distributed_sched_test_util.h"
+#include "distributedsched_ipc_interface_code.h"
 #include "if_system_ability_manager.h"
 #include "ipc_skeleton.h"
 #include "iservice_registry.h"
@@ -53,12 +54,42 @@ void DistributedClientTest::SetUp()
 void DistributedClientTest::TearDown()
 {
     DTEST_LOG << "DistributedClientTest::TearDown" << std::endl;
+    DistributedClient::proxyLoader_ = nullptr;
+    DistributedClient::ResetDmsProxy();
 }
 
 void BusinessHandlerTest::DSchedEventNotify(EventNotify &notify)
 {
 }
 
+int MockDmsRemoteObject::OnRemoteRequest(uint32_t code, MessageParcel& data, MessageParcel& reply,
+    MessageOption& option)
+{
+    codes_.emplace_back(code);
+    if (code == static_cast<uint32_t>(IDSchedInterfaceCode::REGISTER_DSCHED_EVENT_LISTENERS)) {
+        data.ReadInterfaceToken();
+        uint32_t size = data.ReadUint32();
+        for (uint32_t i = 0; i < size; i++) {
+            registeredTypes_.emplace_back(data.ReadUint8());
+            data.ReadRemoteObject();
+        }
+    }
+    reply.WriteInt32(ERR_OK);
+    return ERR_NONE;
+}
+
+bool MockDmsRemoteObject::AddDeathRecipient(const sptr<DeathRecipient>& recipient)
+{
+    deathRecipient_ = recipient;
+    return true;
+}
+
+bool MockDmsRemoteObject::RemoveDeathRecipient(const sptr<DeathRecipient>& recipient)
+{
+    deathRecipient_ = nullptr;
+    return true;
+}
+
 /**
  * @tc.name: RegisterDSchedEventListener_001
  * @tc.desc: RegisterDSchedEventListener
@@ -137,5 +168,116 @@ HWTEST_F(DistributedClientTest, DistributedClientTest_ConnectDExtAbility_001, Te
     EXPECT_NE(rlt, ERR_NONE);
     GTEST_LOG_(INFO) << "DistributedClientTest_ConnectDExtAbility_001 end";
 }
+
+/**
+ * @tc.name: GetDmsProxy_001
+ * @tc.desc: the dms proxy is looked up once and shared by later calls of every client
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedClientTest, GetDmsProxy_001, TestSize.Level3)
+{
+    DTEST_LOG << "DistributedClientTest GetDmsProxy_001 start" << std::endl;
+    sptr<MockDmsRemoteObject> dms(new MockDmsRemoteObject());
+    int32_t lookupCount = 0;
+    DistributedClient::ResetDmsProxy();
+    DistributedClient::proxyLoader_ = [&lookupCount, dms]() -> sptr<IRemoteObject> {
+        lookupCount++;
+        return dms;
+    };
+    sptr<IDSchedEventListener> listener(new BusinessHandlerTest());
+    EXPECT_EQ(distributedClient_.RegisterDSchedEventListener(DMS_CONTINUE, listener), ERR_OK);
+    EXPECT_EQ(distributedClient_.UnRegisterDSchedEventListener(DMS_CONTINUE, listener), ERR_OK);
+    DistributedClient otherClient;
+    EXPECT_EQ(otherClient.RegisterDSchedEventListener(DMS_COLLABORATION, listener), ERR_OK);
+    EXPECT_EQ(lookupCount, 1);
+    EXPECT_EQ(dms->codes_.size(), 3u);
+    EXPECT_NE(dms->deathRecipient_, nullptr);
+    DTEST_LOG << "DistributedClientTest GetDmsProxy_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: GetDmsProxy_002
+ * @tc.desc: the dms proxy is dropped when dms dies and looked up again by the next call
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedClientTest, GetDmsProxy_002, TestSize.Level3)
+{
+    DTEST_LOG << "DistributedClientTest GetDmsProxy_002 start" << std::endl;
+    sptr<MockDmsRemoteObject> dms(new MockDmsRemoteObject());
+    int32_t lookupCount = 0;
+    DistributedClient::ResetDmsProxy();
+    DistributedClient::proxyLoader_ = [&lookupCount, dms]() -> sptr<IRemoteObject> {
+        lookupCount++;
+        return dms;
+    };
+    sptr<IDSchedEventListener> listener(new BusinessHandlerTest());
+    EXPECT_EQ(distributedClient_.RegisterDSchedEventListener(DMS_CONTINUE, listener), ERR_OK);
+    sptr<IRemoteObject::DeathRecipient> deathRecipient = dms->deathRecipient_;
+    ASSERT_NE(deathRecipient, nullptr);
+    sptr<IRemoteObject> remote = dms;
+    deathRecipient->OnRemoteDied(remote);
+    EXPECT_EQ(DistributedClient::dmsProxy_, nullptr);
+    EXPECT_EQ(dms->deathRecipient_, nullptr);
+
+    EXPECT_EQ(distributedClient_.RegisterDSchedEventListener(DMS_CONTINUE, listener), ERR_OK);
+    EXPECT_EQ(lookupCount, 2);
+    EXPECT_EQ(dms->codes_.size(), 2u);
+    DTEST_LOG << "DistributedClientTest GetDmsProxy_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: RegisterDSchedEventListeners_001
+ * @tc.desc: invalid listeners are refused before any transaction
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedClientTest, RegisterDSchedEventListeners_001, TestSize.Level3)
+{
+    DTEST_LOG << "DistributedClientTest RegisterDSchedEventListeners_001 start" << std::endl;
+    sptr<MockDmsRemoteObject> dms(new MockDmsRemoteObject());
+    DistributedClient::ResetDmsProxy();
+    DistributedClient::proxyLoader_ = [dms]() -> sptr<IRemoteObject> {
+        return dms;
+    };
+    std::map<DSchedEventType, sptr<IDSchedEventListener>> listeners;
+    EXPECT_EQ(distributedClient_.RegisterDSchedEventListeners(listeners), INVALID_PARAMETERS_ERR);
+
+    listeners[DMS_CONTINUE] = sptr<IDSchedEventListener>(new BusinessHandlerTest());
+    listeners[DMS_COLLABORATION] = nullptr;
+    EXPECT_EQ(distributedClient_.RegisterDSchedEventListeners(listeners), INVALID_PARAMETERS_ERR);
+    EXPECT_TRUE(dms->codes_.empty());
+
+    DistributedClient::ResetDmsProxy();
+    DistributedClient::proxyLoader_ = []() -> sptr<IRemoteObject> {
+        return nullptr;
+    };
+    listeners.erase(DMS_COLLABORATION);
+    EXPECT_EQ(distributedClient_.RegisterDSchedEventListeners(listeners), INVALID_PARAMETERS_ERR);
+    DTEST_LOG << "DistributedClientTest RegisterDSchedEventListeners_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: RegisterDSchedEventListeners_002
+ * @tc.desc: listeners of several types are registered in one transaction
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedClientTest, RegisterDSchedEventListeners_002, TestSize.Level3)
+{
+    DTEST_LOG << "DistributedClientTest RegisterDSchedEventListeners_002 start" << std::endl;
+    sptr<MockDmsRemoteObject> dms(new MockDmsRemoteObject());
+    DistributedClient::ResetDmsProxy();
+    DistributedClient::proxyLoader_ = [dms]() -> sptr<IRemoteObject> {
+        return dms;
+    };
+    std::map<DSchedEventType, sptr<IDSchedEventListener>> listeners;
+    listeners[DMS_CONTINUE] = sptr<IDSchedEventListener>(new BusinessHandlerTest());
+    listeners[DMS_COLLABORATION] = sptr<IDSchedEventListener>(new BusinessHandlerTest());
+    listeners[DMS_ALL] = sptr<IDSchedEventListener>(new BusinessHandlerTest());
+    EXPECT_EQ(distributedClient_.RegisterDSchedEventListeners(listeners), ERR_OK);
+    ASSERT_EQ(dms->codes_.size(), 1u);
+    EXPECT_EQ(dms->codes_[0], static_cast<uint32_t>(IDSchedInterfaceCode::REGISTER_DSCHED_EVENT_LISTENERS));
+    std::vector<uint8_t> expectTypes = { DMS_CONTINUE, DMS_COLLABORATION, DMS_ALL };
+    EXPECT_EQ(dms->registeredTypes_, expectTypes);
+    DTEST_LOG << "DistributedClientTest RegisterDSchedEventListeners_002 end" << std::endl;
+}
 }
 }
\ No newline at end of file
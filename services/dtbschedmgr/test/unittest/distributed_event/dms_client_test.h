@@ -19,14 +19,15 @@
 #include "dms_client.h"
 
 #include <string>
+#include <vector>
 
 #include "ability_manager_errors.h"
 #include "distributed_event_listener.h"
 #include "dms_sdk_demo.h"
 #include "gtest/gtest.h"
+#include "ipc_object_stub.h"
 #include "iremote_broker.h"
 
-
 namespace OHOS {
 namespace DistributedSchedule {
 class DistributedClientTest : public testing::Test {
@@ -47,6 +48,21 @@ public:
 
     void DSchedEventNotify(EventNotify &notify);
 };
+
+// stands in for the dms proxy, counts the transactions it gets
+class MockDmsRemoteObject : public IPCObjectStub {
+public:
+    MockDmsRemoteObject() : IPCObjectStub(u"ohos.distributedschedule.accessToken") {}
+    ~MockDmsRemoteObject() = default;
+
+    int OnRemoteRequest(uint32_t code, MessageParcel& data, MessageParcel& reply, MessageOption& option) override;
+    bool AddDeathRecipient(const sptr<DeathRecipient>& recipient) override;
+    bool RemoveDeathRecipient(const sptr<DeathRecipient>& recipient) override;
+
+    std::vector<uint32_t> codes_;
+    std::vector<uint8_t> registeredTypes_;
+    sptr<DeathRecipient> deathRecipient_;
+};
 } // namespace DistributedSchedule
 } // namespace OHOS
 #endif // OHOS_DMS_CLIENT_TEST_H
\ No newline at end of file
@@ -14,6 +14,7 @@
  */
 #include "dms_sa_cilent_test.h"
 
+#include "distributedsched_ipc_interface_code.h"
 #include "test_log.h"
 
 using namespace testing;
@@ -45,6 +46,8 @@ void DmsSaClientTest::SetUp()
 void DmsSaClientTest::TearDown()
 {
     DTEST_LOG << "DmsSaClientTest::TearDown" << std::endl;
+    DistributedClient::proxyLoader_ = nullptr;
+    DistributedClient::ResetDmsProxy();
 }
 
 void IDSchedEventListenerTest::DSchedEventNotify(EventNotify &notify)
@@ -256,5 +259,63 @@ HWTEST_F(DmsSaClientTest, DmsSAStatusChangeOnRemoveSystemAbility_001, TestSize.L
     EXPECT_NO_FATAL_FAILURE(dmsSystemAbilityStatusChange.OnRemoveSystemAbility(DISTRIBUTED_SCHED_SA_ID, DEVICE_ID));
     DTEST_LOG << "DmsSaClientTest DmsSAStatusChangeOnRemoveSystemAbility_001 end" << std::endl;
 }
+
+/**
+ * @tc.name: AddDSchedEventListener_003
+ * @tc.desc: the listener of every type is kept and dms is looked up once
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsSaClientTest, AddDSchedEventListener_003, TestSize.Level3)
+{
+    DTEST_LOG << "DmsSaClientTest AddDSchedEventListener_003 start" << std::endl;
+    ASSERT_NE(nullptr, dmssaClient_);
+    sptr<MockDmsRemoteObject> dms(new MockDmsRemoteObject());
+    int32_t lookupCount = 0;
+    DistributedClient::ResetDmsProxy();
+    DistributedClient::proxyLoader_ = [&lookupCount, dms]() -> sptr<IRemoteObject> {
+        lookupCount++;
+        return dms;
+    };
+    sptr<IDSchedEventListener> listener(new BusinessHandlerTest());
+    dmssaClient_->hasSubscribeDmsSA_ = true;
+    EXPECT_EQ(dmssaClient_->AddDSchedEventListener(DMS_CONTINUE, listener), NO_ERROR);
+    EXPECT_EQ(dmssaClient_->AddDSchedEventListener(DMS_COLLABORATION, listener), NO_ERROR);
+    EXPECT_EQ(dmssaClient_->listeners_.size(), 2u);
+    EXPECT_EQ(dms->codes_.size(), 2u);
+    EXPECT_EQ(lookupCount, 1);
+    DTEST_LOG << "DmsSaClientTest AddDSchedEventListener_003 end" << std::endl;
+}
+
+/**
+ * @tc.name: OnAddSystemAbility_002
+ * @tc.desc: all listeners are restored in one transaction when dms is added again
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsSaClientTest, OnAddSystemAbility_002, TestSize.Level3)
+{
+    DTEST_LOG << "DmsSaClientTest OnAddSystemAbility_002 start" << std::endl;
+    ASSERT_NE(nullptr, dmssaClient_);
+    sptr<MockDmsRemoteObject> dms(new MockDmsRemoteObject());
+    int32_t lookupCount = 0;
+    DistributedClient::ResetDmsProxy();
+    DistributedClient::proxyLoader_ = [&lookupCount, dms]() -> sptr<IRemoteObject> {
+        lookupCount++;
+        return dms;
+    };
+    sptr<IDSchedEventListener> listener(new BusinessHandlerTest());
+    dmssaClient_->listeners_[DMS_CONTINUE] = listener;
+    dmssaClient_->listeners_[DMS_COLLABORATION] = listener;
+    dmssaClient_->listeners_[DMS_ALL] = listener;
+
+    dmssaClient_->OnAddSystemAbility(DISTRIBUTED_SCHED_SA_ID, DEVICE_ID);
+    ASSERT_EQ(dms->codes_.size(), 1u);
+    EXPECT_EQ(dms->codes_[0], static_cast<uint32_t>(IDSchedInterfaceCode::REGISTER_DSCHED_EVENT_LISTENERS));
+    EXPECT_EQ(dms->registeredTypes_.size(), 3u);
+    EXPECT_EQ(lookupCount, 1);
+
+    dmssaClient_->OnRemoveSystemAbility(DISTRIBUTED_SCHED_SA_ID, DEVICE_ID);
+    EXPECT_EQ(DistributedClient::dmsProxy_, nullptr);
+    DTEST_LOG << "DmsSaClientTest OnAddSystemAbility_002 end" << std::endl;
+}
 }
 }
\ No newline at end of file
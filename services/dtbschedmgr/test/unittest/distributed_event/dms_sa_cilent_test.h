@@ -22,6 +22,7 @@
 
 #include "distributed_event_listener.h"
 #include "dms_client.h"
+#include "dms_client_test.h"
 #include "dms_handler.h"
 #include "if_system_ability_manager.h"
 #include "iservice_registry.h"
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_event_history_test.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "dtbschedmgr_log.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string SRC_NETWORK_ID = "srcNetworkId";
+const std::string DST_NETWORK_ID = "dstNetworkId";
+const std::string OTHER_NETWORK_ID = "otherNetworkId";
+const std::string BUNDLE_NAME = "com.example.demo";
+const std::string OTHER_BUNDLE_NAME = "com.example.other";
+constexpr int32_t BENCHMARK_ROUNDS = 100;
+
+EventNotify MakeEvent(DSchedEventType type, const std::string& bundleName, const std::string& dstNetworkId)
+{
+    EventNotify event;
+    event.eventResult_ = ERR_OK;
+    event.srcNetworkId_ = SRC_NETWORK_ID;
+    event.dstNetworkId_ = dstNetworkId;
+    event.srcBundleName_ = bundleName;
+    event.srcModuleName_ = "entry";
+    event.srcAbilityName_ = "MainAbility";
+    event.destBundleName_ = bundleName;
+    event.destModuleName_ = "entry";
+    event.destAbilityName_ = "MainAbility";
+    event.developerId_ = "developerId";
+    event.dSchedEventType_ = type;
+    event.state_ = DMS_DSCHED_EVENT_FINISH;
+    return event;
+}
+
+void ExpectSameEvent(const EventNotify& expect, const EventNotify& actual)
+{
+    EXPECT_EQ(expect.eventResult_, actual.eventResult_);
+    EXPECT_EQ(expect.srcNetworkId_, actual.srcNetworkId_);
+    EXPECT_EQ(expect.dstNetworkId_, actual.dstNetworkId_);
+    EXPECT_EQ(expect.srcBundleName_, actual.srcBundleName_);
+    EXPECT_EQ(expect.srcModuleName_, actual.srcModuleName_);
+    EXPECT_EQ(expect.srcAbilityName_, actual.srcAbilityName_);
+    EXPECT_EQ(expect.destBundleName_, actual.destBundleName_);
+    EXPECT_EQ(expect.destModuleName_, actual.destModuleName_);
+    EXPECT_EQ(expect.destAbilityName_, actual.destAbilityName_);
+    EXPECT_EQ(expect.developerId_, actual.developerId_);
+    EXPECT_EQ(expect.dSchedEventType_, actual.dSchedEventType_);
+    EXPECT_EQ(expect.state_, actual.state_);
+    EXPECT_EQ(expect.eventTime_, actual.eventTime_);
+}
+
+int64_t GetElapsedUs(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+}
+
+void DSchedEventHistoryTest::SetUpTestCase()
+{
+    DTEST_LOG << "DSchedEventHistoryTest::SetUpTestCase" << std::endl;
+}
+
+void DSchedEventHistoryTest::TearDownTestCase()
+{
+    DTEST_LOG << "DSchedEventHistoryTest::TearDownTestCase" << std::endl;
+}
+
+void DSchedEventHistoryTest::SetUp()
+{
+    DTEST_LOG << "DSchedEventHistoryTest::SetUp" << std::endl;
+}
+
+void DSchedEventHistoryTest::TearDown()
+{
+    DTEST_LOG << "DSchedEventHistoryTest::TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: EncodeDecode_001
+ * @tc.desc: events survive an encode and decode round trip
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedEventHistoryTest, EncodeDecode_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedEventHistoryTest EncodeDecode_001 start" << std::endl;
+    std::vector<EventNotify> events;
+    events.emplace_back(MakeEvent(DMS_CONTINUE, BUNDLE_NAME, DST_NETWORK_ID));
+    EventNotify failed = MakeEvent(DMS_COLLABORATION, OTHER_BUNDLE_NAME, OTHER_NETWORK_ID);
+    failed.eventResult_ = INVALID_PARAMETERS_ERR;
+    failed.state_ = DMS_DSCHED_EVENT_STOP;
+    failed.eventTime_ = INT64_MAX;
+    failed.developerId_ = std::string(300, 'x');
+    events.emplace_back(failed);
+    EventNotify empty;
+    empty.eventTime_ = -1;
+    events.emplace_back(empty);
+
+    std::vector<uint8_t> buffer;
+    EXPECT_EQ(DSchedEventCodec::Encode(events, buffer), ERR_OK);
+    std::vector<EventNotify> decoded;
+    EXPECT_EQ(DSchedEventCodec::Decode(buffer, decoded), ERR_OK);
+    ASSERT_EQ(decoded.size(), events.size());
+    for (size_t i = 0; i < events.size(); i++) {
+        ExpectSameEvent(events[i], decoded[i]);
+    }
+
+    EXPECT_EQ(DSchedEventCodec::Encode({}, buffer), ERR_OK);
+    decoded.clear();
+    EXPECT_EQ(DSchedEventCodec::Decode(buffer, decoded), ERR_OK);
+    EXPECT_TRUE(decoded.empty());
+    DTEST_LOG << "DSchedEventHistoryTest EncodeDecode_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: EncodeDecode_002
+ * @tc.desc: the strings shared by the records of a page are written once
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedEventHistoryTest, EncodeDecode_002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedEventHistoryTest EncodeDecode_002 start" << std::endl;
+    std::vector<EventNotify> events(DSchedEventHistory::MAX_PAGE_SIZE,
+        MakeEvent(DMS_CONTINUE, BUNDLE_NAME, DST_NETWORK_ID));
+    std::vector<uint8_t> buffer;
+    EXPECT_EQ(DSchedEventCodec::Encode(events, buffer), ERR_OK);
+    size_t stringSize = 0;
+    const EventNotify& event = events.front();
+    for (const auto* value : { &event.srcNetworkId_, &event.dstNetworkId_, &event.srcBundleName_,
+        &event.srcModuleName_, &event.srcAbilityName_, &event.destBundleName_, &event.destModuleName_,
+        &event.destAbilityName_, &event.developerId_ }) {
+        stringSize += value->size();
+    }
+    DTEST_LOG << events.size() << " events encoded into " << buffer.size() << " bytes, " << stringSize <<
+        " string bytes per event" << std::endl;
+    EXPECT_LT(buffer.size(), events.size() * stringSize / 4);
+    DTEST_LOG << "DSchedEventHistoryTest EncodeDecode_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: Decode_001
+ * @tc.desc: truncated and corrupted buffers are refused
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedEventHistoryTest, Decode_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedEventHistoryTest Decode_001 start" << std::endl;
+    std::vector<EventNotify> events;
+    events.emplace_back(MakeEvent(DMS_CONTINUE, BUNDLE_NAME, DST_NETWORK_ID));
+    events.emplace_back(MakeEvent(DMS_COLLABORATION, OTHER_BUNDLE_NAME, OTHER_NETWORK_ID));
+    std::vector<uint8_t> buffer;
+    ASSERT_EQ(DSchedEventCodec::Encode(events, buffer), ERR_OK);
+
+    std::vector<EventNotify> decoded;
+    for (size_t size = 0; size < buffer.size(); size++) {
+        std::vector<uint8_t> truncated(buffer.begin(), buffer.begin() + size);
+        EXPECT_NE(DSchedEventCodec::Decode(truncated, decoded), ERR_OK) << "size " << size;
+    }
+    EXPECT_TRUE(decoded.empty());
+
+    std::vector<uint8_t> badVersion = buffer;
+    badVersion[0] = DSchedEventCodec::CODEC_VERSION + 1;
+    EXPECT_EQ(DSchedEventCodec::Decode(badVersion, decoded), INVALID_PARAMETERS_ERR);
+
+    std::vector<uint8_t> badStringNum = { DSchedEventCodec::CODEC_VERSION, 0x7f, 0x00 };
+    EXPECT_EQ(DSchedEventCodec::Decode(badStringNum, decoded), INVALID_PARAMETERS_ERR);
+
+    // one empty string, one record whose first string index points past the table
+    std::vector<uint8_t> badIndex = { DSchedEventCodec::CODEC_VERSION, 0x01, 0x00, 0x01, 0x00, 0x05,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    EXPECT_EQ(DSchedEventCodec::Decode(badIndex, decoded), INVALID_PARAMETERS_ERR);
+    EXPECT_TRUE(decoded.empty());
+    DTEST_LOG << "DSchedEventHistoryTest Decode_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Query_001
+ * @tc.desc: events are filtered by type, bundle and device
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedEventHistoryTest, Query_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedEventHistoryTest Query_001 start" << std::endl;
+    DSchedEventHistory history;
+    history.Record(MakeEvent(DMS_CONTINUE, BUNDLE_NAME, DST_NETWORK_ID));
+    history.Record(MakeEvent(DMS_COLLABORATION, BUNDLE_NAME, OTHER_NETWORK_ID));
+    history.Record(MakeEvent(DMS_CONTINUE, OTHER_BUNDLE_NAME, OTHER_NETWORK_ID));
+    EXPECT_EQ(history.GetSize(), 3u);
+
+    DSchedEventQuery query;
+    std::vector<EventNotify> events;
+    uint64_t nextCursor = 0;
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_EQ(events.size(), 3u);
+    EXPECT_EQ(nextCursor, 0u);
+
+    query.type_ = DMS_CONTINUE;
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_EQ(events.size(), 2u);
+
+    query.bundleName_ = BUNDLE_NAME;
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].dstNetworkId_, DST_NETWORK_ID);
+
+    query.type_ = DMS_ALL;
+    query.bundleName_ = "";
+    query.networkId_ = OTHER_NETWORK_ID;
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_EQ(events.size(), 2u);
+
+    query.networkId_ = SRC_NETWORK_ID;
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_EQ(events.size(), 3u);
+
+    query.type_ = DMS_UNKNOW;
+    EXPECT_EQ(history.Query(query, events, nextCursor), INVALID_PARAMETERS_ERR);
+    DTEST_LOG << "DSchedEventHistoryTest Query_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Query_002
+ * @tc.desc: events are stamped when recorded and filtered by time range
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedEventHistoryTest, Query_002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedEventHistoryTest Query_002 start" << std::endl;
+    DSchedEventHistory history;
+    history.Record(MakeEvent(DMS_CONTINUE, BUNDLE_NAME, DST_NETWORK_ID));
+    DSchedEventQuery query;
+    std::vector<EventNotify> events;
+    uint64_t nextCursor = 0;
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    ASSERT_EQ(events.size(), 1u);
+    int64_t eventTime = events[0].eventTime_;
+    EXPECT_GT(eventTime, 0);
+
+    query.beginTime_ = eventTime;
+    query.endTime_ = eventTime;
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_EQ(events.size(), 1u);
+
+    query.beginTime_ = eventTime + 1;
+    query.endTime_ = 0;
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_TRUE(events.empty());
+
+    query.beginTime_ = 0;
+    query.endTime_ = eventTime - 1;
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_TRUE(events.empty());
+    DTEST_LOG << "DSchedEventHistoryTest Query_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: Query_003
+ * @tc.desc: pages follow the cursor and return each matching event once
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedEventHistoryTest, Query_003, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedEventHistoryTest Query_003 start" << std::endl;
+    constexpr int32_t eventNum = 100;
+    DSchedEventHistory history;
+    for (int32_t i = 0; i < eventNum; i++) {
+        EventNotify event = MakeEvent(i % 2 == 0 ? DMS_CONTINUE : DMS_COLLABORATION, BUNDLE_NAME, DST_NETWORK_ID);
+        event.eventResult_ = i;
+        history.Record(event);
+    }
+
+    DSchedEventQuery query;
+    query.type_ = DMS_CONTINUE;
+    query.pageSize_ = 7;
+    std::vector<EventNotify> events;
+    int32_t pageNum = 0;
+    do {
+        size_t lastSize = events.size();
+        uint64_t nextCursor = 0;
+        EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+        EXPECT_LE(events.size() - lastSize, query.pageSize_);
+        pageNum++;
+        query.cursor_ = nextCursor;
+    } while (query.cursor_ != 0 && pageNum <= eventNum);
+    ASSERT_EQ(events.size(), static_cast<size_t>(eventNum / 2));
+    EXPECT_EQ(pageNum, (eventNum / 2 + query.pageSize_ - 1) / query.pageSize_);
+    for (size_t i = 0; i < events.size(); i++) {
+        EXPECT_EQ(events[i].eventResult_, static_cast<int32_t>(i * 2));
+    }
+
+    query.cursor_ = 0;
+    query.pageSize_ = DSchedEventHistory::MAX_PAGE_SIZE + 1;
+    query.type_ = DMS_ALL;
+    events.clear();
+    uint64_t nextCursor = 0;
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_EQ(events.size(), static_cast<size_t>(eventNum));
+    EXPECT_EQ(nextCursor, 0u);
+    DTEST_LOG << "DSchedEventHistoryTest Query_003 end" << std::endl;
+}
+
+/**
+ * @tc.name: Record_001
+ * @tc.desc: the oldest events are overwritten once the history is full
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedEventHistoryTest, Record_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedEventHistoryTest Record_001 start" << std::endl;
+    constexpr size_t capacity = 8;
+    DSchedEventHistory history(capacity);
+    for (size_t i = 0; i < capacity * 3 + 1; i++) {
+        EventNotify event = MakeEvent(DMS_CONTINUE, BUNDLE_NAME, DST_NETWORK_ID);
+        event.eventResult_ = static_cast<int32_t>(i);
+        history.Record(event);
+    }
+    EXPECT_EQ(history.GetSize(), capacity);
+
+    DSchedEventQuery query;
+    query.cursor_ = 1;
+    std::vector<EventNotify> events;
+    uint64_t nextCursor = 0;
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    ASSERT_EQ(events.size(), capacity);
+    for (size_t i = 0; i < capacity; i++) {
+        EXPECT_EQ(events[i].eventResult_, static_cast<int32_t>(capacity * 2 + 1 + i));
+    }
+
+    query.pageSize_ = 3;
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_EQ(events.size(), 3u);
+    query.cursor_ = nextCursor;
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[0].eventResult_, static_cast<int32_t>(capacity * 2 + 4));
+
+    history.Clear();
+    EXPECT_EQ(history.GetSize(), 0u);
+    events.clear();
+    EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+    EXPECT_TRUE(events.empty());
+    DTEST_LOG << "DSchedEventHistoryTest Record_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Benchmark_001
+ * @tc.desc: query, encode and decode cost of one page against the history size
+ * @tc.type: PERF
+ */
+HWTEST_F(DSchedEventHistoryTest, Benchmark_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedEventHistoryTest Benchmark_001 start" << std::endl;
+    for (size_t historySize : { 64, 256, 1024, 4096 }) {
+        DSchedEventHistory history(historySize);
+        for (size_t i = 0; i < historySize; i++) {
+            // one event in eight belongs to the queried bundle
+            history.Record(MakeEvent(DMS_CONTINUE, i % 8 == 0 ? BUNDLE_NAME : OTHER_BUNDLE_NAME + std::to_string(i),
+                DST_NETWORK_ID));
+        }
+        DSchedEventQuery query;
+        query.bundleName_ = BUNDLE_NAME;
+        std::vector<EventNotify> events;
+        std::vector<uint8_t> buffer;
+        int64_t queryUs = 0;
+        int64_t codecUs = 0;
+        for (int32_t round = 0; round < BENCHMARK_ROUNDS; round++) {
+            events.clear();
+            uint64_t nextCursor = 0;
+            auto begin = std::chrono::steady_clock::now();
+            EXPECT_EQ(history.Query(query, events, nextCursor), ERR_OK);
+            queryUs += GetElapsedUs(begin);
+            begin = std::chrono::steady_clock::now();
+            EXPECT_EQ(DSchedEventCodec::Encode(events, buffer), ERR_OK);
+            std::vector<EventNotify> decoded;
+            EXPECT_EQ(DSchedEventCodec::Decode(buffer, decoded), ERR_OK);
+            codecUs += GetElapsedUs(begin);
+        }
+        EXPECT_LE(events.size(), DSchedEventHistory::DEFAULT_PAGE_SIZE);
+        DTEST_LOG << "history " << historySize << ": page " << events.size() << " events, " << buffer.size() <<
+            "B, query " << queryUs / BENCHMARK_ROUNDS << "us, encode+decode " << codecUs / BENCHMARK_ROUNDS <<
+            "us" << std::endl;
+    }
+    DTEST_LOG << "DSchedEventHistoryTest Benchmark_001 end" << std::endl;
+}
+}
+}
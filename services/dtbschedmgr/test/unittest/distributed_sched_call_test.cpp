@@ -713,7 +713,7 @@ void DistributedSchedCallTest::RemoveSession(const sptr<IRemoteObject>& connect)
     }
 
     std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().distributedLock_);
-    DistributedSchedService::GetInstance().distributedConnectAbilityMap_.erase(connect);
+    DistributedSchedService::GetInstance().distributedConnectAbilityMap_.Erase(connect);
 }
 
 void DistributedSchedCallTest::AddConnectInfo(const sptr<IRemoteObject>& connect,
@@ -734,7 +734,7 @@ void DistributedSchedCallTest::AddConnectInfo(const sptr<IRemoteObject>& connect
 
     sptr<IRemoteObject> callbackWrapper = new AbilityCallWrapperStubTest(connect);
     ConnectInfo connectInfo {callerInfo, callbackWrapper};
-    DistributedSchedService::GetInstance().connectAbilityMap_.emplace(connect, connectInfo);
+    DistributedSchedService::GetInstance().connectAbilityMap_.Emplace(connect, connectInfo);
 }
 
 void DistributedSchedCallTest::RemoveConnectInfo(const sptr<IRemoteObject>& connect) const
@@ -746,7 +746,7 @@ void DistributedSchedCallTest::RemoveConnectInfo(const sptr<IRemoteObject>& conn
     }
 
     std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().distributedLock_);
-    DistributedSchedService::GetInstance().connectAbilityMap_.erase(connect);
+    DistributedSchedService::GetInstance().connectAbilityMap_.Erase(connect);
 }
 
 void DistributedSchedCallTest::AddConnectCount(int32_t uid) const
@@ -178,7 +178,7 @@ void DistributedSchedConnectTest::RemoveSession(const sptr<IRemoteObject>& conne
     }
 
     std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().distributedLock_);
-    DistributedSchedService::GetInstance().distributedConnectAbilityMap_.erase(connect);
+    DistributedSchedService::GetInstance().distributedConnectAbilityMap_.Erase(connect);
 }
 
 void DistributedSchedConnectTest::AddConnectInfo(const sptr<IRemoteObject>& connect,
@@ -197,7 +197,7 @@ void DistributedSchedConnectTest::AddConnectInfo(const sptr<IRemoteObject>& conn
 
     sptr<IRemoteObject> callbackWrapper(new AbilityConnectionWrapperStubTest(connect));
     ConnectInfo connectInfo {callerInfo, callbackWrapper};
-    DistributedSchedService::GetInstance().connectAbilityMap_.emplace(connect, connectInfo);
+    DistributedSchedService::GetInstance().connectAbilityMap_.Emplace(connect, connectInfo);
 }
 
 void DistributedSchedConnectTest::RemoveConnectInfo(const sptr<IRemoteObject>& connect) const
@@ -207,7 +207,7 @@ void DistributedSchedConnectTest::RemoveConnectInfo(const sptr<IRemoteObject>& c
     }
 
     std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().distributedLock_);
-    DistributedSchedService::GetInstance().connectAbilityMap_.erase(connect);
+    DistributedSchedService::GetInstance().connectAbilityMap_.Erase(connect);
 }
 
 void DistributedSchedConnectTest::AddConnectCount(int32_t uid) const
@@ -317,7 +317,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessConnectDied001, TestSize.Level1)
     AddSession(connect, "123_local_device_id", "123_remote_device_id", want);
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(1));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(1));
     }
 
     /**
@@ -327,7 +327,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessConnectDied001, TestSize.Level1)
     DistributedSchedService::GetInstance().ProcessConnectDied(connect);
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(0));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(0));
     }
 
     RemoveSession(connect);
@@ -354,7 +354,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessConnectDied002, TestSize.Level0)
     AddSession(connect, "123_local_device_id", "123_remote_device_id", want);
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(1));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(1));
     }
 
     /**
@@ -364,7 +364,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessConnectDied002, TestSize.Level0)
     DistributedSchedService::GetInstance().ProcessConnectDied(new AbilityConnectCallbackTest());
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(1));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(1));
     }
 
     RemoveSession(connect);
@@ -426,7 +426,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessConnectDied004, TestSize.Level1)
     AddConnectInfo(connect, "123_local_device_id", "123_remote_device_id");
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectAbilityMap.size(), static_cast<size_t>(1));
+        EXPECT_EQ(connectAbilityMap.Size(), static_cast<size_t>(1));
     }
 
     /**
@@ -437,7 +437,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessConnectDied004, TestSize.Level1)
         IPCSkeleton::GetCallingUid(), "123_local_device_id");
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectAbilityMap.size(), static_cast<size_t>(0));
+        EXPECT_EQ(connectAbilityMap.Size(), static_cast<size_t>(0));
     }
 
     RemoveConnectInfo(connect);
@@ -468,7 +468,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessDeviceOffline001, TestSize.Level0)
     DistributedSchedService::GetInstance().ProcessDeviceOffline("123_remote_device_id");
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(0));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(0));
     }
 
     RemoveSession(connect);
@@ -497,7 +497,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessDeviceOffline002, TestSize.Level0)
     AddSession(connect2, "123_local_device_id", "123_remote_device_id", want);
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(2));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(2));
     }
 
     /**
@@ -507,7 +507,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessDeviceOffline002, TestSize.Level0)
     DistributedSchedService::GetInstance().ProcessDeviceOffline("123_remote_device_id");
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(0));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(0));
     }
 
     RemoveSession(connect1);
@@ -539,9 +539,8 @@ HWTEST_F(DistributedSchedConnectTest, ProcessDeviceOffline003, TestSize.Level0)
     DistributedSchedService::GetInstance().ProcessDeviceOffline("456_remote_device_id");
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        auto iter = connectionMap.find(connect);
-        EXPECT_NE(iter, connectionMap.end());
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(1));
+        EXPECT_TRUE(connectionMap.Contains(connect));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(1));
     }
 
     RemoveSession(connect);
@@ -602,7 +601,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessDeviceOffline005, TestSize.Level1)
     AddConnectInfo(connect, "123_local_device_id", "123_remote_device_id");
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectAbilityMap.size(), static_cast<size_t>(1));
+        EXPECT_EQ(connectAbilityMap.Size(), static_cast<size_t>(1));
     }
 
     /**
@@ -612,7 +611,7 @@ HWTEST_F(DistributedSchedConnectTest, ProcessDeviceOffline005, TestSize.Level1)
     DistributedSchedService::GetInstance().ProcessDeviceOffline("123_local_device_id");
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectAbilityMap.size(), static_cast<size_t>(0));
+        EXPECT_EQ(connectAbilityMap.Size(), static_cast<size_t>(0));
     }
 
     RemoveConnectInfo(connect);
@@ -643,7 +642,7 @@ HWTEST_F(DistributedSchedConnectTest, DisconnectRemoteAbility001, TestSize.Level
     DistributedSchedService::GetInstance().DisconnectRemoteAbility(connect, 0, 0);
     {
         std::lock_guard<std::mutex> autoLock(distributedLock);
-        EXPECT_EQ(connectionMap.size(), static_cast<size_t>(0));
+        EXPECT_EQ(connectionMap.Size(), static_cast<size_t>(0));
     }
 
     RemoveSession(connect);
@@ -1416,7 +1416,7 @@ HWTEST_F(DistributedSchedServiceFirstTest, NotifyProcessDiedFromRemote_001, Test
     connectInfo.callerInfo.pid = 0;
     connectInfo.callerInfo.callerType = 0;
     {
-        std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().connectLock_);
+        std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().calleeLock_);
         DistributedSchedService::GetInstance().calleeMap_[connect] = connectInfo;
     }
     CallerInfo callerInfo;
@@ -1661,7 +1661,7 @@ HWTEST_F(DistributedSchedServiceFirstTest, ReleaseAbilityFromRemote_002, TestSiz
     std::list<ConnectAbilitySession> sessionsList;
     {
         std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().distributedLock_);
-        DistributedSchedService::GetInstance().distributedConnectAbilityMap_[connect] = sessionsList;
+        DistributedSchedService::GetInstance().distributedConnectAbilityMap_.Assign(connect, sessionsList);
     }
     DistributedSchedService::GetInstance().ProcessConnectDied(connect);
     /**
@@ -390,7 +390,7 @@ HWTEST_F(DistributedSchedServiceSecondTest, NotifyStateChangedFromRemote_003, Te
     AppExecFwk::ElementName element(localDeviceId, BUNDLE_NAME, ABILITY_NAME);
 
     sptr<IRemoteObject> connect = nullptr;
-    DistributedSchedService::GetInstance().callMap_[connect] = {1, localDeviceId};
+    DistributedSchedService::GetInstance().callMap_.Assign(connect, {1, localDeviceId});
     int ret = DistributedSchedService::GetInstance().NotifyStateChangedFromRemote(0, 0, element);
     EXPECT_EQ(ret, INVALID_PARAMETERS_ERR);
     DTEST_LOG << "DistributedSchedServiceSecondTest NotifyStateChangedFromRemote_003 end" << std::endl;
@@ -430,11 +430,11 @@ HWTEST_F(DistributedSchedServiceSecondTest, NotifyStateChangedFromRemote_005, Te
     std::string localDeviceId;
     DtbschedmgrDeviceInfoStorage::GetInstance().GetLocalDeviceId(localDeviceId);
     sptr<IRemoteObject> connect = nullptr;
-    DistributedSchedService::GetInstance().callMap_[connect] = {2, localDeviceId};
+    DistributedSchedService::GetInstance().callMap_.Assign(connect, {2, localDeviceId});
     AppExecFwk::ElementName element(localDeviceId, BUNDLE_NAME, ABILITY_NAME);
     int32_t ret = DistributedSchedService::GetInstance().NotifyStateChangedFromRemote(abilityState, 0, element);
     DTEST_LOG << "ret:" << ret << std::endl;
-    DistributedSchedService::GetInstance().callMap_.clear();
+    DistributedSchedService::GetInstance().callMap_.Clear();
     EXPECT_EQ(ret, INVALID_PARAMETERS_ERR);
     DTEST_LOG << "DistributedSchedServiceSecondTest NotifyStateChangedFromRemote_005 end" << std::endl;
 }
@@ -453,11 +453,11 @@ HWTEST_F(DistributedSchedServiceSecondTest, NotifyStateChangedFromRemote_006, Te
     std::string localDeviceId;
     DtbschedmgrDeviceInfoStorage::GetInstance().GetLocalDeviceId(localDeviceId);
     sptr<IRemoteObject> connect(new MockDistributedSched());
-    DistributedSchedService::GetInstance().callMap_[connect] = {3, localDeviceId};
+    DistributedSchedService::GetInstance().callMap_.Assign(connect, {3, localDeviceId});
     AppExecFwk::ElementName element(localDeviceId, BUNDLE_NAME, ABILITY_NAME);
     int32_t ret = DistributedSchedService::GetInstance().NotifyStateChangedFromRemote(abilityState, 3, element);
     DTEST_LOG << "ret:" << ret << std::endl;
-    DistributedSchedService::GetInstance().callMap_.clear();
+    DistributedSchedService::GetInstance().callMap_.Clear();
     EXPECT_EQ(ret, ERR_OK);
     DTEST_LOG << "DistributedSchedServiceSecondTest NotifyStateChangedFromRemote_006 end" << std::endl;
 }
@@ -1106,13 +1106,13 @@ HWTEST_F(DistributedSchedServiceSecondTest, HandleLocalCallerDied_001, TestSize.
     DtbschedmgrDeviceInfoStorage::GetInstance().GetLocalDeviceId(localDeviceId);
     sptr<IRemoteObject> connect(new MockDistributedSched());
     std::list<ConnectAbilitySession> sessionsList;
-    DistributedSchedService::GetInstance().callerMap_[connect] = sessionsList;
-    DistributedSchedService::GetInstance().callMap_[connect] = {4, localDeviceId};
+    DistributedSchedService::GetInstance().callerMap_.Assign(connect, sessionsList);
+    DistributedSchedService::GetInstance().callMap_.Assign(connect, {4, localDeviceId});
     DistributedSchedService::GetInstance().HandleLocalCallerDied(connect);
-    DistributedSchedService::GetInstance().callerMap_.clear();
-    EXPECT_TRUE(DistributedSchedService::GetInstance().callerMap_.empty());
-    DistributedSchedService::GetInstance().callMap_.clear();
-    EXPECT_TRUE(DistributedSchedService::GetInstance().callMap_.empty());
+    DistributedSchedService::GetInstance().callerMap_.Clear();
+    EXPECT_TRUE(DistributedSchedService::GetInstance().callerMap_.Empty());
+    DistributedSchedService::GetInstance().callMap_.Clear();
+    EXPECT_TRUE(DistributedSchedService::GetInstance().callMap_.Empty());
     DTEST_LOG << "DistributedSchedServiceSecondTest HandleLocalCallerDied_001 end" << std::endl;
 }
 
@@ -1129,14 +1129,14 @@ HWTEST_F(DistributedSchedServiceSecondTest, RemoveCallerComponent_001, TestSize.
     DtbschedmgrDeviceInfoStorage::GetInstance().GetLocalDeviceId(localDeviceId);
     sptr<IRemoteObject> connect(new MockDistributedSched());
     std::list<ConnectAbilitySession> sessionsList;
-    DistributedSchedService::GetInstance().callerMap_[connect] = sessionsList;
-    DistributedSchedService::GetInstance().callMap_[connect] = {5, localDeviceId};
+    DistributedSchedService::GetInstance().callerMap_.Assign(connect, sessionsList);
+    DistributedSchedService::GetInstance().callMap_.Assign(connect, {5, localDeviceId});
     DistributedSchedService::GetInstance().RemoveCallerComponent(connect);
     DistributedSchedService::GetInstance().RemoveCallerComponent(nullptr);
-    DistributedSchedService::GetInstance().callerMap_.clear();
-    EXPECT_TRUE(DistributedSchedService::GetInstance().callerMap_.empty());
-    DistributedSchedService::GetInstance().callMap_.clear();
-    EXPECT_TRUE(DistributedSchedService::GetInstance().callMap_.empty());
+    DistributedSchedService::GetInstance().callerMap_.Clear();
+    EXPECT_TRUE(DistributedSchedService::GetInstance().callerMap_.Empty());
+    DistributedSchedService::GetInstance().callMap_.Clear();
+    EXPECT_TRUE(DistributedSchedService::GetInstance().callMap_.Empty());
     DTEST_LOG << "DistributedSchedServiceSecondTest RemoveCallerComponent_001 end" << std::endl;
 }
 
@@ -1153,17 +1153,17 @@ HWTEST_F(DistributedSchedServiceSecondTest, ProcessCalleeOffline_001, TestSize.L
     DtbschedmgrDeviceInfoStorage::GetInstance().GetLocalDeviceId(localDeviceId);
     sptr<IRemoteObject> connect(new MockDistributedSched());
     std::list<ConnectAbilitySession> sessionsList;
-    DistributedSchedService::GetInstance().callerMap_[connect] = sessionsList;
-    DistributedSchedService::GetInstance().callMap_[connect] = {6, localDeviceId};
+    DistributedSchedService::GetInstance().callerMap_.Assign(connect, sessionsList);
+    DistributedSchedService::GetInstance().callMap_.Assign(connect, {6, localDeviceId});
     DistributedSchedService::GetInstance().ProcessCalleeOffline(REMOTE_DEVICEID);
 
     sptr<IRemoteObject> mockConnect = nullptr;
-    DistributedSchedService::GetInstance().callerMap_[mockConnect] = sessionsList;
+    DistributedSchedService::GetInstance().callerMap_.Assign(mockConnect, sessionsList);
     DistributedSchedService::GetInstance().ProcessCalleeOffline(localDeviceId);
-    DistributedSchedService::GetInstance().callerMap_.clear();
-    EXPECT_TRUE(DistributedSchedService::GetInstance().callerMap_.empty());
-    DistributedSchedService::GetInstance().callMap_.clear();
-    EXPECT_TRUE(DistributedSchedService::GetInstance().callMap_.empty());
+    DistributedSchedService::GetInstance().callerMap_.Clear();
+    EXPECT_TRUE(DistributedSchedService::GetInstance().callerMap_.Empty());
+    DistributedSchedService::GetInstance().callMap_.Clear();
+    EXPECT_TRUE(DistributedSchedService::GetInstance().callMap_.Empty());
     DTEST_LOG << "DistributedSchedServiceSecondTest ProcessCalleeOffline_001 end" << std::endl;
 }
 
@@ -1184,8 +1184,8 @@ HWTEST_F(DistributedSchedServiceSecondTest, GetConnectComponentList_001, TestSiz
     std::vector<std::string> distributedComponents;
     {
         std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().distributedLock_);
-        DistributedSchedService::GetInstance().distributedConnectAbilityMap_.clear();
-        DistributedSchedService::GetInstance().distributedConnectAbilityMap_[connect] = sessionsList;
+        DistributedSchedService::GetInstance().distributedConnectAbilityMap_.Clear();
+        DistributedSchedService::GetInstance().distributedConnectAbilityMap_.Assign(connect, sessionsList);
     }
     DistributedSchedService::GetInstance().GetConnectComponentList(distributedComponents);
     EXPECT_TRUE(distributedComponents.empty());
@@ -1197,7 +1197,7 @@ HWTEST_F(DistributedSchedServiceSecondTest, GetConnectComponentList_001, TestSiz
     sessionsList.emplace_back(connectAbilitySession);
     {
         std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().distributedLock_);
-        DistributedSchedService::GetInstance().distributedConnectAbilityMap_[connect] = sessionsList;
+        DistributedSchedService::GetInstance().distributedConnectAbilityMap_.Assign(connect, sessionsList);
     }
     DistributedSchedService::GetInstance().GetConnectComponentList(distributedComponents);
     EXPECT_FALSE(distributedComponents.empty());
@@ -1206,10 +1206,7 @@ HWTEST_F(DistributedSchedServiceSecondTest, GetConnectComponentList_001, TestSiz
     */
     distributedComponents.clear();
     ConnectInfo connectInfo;
-    {
-        std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().connectLock_);
-        DistributedSchedService::GetInstance().connectAbilityMap_[connect] = connectInfo;
-    }
+    DistributedSchedService::GetInstance().connectAbilityMap_.Assign(connect, connectInfo);
     DistributedSchedService::GetInstance().GetConnectComponentList(distributedComponents);
     EXPECT_FALSE(distributedComponents.empty());
     DTEST_LOG << "DistributedSchedServiceSecondTest GetConnectComponentList_001 end" << std::endl;
@@ -1230,11 +1227,8 @@ HWTEST_F(DistributedSchedServiceSecondTest, GetCallComponentList_001, TestSize.L
     sptr<IRemoteObject> connect(new MockDistributedSched());
     std::list<ConnectAbilitySession> sessionsList;
     std::vector<std::string> distributedComponents;
-    {
-        std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().callerLock_);
-        DistributedSchedService::GetInstance().callerMap_.clear();
-        DistributedSchedService::GetInstance().callerMap_[connect] = sessionsList;
-    }
+    DistributedSchedService::GetInstance().callerMap_.Clear();
+    DistributedSchedService::GetInstance().callerMap_.Assign(connect, sessionsList);
     DistributedSchedService::GetInstance().GetCallComponentList(distributedComponents);
     EXPECT_TRUE(distributedComponents.empty());
     /**
@@ -1243,10 +1237,7 @@ HWTEST_F(DistributedSchedServiceSecondTest, GetCallComponentList_001, TestSize.L
     CallerInfo callerInfo;
     ConnectAbilitySession connectAbilitySession("sourceDeviceId", "destinationDeviceId", callerInfo);
     sessionsList.emplace_back(connectAbilitySession);
-    {
-        std::lock_guard<std::mutex> autoLock(DistributedSchedService::GetInstance().callerLock_);
-        DistributedSchedService::GetInstance().callerMap_[connect] = sessionsList;
-    }
+    DistributedSchedService::GetInstance().callerMap_.Assign(connect, sessionsList);
     DistributedSchedService::GetInstance().GetCallComponentList(distributedComponents);
     EXPECT_FALSE(distributedComponents.empty());
     /**
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_component_registry_test.h"
+
+#include "distributed_sched_service.h"
+#include "distributed_sched_test_util.h"
+#include "dms_component_registry.h"
+#include "dsched_collab.h"
+#include "dsched_transport_softbus_adapter.h"
+#include "dtbschedmgr_log.h"
+#include "test_log.h"
+#include "want_params.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr const char* FOUNDATION_PROCESS_NAME = "foundation";
+const char *PERMS[] = {
+    "ohos.permission.DISTRIBUTED_DATASYNC"
+};
+
+// records what the real entry points start, in place of the subsystem inits
+struct FakeComponents {
+    std::vector<std::string> inits;
+    std::vector<std::string> unInits;
+    bool continueSwitchOn = true;
+};
+
+FakeComponents g_fakes;
+std::map<int32_t, std::vector<std::shared_ptr<IDataListener>>> g_savedListeners;
+
+// keeps the graph and loader of DistributedSchedService::RegisterComponents, swaps only the init funcs
+void UseFakeInits()
+{
+    auto& registry = DmsComponentRegistry::GetInstance();
+    std::lock_guard<std::recursive_mutex> lock(registry.componentMutex_);
+    for (auto& [name, component] : registry.components_) {
+        std::string componentName = name;
+        component.init = [componentName]() {
+            if (componentName == DMS_COMPONENT_CONTINUE && !g_fakes.continueSwitchOn) {
+                return false;
+            }
+            g_fakes.inits.emplace_back(componentName);
+            return true;
+        };
+        component.unInit = [componentName]() {
+            g_fakes.unInits.emplace_back(componentName);
+        };
+    }
+}
+
+int32_t CallContinueMission()
+{
+    MessageParcel data;
+    MessageParcel reply;
+    data.WriteString("srcDevId");
+    data.WriteString("dstDevId");
+    data.WriteString("bundleName");
+    sptr<IRemoteObject> callback(new DistributedSchedService());
+    data.WriteRemoteObject(callback);
+    AAFwk::WantParams wantParams;
+    data.WriteParcelable(&wantParams);
+    return DistributedSchedService::GetInstance().ContinueMissionOfBundleNameInner(data, reply);
+}
+
+int32_t CallGetSinkCollabVersion()
+{
+    MessageParcel data;
+    MessageParcel reply;
+    data.WriteInt32(0);
+    data.WriteString("sinkDeviceId");
+    data.WriteString("collabToken");
+    sptr<IRemoteObject> callback(new DistributedSchedService());
+    data.WriteRemoteObject(callback);
+    return DistributedSchedService::GetInstance().GetSinkCollabVersionInner(data, reply);
+}
+
+int32_t CallCollabMission()
+{
+    MessageParcel data;
+    MessageParcel reply;
+    data.WriteInt32(0);
+    data.WriteString("socketName");
+    CollabMessage localInfo;
+    data.WriteParcelable(&localInfo);
+    CollabMessage peerInfo;
+    data.WriteParcelable(&peerInfo);
+    ConnectOpt opt;
+    data.WriteParcelable(&opt);
+    data.WriteString("collabToken");
+    return DistributedSchedService::GetInstance().CollabMissionInner(data, reply);
+}
+}
+
+void DmsComponentRegistryTest::SetUpTestCase()
+{
+    DTEST_LOG << "DmsComponentRegistryTest::SetUpTestCase" << std::endl;
+}
+
+void DmsComponentRegistryTest::TearDownTestCase()
+{
+    DTEST_LOG << "DmsComponentRegistryTest::TearDownTestCase" << std::endl;
+}
+
+void DmsComponentRegistryTest::TearDown()
+{
+    DTEST_LOG << "DmsComponentRegistryTest::TearDown" << std::endl;
+    DmsComponentRegistry::GetInstance().Reset();
+    auto& adapter = DSchedTransportSoftbusAdapter::GetInstance();
+    adapter.SetListenerLoader(nullptr);
+    std::lock_guard<std::mutex> listenerLock(adapter.listenerMutex_);
+    adapter.listeners_ = g_savedListeners;
+}
+
+void DmsComponentRegistryTest::SetUp()
+{
+    DTEST_LOG << "DmsComponentRegistryTest::SetUp" << std::endl;
+    DistributedSchedUtil::MockProcessAndPermission(FOUNDATION_PROCESS_NAME, PERMS, 1);
+    g_fakes = FakeComponents();
+    {
+        // peer data only loads a service that has no listener yet
+        auto& adapter = DSchedTransportSoftbusAdapter::GetInstance();
+        std::lock_guard<std::mutex> listenerLock(adapter.listenerMutex_);
+        g_savedListeners = adapter.listeners_;
+        adapter.listeners_.clear();
+    }
+    DmsComponentRegistry::GetInstance().Reset();
+    DistributedSchedService::GetInstance().RegisterComponents();
+    UseFakeInits();
+}
+
+/**
+ * @tc.name: Register_001
+ * @tc.desc: test Register rejects empty and duplicate names
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsComponentRegistryTest, Register_001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsComponentRegistryTest Register_001 begin" << std::endl;
+    DmsComponentRegistry registry;
+    EXPECT_EQ(registry.Register("", {}, nullptr), INVALID_PARAMETERS_ERR);
+    EXPECT_EQ(registry.Register(DMS_COMPONENT_MISSION, {}, nullptr), ERR_OK);
+    EXPECT_EQ(registry.Register(DMS_COMPONENT_MISSION, {}, nullptr), INVALID_PARAMETERS_ERR);
+    EXPECT_FALSE(registry.IsStarted(DMS_COMPONENT_MISSION));
+    EXPECT_FALSE(registry.Ensure(DMS_COMPONENT_COLLAB, DMS_TRIGGER_COLLAB_MISSION));
+
+    // the service registers each of its components once
+    EXPECT_EQ(DmsComponentRegistry::GetInstance().Register(DMS_COMPONENT_COLLAB, {}, nullptr),
+        INVALID_PARAMETERS_ERR);
+    DTEST_LOG << "DmsComponentRegistryTest Register_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: StartComponents_001
+ * @tc.desc: test sa start only starts the channel and mission components
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsComponentRegistryTest, StartComponents_001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsComponentRegistryTest StartComponents_001 begin" << std::endl;
+    auto& registry = DmsComponentRegistry::GetInstance();
+    DistributedSchedService::GetInstance().StartComponents();
+    std::vector<std::string> expected = { DMS_COMPONENT_SOFTBUS_CHANNEL, DMS_COMPONENT_MISSION };
+    EXPECT_EQ(g_fakes.inits, expected);
+    EXPECT_EQ(registry.GetStartedComponents(), expected);
+    EXPECT_FALSE(registry.IsStarted(DMS_COMPONENT_CONTINUE));
+    EXPECT_FALSE(registry.IsStarted(DMS_COMPONENT_COLLAB));
+
+    DmsComponentInfo info;
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_MISSION, info));
+    EXPECT_EQ(info.state, DmsComponentState::STARTED);
+    EXPECT_EQ(info.trigger, DMS_TRIGGER_SA_START);
+    EXPECT_EQ(info.startCount, 1u);
+    EXPECT_GE(info.startCostUs, 0);
+    DTEST_LOG << "DmsComponentRegistryTest StartComponents_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: ContinueMission_001
+ * @tc.desc: test a continue call through the stub starts continue once and leaves collab alone
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsComponentRegistryTest, ContinueMission_001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsComponentRegistryTest ContinueMission_001 begin" << std::endl;
+    auto& registry = DmsComponentRegistry::GetInstance();
+    DistributedSchedService::GetInstance().StartComponents();
+    CallContinueMission();
+    CallContinueMission();
+    std::vector<std::string> expected = { DMS_COMPONENT_SOFTBUS_CHANNEL, DMS_COMPONENT_MISSION,
+        DMS_COMPONENT_CONTINUE };
+    EXPECT_EQ(g_fakes.inits, expected);
+    EXPECT_FALSE(registry.IsStarted(DMS_COMPONENT_COLLAB));
+
+    DmsComponentInfo info;
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_CONTINUE, info));
+    EXPECT_EQ(info.trigger, DMS_TRIGGER_CONTINUE_MISSION);
+    EXPECT_EQ(info.startCount, 1u);
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_SOFTBUS_CHANNEL, info));
+    EXPECT_EQ(info.trigger, DMS_TRIGGER_SA_START);
+    DTEST_LOG << "DmsComponentRegistryTest ContinueMission_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: CollabMission_001
+ * @tc.desc: test the collab calls through the stub start collab after the channel it depends on
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsComponentRegistryTest, CollabMission_001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsComponentRegistryTest CollabMission_001 begin" << std::endl;
+    auto& registry = DmsComponentRegistry::GetInstance();
+    CallGetSinkCollabVersion();
+    std::vector<std::string> expected = { DMS_COMPONENT_SOFTBUS_CHANNEL, DMS_COMPONENT_COLLAB };
+    EXPECT_EQ(g_fakes.inits, expected);
+    EXPECT_EQ(registry.GetStartedComponents(), expected);
+    EXPECT_FALSE(registry.IsStarted(DMS_COMPONENT_CONTINUE));
+
+    DmsComponentInfo info;
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_SOFTBUS_CHANNEL, info));
+    EXPECT_EQ(info.trigger, "dependency of " + DMS_COMPONENT_COLLAB);
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_COLLAB, info));
+    EXPECT_EQ(info.trigger, DMS_TRIGGER_COLLAB_MISSION);
+
+    CallCollabMission();
+    EXPECT_EQ(g_fakes.inits, expected);
+    DTEST_LOG << "DmsComponentRegistryTest CollabMission_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: PeerData_001
+ * @tc.desc: test data from a peer starts the service of its type through the listener loader
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsComponentRegistryTest, PeerData_001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsComponentRegistryTest PeerData_001 begin" << std::endl;
+    auto& registry = DmsComponentRegistry::GetInstance();
+    auto& adapter = DSchedTransportSoftbusAdapter::GetInstance();
+    adapter.OnDataReady(0, nullptr, SERVICE_TYPE_COLLAB);
+    EXPECT_TRUE(registry.IsStarted(DMS_COMPONENT_COLLAB));
+    EXPECT_FALSE(registry.IsStarted(DMS_COMPONENT_CONTINUE));
+    DmsComponentInfo info;
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_COLLAB, info));
+    EXPECT_EQ(info.trigger, DMS_TRIGGER_PEER_DATA);
+
+    adapter.OnDataReady(0, nullptr, SERVICE_TYPE_CONTINUE);
+    EXPECT_TRUE(registry.IsStarted(DMS_COMPONENT_CONTINUE));
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_CONTINUE, info));
+    EXPECT_EQ(info.trigger, DMS_TRIGGER_PEER_DATA);
+    std::vector<std::string> expected = { DMS_COMPONENT_SOFTBUS_CHANNEL, DMS_COMPONENT_COLLAB,
+        DMS_COMPONENT_CONTINUE };
+    EXPECT_EQ(g_fakes.inits, expected);
+    DTEST_LOG << "DmsComponentRegistryTest PeerData_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Ensure_001
+ * @tc.desc: test a refused init is retried and a dependency cycle fails
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsComponentRegistryTest, Ensure_001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsComponentRegistryTest Ensure_001 begin" << std::endl;
+    auto& registry = DmsComponentRegistry::GetInstance();
+    g_fakes.continueSwitchOn = false;
+    CallContinueMission();
+    DmsComponentInfo info;
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_CONTINUE, info));
+    EXPECT_EQ(info.state, DmsComponentState::FAILED);
+    EXPECT_TRUE(registry.IsStarted(DMS_COMPONENT_SOFTBUS_CHANNEL));
+
+    g_fakes.continueSwitchOn = true;
+    CallContinueMission();
+    EXPECT_TRUE(registry.IsStarted(DMS_COMPONENT_CONTINUE));
+
+    DmsComponentRegistry cycle;
+    cycle.Register("cycle_a", { "cycle_b" }, nullptr);
+    cycle.Register("cycle_b", { "cycle_a" }, nullptr);
+    EXPECT_FALSE(cycle.Ensure("cycle_a", DMS_TRIGGER_SA_START));
+    EXPECT_FALSE(cycle.IsStarted("cycle_a"));
+    EXPECT_FALSE(cycle.IsStarted("cycle_b"));
+    DTEST_LOG << "DmsComponentRegistryTest Ensure_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Stop_001
+ * @tc.desc: test Stop uninits dependents first and later peer data restarts continue
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsComponentRegistryTest, Stop_001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsComponentRegistryTest Stop_001 begin" << std::endl;
+    auto& registry = DmsComponentRegistry::GetInstance();
+    DistributedSchedService::GetInstance().StartComponents();
+    registry.Stop(DMS_COMPONENT_CONTINUE);
+    EXPECT_TRUE(g_fakes.unInits.empty());
+
+    CallContinueMission();
+    CallGetSinkCollabVersion();
+    registry.Stop(DMS_COMPONENT_SOFTBUS_CHANNEL);
+    EXPECT_EQ(g_fakes.unInits.size(), 3u);
+    EXPECT_EQ(g_fakes.unInits.back(), DMS_COMPONENT_SOFTBUS_CHANNEL);
+    EXPECT_EQ(registry.GetStartedComponents(), std::vector<std::string>({ DMS_COMPONENT_MISSION }));
+
+    DSchedTransportSoftbusAdapter::GetInstance().OnDataReady(0, nullptr, SERVICE_TYPE_CONTINUE);
+    DmsComponentInfo info;
+    EXPECT_TRUE(registry.GetComponentInfo(DMS_COMPONENT_CONTINUE, info));
+    EXPECT_EQ(info.startCount, 2u);
+    EXPECT_EQ(info.trigger, DMS_TRIGGER_PEER_DATA);
+    DTEST_LOG << "DmsComponentRegistryTest Stop_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Dump_001
+ * @tc.desc: test Dump shows state, trigger and start order of the components
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsComponentRegistryTest, Dump_001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsComponentRegistryTest Dump_001 begin" << std::endl;
+    auto& registry = DmsComponentRegistry::GetInstance();
+    DistributedSchedService::GetInstance().StartComponents();
+    std::string result;
+    registry.Dump(result);
+    EXPECT_NE(result.find("mission: started, trigger sa start"), std::string::npos);
+    EXPECT_NE(result.find("collab: not started, deps softbus_channel"), std::string::npos);
+    EXPECT_NE(result.find("start order: softbus_channel mission"), std::string::npos);
+
+    registry.Reset();
+    EXPECT_TRUE(registry.GetStartedComponents().empty());
+    EXPECT_FALSE(registry.IsStarted(DMS_COMPONENT_MISSION));
+    DTEST_LOG << "DmsComponentRegistryTest Dump_001 end" << std::endl;
+}
+}
+}
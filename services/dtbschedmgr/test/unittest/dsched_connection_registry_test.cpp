@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsched_connection_registry_test.h"
+
+#include <atomic>
+#include <thread>
+
+#include "dsched_connection_registry.h"
+#include "mock_remote_stub.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr int32_t CONNECT_NUM = 400;
+constexpr int32_t DEVICE_NUM = 8;
+constexpr int32_t CONNECT_THREAD_NUM = 4;
+constexpr int32_t FLAP_ROUND = 50;
+const std::string DEVICE_ID_PREFIX = "remote_device_";
+
+// one connect, the devices it has sessions with
+using TestSessions = std::set<std::string>;
+using TestRegistry = DSchedConnectionRegistry<TestSessions>;
+
+std::set<std::string> GetTestDeviceIds(const TestSessions& sessions)
+{
+    return sessions;
+}
+
+std::string GetDeviceId(int32_t index)
+{
+    return DEVICE_ID_PREFIX + std::to_string(index % DEVICE_NUM);
+}
+
+std::vector<sptr<IRemoteObject>> CreateConnects(int32_t num)
+{
+    std::vector<sptr<IRemoteObject>> connects;
+    for (int32_t i = 0; i < num; i++) {
+        connects.emplace_back(new MockRemoteStub());
+    }
+    return connects;
+}
+
+void AddSession(TestRegistry& registry, const sptr<IRemoteObject>& connect, const std::string& deviceId)
+{
+    registry.Update(connect, [&deviceId](TestSessions& sessions) {
+        sessions.insert(deviceId);
+        return true;
+    });
+}
+
+// what ProcessDeviceOffline does, returns the number of connects visited
+int32_t RemoveDevice(TestRegistry& registry, const std::string& deviceId)
+{
+    int32_t visited = 0;
+    for (const auto& connect : registry.GetConnectsOfDevice(deviceId)) {
+        registry.UpdateIfExists(connect, [&deviceId, &visited](TestSessions& sessions) {
+            visited++;
+            sessions.erase(deviceId);
+            return !sessions.empty();
+        });
+    }
+    return visited;
+}
+
+// every session is indexed under its device and every index entry has a session
+void CheckIndex(const TestRegistry& registry)
+{
+    std::map<std::string, std::set<IRemoteObject*>> expected;
+    registry.ForEach([&expected](const sptr<IRemoteObject>& connect, const TestSessions& sessions) {
+        EXPECT_FALSE(sessions.empty());
+        for (const auto& deviceId : sessions) {
+            expected[deviceId].insert(connect.GetRefPtr());
+        }
+    });
+    for (int32_t i = 0; i < DEVICE_NUM; i++) {
+        std::string deviceId = GetDeviceId(i);
+        std::set<IRemoteObject*> indexed;
+        for (const auto& connect : registry.GetConnectsOfDevice(deviceId)) {
+            indexed.insert(connect.GetRefPtr());
+        }
+        EXPECT_EQ(indexed, expected[deviceId]);
+    }
+}
+}
+
+void DSchedConnectionRegistryTest::SetUpTestCase()
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest::SetUpTestCase" << std::endl;
+}
+
+void DSchedConnectionRegistryTest::TearDownTestCase()
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest::TearDownTestCase" << std::endl;
+}
+
+void DSchedConnectionRegistryTest::TearDown()
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest::TearDown" << std::endl;
+}
+
+void DSchedConnectionRegistryTest::SetUp()
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest::SetUp" << std::endl;
+}
+
+/**
+ * @tc.name: EmplaceFindErase_001
+ * @tc.desc: test Emplace, Find and Erase keep the device index in step
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedConnectionRegistryTest, EmplaceFindErase_001, TestSize.Level1)
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest EmplaceFindErase_001 begin" << std::endl;
+    TestRegistry registry(GetTestDeviceIds);
+    sptr<IRemoteObject> connect(new MockRemoteStub());
+    EXPECT_TRUE(registry.Emplace(connect, { GetDeviceId(0), GetDeviceId(1) }));
+    EXPECT_FALSE(registry.Emplace(connect, { GetDeviceId(2) }));
+
+    TestSessions sessions;
+    EXPECT_TRUE(registry.Find(connect, sessions));
+    EXPECT_EQ(sessions.size(), static_cast<size_t>(2));
+    EXPECT_EQ(registry.GetConnectsOfDevice(GetDeviceId(1)).size(), static_cast<size_t>(1));
+    EXPECT_TRUE(registry.GetConnectsOfDevice(GetDeviceId(2)).empty());
+
+    EXPECT_TRUE(registry.Erase(connect, &sessions));
+    EXPECT_FALSE(registry.Erase(connect));
+    EXPECT_FALSE(registry.Contains(connect));
+    EXPECT_TRUE(registry.Empty());
+    EXPECT_TRUE(registry.GetConnectsOfDevice(GetDeviceId(0)).empty());
+    DTEST_LOG << "DSchedConnectionRegistryTest EmplaceFindErase_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Update_001
+ * @tc.desc: test Update reindexes changed sessions and drops emptied entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedConnectionRegistryTest, Update_001, TestSize.Level1)
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest Update_001 begin" << std::endl;
+    TestRegistry registry(GetTestDeviceIds);
+    sptr<IRemoteObject> connect(new MockRemoteStub());
+    auto addDevice0 = [](TestSessions& sessions) {
+        sessions.insert(GetDeviceId(0));
+        return true;
+    };
+    EXPECT_TRUE(registry.Update(connect, addDevice0));
+    EXPECT_FALSE(registry.Update(connect, addDevice0));
+    AddSession(registry, connect, GetDeviceId(1));
+    EXPECT_EQ(registry.GetConnectsOfDevice(GetDeviceId(1)).size(), static_cast<size_t>(1));
+
+    EXPECT_EQ(RemoveDevice(registry, GetDeviceId(0)), 1);
+    EXPECT_TRUE(registry.Contains(connect));
+    EXPECT_TRUE(registry.GetConnectsOfDevice(GetDeviceId(0)).empty());
+
+    EXPECT_EQ(RemoveDevice(registry, GetDeviceId(1)), 1);
+    EXPECT_FALSE(registry.Contains(connect));
+    EXPECT_FALSE(registry.UpdateIfExists(connect, addDevice0));
+    EXPECT_TRUE(registry.Empty());
+    DTEST_LOG << "DSchedConnectionRegistryTest Update_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: EraseIf_001
+ * @tc.desc: test EraseIf and FindIf across shards
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedConnectionRegistryTest, EraseIf_001, TestSize.Level1)
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest EraseIf_001 begin" << std::endl;
+    TestRegistry registry(GetTestDeviceIds);
+    auto connects = CreateConnects(CONNECT_NUM);
+    for (int32_t i = 0; i < CONNECT_NUM; i++) {
+        AddSession(registry, connects[i], GetDeviceId(i));
+    }
+    EXPECT_EQ(registry.Size(), static_cast<size_t>(CONNECT_NUM));
+
+    TestRegistry::Entry entry;
+    EXPECT_TRUE(registry.FindIf([&connects](const sptr<IRemoteObject>& connect, const TestSessions& sessions) {
+        return connect == connects[1];
+    }, entry));
+    EXPECT_EQ(entry.second.count(GetDeviceId(1)), static_cast<size_t>(1));
+
+    auto removed = registry.EraseIf([](const sptr<IRemoteObject>& connect, const TestSessions& sessions) {
+        return sessions.count(GetDeviceId(0)) != 0;
+    });
+    EXPECT_EQ(removed.size(), static_cast<size_t>(CONNECT_NUM / DEVICE_NUM));
+    EXPECT_EQ(registry.Size(), static_cast<size_t>(CONNECT_NUM - CONNECT_NUM / DEVICE_NUM));
+    CheckIndex(registry);
+
+    registry.Clear();
+    EXPECT_TRUE(registry.Empty());
+    EXPECT_TRUE(registry.GetConnectsOfDevice(GetDeviceId(1)).empty());
+    DTEST_LOG << "DSchedConnectionRegistryTest EraseIf_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: DeviceOffline_001
+ * @tc.desc: test device offline only visits the connects of that device
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedConnectionRegistryTest, DeviceOffline_001, TestSize.Level1)
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest DeviceOffline_001 begin" << std::endl;
+    TestRegistry registry(GetTestDeviceIds);
+    auto connects = CreateConnects(CONNECT_NUM);
+    for (int32_t i = 0; i < CONNECT_NUM; i++) {
+        AddSession(registry, connects[i], GetDeviceId(i));
+    }
+    // a few connects also talk to a second device
+    AddSession(registry, connects[0], GetDeviceId(1));
+    AddSession(registry, connects[DEVICE_NUM], GetDeviceId(1));
+
+    EXPECT_EQ(RemoveDevice(registry, GetDeviceId(1)), CONNECT_NUM / DEVICE_NUM + 2);
+    EXPECT_EQ(registry.Size(), static_cast<size_t>(CONNECT_NUM - CONNECT_NUM / DEVICE_NUM));
+    EXPECT_TRUE(registry.Contains(connects[0]));
+    EXPECT_TRUE(registry.Contains(connects[DEVICE_NUM]));
+    CheckIndex(registry);
+    DTEST_LOG << "DSchedConnectionRegistryTest DeviceOffline_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: StressDeviceFlap_001
+ * @tc.desc: test concurrent connects and disconnects while devices go offline and back
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedConnectionRegistryTest, StressDeviceFlap_001, TestSize.Level1)
+{
+    DTEST_LOG << "DSchedConnectionRegistryTest StressDeviceFlap_001 begin" << std::endl;
+    TestRegistry registry(GetTestDeviceIds);
+    auto connects = CreateConnects(CONNECT_NUM);
+    std::atomic<bool> isRunning { true };
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < CONNECT_THREAD_NUM; t++) {
+        threads.emplace_back([&registry, &connects, &isRunning, t]() {
+            int32_t round = 0;
+            while (isRunning.load()) {
+                for (int32_t i = t; i < CONNECT_NUM; i += CONNECT_THREAD_NUM) {
+                    AddSession(registry, connects[i], GetDeviceId(i + round));
+                    if ((i + round) % CONNECT_THREAD_NUM == 0) {
+                        registry.Erase(connects[i]);
+                    }
+                }
+                round++;
+            }
+        });
+    }
+    std::thread flapper([&registry]() {
+        for (int32_t round = 0; round < FLAP_ROUND; round++) {
+            for (int32_t i = 0; i < DEVICE_NUM; i++) {
+                RemoveDevice(registry, GetDeviceId(i));
+            }
+        }
+    });
+    flapper.join();
+    isRunning.store(false);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CheckIndex(registry);
+
+    for (int32_t i = 0; i < DEVICE_NUM; i++) {
+        RemoveDevice(registry, GetDeviceId(i));
+    }
+    EXPECT_TRUE(registry.Empty());
+    DTEST_LOG << "DSchedConnectionRegistryTest StressDeviceFlap_001 end" << std::endl;
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
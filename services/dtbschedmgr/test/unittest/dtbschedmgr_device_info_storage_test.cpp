@@ -308,10 +308,7 @@ HWTEST_F(DtbschedmgrDeviceInfoStorageTest, GetUuidByNetworkIdTest_001, TestSize.
      * @tc.steps: step3. test GetUuidByNetworkId when networkId is in map;
      */
     std::string uuid = "invalid uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = networkId;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ networkId, uuid, "" });
     result = DtbschedmgrDeviceInfoStorage::GetInstance().GetUuidByNetworkId(networkId);
     EXPECT_EQ(result, uuid);
     DTEST_LOG << "DtbschedmgrDeviceInfoStorageTest GetUuidByNetworkIdTest_001 end" << std::endl;
@@ -341,10 +338,7 @@ HWTEST_F(DtbschedmgrDeviceInfoStorageTest, GetNetworkIdByUuidTest_001, TestSize.
      * @tc.steps: step3. test GetNetworkIdByUuid;
      */
     std::string networkId = "invalid networkId for GetNetworkIdByUuid";
-    {
-        std::lock_guard<std::mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = networkId;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ networkId, uuid, "" });
     result = DtbschedmgrDeviceInfoStorage::GetInstance().GetNetworkIdByUuid(uuid);
     EXPECT_EQ(result, networkId);
     /**
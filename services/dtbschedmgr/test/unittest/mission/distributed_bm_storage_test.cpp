@@ -15,9 +15,11 @@
 
 #include "distributed_bm_storage_test.h"
 
+#include <chrono>
 #include <thread>
 #include "distributed_sched_test_util.h"
 #include "dtbschedmgr_device_info_storage.h"
+#include "mission/dms_kv_store_manager.h"
 #include "test_log.h"
 
 namespace OHOS {
@@ -38,6 +40,8 @@ constexpr int32_t TASK_ID_2 = 12;
 constexpr size_t BYTESTREAM_LENGTH = 100;
 constexpr uint8_t ONE_BYTE = '6';
 constexpr uint16_t ONE = 1;
+constexpr int32_t WAIT_STORE_READY_TIMES = 300;
+const std::string PUBLIC_RECORDS_SUFFIX = "_publicRecords";
 }
 
 bool DtbschedmgrDeviceInfoStorage::GetLocalUdid(std::string& udid)
@@ -59,6 +63,12 @@ std::string DtbschedmgrDeviceInfoStorage::GetUuidByNetworkId(const std::string&
 void DistributedBmStorageTest::SetUpTestCase()
 {
     mkdir(BASEDIR.c_str(), (S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH));
+    // the store opens in the background, the cases below expect it open
+    auto bmStorage = DmsBmStorage::GetInstance();
+    for (int32_t i = 0; i < WAIT_STORE_READY_TIMES && DmsKvStoreManager::GetInstance().GetStoreState(
+        DISTRIBUTE_BM_STORE_ID) != DmsKvStoreManager::StoreState::READY; i++) {
+        this_thread::sleep_for(10ms);
+    }
     DTEST_LOG << "DistributedBmStorageTest::SetUpTestCase" << std::endl;
 }
 
@@ -891,5 +901,46 @@ HWTEST_F(DistributedBmStorageTest, GetLastBundleNameIdTest_001, TestSize.Level1)
     }
     DTEST_LOG << "DistributedBmStorageTest GetLastBundleNameIdTest_001 end" << std::endl;
 }
+
+/**
+ * @tc.name: PublishOnStoreReadyTest_001
+ * @tc.desc: the local bundle infos are published once the store opened in the background is ready
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedBmStorageTest, PublishOnStoreReadyTest_001, TestSize.Level1)
+{
+    DTEST_LOG << "DistributedBmStorageTest PublishOnStoreReadyTest_001 start" << std::endl;
+    ASSERT_NE(dmsBmStorage_, nullptr);
+    auto bundleMgr = dmsBmStorage_->GetBundleMgr();
+    ASSERT_NE(bundleMgr, nullptr);
+    std::vector<AppExecFwk::BundleInfo> bundleInfos;
+    if (!bundleMgr->GetBundleInfosForContinuation(AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES, bundleInfos,
+        AppExecFwk::Constants::ALL_USERID) || bundleInfos.empty()) {
+        DTEST_LOG << "no continuable bundle to publish, skip" << std::endl;
+        return;
+    }
+    // a udid without records, so every continuable bundle is written
+    g_mockGetLocalUdid = "publishOnReadyUdid" + std::to_string(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+
+    // the kv data service comes up after the storage is created, as at sa start
+    DmsKvStoreManager::GetInstance().OnKvServiceRemoved();
+    dmsBmStorage_->UpdateDistributedData();
+    DmsKvStoreManager::GetInstance().OnKvServiceAdded();
+
+    bool isPublished = false;
+    Key key(g_mockGetLocalUdid + PUBLIC_RECORDS_SUFFIX);
+    for (int32_t i = 0; i < WAIT_STORE_READY_TIMES && !isPublished; i++) {
+        std::shared_ptr<SingleKvStore> kvStore;
+        Value value;
+        isPublished = DmsKvStoreManager::GetInstance().GetKvStore(DISTRIBUTE_BM_STORE_ID, kvStore) == ERR_OK &&
+            kvStore->Get(key, value) == Status::SUCCESS;
+        if (!isPublished) {
+            this_thread::sleep_for(10ms);
+        }
+    }
+    EXPECT_TRUE(isPublished);
+    DTEST_LOG << "DistributedBmStorageTest PublishOnStoreReadyTest_001 end" << std::endl;
+}
 } // namespace DistributedSchedule
 } // namespace OHOS
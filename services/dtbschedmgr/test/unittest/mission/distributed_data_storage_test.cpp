@@ -32,6 +32,36 @@ constexpr int32_t TASK_ID_1 = 11;
 constexpr int32_t TASK_ID_2 = 12;
 constexpr size_t BYTESTREAM_LENGTH = 100;
 constexpr uint8_t ONE_BYTE = '6';
+constexpr int64_t FAKE_DELAY_MS = 200;
+constexpr int32_t FAKE_QUERY_COUNT = 8;
+const std::string FAKE_NETWORK_ID = "fakeNetworkId";
+const std::string FAKE_UUID = "fakeUuid";
+const std::string FAKE_VALUE = "fakeSnapshot";
+}
+
+FakeDistributedDataStorage::~FakeDistributedDataStorage()
+{
+    for (auto& replyThread : replyThreads) {
+        if (replyThread.joinable()) {
+            replyThread.join();
+        }
+    }
+}
+
+bool FakeDistributedDataStorage::GetFromKvStoreLocked(const Key& key, const std::string& networkId,
+    const std::function<void(Status, Value&&)>& onResult) const
+{
+    getCount++;
+    if (dropReply) {
+        return true;
+    }
+    int64_t delay = delayMs;
+    Status replyStatus = status;
+    replyThreads.emplace_back([onResult, delay, replyStatus]() {
+        this_thread::sleep_for(chrono::milliseconds(delay));
+        onResult(replyStatus, Value(FAKE_VALUE));
+    });
+    return true;
 }
 
 void DistributedDataStorageTest::SetUpTestCase()
@@ -382,5 +412,135 @@ HWTEST_F(DistributedDataStorageTest, QueryTest_007, TestSize.Level1)
     distributedDataStorage_->Stop();
     DTEST_LOG << "DistributedDataStorageTest QueryTest_007 end" << std::endl;
 }
+
+/**
+ * @tc.name: QueryAsyncTest_001
+ * @tc.desc: test async query completes through the callback and Wait
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedDataStorageTest, QueryAsyncTest_001, TestSize.Level1)
+{
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_001 start" << std::endl;
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ FAKE_NETWORK_ID, FAKE_UUID, "" });
+    auto storage = std::make_shared<FakeDistributedDataStorage>();
+    storage->delayMs = FAKE_DELAY_MS;
+    std::atomic<int32_t> callbackCount { 0 };
+    auto task = storage->QueryAsync(FAKE_NETWORK_ID, TASK_ID_1, storage->GetQueryDeadline(),
+        [&callbackCount](Status status, const Value& value) {
+            EXPECT_EQ(status, Status::SUCCESS);
+            EXPECT_EQ(value.ToString(), FAKE_VALUE);
+            callbackCount++;
+        });
+    ASSERT_NE(task, nullptr);
+    EXPECT_FALSE(task->IsDone());
+    Value value;
+    EXPECT_EQ(task->Wait(value), Status::SUCCESS);
+    EXPECT_EQ(value.ToString(), FAKE_VALUE);
+    EXPECT_EQ(callbackCount.load(), 1);
+    EXPECT_FALSE(task->Complete(Status::ERROR, Value()));
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: QueryAsyncTest_002
+ * @tc.desc: test async query times out at the deadline when the store never replies
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedDataStorageTest, QueryAsyncTest_002, TestSize.Level1)
+{
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_002 start" << std::endl;
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ FAKE_NETWORK_ID, FAKE_UUID, "" });
+    auto storage = std::make_shared<FakeDistributedDataStorage>();
+    storage->dropReply = true;
+    auto begin = chrono::steady_clock::now();
+    auto task = storage->QueryAsync(FAKE_NETWORK_ID, TASK_ID_1, begin + chrono::milliseconds(FAKE_DELAY_MS));
+    ASSERT_NE(task, nullptr);
+    Value value;
+    EXPECT_EQ(task->Wait(value), Status::TIME_OUT);
+    EXPECT_GE(chrono::steady_clock::now() - begin, chrono::milliseconds(FAKE_DELAY_MS));
+    EXPECT_TRUE(task->IsDone());
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: QueryAsyncTest_003
+ * @tc.desc: test a cancelled query drops the late reply and skips the callback
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedDataStorageTest, QueryAsyncTest_003, TestSize.Level1)
+{
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_003 start" << std::endl;
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ FAKE_NETWORK_ID, FAKE_UUID, "" });
+    auto storage = std::make_shared<FakeDistributedDataStorage>();
+    storage->delayMs = FAKE_DELAY_MS;
+    std::atomic<int32_t> callbackCount { 0 };
+    auto task = storage->QueryAsync(FAKE_NETWORK_ID, TASK_ID_1, storage->GetQueryDeadline(),
+        [&callbackCount](Status status, const Value& value) {
+            callbackCount++;
+        });
+    ASSERT_NE(task, nullptr);
+    EXPECT_TRUE(task->Cancel());
+    EXPECT_FALSE(task->Cancel());
+    Value value;
+    EXPECT_EQ(task->Wait(value), Status::ERROR);
+    storage.reset();
+    EXPECT_EQ(callbackCount.load(), 0);
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_003 end" << std::endl;
+}
+
+/**
+ * @tc.name: QueryAsyncTest_004
+ * @tc.desc: test concurrent queries overlap instead of adding up their delays
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedDataStorageTest, QueryAsyncTest_004, TestSize.Level1)
+{
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_004 start" << std::endl;
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ FAKE_NETWORK_ID, FAKE_UUID, "" });
+    auto storage = std::make_shared<FakeDistributedDataStorage>();
+    storage->delayMs = FAKE_DELAY_MS;
+    auto begin = chrono::steady_clock::now();
+    auto deadline = storage->GetQueryDeadline();
+    std::vector<std::shared_ptr<DistributedDataQueryTask>> tasks;
+    for (int32_t missionId = 0; missionId < FAKE_QUERY_COUNT; missionId++) {
+        auto task = storage->QueryAsync(FAKE_NETWORK_ID, missionId, deadline);
+        ASSERT_NE(task, nullptr);
+        tasks.push_back(task);
+    }
+    for (auto& task : tasks) {
+        Value value;
+        EXPECT_EQ(task->Wait(value), Status::SUCCESS);
+    }
+    EXPECT_LT(chrono::steady_clock::now() - begin, chrono::milliseconds(FAKE_DELAY_MS * FAKE_QUERY_COUNT / 2));
+    EXPECT_EQ(storage->getCount.load(), FAKE_QUERY_COUNT);
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_004 end" << std::endl;
+}
+
+/**
+ * @tc.name: QueryAsyncTest_005
+ * @tc.desc: test the sync Query wrapper and invalid async arguments
+ * @tc.type: FUNC
+ */
+HWTEST_F(DistributedDataStorageTest, QueryAsyncTest_005, TestSize.Level1)
+{
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_005 start" << std::endl;
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ FAKE_NETWORK_ID, FAKE_UUID, "" });
+    auto storage = std::make_shared<FakeDistributedDataStorage>();
+    Value value;
+    EXPECT_TRUE(storage->Query(FAKE_NETWORK_ID, TASK_ID_1, value));
+    EXPECT_EQ(value.ToString(), FAKE_VALUE);
+    storage->status = Status::KEY_NOT_FOUND;
+    EXPECT_FALSE(storage->Query(FAKE_NETWORK_ID, TASK_ID_2, value));
+    auto deadline = storage->GetQueryDeadline();
+    EXPECT_EQ(storage->QueryAsync("", TASK_ID_1, deadline), nullptr);
+    EXPECT_EQ(storage->QueryAsync(FAKE_NETWORK_ID, -1, deadline), nullptr);
+    EXPECT_EQ(storage->QueryAsync("unknownNetworkId", TASK_ID_1, deadline), nullptr);
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DTEST_LOG << "DistributedDataStorageTest QueryAsyncTest_005 end" << std::endl;
+}
 } // namespace DistributedSchedule
 } // namespace OHOS
\ No newline at end of file
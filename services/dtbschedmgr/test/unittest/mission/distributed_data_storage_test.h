@@ -16,6 +16,9 @@
 #ifndef OHOS_DISTRIBUTED_DATA_STORAGE_TEST_H
 #define OHOS_DISTRIBUTED_DATA_STORAGE_TEST_H
 
+#include <atomic>
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "device_manager.h"
@@ -23,6 +26,20 @@
 
 namespace OHOS {
 namespace DistributedSchedule {
+class FakeDistributedDataStorage : public DistributedDataStorage {
+public:
+    ~FakeDistributedDataStorage() override;
+    bool GetFromKvStoreLocked(const DistributedKv::Key& key, const std::string& networkId,
+        const std::function<void(DistributedKv::Status, DistributedKv::Value&&)>& onResult) const override;
+
+    // reply after delayMs, never reply when dropReply is set
+    int64_t delayMs = 0;
+    bool dropReply = false;
+    DistributedKv::Status status = DistributedKv::Status::SUCCESS;
+    mutable std::atomic<int32_t> getCount { 0 };
+    mutable std::vector<std::thread> replyThreads;
+};
+
 class DistributedDataStorageTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -15,12 +15,15 @@
 
 #include "dms_continue_manager_test.h"
 
+#include "datashare_manager.h"
 #include "datetime_ex.h"
 #include "distributed_sched_test_util.h"
 #include "dtbschedmgr_log.h"
 #define private public
 #include "mission/notification/dms_continue_recv_manager.h"
+#include "mission/notification/dms_continue_send_manager.h"
 #undef private
+#include "mission/wifi_state_adapter.h"
 #include "multi_user_manager.h"
 #include "softbus_adapter/softbus_adapter.h"
 #include "test_log.h"
@@ -48,10 +51,17 @@ constexpr int32_t INACTIVE = 1;
 constexpr int32_t CANCEL_FOCUSED_DELAYED = 10000;
 constexpr int32_t DBMS_RETRY_MAX_TIME = 5;
 constexpr uint8_t DMS_FOCUSED_TYPE = 0x00;
+constexpr uint32_t BROADCAST_LEN = 4;
+constexpr int32_t DEDUP_WINDOW = 60000;
+constexpr int64_t COALESCE_WINDOW = 100;
+constexpr int64_t MIN_INTERVAL = 200;
+constexpr uint32_t BURST = 1;
+int32_t g_softbusSendCount = 0;
 }
 
 int32_t SoftbusAdapter::SendSoftbusEvent(std::shared_ptr<DSchedDataBuffer> buffer)
 {
+    g_softbusSendCount++;
     return CAN_NOT_FOUND_ABILITY_ERR;
 }
 
@@ -746,5 +756,168 @@ HWTEST_F(DMSContinueManagerTest, NotifyDockDisplay_001, TestSize.Level1)
     EXPECT_EQ(ret, ERR_OK);
     DTEST_LOG << "DMSContinueManagerTest NotifyDockDisplay_001 end" << std::endl;
 }
+
+/**
+ * @tc.name: testNotifyDataRecvDedup001
+ * @tc.desc: test NotifyDataRecv drops identical broadcasts within the dedup window
+ * @tc.type: FUNC
+ */
+HWTEST_F(DMSContinueManagerTest, testNotifyDataRecvDedup001, TestSize.Level1)
+{
+    DTEST_LOG << "DMSContinueManagerTest testNotifyDataRecvDedup001 start" << std::endl;
+    auto recvMgr = MultiUserManager::GetInstance().GetCurrentRecvMgr();
+    ASSERT_NE(nullptr, recvMgr);
+    recvMgr->UnInit();
+    WifiStateAdapter::GetInstance().UpdateWifiState(true);
+    DataShareManager::GetInstance().SetCurrentContinueSwitch(true);
+    recvMgr->ClearBroadcastRecord();
+    recvMgr->SetBroadcastDedupWindow(DEDUP_WINDOW);
+
+    std::string senderNetworkId = NETWORKID_01;
+    uint8_t focused[] = {0x03, 0x00, 0x01, 0x00};
+    uint8_t unfocused[] = {0x13, 0x00, 0x01, 0x00};
+    BroadcastRecvStat before = recvMgr->GetBroadcastRecvStat();
+    recvMgr->NotifyDataRecv(senderNetworkId, focused, BROADCAST_LEN);
+    recvMgr->NotifyDataRecv(senderNetworkId, focused, BROADCAST_LEN);
+    recvMgr->NotifyDataRecv(senderNetworkId, focused, BROADCAST_LEN);
+    BroadcastRecvStat after = recvMgr->GetBroadcastRecvStat();
+    EXPECT_EQ(after.droppedCount - before.droppedCount, 2u);
+
+    recvMgr->NotifyDataRecv(senderNetworkId, unfocused, BROADCAST_LEN);
+    std::string otherNetworkId = NETWORKID_02;
+    recvMgr->NotifyDataRecv(otherNetworkId, unfocused, BROADCAST_LEN);
+    BroadcastRecvStat last = recvMgr->GetBroadcastRecvStat();
+    EXPECT_EQ(last.droppedCount, after.droppedCount);
+    EXPECT_EQ(recvMgr->lastBroadcast_[senderNetworkId].state, INACTIVE);
+
+    recvMgr->SetBroadcastDedupWindow(0);
+    recvMgr->NotifyDataRecv(senderNetworkId, unfocused, BROADCAST_LEN);
+    EXPECT_EQ(recvMgr->GetBroadcastRecvStat().droppedCount, last.droppedCount);
+    recvMgr->SetBroadcastDedupWindow(DMSContinueRecvMgr::DEFAULT_BROADCAST_DEDUP_WINDOW);
+    recvMgr->ClearBroadcastRecord();
+    DTEST_LOG << "DMSContinueManagerTest testNotifyDataRecvDedup001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testNotifyDataRecvDedup002
+ * @tc.desc: test dedup record is reset when the sender goes offline
+ * @tc.type: FUNC
+ */
+HWTEST_F(DMSContinueManagerTest, testNotifyDataRecvDedup002, TestSize.Level1)
+{
+    DTEST_LOG << "DMSContinueManagerTest testNotifyDataRecvDedup002 start" << std::endl;
+    auto recvMgr = MultiUserManager::GetInstance().GetCurrentRecvMgr();
+    ASSERT_NE(nullptr, recvMgr);
+    recvMgr->UnInit();
+    WifiStateAdapter::GetInstance().UpdateWifiState(true);
+    DataShareManager::GetInstance().SetCurrentContinueSwitch(true);
+    recvMgr->ClearBroadcastRecord();
+    recvMgr->SetBroadcastDedupWindow(DEDUP_WINDOW);
+
+    std::string senderNetworkId = NETWORKID_01;
+    uint8_t focused[] = {0x03, 0x00, 0x02, 0x00};
+    recvMgr->NotifyDataRecv(senderNetworkId, focused, BROADCAST_LEN);
+    EXPECT_EQ(recvMgr->lastBroadcast_.count(senderNetworkId), 1u);
+    recvMgr->NotifyDeviceOffline(senderNetworkId);
+    EXPECT_EQ(recvMgr->lastBroadcast_.count(senderNetworkId), 0u);
+
+    BroadcastRecvStat before = recvMgr->GetBroadcastRecvStat();
+    recvMgr->NotifyDataRecv(senderNetworkId, focused, BROADCAST_LEN);
+    EXPECT_EQ(recvMgr->GetBroadcastRecvStat().droppedCount, before.droppedCount);
+    recvMgr->SetBroadcastDedupWindow(DMSContinueRecvMgr::DEFAULT_BROADCAST_DEDUP_WINDOW);
+    recvMgr->ClearBroadcastRecord();
+    DTEST_LOG << "DMSContinueManagerTest testNotifyDataRecvDedup002 end" << std::endl;
+}
+
+/**
+ * @tc.name: testNotifyDataRecvCoalesce001
+ * @tc.desc: test a burst from one sender collapses to its latest state
+ * @tc.type: FUNC
+ */
+HWTEST_F(DMSContinueManagerTest, testNotifyDataRecvCoalesce001, TestSize.Level1)
+{
+    DTEST_LOG << "DMSContinueManagerTest testNotifyDataRecvCoalesce001 start" << std::endl;
+    auto recvMgr = MultiUserManager::GetInstance().GetCurrentRecvMgr();
+    ASSERT_NE(nullptr, recvMgr);
+    int32_t accountId = 100;
+    recvMgr->Init(accountId);
+    ASSERT_NE(nullptr, recvMgr->eventHandler_);
+    WifiStateAdapter::GetInstance().UpdateWifiState(true);
+    DataShareManager::GetInstance().SetCurrentContinueSwitch(true);
+    recvMgr->ClearBroadcastRecord();
+
+    std::mutex blockMutex;
+    std::condition_variable blockCon;
+    bool released = false;
+    recvMgr->eventHandler_->PostTask([&blockMutex, &blockCon, &released]() {
+        std::unique_lock<std::mutex> lock(blockMutex);
+        blockCon.wait(lock, [&released] { return released; });
+    });
+
+    std::string senderNetworkId = NETWORKID_01;
+    uint8_t first[] = {0x03, 0x00, 0x01, 0x00};
+    uint8_t second[] = {0x03, 0x00, 0x02, 0x00};
+    uint8_t third[] = {0x13, 0x00, 0x02, 0x00};
+    BroadcastRecvStat before = recvMgr->GetBroadcastRecvStat();
+    recvMgr->NotifyDataRecv(senderNetworkId, first, BROADCAST_LEN);
+    recvMgr->NotifyDataRecv(senderNetworkId, second, BROADCAST_LEN);
+    recvMgr->NotifyDataRecv(senderNetworkId, third, BROADCAST_LEN);
+    std::string otherNetworkId = NETWORKID_02;
+    recvMgr->NotifyDataRecv(otherNetworkId, first, BROADCAST_LEN);
+    BroadcastRecvStat after = recvMgr->GetBroadcastRecvStat();
+    EXPECT_EQ(after.coalescedCount - before.coalescedCount, 2u);
+    EXPECT_EQ(after.droppedCount, before.droppedCount);
+    {
+        std::lock_guard<std::mutex> lock(blockMutex);
+        released = true;
+    }
+    blockCon.notify_all();
+    recvMgr->UnInit();
+    recvMgr->ClearBroadcastRecord();
+    DTEST_LOG << "DMSContinueManagerTest testNotifyDataRecvCoalesce001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testScheduleBroadcast001
+ * @tc.desc: test broadcasts are coalesced and paced with a fake clock
+ * @tc.type: FUNC
+ */
+HWTEST_F(DMSContinueManagerTest, testScheduleBroadcast001, TestSize.Level1)
+{
+    DTEST_LOG << "DMSContinueManagerTest testScheduleBroadcast001 start" << std::endl;
+    auto sendMgr = std::make_shared<DMSContinueSendMgr>();
+    int64_t now = 0;
+    sendMgr->sendScheduler_ = std::make_shared<DmsContinueSendScheduler>(
+        [sendMgr](const ContinueBroadcastInfo& info) {
+            uint16_t bundleNameId = info.bundleNameId;
+            uint8_t continueTypeId = info.continueTypeId;
+            sendMgr->SendSoftbusEvent(bundleNameId, continueTypeId, info.sendType);
+        },
+        [&now]() { return now; });
+    sendMgr->sendScheduler_->SetConfig(COALESCE_WINDOW, MIN_INTERVAL, BURST);
+    g_softbusSendCount = 0;
+
+    sendMgr->ScheduleBroadcast({ MISSIONID_01, 1, 0, DMSContinueSendMgr::DMS_FOCUSED_TYPE });
+    sendMgr->ScheduleBroadcast({ MISSIONID_01, 1, 0, DMSContinueSendMgr::DMS_UNFOCUSED_TYPE });
+    sendMgr->ScheduleBroadcast({ MISSIONID_02, 2, 0, DMSContinueSendMgr::DMS_FOCUSED_TYPE });
+    EXPECT_EQ(g_softbusSendCount, 0);
+
+    now += COALESCE_WINDOW;
+    sendMgr->PostBroadcastFlush(0);
+    EXPECT_EQ(g_softbusSendCount, 1);
+    now += MIN_INTERVAL;
+    sendMgr->PostBroadcastFlush(0);
+    EXPECT_EQ(g_softbusSendCount, 2);
+
+    ContinueBroadcastStat stat = sendMgr->sendScheduler_->GetStat();
+    EXPECT_EQ(stat.submittedCount, 3u);
+    EXPECT_EQ(stat.coalescedCount, 1u);
+    EXPECT_EQ(stat.throttledCount, 1u);
+    std::string result;
+    sendMgr->DumpBroadcastInfo(result);
+    EXPECT_FALSE(result.empty());
+    sendMgr->sendScheduler_ = nullptr;
+    DTEST_LOG << "DMSContinueManagerTest testScheduleBroadcast001 end" << std::endl;
+}
 } // namespace DistributedSchedule
 } // namespace OHOS
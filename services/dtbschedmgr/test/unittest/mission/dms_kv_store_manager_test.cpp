@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_kv_store_manager_test.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <thread>
+
+#include "dtbschedmgr_log.h"
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS::DistributedKv;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr int64_t WAIT_STATE_MS = 3000;
+constexpr int64_t WAIT_INTERVAL_MS = 10;
+constexpr int64_t NOT_READY_RETURN_MS = 50;
+constexpr int32_t OPEN_FAILED_TIMES = 2;
+
+// opens of one store, stores of earlier cases are opened again when the service comes back
+struct OpenRecord {
+    std::atomic<int32_t> openCount { 0 };
+    std::atomic<int32_t> failedTimes { 0 };
+};
+
+// stands in for the kv data service, it can be switched on and off
+class FakeKvService {
+public:
+    DmsKvStoreManager::Opener MakeOpener(const std::shared_ptr<OpenRecord>& record)
+    {
+        return [this, record](std::shared_ptr<SingleKvStore>& kvStore) {
+            record->openCount++;
+            if (!isAvailable_) {
+                return Status::IPC_ERROR;
+            }
+            if (record->failedTimes > 0) {
+                record->failedTimes--;
+                return Status::ERROR;
+            }
+            kvStore = GetHandle();
+            return Status::SUCCESS;
+        };
+    }
+
+    // a handle the manager only passes around, it is never dereferenced
+    std::shared_ptr<SingleKvStore> GetHandle()
+    {
+        return std::shared_ptr<SingleKvStore>(holder_, reinterpret_cast<SingleKvStore*>(holder_.get()));
+    }
+
+    std::atomic<bool> isAvailable_ { false };
+
+private:
+    std::shared_ptr<int32_t> holder_ = std::make_shared<int32_t>(0);
+};
+
+FakeKvService g_kvService;
+
+bool WaitFor(const std::function<bool()>& condition)
+{
+    for (int64_t passed = 0; passed < WAIT_STATE_MS; passed += WAIT_INTERVAL_MS) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_INTERVAL_MS));
+    }
+    return condition();
+}
+
+bool WaitStoreState(const std::string& storeId, DmsKvStoreManager::StoreState state)
+{
+    return WaitFor([&storeId, state]() { return DmsKvStoreManager::GetInstance().GetStoreState(storeId) == state; });
+}
+}
+
+void DmsKvStoreManagerTest::SetUpTestCase()
+{
+    DTEST_LOG << "DmsKvStoreManagerTest::SetUpTestCase" << std::endl;
+    DmsKvStoreManager::GetInstance().serviceProbe_ = []() { return g_kvService.isAvailable_.load(); };
+}
+
+void DmsKvStoreManagerTest::TearDownTestCase()
+{
+    DTEST_LOG << "DmsKvStoreManagerTest::TearDownTestCase" << std::endl;
+    DmsKvStoreManager::GetInstance().serviceProbe_ = nullptr;
+}
+
+void DmsKvStoreManagerTest::SetUp()
+{
+    DTEST_LOG << "DmsKvStoreManagerTest::SetUp" << std::endl;
+    g_kvService.isAvailable_ = false;
+    DmsKvStoreManager::GetInstance().OnKvServiceRemoved();
+}
+
+void DmsKvStoreManagerTest::TearDown()
+{
+    DTEST_LOG << "DmsKvStoreManagerTest::TearDown" << std::endl;
+}
+
+/**
+ * @tc.name: GetKvStore_001
+ * @tc.desc: without the kv data service GetKvStore returns not ready at once
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsKvStoreManagerTest, GetKvStore_001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsKvStoreManagerTest GetKvStore_001 begin" << std::endl;
+    const std::string storeId = "GetKvStore_001";
+    auto& storeMgr = DmsKvStoreManager::GetInstance();
+    auto record = std::make_shared<OpenRecord>();
+    storeMgr.RegisterStore(storeId, g_kvService.MakeOpener(record));
+    std::shared_ptr<SingleKvStore> kvStore;
+    auto begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(storeMgr.GetKvStore(storeId, kvStore), DMS_KV_STORE_NOT_READY);
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    EXPECT_LT(elapsedMs, NOT_READY_RETURN_MS);
+    EXPECT_EQ(kvStore, nullptr);
+    EXPECT_EQ(record->openCount.load(), 0);
+    EXPECT_EQ(storeMgr.GetKvStore("unregistered", kvStore), DMS_KV_STORE_NOT_READY);
+    DTEST_LOG << "DmsKvStoreManagerTest GetKvStore_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: GetKvStore_002
+ * @tc.desc: the store opens once the kv data service is added and its listener gets the handle
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsKvStoreManagerTest, GetKvStore_002, TestSize.Level3)
+{
+    DTEST_LOG << "DmsKvStoreManagerTest GetKvStore_002 begin" << std::endl;
+    const std::string storeId = "GetKvStore_002";
+    auto& storeMgr = DmsKvStoreManager::GetInstance();
+    auto record = std::make_shared<OpenRecord>();
+    storeMgr.RegisterStore(storeId, g_kvService.MakeOpener(record));
+    std::atomic<int32_t> readyCount { 0 };
+    int32_t listenerId = storeMgr.AddStoreListener(storeId,
+        [&readyCount](const std::shared_ptr<SingleKvStore>& kvStore) {
+            if (kvStore != nullptr) {
+                readyCount++;
+            }
+        });
+    EXPECT_NE(listenerId, 0);
+
+    g_kvService.isAvailable_ = true;
+    storeMgr.OnKvServiceAdded();
+    EXPECT_TRUE(WaitStoreState(storeId, DmsKvStoreManager::StoreState::READY));
+    std::shared_ptr<SingleKvStore> kvStore;
+    EXPECT_EQ(storeMgr.GetKvStore(storeId, kvStore), ERR_OK);
+    EXPECT_EQ(kvStore, g_kvService.GetHandle());
+    // listeners run right after the state turns ready
+    EXPECT_TRUE(WaitFor([&readyCount]() { return readyCount.load() == 1; }));
+    EXPECT_EQ(record->openCount.load(), 1);
+    storeMgr.RemoveStoreListener(listenerId);
+    DTEST_LOG << "DmsKvStoreManagerTest GetKvStore_002 end" << std::endl;
+}
+
+/**
+ * @tc.name: GetKvStore_003
+ * @tc.desc: the handle is dropped when the kv data service goes away and reopened when it is back
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsKvStoreManagerTest, GetKvStore_003, TestSize.Level3)
+{
+    DTEST_LOG << "DmsKvStoreManagerTest GetKvStore_003 begin" << std::endl;
+    const std::string storeId = "GetKvStore_003";
+    auto& storeMgr = DmsKvStoreManager::GetInstance();
+    g_kvService.isAvailable_ = true;
+    storeMgr.OnKvServiceAdded();
+    auto record = std::make_shared<OpenRecord>();
+    storeMgr.RegisterStore(storeId, g_kvService.MakeOpener(record));
+    EXPECT_TRUE(WaitStoreState(storeId, DmsKvStoreManager::StoreState::READY));
+
+    std::atomic<int32_t> releaseCount { 0 };
+    int32_t listenerId = storeMgr.AddStoreListener(storeId,
+        [&releaseCount](const std::shared_ptr<SingleKvStore>& kvStore) {
+            if (kvStore == nullptr) {
+                releaseCount++;
+            }
+        });
+    g_kvService.isAvailable_ = false;
+    storeMgr.OnKvServiceRemoved();
+    EXPECT_EQ(releaseCount.load(), 1);
+    std::shared_ptr<SingleKvStore> kvStore;
+    EXPECT_EQ(storeMgr.GetKvStore(storeId, kvStore), DMS_KV_STORE_NOT_READY);
+
+    g_kvService.isAvailable_ = true;
+    storeMgr.OnKvServiceAdded();
+    EXPECT_TRUE(WaitStoreState(storeId, DmsKvStoreManager::StoreState::READY));
+    EXPECT_EQ(storeMgr.GetKvStore(storeId, kvStore), ERR_OK);
+    EXPECT_NE(kvStore, nullptr);
+    storeMgr.RemoveStoreListener(listenerId);
+    DTEST_LOG << "DmsKvStoreManagerTest GetKvStore_003 end" << std::endl;
+}
+
+/**
+ * @tc.name: GetKvStore_004
+ * @tc.desc: a failed open is retried in the background, a reset store is opened again on demand
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsKvStoreManagerTest, GetKvStore_004, TestSize.Level3)
+{
+    DTEST_LOG << "DmsKvStoreManagerTest GetKvStore_004 begin" << std::endl;
+    const std::string storeId = "GetKvStore_004";
+    auto& storeMgr = DmsKvStoreManager::GetInstance();
+    g_kvService.isAvailable_ = true;
+    storeMgr.OnKvServiceAdded();
+    auto record = std::make_shared<OpenRecord>();
+    record->failedTimes = OPEN_FAILED_TIMES;
+    storeMgr.RegisterStore(storeId, g_kvService.MakeOpener(record));
+    EXPECT_TRUE(WaitStoreState(storeId, DmsKvStoreManager::StoreState::READY));
+    EXPECT_EQ(record->openCount.load(), OPEN_FAILED_TIMES + 1);
+
+    storeMgr.ResetStore(storeId);
+    std::shared_ptr<SingleKvStore> kvStore;
+    EXPECT_EQ(storeMgr.GetKvStore(storeId, kvStore), DMS_KV_STORE_NOT_READY);
+    EXPECT_TRUE(WaitStoreState(storeId, DmsKvStoreManager::StoreState::READY));
+    EXPECT_EQ(storeMgr.GetKvStore(storeId, kvStore), ERR_OK);
+    EXPECT_EQ(record->openCount.load(), OPEN_FAILED_TIMES + 2);
+    DTEST_LOG << "DmsKvStoreManagerTest GetKvStore_004 end" << std::endl;
+}
+
+/**
+ * @tc.name: StoreListener_001
+ * @tc.desc: a slow listener does not block adding or removing others, removing it waits until it returns
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsKvStoreManagerTest, StoreListener_001, TestSize.Level3)
+{
+    DTEST_LOG << "DmsKvStoreManagerTest StoreListener_001 begin" << std::endl;
+    const std::string storeId = "StoreListener_001";
+    auto& storeMgr = DmsKvStoreManager::GetInstance();
+    g_kvService.isAvailable_ = true;
+    storeMgr.OnKvServiceAdded();
+    storeMgr.RegisterStore(storeId, g_kvService.MakeOpener(std::make_shared<OpenRecord>()));
+    EXPECT_TRUE(WaitStoreState(storeId, DmsKvStoreManager::StoreState::READY));
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> isRunning { false };
+    std::atomic<bool> isReturned { false };
+    int32_t slowId = storeMgr.AddStoreListener(storeId,
+        [released, &isRunning, &isReturned](const std::shared_ptr<SingleKvStore>& kvStore) {
+            isRunning = true;
+            released.wait();
+            isReturned = true;
+        });
+    ASSERT_TRUE(WaitFor([&isRunning]() { return isRunning.load(); }));
+
+    int32_t otherId = storeMgr.AddStoreListener(storeId, [](const std::shared_ptr<SingleKvStore>& kvStore) {});
+    EXPECT_NE(otherId, 0);
+    storeMgr.RemoveStoreListener(otherId);
+
+    std::atomic<bool> isRemoved { false };
+    std::thread remover([&storeMgr, slowId, &isRemoved]() {
+        storeMgr.RemoveStoreListener(slowId);
+        isRemoved = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(NOT_READY_RETURN_MS));
+    EXPECT_FALSE(isRemoved.load());
+    release.set_value();
+    remover.join();
+    EXPECT_TRUE(isReturned.load());
+    DTEST_LOG << "DmsKvStoreManagerTest StoreListener_001 end" << std::endl;
+}
+}
+}
@@ -657,7 +657,7 @@ HWTEST_F(DMSMissionManagerTest, testRegisterMissionListener004, TestSize.Level3)
 {
     DTEST_LOG << "testRegisterMissionListener004 begin" << std::endl;
     sptr<IRemoteObject> listener(new RemoteMissionListenerTest());
-    DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_["1234567"] = DEVICE_ID;
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ DEVICE_ID, "1234567", "" });
     auto ret = DistributedSchedMissionManager::GetInstance().RegisterMissionListener(U16DEVICE_ID, listener);
     EXPECT_EQ(ret, ERR_NONE);
     DTEST_LOG << "testRegisterMissionListener004 end" << std::endl;
@@ -1501,10 +1501,7 @@ HWTEST_F(DMSMissionManagerTest, testDeleteDataStorage005, TestSize.Level3)
 {
     DTEST_LOG << "testDeleteDataStorage005 begin" << std::endl;
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = localDeviceId_;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
     DistributedSchedMissionManager::GetInstance().distributedDataStorage_ =
         std::make_shared<DistributedDataStorage>();
     auto result = DistributedSchedMissionManager::GetInstance().distributedDataStorage_->Init();
@@ -1547,10 +1544,7 @@ HWTEST_F(DMSMissionManagerTest, testDeleteDataStorage006, TestSize.Level3)
 {
     DTEST_LOG << "testDeleteDataStorage006 begin" << std::endl;
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = localDeviceId_;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
     DistributedSchedMissionManager::GetInstance().distributedDataStorage_ =
         std::make_shared<DistributedDataStorage>();
     auto result = DistributedSchedMissionManager::GetInstance().distributedDataStorage_->Init();
@@ -1596,10 +1590,7 @@ HWTEST_F(DMSMissionManagerTest, testRegisterMissionListener009, TestSize.Level3)
     DistributedSchedMissionManager::GetInstance().missionHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
     u16string deviceId = Str8ToStr16(localDeviceId_);
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = localDeviceId_;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
     sptr<IRemoteObject> listener(new RemoteMissionListenerTest());
     auto ret = DistributedSchedMissionManager::GetInstance().RegisterMissionListener(deviceId, listener);
     EXPECT_EQ(ret, INVALID_PARAMETERS_ERR);
@@ -1618,10 +1609,7 @@ HWTEST_F(DMSMissionManagerTest, testRegisterMissionListener010, TestSize.Level3)
     DistributedSchedMissionManager::GetInstance().missionHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
     u16string deviceId = Str8ToStr16(DEVICE_ID);
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = DEVICE_ID;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ DEVICE_ID, uuid, "" });
     sptr<IRemoteObject> listener(new RemoteMissionListenerTest());
     {
         std::lock_guard<std::mutex> autoLock(DistributedSchedMissionManager::GetInstance().listenDeviceLock_);
@@ -1846,10 +1834,7 @@ HWTEST_F(DMSMissionManagerTest, testStoreSnapshotInfo003, TestSize.Level3)
     EXPECT_TRUE(result);
     isCaseDone_ = false;
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = localDeviceId_;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
     uint8_t* byteStream = new uint8_t[BYTESTREAM_LENGTH];
     for (size_t i = 0; i < BYTESTREAM_LENGTH; ++i) {
         byteStream[i] = ONE_BYTE;
@@ -1889,10 +1874,7 @@ HWTEST_F(DMSMissionManagerTest, testGetRemoteMissionSnapshotInfo002, TestSize.Le
     unique_ptr<AAFwk::MissionSnapshot> missionSnapshot = nullptr;
     DistributedSchedMissionManager::GetInstance().distributedDataStorage_ = nullptr;
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = localDeviceId_;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
     auto ret = DistributedSchedMissionManager::GetInstance().GetRemoteMissionSnapshotInfo(localDeviceId_,
         0, missionSnapshot);
     EXPECT_EQ(ret, ERR_NULL_OBJECT);
@@ -1909,10 +1891,7 @@ HWTEST_F(DMSMissionManagerTest, testGetRemoteMissionSnapshotInfo004, TestSize.Le
     DTEST_LOG << "testGetRemoteMissionSnapshotInfo004 begin" << std::endl;
     unique_ptr<AAFwk::MissionSnapshot> missionSnapshot = nullptr;
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = localDeviceId_;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
     DistributedSchedMissionManager::GetInstance().distributedDataStorage_ =
         std::make_shared<DistributedDataStorage>();
     auto ret = DistributedSchedMissionManager::GetInstance().GetRemoteMissionSnapshotInfo(localDeviceId_,
@@ -1931,10 +1910,7 @@ HWTEST_F(DMSMissionManagerTest, testGetRemoteMissionSnapshotInfo005, TestSize.Le
     DTEST_LOG << "testGetRemoteMissionSnapshotInfo005 begin" << std::endl;
     unique_ptr<AAFwk::MissionSnapshot> missionSnapshot = nullptr;
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = localDeviceId_;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
     DistributedSchedMissionManager::GetInstance().distributedDataStorage_ =
         std::make_shared<DistributedDataStorage>();
     auto result = DistributedSchedMissionManager::GetInstance().distributedDataStorage_->Init();
@@ -1969,6 +1945,41 @@ HWTEST_F(DMSMissionManagerTest, testGetRemoteMissionSnapshotInfo005, TestSize.Le
     DTEST_LOG << "testGetRemoteMissionSnapshotInfo005 end" << std::endl;
 }
 
+/**
+ * @tc.name: testGetRemoteMissionSnapshotInfos001
+ * @tc.desc: test get remote mission snapshot infos serves the cached missions and reports the missed ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(DMSMissionManagerTest, testGetRemoteMissionSnapshotInfos001, TestSize.Level3)
+{
+    DTEST_LOG << "testGetRemoteMissionSnapshotInfos001 begin" << std::endl;
+    std::string uuid = "uuid for GetUuidByNetworkId";
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
+    DistributedSchedMissionManager::GetInstance().distributedDataStorage_ = nullptr;
+    std::map<int32_t, std::unique_ptr<AAFwk::MissionSnapshot>> missionSnapshots;
+    auto ret = DistributedSchedMissionManager::GetInstance().GetRemoteMissionSnapshotInfos(localDeviceId_,
+        { TASK_ID, TASK_ID + 1 }, missionSnapshots);
+    EXPECT_EQ(ret, ERR_NULL_OBJECT);
+    EXPECT_TRUE(missionSnapshots.empty());
+
+    DistributedSchedMissionManager::GetInstance().EnqueueCachedSnapshotInfo(uuid, TASK_ID,
+        std::make_unique<Snapshot>());
+    ret = DistributedSchedMissionManager::GetInstance().GetRemoteMissionSnapshotInfos(localDeviceId_,
+        { TASK_ID, TASK_ID + 1, TASK_ID }, missionSnapshots);
+    EXPECT_EQ(ret, ERR_NONE);
+    ASSERT_EQ(missionSnapshots.size(), 1u);
+    EXPECT_NE(missionSnapshots[TASK_ID], nullptr);
+
+    unique_ptr<AAFwk::MissionSnapshot> missionSnapshot = nullptr;
+    DistributedSchedMissionManager::GetInstance().EnqueueCachedSnapshotInfo(uuid, TASK_ID,
+        std::make_unique<Snapshot>());
+    ret = DistributedSchedMissionManager::GetInstance().GetRemoteMissionSnapshotInfo(localDeviceId_,
+        TASK_ID, missionSnapshot);
+    EXPECT_EQ(ret, ERR_NONE);
+    EXPECT_NE(missionSnapshot, nullptr);
+    DTEST_LOG << "testGetRemoteMissionSnapshotInfos001 end" << std::endl;
+}
+
 /**
  * @tc.name: testDeviceOfflineNotify003
  * @tc.desc: test device offline notify
@@ -2386,14 +2397,8 @@ HWTEST_F(DMSMissionManagerTest, testNeedSyncDevice003, TestSize.Level3)
     }
     DistributedSchedMissionManager::GetInstance().NotifySnapshotChanged(DEVICE_ID, 0);
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_.clear();
-    }
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = DEVICE_ID;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ DEVICE_ID, uuid, "" });
     std::unique_ptr<Snapshot> snapshot = make_unique<Snapshot>();
     std::string key = DistributedSchedMissionManager::GetInstance().GenerateKeyInfo(DEVICE_ID, 1);
     {
@@ -2433,14 +2438,8 @@ HWTEST_F(DMSMissionManagerTest, testHasSyncListener002, TestSize.Level3)
      */
     DTEST_LOG << "testRebornMissionCache003 begin" << std::endl;
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_.clear();
-    }
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = DEVICE_ID;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ DEVICE_ID, uuid, "" });
     std::vector<DstbMissionInfo> missionInfos;
     DistributedSchedMissionManager::GetInstance().RebornMissionCache(DEVICE_ID, missionInfos);
     DTEST_LOG << "testRebornMissionCache003 end" << std::endl;
@@ -2508,14 +2507,8 @@ HWTEST_F(DMSMissionManagerTest, testFetchCachedRemoteMissions010, TestSize.Level
 {
     DTEST_LOG << "testFetchCachedRemoteMissions010 begin" << std::endl;
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_.clear();
-    }
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = DEVICE_ID;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ DEVICE_ID, uuid, "" });
     {
         std::lock_guard<std::mutex> autoLock(DistributedSchedMissionManager::GetInstance().remoteMissionInfosLock_);
         DistributedSchedMissionManager::GetInstance().deviceMissionInfos_.clear();
@@ -2610,14 +2603,8 @@ HWTEST_F(DMSMissionManagerTest, testNotifyMissionsChangedToRemote003, TestSize.L
         DtbschedmgrDeviceInfoStorage::GetInstance().remoteDevices_[localDeviceId_] = dmsDeviceInfo;
     }
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_.clear();
-    }
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = localDeviceId_;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ localDeviceId_, uuid, "" });
     std::vector<DstbMissionInfo> missionInfos;
     auto ret = DistributedSchedMissionManager::GetInstance().NotifyMissionsChangedToRemote(missionInfos);
     EXPECT_EQ(ret, ERR_NONE);
@@ -2670,14 +2657,8 @@ HWTEST_F(DMSMissionManagerTest, testFetchDeviceHandler004, TestSize.Level3)
     }
 
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_.clear();
-    }
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = DEVICE_ID;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ DEVICE_ID, uuid, "" });
     auto ret = DistributedSchedMissionManager::GetInstance().FetchDeviceHandler(DEVICE_ID);
     EXPECT_NE(ret, nullptr);
     DTEST_LOG << "testFetchDeviceHandler004 end" << std::endl;
@@ -2706,14 +2687,8 @@ HWTEST_F(DMSMissionManagerTest, testFetchDeviceHandler005, TestSize.Level3)
     }
 
     std::string uuid = "uuid for GetUuidByNetworkId";
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_.clear();
-    }
-    {
-        lock_guard<mutex> autoLock(DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdLock_);
-        DtbschedmgrDeviceInfoStorage::GetInstance().uuidNetworkIdMap_[uuid] = DEVICE_ID;
-    }
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Clear();
+    DtbschedmgrDeviceInfoStorage::GetInstance().identityTable_.Update({ DEVICE_ID, uuid, "" });
     auto anonyUuid = GetAnonymStr(uuid);
     auto runner = AppExecFwk::EventRunner::Create(anonyUuid + "_MissionN");
     auto handler = std::make_shared<AppExecFwk::EventHandler>(runner);
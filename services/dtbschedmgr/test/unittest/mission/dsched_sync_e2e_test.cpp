@@ -18,6 +18,7 @@
 #include <thread>
 #include "distributed_sched_test_util.h"
 #include "dtbschedmgr_device_info_storage.h"
+#include "mission/dms_kv_store_manager.h"
 #include "test_log.h"
 
 namespace OHOS {
@@ -33,6 +34,7 @@ constexpr int32_t TASK_ID_1 = 11;
 constexpr int32_t TASK_ID_2 = 12;
 constexpr size_t BYTESTREAM_LENGTH = 100;
 constexpr uint8_t ONE_BYTE = '6';
+constexpr int32_t WAIT_STORE_READY_TIMES = 300;
 }
 
 void DmsKvSyncE2ETest::SetUpTestCase()
@@ -366,8 +368,15 @@ HWTEST_F(DmsKvSyncE2ETest, CheckKvStoreTest_001, TestSize.Level1)
     EXPECT_NE(dmsKvSyncE2E, nullptr);
     if (dmsKvSyncE2E != nullptr) {
         dmsKvSyncE2E_->GetInstance()->kvStorePtr_ = nullptr;
+        // the store opens in the background, CheckKvStore does not wait for it
+        const std::string storeId = dmsKvSyncE2E_->GetInstance()->storeId_.storeId;
+        for (int32_t i = 0; i < WAIT_STORE_READY_TIMES && DmsKvStoreManager::GetInstance().GetStoreState(storeId) !=
+            DmsKvStoreManager::StoreState::READY; i++) {
+            this_thread::sleep_for(10ms);
+        }
         bool ret = dmsKvSyncE2E_->GetInstance()->CheckKvStore();
         EXPECT_EQ(ret, true);
+        EXPECT_NE(dmsKvSyncE2E_->GetInstance()->kvStorePtr_, nullptr);
     }
     DTEST_LOG << "DmsKvSyncE2ETest CheckKvStoreTest_001 end" << std::endl;
 }
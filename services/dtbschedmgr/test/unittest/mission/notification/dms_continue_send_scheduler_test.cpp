@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dms_continue_send_scheduler_test.h"
+
+#include "test_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr int64_t COALESCE_WINDOW = 100;
+constexpr int64_t MIN_INTERVAL = 200;
+constexpr uint32_t BURST = 2;
+constexpr int32_t MISSION_ID_01 = 1;
+constexpr int32_t MISSION_ID_02 = 2;
+constexpr uint8_t FOCUSED = 0;
+constexpr uint8_t UNFOCUSED = 1;
+}
+
+void DmsContinueSendSchedulerTest::SetUpTestCase()
+{
+}
+
+void DmsContinueSendSchedulerTest::TearDownTestCase()
+{
+}
+
+void DmsContinueSendSchedulerTest::SetUp()
+{
+    now_ = 0;
+    sent_.clear();
+    scheduler_ = std::make_shared<DmsContinueSendScheduler>(
+        [this](const ContinueBroadcastInfo& info) { sent_.push_back(info); },
+        [this]() { return now_; });
+    scheduler_->SetConfig(COALESCE_WINDOW, MIN_INTERVAL, BURST);
+}
+
+void DmsContinueSendSchedulerTest::TearDown()
+{
+    scheduler_ = nullptr;
+}
+
+/**
+ * @tc.name: testSubmit001
+ * @tc.desc: a single transition is sent once the coalesce window has passed
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsContinueSendSchedulerTest, testSubmit001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsContinueSendSchedulerTest testSubmit001 start" << std::endl;
+    int64_t delay = scheduler_->Submit({ MISSION_ID_01, 1, 0, FOCUSED });
+    EXPECT_EQ(delay, COALESCE_WINDOW);
+    now_ += COALESCE_WINDOW - 1;
+    EXPECT_EQ(scheduler_->Flush(), 1);
+    EXPECT_TRUE(sent_.empty());
+    now_ += 1;
+    EXPECT_EQ(scheduler_->Flush(), DmsContinueSendScheduler::NO_FLUSH);
+    ASSERT_EQ(sent_.size(), 1u);
+    EXPECT_EQ(sent_[0].sendType, FOCUSED);
+    DTEST_LOG << "DmsContinueSendSchedulerTest testSubmit001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testCoalesce001
+ * @tc.desc: transitions of one mission inside the window collapse to the final state
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsContinueSendSchedulerTest, testCoalesce001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsContinueSendSchedulerTest testCoalesce001 start" << std::endl;
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, FOCUSED });
+    now_ += 10;
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, UNFOCUSED });
+    now_ += 10;
+    scheduler_->Submit({ MISSION_ID_02, 2, 0, FOCUSED });
+    now_ += COALESCE_WINDOW;
+    scheduler_->Flush();
+    ASSERT_EQ(sent_.size(), 2u);
+    EXPECT_EQ(sent_[0].missionId, MISSION_ID_01);
+    EXPECT_EQ(sent_[0].sendType, UNFOCUSED);
+    EXPECT_EQ(sent_[1].missionId, MISSION_ID_02);
+    EXPECT_EQ(scheduler_->GetStat().coalescedCount, 1u);
+    DTEST_LOG << "DmsContinueSendSchedulerTest testCoalesce001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testCoalesce002
+ * @tc.desc: a burst that returns to the last sent state is not broadcast again
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsContinueSendSchedulerTest, testCoalesce002, TestSize.Level1)
+{
+    DTEST_LOG << "DmsContinueSendSchedulerTest testCoalesce002 start" << std::endl;
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, FOCUSED });
+    now_ += COALESCE_WINDOW;
+    scheduler_->Flush();
+    ASSERT_EQ(sent_.size(), 1u);
+
+    now_ += MIN_INTERVAL;
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, UNFOCUSED });
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, FOCUSED });
+    now_ += COALESCE_WINDOW;
+    EXPECT_EQ(scheduler_->Flush(), DmsContinueSendScheduler::NO_FLUSH);
+    EXPECT_EQ(sent_.size(), 1u);
+    EXPECT_EQ(scheduler_->GetStat().unchangedCount, 1u);
+
+    now_ += MIN_INTERVAL;
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, FOCUSED });
+    now_ += COALESCE_WINDOW;
+    scheduler_->Flush();
+    EXPECT_EQ(sent_.size(), 2u);
+    DTEST_LOG << "DmsContinueSendSchedulerTest testCoalesce002 end" << std::endl;
+}
+
+/**
+ * @tc.name: testCoalesce003
+ * @tc.desc: a burst returning to a state that another mission has since replaced is broadcast again
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsContinueSendSchedulerTest, testCoalesce003, TestSize.Level1)
+{
+    DTEST_LOG << "DmsContinueSendSchedulerTest testCoalesce003 start" << std::endl;
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, FOCUSED });
+    now_ += COALESCE_WINDOW;
+    scheduler_->Flush();
+    now_ += MIN_INTERVAL;
+    scheduler_->Submit({ MISSION_ID_02, 2, 0, FOCUSED });
+    now_ += COALESCE_WINDOW;
+    scheduler_->Flush();
+    ASSERT_EQ(sent_.size(), 2u);
+
+    now_ += MIN_INTERVAL;
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, UNFOCUSED });
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, FOCUSED });
+    now_ += COALESCE_WINDOW;
+    scheduler_->Flush();
+    ASSERT_EQ(sent_.size(), 3u);
+    EXPECT_EQ(sent_[2].missionId, MISSION_ID_01);
+    EXPECT_EQ(scheduler_->GetStat().unchangedCount, 0u);
+    DTEST_LOG << "DmsContinueSendSchedulerTest testCoalesce003 end" << std::endl;
+}
+
+/**
+ * @tc.name: testThrottle001
+ * @tc.desc: token bucket limits the broadcast rate and keeps submit order
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsContinueSendSchedulerTest, testThrottle001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsContinueSendSchedulerTest testThrottle001 start" << std::endl;
+    constexpr int32_t missionCount = 4;
+    for (int32_t i = 0; i < missionCount; i++) {
+        scheduler_->Submit({ i, static_cast<uint16_t>(i), 0, FOCUSED });
+    }
+    now_ += COALESCE_WINDOW;
+    int64_t delay = scheduler_->Flush();
+    ASSERT_EQ(sent_.size(), BURST);
+    EXPECT_EQ(delay, MIN_INTERVAL - COALESCE_WINDOW);
+    EXPECT_EQ(scheduler_->GetStat().throttledCount, 1u);
+
+    now_ += delay;
+    delay = scheduler_->Flush();
+    ASSERT_EQ(sent_.size(), BURST + 1);
+    EXPECT_EQ(delay, MIN_INTERVAL);
+    now_ += delay;
+    EXPECT_EQ(scheduler_->Flush(), DmsContinueSendScheduler::NO_FLUSH);
+    ASSERT_EQ(sent_.size(), static_cast<size_t>(missionCount));
+    for (int32_t i = 0; i < missionCount; i++) {
+        EXPECT_EQ(sent_[i].missionId, i);
+    }
+    DTEST_LOG << "DmsContinueSendSchedulerTest testThrottle001 end" << std::endl;
+}
+
+/**
+ * @tc.name: testReset001
+ * @tc.desc: reset drops pending broadcasts and refills the bucket
+ * @tc.type: FUNC
+ */
+HWTEST_F(DmsContinueSendSchedulerTest, testReset001, TestSize.Level1)
+{
+    DTEST_LOG << "DmsContinueSendSchedulerTest testReset001 start" << std::endl;
+    scheduler_->Submit({ MISSION_ID_01, 1, 0, FOCUSED });
+    scheduler_->Reset();
+    now_ += COALESCE_WINDOW;
+    EXPECT_EQ(scheduler_->Flush(), DmsContinueSendScheduler::NO_FLUSH);
+    EXPECT_TRUE(sent_.empty());
+    std::string result;
+    scheduler_->Dump(result);
+    EXPECT_NE(result.find("submitted: 1"), std::string::npos);
+    DTEST_LOG << "DmsContinueSendSchedulerTest testReset001 end" << std::endl;
+}
+}
+}
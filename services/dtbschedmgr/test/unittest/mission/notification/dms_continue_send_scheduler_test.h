@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DMS_CONTINUE_SEND_SCHEDULER_TEST_H
+#define DMS_CONTINUE_SEND_SCHEDULER_TEST_H
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "mission/notification/dms_continue_send_scheduler.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+class DmsContinueSendSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    int64_t now_ = 0;
+    std::vector<ContinueBroadcastInfo> sent_;
+    std::shared_ptr<DmsContinueSendScheduler> scheduler_;
+};
+}
+}
+#endif /* DMS_CONTINUE_SEND_SCHEDULER_TEST_H */
@@ -34,13 +34,30 @@ int32_t DSchedTransportSoftbusAdapter::InitChannel()
     return IDSchedTransportSoftbusAdapter::adapterMock->InitChannel();
 }
 
-int32_t DSchedTransportSoftbusAdapter::ConnectDevice(const std::string &peerDeviceId,
-    int32_t &sessionId, DSchedServiceType type)
+int32_t DSchedTransportSoftbusAdapter::ConnectDeviceAsync(const std::string &peerDeviceId,
+    DSchedServiceType type, const ConnectCallback &callback)
 {
     if (IDSchedTransportSoftbusAdapter::adapterMock == nullptr) {
+        callback(0, 0);
         return 0;
     }
-    return IDSchedTransportSoftbusAdapter::adapterMock->ConnectDevice(peerDeviceId, sessionId, type);
+    return IDSchedTransportSoftbusAdapter::adapterMock->ConnectDeviceAsync(peerDeviceId, type, callback);
+}
+
+void DSchedTransportSoftbusAdapter::DisconnectDevice(const std::string &peerDeviceId)
+{
+    if (IDSchedTransportSoftbusAdapter::adapterMock == nullptr) {
+        return;
+    }
+    return IDSchedTransportSoftbusAdapter::adapterMock->DisconnectDevice(peerDeviceId);
+}
+
+void DSchedTransportSoftbusAdapter::DisconnectSession(int32_t sessionId)
+{
+    if (IDSchedTransportSoftbusAdapter::adapterMock == nullptr) {
+        return;
+    }
+    return IDSchedTransportSoftbusAdapter::adapterMock->DisconnectSession(sessionId);
 }
 
 int32_t DSchedTransportSoftbusAdapter::ReleaseChannel()
@@ -25,8 +25,10 @@ class IDSchedTransportSoftbusAdapter {
 public:
     virtual ~IDSchedTransportSoftbusAdapter() = default;
     virtual int32_t InitChannel() = 0;
-    virtual int32_t ConnectDevice(const std::string &peerDeviceId, int32_t &sessionId, DSchedServiceType type) = 0;
+    virtual int32_t ConnectDeviceAsync(const std::string &peerDeviceId, DSchedServiceType type,
+        const DSchedTransportSoftbusAdapter::ConnectCallback &callback) = 0;
     virtual void DisconnectDevice(const std::string &peerDeviceId) = 0;
+    virtual void DisconnectSession(int32_t sessionId) = 0;
     virtual int32_t ReleaseChannel() = 0;
     virtual int32_t SendData(int32_t sessionId, int32_t dataType, std::shared_ptr<DSchedDataBuffer> dataBuffer) = 0;
     virtual int32_t SendBytesBySoftbus(int32_t sessionId, std::shared_ptr<DSchedDataBuffer> dataBuffer) = 0;
@@ -46,8 +48,10 @@ public:
 class DSchedTransportSoftbusAdapterMock : public IDSchedTransportSoftbusAdapter {
 public:
     MOCK_METHOD0(InitChannel, int32_t());
-    MOCK_METHOD3(ConnectDevice, int32_t(const std::string &peerDeviceId, int32_t &sessionId, DSchedServiceType type));
+    MOCK_METHOD3(ConnectDeviceAsync, int32_t(const std::string &peerDeviceId, DSchedServiceType type,
+        const DSchedTransportSoftbusAdapter::ConnectCallback &callback));
     MOCK_METHOD1(DisconnectDevice, void(const std::string &peerDeviceId));
+    MOCK_METHOD1(DisconnectSession, void(int32_t sessionId));
     MOCK_METHOD0(ReleaseChannel, int32_t());
     MOCK_METHOD3(SendData, int32_t(int32_t sessionId, int32_t dataType, std::shared_ptr<DSchedDataBuffer> dataBuffer));
     MOCK_METHOD2(SendBytesBySoftbus, int32_t(int32_t sessionId, std::shared_ptr<DSchedDataBuffer> dataBuffer));
@@ -13,6 +13,10 @@
  * limitations under the License.
  */
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "softbus_adapter/allconnectmgr/dsched_all_connect_manager.h"
@@ -24,6 +28,35 @@ using namespace testing::ext;
 
 namespace OHOS {
 namespace DistributedSchedule {
+namespace {
+struct FakeApplyCall {
+    std::string peerNetworkId;
+    int32_t (*applyResult)(int32_t errorcode, int32_t result, const char *reason) = nullptr;
+};
+std::vector<FakeApplyCall> g_applyCalls;
+bool g_applyPassInline = false;
+
+int32_t FakeApplyAdvancedResource(const char *peerNetworkId, const char *serviceName,
+    ServiceCollaborationManager_ResourceRequestInfoSets *resourceRequest,
+    ServiceCollaborationManager_Callback *callback)
+{
+    g_applyCalls.push_back({ peerNetworkId, callback->ApplyResult });
+    if (g_applyPassInline) {
+        callback->ApplyResult(ERR_OK, ServiceCollaborationManagerResultCode::PASS, "");
+    }
+    return ERR_OK;
+}
+
+void ResetFakeApply()
+{
+    g_applyCalls.clear();
+    g_applyPassInline = false;
+    DSchedAllConnectManager::GetInstance().allConnectMgrApi_.
+        ServiceCollaborationManager_ApplyAdvancedResource = &FakeApplyAdvancedResource;
+    DSchedAllConnectManager::GetInstance().peerConnectDecision_.clear();
+}
+}
+
 class DSchedAllConnectManagerTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -80,7 +113,7 @@ HWTEST_F(DSchedAllConnectManagerTest, UnregistLifecycleCallback001, TestSize.Lev
 
 /**
  * @tc.name: ApplyAdvanceResource001
- * @tc.desc: call ApplyAdvanceResource
+ * @tc.desc: call ApplyAdvanceResourceAsync without the arbiter, answered at once
  * @tc.type: FUNC
  */
 HWTEST_F(DSchedAllConnectManagerTest, ApplyAdvanceResource001, TestSize.Level3)
@@ -90,29 +123,118 @@ HWTEST_F(DSchedAllConnectManagerTest, ApplyAdvanceResource001, TestSize.Level3)
     ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets;
     DSchedAllConnectManager::GetInstance().allConnectMgrApi_.
         ServiceCollaborationManager_ApplyAdvancedResource = nullptr;
-    int32_t ret = DSchedAllConnectManager::GetInstance().ApplyAdvanceResource(peerNetworkId, reqInfoSets);
+    int32_t result = -1;
+    int32_t ret = DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync(peerNetworkId, reqInfoSets,
+        [&result](int32_t applyResult) { result = applyResult; });
     EXPECT_EQ(ret, ERR_OK);
+    EXPECT_EQ(result, ERR_OK);
     DTEST_LOG << "DSchedAllConnectManagerTest ApplyAdvanceResource001 end" << std::endl;
 }
 
 /**
- * @tc.name: WaitAllConnectApplyCb001
- * @tc.desc: call WaitAllConnectApplyCb
+ * @tc.name: ApplyAdvanceResourceAsync001
+ * @tc.desc: call ApplyAdvanceResourceAsync, the arbiter answers two peers out of order
  * @tc.type: FUNC
  */
-HWTEST_F(DSchedAllConnectManagerTest, WaitAllConnectApplyCb001, TestSize.Level3)
+HWTEST_F(DSchedAllConnectManagerTest, ApplyAdvanceResourceAsync001, TestSize.Level3)
 {
-    DTEST_LOG << "DSchedAllConnectManagerTest WaitAllConnectApplyCb001 start" << std::endl;
-    std::string peerNetworkId = "peerNetworkId1";
-    DSchedAllConnectManager::GetInstance().peerConnectDecision_.clear();
-    DSchedAllConnectManager::GetInstance().peerConnectDecision_["peerNetworkId"] = true;
-    int32_t ret = DSchedAllConnectManager::GetInstance().WaitAllConnectApplyCb(peerNetworkId);
-    EXPECT_EQ(ret, DMS_CONNECT_APPLY_TIMEOUT_FAILED);
-
-    peerNetworkId = "peerNetworkId";
-    ret = DSchedAllConnectManager::GetInstance().WaitAllConnectApplyCb(peerNetworkId);
+    DTEST_LOG << "DSchedAllConnectManagerTest ApplyAdvanceResourceAsync001 start" << std::endl;
+    ResetFakeApply();
+    ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets;
+    DSchedAllConnectManager::GetInstance().GetResourceRequest(reqInfoSets);
+    std::map<std::string, int32_t> results;
+    int32_t ret = DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerA", reqInfoSets,
+        [&results](int32_t result) { results["peerA"] = result; });
+    EXPECT_EQ(ret, ERR_OK);
+    ret = DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerB", reqInfoSets,
+        [&results](int32_t result) { results["peerB"] = result; });
     EXPECT_EQ(ret, ERR_OK);
-    DTEST_LOG << "DSchedAllConnectManagerTest WaitAllConnectApplyCb001 end" << std::endl;
+    ASSERT_EQ(g_applyCalls.size(), 2);
+    EXPECT_NE(g_applyCalls[0].applyResult, g_applyCalls[1].applyResult);
+    EXPECT_TRUE(results.empty());
+
+    g_applyCalls[1].applyResult(ERR_OK, ServiceCollaborationManagerResultCode::REJECT, "busy");
+    EXPECT_EQ(results.count("peerA"), 0);
+    EXPECT_EQ(results["peerB"], DMS_CONNECT_APPLY_REJECT_FAILED);
+    g_applyCalls[0].applyResult(ERR_OK, ServiceCollaborationManagerResultCode::PASS, "");
+    EXPECT_EQ(results["peerA"], ERR_OK);
+
+    g_applyCalls[0].applyResult(ERR_OK, ServiceCollaborationManagerResultCode::REJECT, "late");
+    EXPECT_EQ(results["peerA"], ERR_OK);
+    DTEST_LOG << "DSchedAllConnectManagerTest ApplyAdvanceResourceAsync001 end" << std::endl;
+}
+
+/**
+ * @tc.name: ApplyAdvanceResourceAsync002
+ * @tc.desc: call ApplyAdvanceResourceAsync, joins the in flight request and reuses a fresh decision
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedAllConnectManagerTest, ApplyAdvanceResourceAsync002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedAllConnectManagerTest ApplyAdvanceResourceAsync002 start" << std::endl;
+    ResetFakeApply();
+    ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets;
+    DSchedAllConnectManager::GetInstance().GetResourceRequest(reqInfoSets);
+    std::vector<int32_t> results;
+    auto callback = [&results](int32_t result) { results.push_back(result); };
+    EXPECT_EQ(DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerA", reqInfoSets, callback),
+        ERR_OK);
+    EXPECT_EQ(DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerA", reqInfoSets, callback),
+        ERR_OK);
+    ASSERT_EQ(g_applyCalls.size(), 1);
+    g_applyCalls[0].applyResult(ERR_OK, ServiceCollaborationManagerResultCode::PASS, "");
+    EXPECT_EQ(results, std::vector<int32_t>({ ERR_OK, ERR_OK }));
+
+    EXPECT_EQ(DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerA", reqInfoSets, callback),
+        ERR_OK);
+    EXPECT_EQ(g_applyCalls.size(), 1);
+    EXPECT_EQ(results.size(), 3);
+
+    DSchedAllConnectManager::GetInstance().InvalidateConnectDecision("peerA");
+    EXPECT_EQ(DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerA", reqInfoSets, callback),
+        ERR_OK);
+    ASSERT_EQ(g_applyCalls.size(), 2);
+    g_applyCalls[1].applyResult(ERR_OK, ServiceCollaborationManagerResultCode::REJECT, "");
+    EXPECT_EQ(results.back(), DMS_CONNECT_APPLY_REJECT_FAILED);
+    DTEST_LOG << "DSchedAllConnectManagerTest ApplyAdvanceResourceAsync002 end" << std::endl;
+}
+
+/**
+ * @tc.name: ApplyAdvanceResourceAsync003
+ * @tc.desc: call ApplyAdvanceResourceAsync with an inline answer, and fill every request slot
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedAllConnectManagerTest, ApplyAdvanceResourceAsync003, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedAllConnectManagerTest ApplyAdvanceResourceAsync003 start" << std::endl;
+    ResetFakeApply();
+    ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets;
+    DSchedAllConnectManager::GetInstance().GetResourceRequest(reqInfoSets);
+    g_applyPassInline = true;
+    int32_t result = -1;
+    EXPECT_EQ(DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerA", reqInfoSets,
+        [&result](int32_t applyResult) { result = applyResult; }), ERR_OK);
+    EXPECT_EQ(result, ERR_OK);
+
+    g_applyPassInline = false;
+    g_applyCalls.clear();
+    int32_t finished = 0;
+    auto callback = [&finished](int32_t result) { finished++; };
+    for (int32_t i = 0; i < DSchedAllConnectManager::MAX_APPLY_REQUEST; i++) {
+        EXPECT_EQ(DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peer" + std::to_string(i),
+            reqInfoSets, callback), ERR_OK);
+    }
+    EXPECT_EQ(DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerBusy", reqInfoSets, callback),
+        DMS_CONNECT_APPLY_BUSY_FAILED);
+    EXPECT_EQ(DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peer0", reqInfoSets, nullptr),
+        INVALID_PARAMETERS_ERR);
+    for (auto &call : g_applyCalls) {
+        call.applyResult(ERR_OK, ServiceCollaborationManagerResultCode::PASS, "");
+    }
+    EXPECT_EQ(finished, DSchedAllConnectManager::MAX_APPLY_REQUEST);
+    DSchedAllConnectManager::GetInstance().allConnectMgrApi_.
+        ServiceCollaborationManager_ApplyAdvancedResource = nullptr;
+    DTEST_LOG << "DSchedAllConnectManagerTest ApplyAdvanceResourceAsync003 end" << std::endl;
 }
 
 /**
@@ -140,15 +262,21 @@ HWTEST_F(DSchedAllConnectManagerTest, ApplyResult001, TestSize.Level3)
     int32_t errorcode = 0;
     int32_t result = 0;
     std::string reason = "reason";
-    while (!DSchedAllConnectManager::GetInstance().peerConnectCbQueue_.empty()) {
-        DSchedAllConnectManager::GetInstance().peerConnectCbQueue_.pop();
-    }
+    ResetFakeApply();
     int32_t ret = DSchedAllConnectManager::GetInstance().ApplyResult(errorcode, result, reason.c_str());
     EXPECT_EQ(ret, ERR_OK);
 
-    DSchedAllConnectManager::GetInstance().peerConnectCbQueue_.push(reason);
+    ServiceCollaborationManager_ResourceRequestInfoSets reqInfoSets;
+    DSchedAllConnectManager::GetInstance().GetResourceRequest(reqInfoSets);
+    int32_t applyResult = ERR_OK;
+    ret = DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync("peerA", reqInfoSets,
+        [&applyResult](int32_t res) { applyResult = res; });
+    EXPECT_EQ(ret, ERR_OK);
     ret = DSchedAllConnectManager::GetInstance().ApplyResult(errorcode, result, reason.c_str());
     EXPECT_EQ(ret, ERR_OK);
+    EXPECT_EQ(applyResult, DMS_CONNECT_APPLY_REJECT_FAILED);
+    DSchedAllConnectManager::GetInstance().allConnectMgrApi_.
+        ServiceCollaborationManager_ApplyAdvancedResource = nullptr;
     DTEST_LOG << "DSchedAllConnectManagerTest ApplyResult001 end" << std::endl;
 }
 } // namespace DistributedSchedule
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "softbus_adapter/allconnectmgr/dsched_all_connect_manager.h"
+#include "softbus_adapter/allconnectmgr/dsched_resource_lease_manager.h"
+#include "test_log.h"
+#include "dtbschedmgr_log.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string PEER_NETWORK_ID = "leasePeerNetworkId";
+constexpr int64_t GRACE_MS = 200;
+constexpr int32_t RACE_THREAD_NUM = 8;
+constexpr int32_t RACE_LOOP_NUM = 200;
+constexpr int64_t ACQUIRE_WAIT_MS = 1000;
+
+std::atomic<int32_t> g_applyCount { 0 };
+std::atomic<int32_t> g_prepareCount { 0 };
+std::atomic<int32_t> g_idleCount { 0 };
+std::atomic<bool> g_applyReject { false };
+std::atomic<bool> g_applyDeferred { false };
+int32_t (*g_deferredApplyResult)(int32_t errorcode, int32_t result, const char *reason) = nullptr;
+
+int32_t FakeApplyAdvancedResource(const char *peerNetworkId, const char *serviceName,
+    ServiceCollaborationManager_ResourceRequestInfoSets *resourceRequest,
+    ServiceCollaborationManager_Callback *callback)
+{
+    g_applyCount++;
+    if (g_applyDeferred) {
+        g_deferredApplyResult = callback->ApplyResult;
+        return ERR_OK;
+    }
+    callback->ApplyResult(ERR_OK, g_applyReject ? ServiceCollaborationManagerResultCode::REJECT :
+        ServiceCollaborationManagerResultCode::PASS, "");
+    return ERR_OK;
+}
+
+int32_t FakePublishServiceState(const char *peerNetworkId, const char *serviceName,
+    const char *extraInfo, ServiceCollaborationManagerBussinessStatus state)
+{
+    if (state == SCM_PREPARE) {
+        g_prepareCount++;
+    } else if (state == SCM_IDLE) {
+        g_idleCount++;
+    }
+    return ERR_OK;
+}
+
+int32_t AcquireAndWait(const std::string &peerNetworkId, DSchedServiceType type)
+{
+    auto promise = std::make_shared<std::promise<int32_t>>();
+    auto future = promise->get_future();
+    int32_t ret = DSchedResourceLeaseManager::GetInstance().AcquireAsync(peerNetworkId, type,
+        [promise](int32_t result) { promise->set_value(result); });
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    if (future.wait_for(std::chrono::milliseconds(ACQUIRE_WAIT_MS)) != std::future_status::ready) {
+        return DMS_CONNECT_APPLY_TIMEOUT_FAILED;
+    }
+    return future.get();
+}
+}
+
+class DSchedResourceLeaseManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void DSchedResourceLeaseManagerTest::SetUpTestCase()
+{
+}
+
+void DSchedResourceLeaseManagerTest::TearDownTestCase()
+{
+}
+
+void DSchedResourceLeaseManagerTest::SetUp()
+{
+    g_applyCount = 0;
+    g_prepareCount = 0;
+    g_idleCount = 0;
+    g_applyReject = false;
+    g_applyDeferred = false;
+    g_deferredApplyResult = nullptr;
+    auto &allConnectMgr = DSchedAllConnectManager::GetInstance();
+    allConnectMgr.allConnectMgrApi_.ServiceCollaborationManager_ApplyAdvancedResource = &FakeApplyAdvancedResource;
+    allConnectMgr.allConnectMgrApi_.ServiceCollaborationManager_PublishServiceState = &FakePublishServiceState;
+    allConnectMgr.peerConnectDecision_.clear();
+    DSchedResourceLeaseManager::GetInstance().Init();
+    DSchedResourceLeaseManager::GetInstance().SetIdleGracePeriod(0);
+}
+
+void DSchedResourceLeaseManagerTest::TearDown()
+{
+    DSchedResourceLeaseManager::GetInstance().UnInit();
+    DSchedResourceLeaseManager::GetInstance().SetIdleGracePeriod(DSchedResourceLeaseManager::DEFAULT_IDLE_GRACE_MS);
+    auto &allConnectMgr = DSchedAllConnectManager::GetInstance();
+    allConnectMgr.allConnectMgrApi_.ServiceCollaborationManager_ApplyAdvancedResource = nullptr;
+    allConnectMgr.allConnectMgrApi_.ServiceCollaborationManager_PublishServiceState = nullptr;
+}
+
+/**
+ * @tc.name: IdleGracePeriod001
+ * @tc.desc: the idle grace period is clamped and Init reloads it from the system parameter
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, IdleGracePeriod001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest IdleGracePeriod001 begin" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    leaseMgr.SetIdleGracePeriod(-1);
+    EXPECT_EQ(leaseMgr.GetIdleGracePeriod(), 0);
+    leaseMgr.SetIdleGracePeriod(DSchedResourceLeaseManager::MAX_IDLE_GRACE_MS + 1);
+    EXPECT_EQ(leaseMgr.GetIdleGracePeriod(), DSchedResourceLeaseManager::MAX_IDLE_GRACE_MS);
+
+    leaseMgr.SetIdleGracePeriod(GRACE_MS);
+    leaseMgr.Init();
+    int64_t idleGraceMs = leaseMgr.GetIdleGracePeriod();
+    EXPECT_GE(idleGraceMs, 0);
+    EXPECT_LE(idleGraceMs, DSchedResourceLeaseManager::MAX_IDLE_GRACE_MS);
+    EXPECT_NE(idleGraceMs, GRACE_MS);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest IdleGracePeriod001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Acquire001
+ * @tc.desc: call Acquire, continue and collab share one negotiation
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, Acquire001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Acquire001 start" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), ERR_OK);
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_COLLAB), ERR_OK);
+    DSchedResourceLeaseStat stat = leaseMgr.GetLeaseStat(PEER_NETWORK_ID);
+    EXPECT_EQ(stat.refCount, 2);
+    EXPECT_EQ(stat.continueAcquired, 1);
+    EXPECT_EQ(stat.collabAcquired, 1);
+    EXPECT_EQ(stat.negotiated, 1);
+    EXPECT_EQ(stat.reused, 1);
+    EXPECT_EQ(g_applyCount.load(), 1);
+    EXPECT_EQ(g_prepareCount.load(), 1);
+
+    leaseMgr.Release(PEER_NETWORK_ID);
+    EXPECT_EQ(g_idleCount.load(), 0);
+    leaseMgr.Release(PEER_NETWORK_ID);
+    EXPECT_EQ(g_idleCount.load(), 1);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).refCount, 0);
+
+    std::string result;
+    leaseMgr.Dump(result);
+    EXPECT_NE(result.find("negotiated 1"), std::string::npos);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Acquire001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Acquire002
+ * @tc.desc: call Acquire, a rejected application leaves no lease behind
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, Acquire002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Acquire002 start" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    g_applyReject = true;
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), DMS_CONNECT_APPLY_REJECT_FAILED);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).refCount, 0);
+    EXPECT_EQ(g_prepareCount.load(), 0);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Acquire002 end" << std::endl;
+}
+
+/**
+ * @tc.name: AcquireAsync001
+ * @tc.desc: call AcquireAsync, callers go on while the arbiter decides and a second acquirer joins
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, AcquireAsync001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest AcquireAsync001 start" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    g_applyDeferred = true;
+    auto continueDone = std::make_shared<std::promise<int32_t>>();
+    auto collabDone = std::make_shared<std::promise<int32_t>>();
+    auto continueFuture = continueDone->get_future();
+    auto collabFuture = collabDone->get_future();
+    EXPECT_EQ(leaseMgr.AcquireAsync(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE,
+        [continueDone](int32_t result) { continueDone->set_value(result); }), ERR_OK);
+    EXPECT_EQ(leaseMgr.AcquireAsync(PEER_NETWORK_ID, SERVICE_TYPE_COLLAB,
+        [collabDone](int32_t result) { collabDone->set_value(result); }), ERR_OK);
+    EXPECT_EQ(leaseMgr.AcquireAsync(PEER_NETWORK_ID, SERVICE_TYPE_COLLAB, nullptr), INVALID_PARAMETERS_ERR);
+    EXPECT_EQ(g_applyCount.load(), 1);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).refCount, 0);
+    ASSERT_NE(g_deferredApplyResult, nullptr);
+
+    g_deferredApplyResult(ERR_OK, ServiceCollaborationManagerResultCode::PASS, "");
+    ASSERT_EQ(continueFuture.wait_for(std::chrono::milliseconds(ACQUIRE_WAIT_MS)), std::future_status::ready);
+    ASSERT_EQ(collabFuture.wait_for(std::chrono::milliseconds(ACQUIRE_WAIT_MS)), std::future_status::ready);
+    EXPECT_EQ(continueFuture.get(), ERR_OK);
+    EXPECT_EQ(collabFuture.get(), ERR_OK);
+    DSchedResourceLeaseStat stat = leaseMgr.GetLeaseStat(PEER_NETWORK_ID);
+    EXPECT_EQ(stat.refCount, 2);
+    EXPECT_EQ(stat.negotiated, 1);
+    EXPECT_EQ(stat.reused, 1);
+    EXPECT_EQ(g_prepareCount.load(), 1);
+
+    leaseMgr.Revoke(PEER_NETWORK_ID);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest AcquireAsync001 end" << std::endl;
+}
+
+/**
+ * @tc.name: AcquireAsync002
+ * @tc.desc: without the lease event handler, a synchronous answer fails the callback and publishes nothing
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, AcquireAsync002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest AcquireAsync002 begin" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    leaseMgr.UnInit();
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), INVALID_PARAMETERS_ERR);
+    EXPECT_EQ(g_applyCount, 1);
+    EXPECT_EQ(g_prepareCount, 0);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).refCount, 0);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest AcquireAsync002 end" << std::endl;
+}
+
+/**
+ * @tc.name: Release001
+ * @tc.desc: call Release, reacquiring within the grace period skips the negotiation
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, Release001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Release001 start" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    leaseMgr.SetIdleGracePeriod(GRACE_MS);
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), ERR_OK);
+    leaseMgr.Release(PEER_NETWORK_ID);
+    EXPECT_EQ(g_idleCount.load(), 0);
+
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), ERR_OK);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).negotiated, 1);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).reused, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(GRACE_MS * 2));
+    EXPECT_EQ(g_idleCount.load(), 0);
+
+    leaseMgr.Release(PEER_NETWORK_ID);
+    std::this_thread::sleep_for(std::chrono::milliseconds(GRACE_MS * 2));
+    EXPECT_EQ(g_idleCount.load(), 1);
+    EXPECT_EQ(g_applyCount.load(), 1);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Release001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Revoke001
+ * @tc.desc: call Revoke, the lease is dropped at once and stale releases are ignored
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, Revoke001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Revoke001 start" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    leaseMgr.SetIdleGracePeriod(GRACE_MS);
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), ERR_OK);
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_COLLAB), ERR_OK);
+    leaseMgr.Revoke(PEER_NETWORK_ID);
+    EXPECT_EQ(g_idleCount.load(), 1);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).refCount, 0);
+
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), ERR_OK);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).negotiated, 2);
+    EXPECT_EQ(g_applyCount.load(), 2);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Revoke001 end" << std::endl;
+}
+
+/**
+ * @tc.name: Revoke002
+ * @tc.desc: a seizure in the idle grace period revokes the lease, the next Acquire applies again
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, Revoke002, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Revoke002 start" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    leaseMgr.SetIdleGracePeriod(GRACE_MS);
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), ERR_OK);
+    leaseMgr.Release(PEER_NETWORK_ID);
+    EXPECT_EQ(g_idleCount.load(), 0);
+
+    // no session is open to the peer while the lease waits out the grace period
+    int32_t sessionId = 0;
+    EXPECT_FALSE(DSchedTransportSoftbusAdapter::GetInstance().GetSessionIdByDeviceId(PEER_NETWORK_ID, sessionId));
+    EXPECT_EQ(DSchedAllConnectManager::OnStop(PEER_NETWORK_ID.c_str()), ERR_OK);
+    EXPECT_EQ(g_idleCount.load(), 1);
+
+    EXPECT_EQ(AcquireAndWait(PEER_NETWORK_ID, SERVICE_TYPE_CONTINUE), ERR_OK);
+    EXPECT_EQ(g_applyCount.load(), 2);
+    EXPECT_EQ(leaseMgr.GetLeaseStat(PEER_NETWORK_ID).negotiated, 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(GRACE_MS * 2));
+    EXPECT_EQ(g_idleCount.load(), 1);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest Revoke002 end" << std::endl;
+}
+
+/**
+ * @tc.name: AcquireReleaseRace001
+ * @tc.desc: acquire and release the same peer from several threads
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedResourceLeaseManagerTest, AcquireReleaseRace001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedResourceLeaseManagerTest AcquireReleaseRace001 start" << std::endl;
+    auto &leaseMgr = DSchedResourceLeaseManager::GetInstance();
+    leaseMgr.SetIdleGracePeriod(GRACE_MS);
+    std::atomic<int32_t> failed { 0 };
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < RACE_THREAD_NUM; i++) {
+        threads.emplace_back([&leaseMgr, &failed, i]() {
+            DSchedServiceType type = (i % 2 == 0) ? SERVICE_TYPE_CONTINUE : SERVICE_TYPE_COLLAB;
+            for (int32_t loop = 0; loop < RACE_LOOP_NUM; loop++) {
+                if (AcquireAndWait(PEER_NETWORK_ID, type) != ERR_OK) {
+                    failed++;
+                    continue;
+                }
+                leaseMgr.Release(PEER_NETWORK_ID);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failed.load(), 0);
+    DSchedResourceLeaseStat stat = leaseMgr.GetLeaseStat(PEER_NETWORK_ID);
+    EXPECT_EQ(stat.refCount, 0);
+    EXPECT_EQ(stat.continueAcquired + stat.collabAcquired, RACE_THREAD_NUM * RACE_LOOP_NUM);
+    EXPECT_EQ(stat.released, RACE_THREAD_NUM * RACE_LOOP_NUM);
+    EXPECT_EQ(stat.negotiated + stat.reused, RACE_THREAD_NUM * RACE_LOOP_NUM);
+    std::this_thread::sleep_for(std::chrono::milliseconds(GRACE_MS * 2));
+    EXPECT_EQ(g_idleCount.load(), 1);
+    DTEST_LOG << "DSchedResourceLeaseManagerTest AcquireReleaseRace001 end" << std::endl;
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
@@ -49,6 +49,18 @@ constexpr uint32_t SIZE_50 = 50;
 constexpr uint32_t MAXSENDSIZE = 513;
 constexpr uint32_t TOTALLEN = 600;
 constexpr int32_t INVALID_SESSION_ID = -1;
+
+class CountingDataListener : public IDataListener {
+public:
+    void OnBind(int32_t socket, PeerSocketInfo info) override {}
+    void OnShutdown(int32_t socket, bool isSelfCalled) override {}
+    void OnDataRecv(int32_t socket, std::shared_ptr<DSchedDataBuffer> dataBuffer) override
+    {
+        recvCount_++;
+    }
+
+    int32_t recvCount_ = 0;
+};
 }
 
 // DSchedDataBufferTest
@@ -753,7 +765,7 @@ HWTEST_F(DSchedTransportSoftbusAdapterTest, AddNewPeerSession_001, TestSize.Leve
 
 /**
  * @tc.name: ConnectDevice_001
- * @tc.desc: call ConnectDevice
+ * @tc.desc: call ConnectDeviceAsync, a connected peer is answered on the calling thread
  * @tc.type: FUNC
  */
 HWTEST_F(DSchedTransportSoftbusAdapterTest, ConnectDevice_001, TestSize.Level3)
@@ -761,15 +773,28 @@ HWTEST_F(DSchedTransportSoftbusAdapterTest, ConnectDevice_001, TestSize.Level3)
     DTEST_LOG << "DSchedTransportSoftbusAdapterTest ConnectDevice_001 begin" << std::endl;
     std::string peerDeviceId = "peerDeviceId";
     int32_t sessionId = 0;
+    int32_t result = -1;
+    auto callback = [&result, &sessionId](int32_t connectResult, int32_t connectSessionId) {
+        result = connectResult;
+        sessionId = connectSessionId;
+    };
     SessionInfo info = {0, "deviceid", "peerDeviceId", "sessionName", false};
     std::shared_ptr<DSchedSoftbusSession> ptr = std::make_shared<DSchedSoftbusSession>(info);
     DSchedTransportSoftbusAdapter::GetInstance().sessions_.clear();
     DSchedTransportSoftbusAdapter::GetInstance().sessions_[1] = nullptr;
     DSchedTransportSoftbusAdapter::GetInstance().sessions_[0] = ptr;
-    int32_t ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDevice("peer", sessionId);
+    int32_t ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDeviceAsync("peer", SERVICE_TYPE_CONTINUE,
+        callback);
 
-    ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDevice(peerDeviceId, sessionId);
+    ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDeviceAsync(peerDeviceId, SERVICE_TYPE_CONTINUE,
+        callback);
     EXPECT_EQ(ret, ERR_OK);
+    EXPECT_EQ(result, ERR_OK);
+    EXPECT_EQ(sessionId, 0);
+
+    ret = DSchedTransportSoftbusAdapter::GetInstance().ConnectDeviceAsync(peerDeviceId, SERVICE_TYPE_CONTINUE,
+        nullptr);
+    EXPECT_EQ(ret, INVALID_PARAMETERS_ERR);
     DTEST_LOG << "DSchedTransportSoftbusAdapterTest ConnectDevice_001 end" << std::endl;
 }
 
@@ -896,5 +921,68 @@ HWTEST_F(DSchedTransportSoftbusAdapterTest, DisconnectDevice_001, TestSize.Level
     EXPECT_EQ(DSchedTransportSoftbusAdapter::GetInstance().sessions_.count(rightSession), 0);
     DTEST_LOG << "DSchedTransportSoftbusAdapterTest DisconnectDevice_001 end" << std::endl;
 }
+
+/**
+ * @tc.name: DisconnectSession_001
+ * @tc.desc: call DisconnectSession, only the given session of the peer loses a reference
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedTransportSoftbusAdapterTest, DisconnectSession_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedTransportSoftbusAdapterTest DisconnectSession_001 begin" << std::endl;
+    int32_t oldSession = 1;
+    int32_t newSession = 2;
+    SessionInfo info = {0, "deviceid", "peerDeviceId", "sessionName", false};
+    std::shared_ptr<DSchedSoftbusSession> oldPtr = std::make_shared<DSchedSoftbusSession>(info);
+    std::shared_ptr<DSchedSoftbusSession> newPtr = std::make_shared<DSchedSoftbusSession>(info);
+    newPtr->refCount_ = 1;
+    DSchedTransportSoftbusAdapter::GetInstance().sessions_.clear();
+    DSchedTransportSoftbusAdapter::GetInstance().sessions_[newSession] = newPtr;
+
+    EXPECT_NO_FATAL_FAILURE(DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(oldSession));
+    EXPECT_EQ(newPtr->refCount_, 1);
+    EXPECT_EQ(DSchedTransportSoftbusAdapter::GetInstance().sessions_.count(newSession), 1);
+
+    oldPtr->refCount_ = 2;
+    DSchedTransportSoftbusAdapter::GetInstance().sessions_[oldSession] = oldPtr;
+    EXPECT_NO_FATAL_FAILURE(DSchedTransportSoftbusAdapter::GetInstance().DisconnectSession(newSession));
+    EXPECT_EQ(DSchedTransportSoftbusAdapter::GetInstance().sessions_.count(newSession), 0);
+    EXPECT_EQ(oldPtr->refCount_, 2);
+    DSchedTransportSoftbusAdapter::GetInstance().sessions_.clear();
+    DTEST_LOG << "DSchedTransportSoftbusAdapterTest DisconnectSession_001 end" << std::endl;
+}
+
+/**
+ * @tc.name: OnDataReady_001
+ * @tc.desc: call OnDataReady, data without listener loads its service once
+ * @tc.type: FUNC
+ */
+HWTEST_F(DSchedTransportSoftbusAdapterTest, OnDataReady_001, TestSize.Level3)
+{
+    DTEST_LOG << "DSchedTransportSoftbusAdapterTest OnDataReady_001 begin" << std::endl;
+    auto& adapter = DSchedTransportSoftbusAdapter::GetInstance();
+    adapter.listeners_.clear();
+    auto listener = std::make_shared<CountingDataListener>();
+    std::vector<int32_t> loadedTypes;
+    adapter.SetListenerLoader([&adapter, &listener, &loadedTypes](int32_t serviceType) {
+        loadedTypes.emplace_back(serviceType);
+        if (serviceType == SERVICE_TYPE_COLLAB) {
+            adapter.RegisterListener(serviceType, listener);
+        }
+    });
+    std::shared_ptr<DSchedDataBuffer> dataBuffer = std::make_shared<DSchedDataBuffer>(SIZE_1);
+    adapter.OnDataReady(SESSIONID, dataBuffer, SERVICE_TYPE_COLLAB);
+    adapter.OnDataReady(SESSIONID, dataBuffer, SERVICE_TYPE_COLLAB);
+    EXPECT_EQ(listener->recvCount_, COUNT);
+    EXPECT_EQ(loadedTypes, std::vector<int32_t>({ SERVICE_TYPE_COLLAB }));
+
+    adapter.OnDataReady(SESSIONID, dataBuffer, SERVICE_TYPE_CONTINUE);
+    EXPECT_EQ(loadedTypes, std::vector<int32_t>({ SERVICE_TYPE_COLLAB, SERVICE_TYPE_CONTINUE }));
+    EXPECT_EQ(listener->recvCount_, COUNT);
+
+    adapter.SetListenerLoader(nullptr);
+    adapter.UnregisterListener(SERVICE_TYPE_COLLAB, listener);
+    DTEST_LOG << "DSchedTransportSoftbusAdapterTest OnDataReady_001 end" << std::endl;
+}
 }
 }
\ No newline at end of file
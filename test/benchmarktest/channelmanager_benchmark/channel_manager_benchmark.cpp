@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_alloc_counter.h"
+#include "data_sender_receiver.h"
+#include "dtbcollabmgr_log.h"
+#include "session_data_header.h"
+#include "softbus_error_code.h"
+#include "softbus_loopback.h"
+
+namespace OHOS {
+namespace DistributedCollab {
+using DistributedSchedule::LoopbackConfig;
+using DistributedSchedule::ScopedAllocCounter;
+using DistributedSchedule::SoftbusLoopback;
+
+namespace {
+const std::string TAG = "ChannelManagerBenchmark";
+const std::string SERVER_SOCKET_NAME = "ohos.dtbcollab.benchmark.server";
+const std::string CLIENT_SOCKET_NAME = "ohos.dtbcollab.benchmark.client";
+const std::string BENCHMARK_PKG_NAME = "dms";
+constexpr uint32_t LOOPBACK_MTU = 64 * 1024;
+constexpr int32_t RECV_TIMEOUT_MS = 5000;
+constexpr int32_t PIPELINE_DEPTH = 16;
+
+/*
+ * Receive side of one loopback pair. The listener callbacks are plain C
+ * functions, so the receiver state lives in a single global.
+ */
+struct RecvContext {
+    std::mutex mutex;
+    std::condition_variable con;
+    std::unique_ptr<DataSenderReceiver> receiver;
+    uint64_t received = 0;
+    uint64_t receivedBytes = 0;
+    int32_t serverSocket = 0;
+
+    void Notify(uint64_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        received++;
+        receivedBytes += bytes;
+        con.notify_all();
+    }
+
+    bool WaitFor(uint64_t target)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return con.wait_for(lock, std::chrono::milliseconds(RECV_TIMEOUT_MS), [this, target] {
+            return received >= target;
+        });
+    }
+};
+
+RecvContext g_recv;
+
+void OnServerBind(int32_t socket, PeerSocketInfo info)
+{
+    std::lock_guard<std::mutex> lock(g_recv.mutex);
+    g_recv.receiver = std::make_unique<DataSenderReceiver>(socket);
+    g_recv.con.notify_all();
+}
+
+void OnServerShutdown(int32_t socket, ShutdownReason reason)
+{
+}
+
+void OnServerBytes(int32_t socket, const void* data, uint32_t dataLen)
+{
+    DataSenderReceiver* receiver = g_recv.receiver.get();
+    if (receiver == nullptr ||
+        receiver->PackRecvPacketData(static_cast<const uint8_t*>(data), dataLen) != ERR_OK) {
+        return;
+    }
+    std::shared_ptr<AVTransDataBuffer> buffer = receiver->GetPacketedData();
+    if (buffer != nullptr) {
+        g_recv.Notify(buffer->Size());
+    }
+}
+
+void OnServerMessage(int32_t socket, const void* data, uint32_t dataLen)
+{
+    g_recv.Notify(dataLen);
+}
+
+void OnServerStream(int32_t socket, const StreamData* data, const StreamData* ext, const StreamFrameInfo* param)
+{
+    g_recv.Notify(data != nullptr ? static_cast<uint64_t>(data->bufLen) : 0);
+}
+
+void OnClientBind(int32_t socket, PeerSocketInfo info)
+{
+}
+
+ISocketListener g_serverListener = {
+    .OnBind = OnServerBind,
+    .OnShutdown = OnServerShutdown,
+    .OnBytes = OnServerBytes,
+    .OnMessage = OnServerMessage,
+    .OnStream = OnServerStream,
+};
+
+ISocketListener g_clientListener = {
+    .OnBind = OnClientBind,
+};
+
+class LoopbackPair {
+public:
+    LoopbackPair(TransDataType dataType, const LoopbackConfig& config)
+    {
+        SoftbusLoopback::GetInstance().Reset();
+        SoftbusLoopback::GetInstance().SetConfig(config);
+        {
+            std::lock_guard<std::mutex> lock(g_recv.mutex);
+            g_recv.receiver = nullptr;
+            g_recv.received = 0;
+            g_recv.receivedBytes = 0;
+        }
+        SocketInfo serverInfo = {
+            .name = const_cast<char*>(SERVER_SOCKET_NAME.c_str()),
+            .pkgName = const_cast<char*>(BENCHMARK_PKG_NAME.c_str()),
+            .dataType = dataType,
+        };
+        serverSocket_ = Socket(serverInfo);
+        Listen(serverSocket_, nullptr, 0, &g_serverListener);
+        SocketInfo clientInfo = {
+            .name = const_cast<char*>(CLIENT_SOCKET_NAME.c_str()),
+            .peerName = const_cast<char*>(SERVER_SOCKET_NAME.c_str()),
+            .peerNetworkId = const_cast<char*>(SoftbusLoopback::LOOPBACK_NETWORK_ID),
+            .pkgName = const_cast<char*>(BENCHMARK_PKG_NAME.c_str()),
+            .dataType = dataType,
+        };
+        clientSocket_ = Socket(clientInfo);
+        isReady_ = Bind(clientSocket_, nullptr, 0, &g_clientListener) == SOFTBUS_OK;
+        if (isReady_) {
+            std::unique_lock<std::mutex> lock(g_recv.mutex);
+            isReady_ = g_recv.con.wait_for(lock, std::chrono::milliseconds(RECV_TIMEOUT_MS), [] {
+                return g_recv.receiver != nullptr;
+            });
+        }
+        sender_ = std::make_unique<DataSenderReceiver>(clientSocket_);
+    }
+
+    ~LoopbackPair()
+    {
+        Shutdown(clientSocket_);
+        Shutdown(serverSocket_);
+        SoftbusLoopback::GetInstance().WaitIdle(RECV_TIMEOUT_MS);
+    }
+
+    bool IsReady() const
+    {
+        return isReady_;
+    }
+
+    DataSenderReceiver& Sender()
+    {
+        return *sender_;
+    }
+
+private:
+    int32_t serverSocket_ = 0;
+    int32_t clientSocket_ = 0;
+    bool isReady_ = false;
+    std::unique_ptr<DataSenderReceiver> sender_;
+};
+
+std::shared_ptr<AVTransDataBuffer> MakePayload(size_t size)
+{
+    auto buffer = std::make_shared<AVTransDataBuffer>(size);
+    for (size_t i = 0; i < size; i++) {
+        buffer->Data()[i] = static_cast<uint8_t>(i);
+    }
+    return buffer;
+}
+
+LoopbackConfig MakeConfig(const benchmark::State& state)
+{
+    LoopbackConfig config;
+    config.mtu = LOOPBACK_MTU;
+    config.latencyUs = state.range(1);
+    return config;
+}
+
+void ReportCounters(benchmark::State& state, const ScopedAllocCounter& allocs, uint64_t messages, size_t size)
+{
+    if (messages == 0) {
+        return;
+    }
+    auto elapsed = allocs.Elapsed();
+    state.SetItemsProcessed(static_cast<int64_t>(messages));
+    state.SetBytesProcessed(static_cast<int64_t>(messages * size));
+    state.counters["allocs_per_msg"] = static_cast<double>(elapsed.count) / messages;
+    state.counters["alloc_bytes_per_msg"] = static_cast<double>(elapsed.bytes) / messages;
+}
+
+/*
+ * One message in flight: the iteration time is the one way latency of a
+ * SendBytesData call through header packing, the bus and reassembly.
+ */
+void BM_SendBytesLatency(benchmark::State& state)
+{
+    size_t size = static_cast<size_t>(state.range(0));
+    LoopbackPair pair(DATA_TYPE_BYTES, MakeConfig(state));
+    if (!pair.IsReady()) {
+        state.SkipWithError("loopback bind failed");
+        return;
+    }
+    auto payload = MakePayload(size);
+    uint64_t sent = 0;
+    ScopedAllocCounter allocs;
+    for (auto _ : state) {
+        if (pair.Sender().SendBytesData(payload) != ERR_OK || !g_recv.WaitFor(++sent)) {
+            state.SkipWithError("send bytes failed");
+            break;
+        }
+    }
+    ReportCounters(state, allocs, sent, size);
+}
+
+/*
+ * PIPELINE_DEPTH messages in flight, so the cost of the receive thread
+ * overlaps with the next send and the result approaches the peak throughput.
+ */
+void BM_SendBytesThroughput(benchmark::State& state)
+{
+    size_t size = static_cast<size_t>(state.range(0));
+    LoopbackPair pair(DATA_TYPE_BYTES, MakeConfig(state));
+    if (!pair.IsReady()) {
+        state.SkipWithError("loopback bind failed");
+        return;
+    }
+    auto payload = MakePayload(size);
+    uint64_t sent = 0;
+    ScopedAllocCounter allocs;
+    for (auto _ : state) {
+        for (int32_t i = 0; i < PIPELINE_DEPTH; i++) {
+            if (pair.Sender().SendBytesData(payload) != ERR_OK) {
+                state.SkipWithError("send bytes failed");
+                return;
+            }
+        }
+        sent += PIPELINE_DEPTH;
+        if (!g_recv.WaitFor(sent)) {
+            state.SkipWithError("receive bytes timeout");
+            break;
+        }
+    }
+    ReportCounters(state, allocs, sent, size);
+}
+
+void BM_SendMessageLatency(benchmark::State& state)
+{
+    size_t size = static_cast<size_t>(state.range(0));
+    LoopbackPair pair(DATA_TYPE_MESSAGE, MakeConfig(state));
+    if (!pair.IsReady()) {
+        state.SkipWithError("loopback bind failed");
+        return;
+    }
+    auto payload = MakePayload(size);
+    uint64_t sent = 0;
+    ScopedAllocCounter allocs;
+    for (auto _ : state) {
+        if (pair.Sender().SendMessageData(payload) != ERR_OK || !g_recv.WaitFor(++sent)) {
+            state.SkipWithError("send message failed");
+            break;
+        }
+    }
+    ReportCounters(state, allocs, sent, size);
+}
+
+void BM_SendStreamFrame(benchmark::State& state)
+{
+    size_t size = static_cast<size_t>(state.range(0));
+    LoopbackPair pair(DATA_TYPE_VIDEO_STREAM, MakeConfig(state));
+    if (!pair.IsReady()) {
+        state.SkipWithError("loopback bind failed");
+        return;
+    }
+    AVTransStreamDataExt ext;
+    ext.flag_ = AvCodecBufferFlag::AVCODEC_BUFFER_FLAG_SYNC_FRAME;
+    auto frame = std::make_shared<AVTransStreamData>(MakePayload(size), ext);
+    uint64_t sent = 0;
+    ScopedAllocCounter allocs;
+    for (auto _ : state) {
+        if (pair.Sender().SendStreamData(frame) != ERR_OK || !g_recv.WaitFor(++sent)) {
+            state.SkipWithError("send stream failed");
+            break;
+        }
+    }
+    ReportCounters(state, allocs, sent, size);
+}
+
+// fragmented payloads are whole multiples of one packet, SendUnpackData always sends full fragments
+constexpr int64_t FRAGMENT_PAYLOAD = LOOPBACK_MTU - SessionDataHeader::HEADER_LEN;
+constexpr int64_t SMALL_PAYLOAD = 64;
+constexpr int64_t MEDIUM_PAYLOAD = 1024;
+constexpr int64_t MESSAGE_PAYLOAD = 4 * 1024;
+constexpr int64_t FRAME_720P = 64 * 1024;
+constexpr int64_t FRAME_1080P = 256 * 1024;
+constexpr int64_t NO_LATENCY = 0;
+constexpr int64_t WLAN_LATENCY_US = 500;
+}
+
+BENCHMARK(BM_SendBytesLatency)
+    ->Args({ SMALL_PAYLOAD, NO_LATENCY })
+    ->Args({ MEDIUM_PAYLOAD, NO_LATENCY })
+    ->Args({ FRAGMENT_PAYLOAD * 4, NO_LATENCY })
+    ->Args({ FRAGMENT_PAYLOAD * 16, NO_LATENCY })
+    ->Args({ SMALL_PAYLOAD, WLAN_LATENCY_US })
+    ->Args({ FRAGMENT_PAYLOAD * 16, WLAN_LATENCY_US })
+    ->UseRealTime();
+
+BENCHMARK(BM_SendBytesThroughput)
+    ->Args({ SMALL_PAYLOAD, NO_LATENCY })
+    ->Args({ MEDIUM_PAYLOAD, NO_LATENCY })
+    ->Args({ FRAGMENT_PAYLOAD * 16, NO_LATENCY })
+    ->UseRealTime();
+
+BENCHMARK(BM_SendMessageLatency)
+    ->Args({ SMALL_PAYLOAD, NO_LATENCY })
+    ->Args({ MESSAGE_PAYLOAD, NO_LATENCY })
+    ->UseRealTime();
+
+BENCHMARK(BM_SendStreamFrame)
+    ->Args({ FRAME_720P, NO_LATENCY })
+    ->Args({ FRAME_1080P, NO_LATENCY })
+    ->UseRealTime();
+} // namespace DistributedCollab
+} // namespace OHOS
+
+BENCHMARK_MAIN();
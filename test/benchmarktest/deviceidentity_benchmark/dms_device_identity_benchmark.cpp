@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "deviceManager/dms_device_identity_table.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+constexpr int32_t READER_THREADS = 4;
+
+DmsDeviceIdentity MakeIdentity(int64_t index)
+{
+    // real ids are 64 character hex strings, keep the keys that long so hashing cost is realistic
+    std::string suffix = std::to_string(index);
+    std::string padding(64 - suffix.size(), '0');
+    return { "n" + padding + suffix, "u" + padding + suffix, "d" + padding + suffix };
+}
+
+std::vector<DmsDeviceIdentity> MakeIdentities(int64_t count)
+{
+    std::vector<DmsDeviceIdentity> identities;
+    for (int64_t i = 0; i < count; i++) {
+        identities.push_back(MakeIdentity(i));
+    }
+    return identities;
+}
+
+// the uuid -> networkId map walked linearly under a mutex, as the storage looked it up before
+class LinearUuidMap {
+public:
+    void Add(const DmsDeviceIdentity& identity)
+    {
+        std::lock_guard<std::mutex> autoLock(lock_);
+        map_[identity.uuid] = identity.networkId;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> autoLock(lock_);
+        map_.clear();
+    }
+
+    std::string GetUuidByNetworkId(const std::string& networkId)
+    {
+        std::lock_guard<std::mutex> autoLock(lock_);
+        for (const auto& item : map_) {
+            if (item.second == networkId) {
+                return item.first;
+            }
+        }
+        return "";
+    }
+
+private:
+    std::mutex lock_;
+    std::map<std::string, std::string> map_;
+};
+
+void BM_IdentityTableGetUuid(benchmark::State& state)
+{
+    static DmsDeviceIdentityTable table;
+    static std::vector<DmsDeviceIdentity> identities;
+    if (state.thread_index() == 0) {
+        table.Clear();
+        identities = MakeIdentities(state.range(0));
+        for (const auto& identity : identities) {
+            table.Update(identity);
+        }
+    }
+    size_t index = 0;
+    std::string uuid;
+    for (auto _ : state) {
+        const DmsDeviceIdentity& identity = identities[index++ % identities.size()];
+        benchmark::DoNotOptimize(table.GetUuidByNetworkId(identity.networkId, uuid));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_IdentityTableGetNetworkId(benchmark::State& state)
+{
+    DmsDeviceIdentityTable table;
+    auto identities = MakeIdentities(state.range(0));
+    for (const auto& identity : identities) {
+        table.Update(identity);
+    }
+    size_t index = 0;
+    std::string networkId;
+    for (auto _ : state) {
+        const DmsDeviceIdentity& identity = identities[index++ % identities.size()];
+        benchmark::DoNotOptimize(table.GetNetworkIdByUuid(identity.uuid, networkId));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_IdentityTableGetUdid(benchmark::State& state)
+{
+    DmsDeviceIdentityTable table;
+    auto identities = MakeIdentities(state.range(0));
+    for (const auto& identity : identities) {
+        table.Update(identity);
+    }
+    size_t index = 0;
+    std::string udid;
+    for (auto _ : state) {
+        const DmsDeviceIdentity& identity = identities[index++ % identities.size()];
+        benchmark::DoNotOptimize(table.GetUdidByNetworkId(identity.networkId, udid));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LinearMapGetUuid(benchmark::State& state)
+{
+    static LinearUuidMap map;
+    static std::vector<DmsDeviceIdentity> identities;
+    if (state.thread_index() == 0) {
+        map.Clear();
+        identities = MakeIdentities(state.range(0));
+        for (const auto& identity : identities) {
+            map.Add(identity);
+        }
+    }
+    size_t index = 0;
+    for (auto _ : state) {
+        const DmsDeviceIdentity& identity = identities[index++ % identities.size()];
+        benchmark::DoNotOptimize(map.GetUuidByNetworkId(identity.networkId));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// cost of one device going on line, paid by the writer for every copy of the table
+void BM_IdentityTableUpdate(benchmark::State& state)
+{
+    DmsDeviceIdentityTable table;
+    auto identities = MakeIdentities(state.range(0));
+    for (const auto& identity : identities) {
+        table.Update(identity);
+    }
+    DmsDeviceIdentity churn = MakeIdentity(state.range(0));
+    for (auto _ : state) {
+        table.Update(churn);
+        table.RemoveByNetworkId(churn.networkId);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+}
+
+BENCHMARK(BM_IdentityTableGetUuid)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK(BM_IdentityTableGetUuid)->Arg(1)->Arg(16)->Arg(256)->Threads(READER_THREADS);
+BENCHMARK(BM_IdentityTableGetNetworkId)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK(BM_IdentityTableGetUdid)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK(BM_LinearMapGetUuid)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK(BM_LinearMapGetUuid)->Arg(1)->Arg(16)->Arg(256)->Threads(READER_THREADS);
+BENCHMARK(BM_IdentityTableUpdate)->Arg(1)->Arg(16)->Arg(256);
+} // namespace DistributedSchedule
+} // namespace OHOS
+
+BENCHMARK_MAIN();
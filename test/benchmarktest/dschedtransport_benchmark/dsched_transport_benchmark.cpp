@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_alloc_counter.h"
+#include "dsched_transport_softbus_adapter.h"
+#include "dtbschedmgr_log.h"
+#include "softbus_error_code.h"
+#include "softbus_loopback.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+const std::string TAG = "DSchedTransportBenchmark";
+const std::string SERVER_SOCKET_NAME = "ohos.distributedschedule.dms.benchmark.server";
+const std::string CLIENT_SOCKET_NAME = "ohos.distributedschedule.dms.benchmark.client";
+const std::string LOCAL_DEVICE_ID = "benchmark.local";
+const std::string PEER_DEVICE_ID = "benchmark.peer";
+constexpr int32_t RECV_TIMEOUT_MS = 5000;
+constexpr int32_t PIPELINE_DEPTH = 16;
+
+class BenchmarkDataListener : public IDataListener {
+public:
+    void OnBind(int32_t socket, PeerSocketInfo info) override
+    {
+    }
+
+    void OnShutdown(int32_t socket, bool isSelfCalled) override
+    {
+    }
+
+    void OnDataRecv(int32_t socket, std::shared_ptr<DSchedDataBuffer> dataBuffer) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        received_++;
+        con_.notify_all();
+    }
+
+    void ResetCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        received_ = 0;
+    }
+
+    bool WaitFor(uint64_t target)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return con_.wait_for(lock, std::chrono::milliseconds(RECV_TIMEOUT_MS), [this, target] {
+            return received_ >= target;
+        });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable con_;
+    uint64_t received_ = 0;
+};
+
+std::mutex g_bindMutex;
+std::condition_variable g_bindCon;
+int32_t g_acceptedSocket = 0;
+
+void OnLoopbackBind(int32_t socket, PeerSocketInfo info)
+{
+    std::lock_guard<std::mutex> lock(g_bindMutex);
+    g_acceptedSocket = socket;
+    g_bindCon.notify_all();
+}
+
+void OnLoopbackShutdown(int32_t socket, ShutdownReason reason)
+{
+}
+
+// same path as the adapter's own socket listener, minus the device manager lookups done on bind
+void OnLoopbackBytes(int32_t socket, const void* data, uint32_t dataLen)
+{
+    DSchedTransportSoftbusAdapter::GetInstance().OnBytes(socket, data, dataLen);
+}
+
+ISocketListener g_serverListener = {
+    .OnBind = OnLoopbackBind,
+    .OnShutdown = OnLoopbackShutdown,
+    .OnBytes = OnLoopbackBytes,
+};
+
+ISocketListener g_clientListener = {
+    .OnShutdown = OnLoopbackShutdown,
+    .OnBytes = OnLoopbackBytes,
+};
+
+/*
+ * A client and an accepted server socket on the loopback bus, each registered
+ * in the adapter as a DSchedSoftbusSession exactly as ConnectDevice and
+ * OnBind would, so SendData and OnBytes run the production framing code.
+ */
+class SessionPair {
+public:
+    SessionPair(uint32_t mtu, int64_t latencyUs)
+    {
+        LoopbackConfig config;
+        config.mtu = mtu;
+        config.latencyUs = latencyUs;
+        SoftbusLoopback::GetInstance().Reset();
+        SoftbusLoopback::GetInstance().SetConfig(config);
+        {
+            std::lock_guard<std::mutex> lock(g_bindMutex);
+            g_acceptedSocket = 0;
+        }
+        SocketInfo serverInfo = {
+            .name = const_cast<char*>(SERVER_SOCKET_NAME.c_str()),
+            .pkgName = const_cast<char*>(SOCKET_DMS_PKG_NAME.c_str()),
+            .dataType = DATA_TYPE_BYTES,
+        };
+        serverSocket_ = Socket(serverInfo);
+        Listen(serverSocket_, nullptr, 0, &g_serverListener);
+        SocketInfo clientInfo = {
+            .name = const_cast<char*>(CLIENT_SOCKET_NAME.c_str()),
+            .peerName = const_cast<char*>(SERVER_SOCKET_NAME.c_str()),
+            .peerNetworkId = const_cast<char*>(PEER_DEVICE_ID.c_str()),
+            .pkgName = const_cast<char*>(SOCKET_DMS_PKG_NAME.c_str()),
+            .dataType = DATA_TYPE_BYTES,
+        };
+        clientSocket_ = Socket(clientInfo);
+        if (Bind(clientSocket_, nullptr, 0, &g_clientListener) != SOFTBUS_OK) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(g_bindMutex);
+        if (!g_bindCon.wait_for(lock, std::chrono::milliseconds(RECV_TIMEOUT_MS), [] {
+            return g_acceptedSocket != 0;
+        })) {
+            return;
+        }
+        acceptedSocket_ = g_acceptedSocket;
+        AddSession(clientSocket_, PEER_DEVICE_ID, false);
+        AddSession(acceptedSocket_, LOCAL_DEVICE_ID, true);
+        isReady_ = true;
+    }
+
+    ~SessionPair()
+    {
+        auto& adapter = DSchedTransportSoftbusAdapter::GetInstance();
+        {
+            std::lock_guard<std::mutex> lock(adapter.sessionMutex_);
+            adapter.sessions_.erase(clientSocket_);
+            adapter.sessions_.erase(acceptedSocket_);
+        }
+        Shutdown(clientSocket_);
+        Shutdown(serverSocket_);
+        SoftbusLoopback::GetInstance().WaitIdle(RECV_TIMEOUT_MS);
+    }
+
+    bool IsReady() const
+    {
+        return isReady_;
+    }
+
+    int32_t ClientSession() const
+    {
+        return clientSocket_;
+    }
+
+private:
+    static void AddSession(int32_t socket, const std::string& peerDeviceId, bool isServer)
+    {
+        SessionInfo info = { socket, "", peerDeviceId, SOCKET_DMS_SESSION_NAME, isServer };
+        auto& adapter = DSchedTransportSoftbusAdapter::GetInstance();
+        std::lock_guard<std::mutex> lock(adapter.sessionMutex_);
+        adapter.sessions_[socket] = std::make_shared<DSchedSoftbusSession>(info);
+    }
+
+    int32_t serverSocket_ = 0;
+    int32_t clientSocket_ = 0;
+    int32_t acceptedSocket_ = 0;
+    bool isReady_ = false;
+};
+
+std::shared_ptr<BenchmarkDataListener> GetListener()
+{
+    static std::shared_ptr<BenchmarkDataListener> listener = [] {
+        auto instance = std::make_shared<BenchmarkDataListener>();
+        DSchedTransportSoftbusAdapter::GetInstance().RegisterListener(SERVICE_TYPE_CONTINUE, instance);
+        return instance;
+    }();
+    return listener;
+}
+
+std::shared_ptr<DSchedDataBuffer> MakePayload(size_t size)
+{
+    auto buffer = std::make_shared<DSchedDataBuffer>(size);
+    for (size_t i = 0; i < size; i++) {
+        buffer->Data()[i] = static_cast<uint8_t>(i);
+    }
+    return buffer;
+}
+
+void ReportCounters(benchmark::State& state, const ScopedAllocCounter& allocs, uint64_t messages, size_t size)
+{
+    if (messages == 0) {
+        return;
+    }
+    auto elapsed = allocs.Elapsed();
+    state.SetItemsProcessed(static_cast<int64_t>(messages));
+    state.SetBytesProcessed(static_cast<int64_t>(messages * size));
+    state.counters["allocs_per_msg"] = static_cast<double>(elapsed.count) / messages;
+    state.counters["alloc_bytes_per_msg"] = static_cast<double>(elapsed.bytes) / messages;
+}
+
+/*
+ * range(0) payload size, range(1) bus MTU, range(2) one way latency. One
+ * message in flight, so the iteration time is the send to OnDataRecv latency.
+ */
+void BM_SessionSendLatency(benchmark::State& state)
+{
+    size_t size = static_cast<size_t>(state.range(0));
+    auto listener = GetListener();
+    listener->ResetCount();
+    SessionPair pair(static_cast<uint32_t>(state.range(1)), state.range(2));
+    if (!pair.IsReady()) {
+        state.SkipWithError("loopback bind failed");
+        return;
+    }
+    auto payload = MakePayload(size);
+    auto& adapter = DSchedTransportSoftbusAdapter::GetInstance();
+    uint64_t sent = 0;
+    ScopedAllocCounter allocs;
+    for (auto _ : state) {
+        if (adapter.SendData(pair.ClientSession(), SERVICE_TYPE_CONTINUE, payload) != ERR_OK ||
+            !listener->WaitFor(++sent)) {
+            state.SkipWithError("send data failed");
+            break;
+        }
+    }
+    ReportCounters(state, allocs, sent, size);
+}
+
+void BM_SessionSendThroughput(benchmark::State& state)
+{
+    size_t size = static_cast<size_t>(state.range(0));
+    auto listener = GetListener();
+    listener->ResetCount();
+    SessionPair pair(static_cast<uint32_t>(state.range(1)), state.range(2));
+    if (!pair.IsReady()) {
+        state.SkipWithError("loopback bind failed");
+        return;
+    }
+    auto payload = MakePayload(size);
+    auto& adapter = DSchedTransportSoftbusAdapter::GetInstance();
+    uint64_t sent = 0;
+    ScopedAllocCounter allocs;
+    for (auto _ : state) {
+        for (int32_t i = 0; i < PIPELINE_DEPTH; i++) {
+            if (adapter.SendData(pair.ClientSession(), SERVICE_TYPE_CONTINUE, payload) != ERR_OK) {
+                state.SkipWithError("send data failed");
+                return;
+            }
+        }
+        sent += PIPELINE_DEPTH;
+        if (!listener->WaitFor(sent)) {
+            state.SkipWithError("receive data timeout");
+            break;
+        }
+    }
+    ReportCounters(state, allocs, sent, size);
+}
+
+constexpr int64_t SMALL_PAYLOAD = 128;
+constexpr int64_t CONTINUE_CMD_PAYLOAD = 4 * 1024;
+constexpr int64_t LARGE_PAYLOAD = 1024 * 1024;
+constexpr int64_t HUGE_PAYLOAD = 4 * 1024 * 1024;
+constexpr int64_t SMALL_MTU = 4 * 1024;
+constexpr int64_t DEFAULT_MTU = 64 * 1024;
+constexpr int64_t NO_LATENCY = 0;
+constexpr int64_t WLAN_LATENCY_US = 500;
+}
+
+BENCHMARK(BM_SessionSendLatency)
+    ->Args({ SMALL_PAYLOAD, DEFAULT_MTU, NO_LATENCY })
+    ->Args({ CONTINUE_CMD_PAYLOAD, DEFAULT_MTU, NO_LATENCY })
+    ->Args({ LARGE_PAYLOAD, DEFAULT_MTU, NO_LATENCY })
+    ->Args({ LARGE_PAYLOAD, SMALL_MTU, NO_LATENCY })
+    ->Args({ HUGE_PAYLOAD, DEFAULT_MTU, NO_LATENCY })
+    ->Args({ CONTINUE_CMD_PAYLOAD, DEFAULT_MTU, WLAN_LATENCY_US })
+    ->UseRealTime();
+
+BENCHMARK(BM_SessionSendThroughput)
+    ->Args({ SMALL_PAYLOAD, DEFAULT_MTU, NO_LATENCY })
+    ->Args({ LARGE_PAYLOAD, DEFAULT_MTU, NO_LATENCY })
+    ->Args({ LARGE_PAYLOAD, SMALL_MTU, NO_LATENCY })
+    ->UseRealTime();
+} // namespace DistributedSchedule
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark_alloc_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace OHOS {
+namespace DistributedSchedule {
+namespace {
+std::atomic<uint64_t> g_allocCount { 0 };
+std::atomic<uint64_t> g_allocBytes { 0 };
+
+void* CountedAlloc(std::size_t size)
+{
+    BenchmarkAllocCounter::Add(size);
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+}
+
+AllocSnapshot BenchmarkAllocCounter::Get()
+{
+    return { g_allocCount.load(std::memory_order_relaxed), g_allocBytes.load(std::memory_order_relaxed) };
+}
+
+void BenchmarkAllocCounter::Add(uint64_t bytes)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
+
+void* operator new(std::size_t size)
+{
+    return OHOS::DistributedSchedule::CountedAlloc(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return OHOS::DistributedSchedule::CountedAlloc(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    OHOS::DistributedSchedule::BenchmarkAllocCounter::Add(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    OHOS::DistributedSchedule::BenchmarkAllocCounter::Add(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
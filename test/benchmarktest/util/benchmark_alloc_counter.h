@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_BENCHMARK_ALLOC_COUNTER_H
+#define OHOS_DMS_BENCHMARK_ALLOC_COUNTER_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace DistributedSchedule {
+struct AllocSnapshot {
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+/*
+ * Process wide operator new counters. Linking benchmark_alloc_counter.cpp
+ * replaces the global operator new/delete, so every heap allocation made
+ * through C++ is counted, on any thread.
+ */
+class BenchmarkAllocCounter {
+public:
+    static AllocSnapshot Get();
+    static void Add(uint64_t bytes);
+};
+
+class ScopedAllocCounter {
+public:
+    ScopedAllocCounter() : begin_(BenchmarkAllocCounter::Get()) {}
+
+    AllocSnapshot Elapsed() const
+    {
+        AllocSnapshot now = BenchmarkAllocCounter::Get();
+        return { now.count - begin_.count, now.bytes - begin_.bytes };
+    }
+
+private:
+    AllocSnapshot begin_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_BENCHMARK_ALLOC_COUNTER_H
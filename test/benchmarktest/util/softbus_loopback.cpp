@@ -0,0 +1,546 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "softbus_loopback.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include "session.h"
+#include "softbus_error_code.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+SoftbusLoopback& SoftbusLoopback::GetInstance()
+{
+    static auto instance = new SoftbusLoopback();
+    return *instance;
+}
+
+SoftbusLoopback::~SoftbusLoopback()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isRunning_ = false;
+    }
+    queueCon_.notify_all();
+    if (deliverThread_.joinable()) {
+        deliverThread_.join();
+    }
+}
+
+void SoftbusLoopback::SetConfig(const LoopbackConfig& config)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_ = config;
+    config_.lossRate = std::clamp(config_.lossRate, 0.0, 1.0);
+    config_.latencyUs = std::max<int64_t>(config_.latencyUs, 0);
+    random_.seed(config_.seed);
+}
+
+LoopbackConfig SoftbusLoopback::GetConfig()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_;
+}
+
+LoopbackStat SoftbusLoopback::GetStat()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stat_;
+}
+
+bool SoftbusLoopback::WaitIdle(int64_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return idleCon_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] {
+        return queue_.empty() && !isDelivering_;
+    });
+}
+
+void SoftbusLoopback::Reset()
+{
+    WaitIdle(INT32_MAX);
+    std::lock_guard<std::mutex> lock(mutex_);
+    sockets_.clear();
+    stat_ = LoopbackStat();
+    random_.seed(config_.seed);
+    lastDeliverTimeUs_ = 0;
+}
+
+int32_t SoftbusLoopback::CreateSocket(const SocketInfo& info)
+{
+    if (info.name == nullptr) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoopbackSocket socket;
+    socket.name = info.name;
+    socket.peerName = info.peerName != nullptr ? info.peerName : "";
+    socket.pkgName = info.pkgName != nullptr ? info.pkgName : "";
+    socket.dataType = info.dataType;
+    int32_t socketId = nextSocket_++;
+    sockets_[socketId] = socket;
+    return socketId;
+}
+
+int32_t SoftbusLoopback::Listen(int32_t socket, const ISocketListener* listener)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = sockets_.find(socket);
+    if (iter == sockets_.end() || listener == nullptr) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    iter->second.listener = listener;
+    iter->second.isListening = true;
+    return SOFTBUS_OK;
+}
+
+int32_t SoftbusLoopback::Bind(int32_t socket, const ISocketListener* listener, bool isAsync)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto clientIter = sockets_.find(socket);
+    if (clientIter == sockets_.end() || listener == nullptr || clientIter->second.peer != 0) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    LoopbackSocket& client = clientIter->second;
+    auto serverIter = std::find_if(sockets_.begin(), sockets_.end(), [&client](const auto& item) {
+        return item.second.isListening && item.second.name == client.peerName;
+    });
+    if (serverIter == sockets_.end()) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    client.listener = listener;
+
+    LoopbackSocket accepted;
+    accepted.name = serverIter->second.name;
+    accepted.peerName = client.name;
+    accepted.pkgName = client.pkgName;
+    accepted.dataType = client.dataType;
+    accepted.listener = serverIter->second.listener;
+    accepted.peer = socket;
+    int32_t acceptedId = nextSocket_++;
+    client.peer = acceptedId;
+
+    Packet serverBind;
+    serverBind.target = acceptedId;
+    serverBind.kind = KIND_BIND;
+    serverBind.peerName = client.name;
+    serverBind.pkgName = client.pkgName;
+    serverBind.dataType = client.dataType;
+    sockets_[acceptedId] = accepted;
+    EnqueueLocked(std::move(serverBind));
+
+    if (isAsync) {
+        Packet clientBind;
+        clientBind.target = socket;
+        clientBind.kind = KIND_BIND;
+        clientBind.peerName = accepted.name;
+        clientBind.pkgName = accepted.pkgName;
+        clientBind.dataType = accepted.dataType;
+        EnqueueLocked(std::move(clientBind));
+    }
+    return SOFTBUS_OK;
+}
+
+int32_t SoftbusLoopback::Send(int32_t socket, int32_t kind, const void* data, uint32_t len)
+{
+    if (data == nullptr || len == 0) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = sockets_.find(socket);
+    if (iter == sockets_.end() || iter->second.peer == 0) {
+        stat_.rejectedPackets++;
+        return SOFTBUS_TRANS_INVALID_SESSION_ID;
+    }
+    if (len > config_.mtu) {
+        stat_.rejectedPackets++;
+        return SOFTBUS_TRANS_SEND_LEN_BEYOND_LIMIT;
+    }
+    stat_.sentPackets++;
+    stat_.sentBytes += len;
+    if (ShouldDropLocked()) {
+        return SOFTBUS_OK;
+    }
+    Packet packet;
+    packet.target = iter->second.peer;
+    packet.kind = kind;
+    const uint8_t* begin = static_cast<const uint8_t*>(data);
+    packet.payload.assign(begin, begin + len);
+    EnqueueLocked(std::move(packet));
+    return SOFTBUS_OK;
+}
+
+int32_t SoftbusLoopback::SendStream(int32_t socket, const StreamData* data, const StreamData* ext,
+    const StreamFrameInfo* param)
+{
+    if (data == nullptr || data->buf == nullptr || data->bufLen <= 0) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = sockets_.find(socket);
+    if (iter == sockets_.end() || iter->second.peer == 0) {
+        stat_.rejectedPackets++;
+        return SOFTBUS_TRANS_INVALID_SESSION_ID;
+    }
+    uint32_t len = static_cast<uint32_t>(data->bufLen);
+    stat_.sentPackets++;
+    stat_.sentBytes += len;
+    if (ShouldDropLocked()) {
+        return SOFTBUS_OK;
+    }
+    Packet packet;
+    packet.target = iter->second.peer;
+    packet.kind = KIND_STREAM;
+    packet.payload.assign(data->buf, data->buf + len);
+    if (ext != nullptr && ext->buf != nullptr && ext->bufLen > 0) {
+        packet.ext.assign(ext->buf, ext->buf + ext->bufLen);
+    }
+    if (param != nullptr) {
+        packet.frameInfo = *param;
+        packet.frameInfo.tvCount = 0;
+        packet.frameInfo.tvList = nullptr;
+    }
+    EnqueueLocked(std::move(packet));
+    return SOFTBUS_OK;
+}
+
+int32_t SoftbusLoopback::SendFile(int32_t socket, const char* sFileList[], const char* dFileList[],
+    uint32_t fileCnt)
+{
+    if (sFileList == nullptr || dFileList == nullptr || fileCnt == 0) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = sockets_.find(socket);
+    if (iter == sockets_.end() || iter->second.peer == 0) {
+        stat_.rejectedPackets++;
+        return SOFTBUS_TRANS_INVALID_SESSION_ID;
+    }
+    Packet packet;
+    // progress is reported to the sender, the peer only sees the files appear
+    packet.target = socket;
+    packet.kind = KIND_FILE;
+    for (uint32_t i = 0; i < fileCnt; ++i) {
+        if (sFileList[i] == nullptr || dFileList[i] == nullptr) {
+            return SOFTBUS_INVALID_PARAM;
+        }
+        packet.sFiles.emplace_back(sFileList[i]);
+        packet.dFiles.emplace_back(dFileList[i]);
+    }
+    stat_.sentPackets++;
+    EnqueueLocked(std::move(packet));
+    return SOFTBUS_OK;
+}
+
+void SoftbusLoopback::Shutdown(int32_t socket)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = sockets_.find(socket);
+    if (iter == sockets_.end()) {
+        return;
+    }
+    int32_t peer = iter->second.peer;
+    sockets_.erase(iter);
+    auto peerIter = sockets_.find(peer);
+    if (peerIter == sockets_.end()) {
+        return;
+    }
+    peerIter->second.peer = 0;
+    Packet packet;
+    packet.target = peer;
+    packet.kind = KIND_SHUTDOWN;
+    EnqueueLocked(std::move(packet));
+}
+
+int32_t SoftbusLoopback::GetMaxSendSize(int32_t socket, uint32_t& size)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sockets_.find(socket) == sockets_.end()) {
+        return SOFTBUS_TRANS_INVALID_SESSION_ID;
+    }
+    size = config_.mtu;
+    return SOFTBUS_OK;
+}
+
+void SoftbusLoopback::EnqueueLocked(Packet&& packet)
+{
+    // a single deliver time line keeps packets in send order even if the latency is changed midway
+    packet.deliverTimeUs = std::max(GetNowUs() + config_.latencyUs, lastDeliverTimeUs_);
+    lastDeliverTimeUs_ = packet.deliverTimeUs;
+    packet.seq = nextSeq_++;
+    queue_.push(std::move(packet));
+    StartLocked();
+    queueCon_.notify_one();
+}
+
+bool SoftbusLoopback::ShouldDropLocked()
+{
+    if (config_.lossRate <= 0.0) {
+        return false;
+    }
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    if (distribution(random_) < config_.lossRate) {
+        stat_.lostPackets++;
+        return true;
+    }
+    return false;
+}
+
+void SoftbusLoopback::StartLocked()
+{
+    if (isRunning_) {
+        return;
+    }
+    isRunning_ = true;
+    deliverThread_ = std::thread(&SoftbusLoopback::Run, this);
+}
+
+void SoftbusLoopback::Run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (isRunning_) {
+        if (queue_.empty()) {
+            idleCon_.notify_all();
+            queueCon_.wait(lock, [this] { return !isRunning_ || !queue_.empty(); });
+            continue;
+        }
+        int64_t waitUs = queue_.top().deliverTimeUs - GetNowUs();
+        if (waitUs > 0) {
+            queueCon_.wait_for(lock, std::chrono::microseconds(waitUs));
+            continue;
+        }
+        Packet packet = queue_.top();
+        queue_.pop();
+        auto iter = sockets_.find(packet.target);
+        if (iter == sockets_.end()) {
+            continue;
+        }
+        const ISocketListener* listener = iter->second.listener;
+        stat_.deliveredPackets++;
+        isDelivering_ = true;
+        lock.unlock();
+        Deliver(packet, listener);
+        lock.lock();
+        isDelivering_ = false;
+    }
+}
+
+void SoftbusLoopback::Deliver(const Packet& packet, const ISocketListener* listener)
+{
+    if (listener == nullptr) {
+        return;
+    }
+    switch (packet.kind) {
+        case KIND_BIND: {
+            if (listener->OnBind == nullptr) {
+                return;
+            }
+            PeerSocketInfo info = {
+                .name = const_cast<char*>(packet.peerName.c_str()),
+                .networkId = const_cast<char*>(LOOPBACK_NETWORK_ID),
+                .pkgName = const_cast<char*>(packet.pkgName.c_str()),
+                .dataType = packet.dataType,
+            };
+            listener->OnBind(packet.target, info);
+            break;
+        }
+        case KIND_SHUTDOWN:
+            if (listener->OnShutdown != nullptr) {
+                listener->OnShutdown(packet.target, SHUTDOWN_REASON_PEER);
+            }
+            break;
+        case KIND_BYTES:
+            if (listener->OnBytes != nullptr) {
+                listener->OnBytes(packet.target, packet.payload.data(), packet.payload.size());
+            }
+            break;
+        case KIND_MESSAGE:
+            if (listener->OnMessage != nullptr) {
+                listener->OnMessage(packet.target, packet.payload.data(), packet.payload.size());
+            }
+            break;
+        case KIND_STREAM: {
+            if (listener->OnStream == nullptr) {
+                return;
+            }
+            StreamData data = {
+                .buf = reinterpret_cast<char*>(const_cast<uint8_t*>(packet.payload.data())),
+                .bufLen = static_cast<int>(packet.payload.size()),
+            };
+            StreamData ext = {
+                .buf = reinterpret_cast<char*>(const_cast<uint8_t*>(packet.ext.data())),
+                .bufLen = static_cast<int>(packet.ext.size()),
+            };
+            listener->OnStream(packet.target, &data, &ext, &packet.frameInfo);
+            break;
+        }
+        case KIND_FILE:
+            DeliverFile(packet, listener);
+            break;
+        default:
+            break;
+    }
+}
+
+void SoftbusLoopback::DeliverFile(const Packet& packet, const ISocketListener* listener)
+{
+    std::vector<const char*> files;
+    FileEvent event {};
+    for (const auto& file : packet.sFiles) {
+        files.push_back(file.c_str());
+        std::error_code err;
+        uintmax_t size = std::filesystem::file_size(file, err);
+        event.bytesTotal += err ? 0 : size;
+    }
+    event.files = files.data();
+    event.fileCnt = static_cast<uint32_t>(files.size());
+    for (size_t i = 0; i < packet.sFiles.size(); ++i) {
+        if (!CopyFileChunked(packet.sFiles[i], packet.dFiles[i], listener, packet.target, event)) {
+            return;
+        }
+    }
+    event.type = FILE_EVENT_SEND_FINISH;
+    if (listener->OnFile != nullptr) {
+        listener->OnFile(packet.target, &event);
+    }
+}
+
+bool SoftbusLoopback::CopyFileChunked(const std::string& src, const std::string& dst,
+    const ISocketListener* listener, int32_t socket, FileEvent& event)
+{
+    std::string recvRoot;
+    uint32_t chunkSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        recvRoot = config_.fileRecvRoot;
+        chunkSize = std::max<uint32_t>(config_.fileChunkSize, 1);
+        stat_.fileSends[src]++;
+    }
+    std::filesystem::path target = std::filesystem::path(recvRoot) / std::filesystem::path(dst).relative_path();
+    std::error_code err;
+    std::filesystem::create_directories(target.parent_path(), err);
+    std::ifstream in(src, std::ios::binary);
+    std::ofstream out(target, std::ios::binary | std::ios::trunc);
+    if (!in.is_open() || !out.is_open()) {
+        event.type = FILE_EVENT_SEND_ERROR;
+        event.errorCode = SOFTBUS_INVALID_PARAM;
+        if (listener->OnFile != nullptr) {
+            listener->OnFile(socket, &event);
+        }
+        return false;
+    }
+    std::vector<char> chunk(chunkSize);
+    while (in.read(chunk.data(), chunk.size()) || in.gcount() > 0) {
+        out.write(chunk.data(), in.gcount());
+        event.bytesProcessed += static_cast<uint64_t>(in.gcount());
+        bool isFailed = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stat_.sentFileBytes += static_cast<uint64_t>(in.gcount());
+            if (config_.fileFailAfterBytes >= 0 &&
+                event.bytesProcessed >= static_cast<uint64_t>(config_.fileFailAfterBytes)) {
+                config_.fileFailAfterBytes = -1;
+                isFailed = true;
+            }
+        }
+        event.type = isFailed ? FILE_EVENT_SEND_ERROR : FILE_EVENT_SEND_PROCESS;
+        event.errorCode = isFailed ? SOFTBUS_TRANS_INVALID_SESSION_ID : 0;
+        if (listener->OnFile != nullptr) {
+            listener->OnFile(socket, &event);
+        }
+        if (isFailed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int64_t SoftbusLoopback::GetNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace DistributedSchedule
+} // namespace OHOS
+
+using OHOS::DistributedSchedule::SoftbusLoopback;
+
+extern "C" {
+int32_t Socket(SocketInfo info)
+{
+    return SoftbusLoopback::GetInstance().CreateSocket(info);
+}
+
+int32_t Listen(int32_t socket, const QosTV qos[], uint32_t qosCount, const ISocketListener* listener)
+{
+    return SoftbusLoopback::GetInstance().Listen(socket, listener);
+}
+
+int32_t Bind(int32_t socket, const QosTV qos[], uint32_t qosCount, const ISocketListener* listener)
+{
+    return SoftbusLoopback::GetInstance().Bind(socket, listener, false);
+}
+
+int32_t BindAsync(int32_t socket, const QosTV qos[], uint32_t qosCount, const ISocketListener* listener)
+{
+    return SoftbusLoopback::GetInstance().Bind(socket, listener, true);
+}
+
+int32_t SendBytes(int32_t socket, const void* data, uint32_t len)
+{
+    return SoftbusLoopback::GetInstance().Send(socket, SoftbusLoopback::KIND_BYTES, data, len);
+}
+
+int32_t SendMessage(int32_t socket, const void* data, uint32_t len)
+{
+    return SoftbusLoopback::GetInstance().Send(socket, SoftbusLoopback::KIND_MESSAGE, data, len);
+}
+
+int32_t SendStream(int32_t socket, const StreamData* data, const StreamData* ext, const StreamFrameInfo* param)
+{
+    return SoftbusLoopback::GetInstance().SendStream(socket, data, ext, param);
+}
+
+int32_t SendFile(int32_t socket, const char* sFileList[], const char* dFileList[], uint32_t fileCnt)
+{
+    return SoftbusLoopback::GetInstance().SendFile(socket, sFileList, dFileList, fileCnt);
+}
+
+void Shutdown(int32_t socket)
+{
+    SoftbusLoopback::GetInstance().Shutdown(socket);
+}
+
+int GetSessionOption(int sessionId, SessionOption option, void* optionValue, uint32_t valueSize)
+{
+    if (optionValue == nullptr || valueSize < sizeof(uint32_t)) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    if (option != SESSION_OPTION_MAX_SENDBYTES_SIZE && option != SESSION_OPTION_MAX_SENDMESSAGE_SIZE) {
+        return SOFTBUS_NOT_IMPLEMENT;
+    }
+    uint32_t size = 0;
+    int32_t ret = SoftbusLoopback::GetInstance().GetMaxSendSize(sessionId, size);
+    if (ret != SOFTBUS_OK) {
+        return ret;
+    }
+    *static_cast<uint32_t*>(optionValue) = size;
+    return SOFTBUS_OK;
+}
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DMS_SOFTBUS_LOOPBACK_H
+#define OHOS_DMS_SOFTBUS_LOOPBACK_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "socket.h"
+
+namespace OHOS {
+namespace DistributedSchedule {
+struct LoopbackConfig {
+    // largest payload accepted by one SendBytes/SendMessage, also reported by GetSessionOption
+    uint32_t mtu = 64 * 1024;
+    // one way delay added to every packet
+    int64_t latencyUs = 0;
+    // probability in [0, 1] that an accepted packet is silently dropped
+    double lossRate = 0.0;
+    uint32_t seed = 1;
+    // SendFile copies dFileList entries below this directory, one progress event per chunk
+    std::string fileRecvRoot = "/data/test/loopback_recv";
+    uint32_t fileChunkSize = 16 * 1024;
+    // when >= 0, the next SendFile reporting this many bytes fails with SEND_ERROR, then it is cleared
+    int64_t fileFailAfterBytes = -1;
+};
+
+struct LoopbackStat {
+    uint64_t sentPackets = 0;
+    uint64_t sentBytes = 0;
+    uint64_t deliveredPackets = 0;
+    uint64_t lostPackets = 0;
+    uint64_t rejectedPackets = 0;
+    uint64_t sentFileBytes = 0;
+    // source file -> number of times its copy was started
+    std::map<std::string, uint32_t> fileSends;
+};
+
+/*
+ * In-process implementation of the softbus socket API. Sockets bound to a
+ * listening socket of the same process are paired, and everything sent on one
+ * end is delivered to the listener of the other end on a single delivery
+ * thread, in send order, after the configured latency. Delivery never runs on
+ * the sending thread, so callers holding locks across Send* behave as they do
+ * against the real bus. SendFile copies the files on the same thread and
+ * reports OnFile progress to the sending socket.
+ */
+class SoftbusLoopback {
+public:
+    static constexpr const char* LOOPBACK_NETWORK_ID = "loopback";
+
+    static SoftbusLoopback& GetInstance();
+
+    void SetConfig(const LoopbackConfig& config);
+    LoopbackConfig GetConfig();
+    LoopbackStat GetStat();
+    bool WaitIdle(int64_t timeoutMs);
+    void Reset();
+
+    int32_t CreateSocket(const SocketInfo& info);
+    int32_t Listen(int32_t socket, const ISocketListener* listener);
+    int32_t Bind(int32_t socket, const ISocketListener* listener, bool isAsync);
+    int32_t Send(int32_t socket, int32_t kind, const void* data, uint32_t len);
+    int32_t SendStream(int32_t socket, const StreamData* data, const StreamData* ext,
+        const StreamFrameInfo* param);
+    int32_t SendFile(int32_t socket, const char* sFileList[], const char* dFileList[], uint32_t fileCnt);
+    void Shutdown(int32_t socket);
+    int32_t GetMaxSendSize(int32_t socket, uint32_t& size);
+
+    enum PacketKind : int32_t {
+        KIND_BIND = 0,
+        KIND_SHUTDOWN,
+        KIND_BYTES,
+        KIND_MESSAGE,
+        KIND_STREAM,
+        KIND_FILE,
+    };
+
+private:
+    struct LoopbackSocket {
+        std::string name;
+        std::string peerName;
+        std::string pkgName;
+        TransDataType dataType = DATA_TYPE_BYTES;
+        const ISocketListener* listener = nullptr;
+        bool isListening = false;
+        int32_t peer = 0;
+    };
+
+    struct Packet {
+        int64_t deliverTimeUs = 0;
+        uint64_t seq = 0;
+        int32_t target = 0;
+        int32_t kind = KIND_BYTES;
+        std::vector<uint8_t> payload;
+        std::vector<uint8_t> ext;
+        StreamFrameInfo frameInfo {};
+        std::string peerName;
+        std::string pkgName;
+        TransDataType dataType = DATA_TYPE_BYTES;
+        std::vector<std::string> sFiles;
+        std::vector<std::string> dFiles;
+
+        bool operator>(const Packet& other) const
+        {
+            return deliverTimeUs != other.deliverTimeUs ? deliverTimeUs > other.deliverTimeUs : seq > other.seq;
+        }
+    };
+
+    SoftbusLoopback() = default;
+    ~SoftbusLoopback();
+
+    void EnqueueLocked(Packet&& packet);
+    bool ShouldDropLocked();
+    void StartLocked();
+    void Run();
+    void Deliver(const Packet& packet, const ISocketListener* listener);
+    void DeliverFile(const Packet& packet, const ISocketListener* listener);
+    bool CopyFileChunked(const std::string& src, const std::string& dst, const ISocketListener* listener,
+        int32_t socket, FileEvent& event);
+    static int64_t GetNowUs();
+
+    std::mutex mutex_;
+    std::condition_variable queueCon_;
+    std::condition_variable idleCon_;
+    std::priority_queue<Packet, std::vector<Packet>, std::greater<Packet>> queue_;
+    std::map<int32_t, LoopbackSocket> sockets_;
+    LoopbackConfig config_;
+    LoopbackStat stat_;
+    std::mt19937 random_ { 1 };
+    int32_t nextSocket_ = 1;
+    uint64_t nextSeq_ = 0;
+    int64_t lastDeliverTimeUs_ = 0;
+    bool isDelivering_ = false;
+    bool isRunning_ = false;
+    std::thread deliverThread_;
+};
+} // namespace DistributedSchedule
+} // namespace OHOS
+#endif // OHOS_DMS_SOFTBUS_LOOPBACK_H
@@ -72,7 +72,8 @@ void FuzzApplyAdvanceResource(const uint8_t* data, size_t size)
     reqInfoSets.communicationRequest = &communicationRequestTemp;
 
     const std::string peerNetworkId(reinterpret_cast<const char*>(data + offset), size - MIN_SIZE);
-    DSchedAllConnectManager::GetInstance().ApplyAdvanceResource(peerNetworkId, reqInfoSets);
+    DSchedAllConnectManager::GetInstance().ApplyAdvanceResourceAsync(peerNetworkId, reqInfoSets,
+        [](int32_t result) {});
 }
 
 void FuzzGetResourceRequest(const uint8_t* data, size_t size)
@@ -74,7 +74,8 @@ void FuzzConnectDevice(const uint8_t* data, size_t size)
     std::string peerDeviceId = fdp.ConsumeRandomLengthString();
 
     DSchedTransportSoftbusAdapter dschedTransportSoftbusAdapter;
-    dschedTransportSoftbusAdapter.ConnectDevice(peerDeviceId, sessionId);
+    dschedTransportSoftbusAdapter.ConnectDeviceAsync(peerDeviceId, SERVICE_TYPE_CONTINUE,
+        [](int32_t result, int32_t connectedSessionId) {});
     std::shared_ptr<DSchedDataBuffer> dataBuffer = std::make_shared<DSchedDataBuffer>(size);
     dschedTransportSoftbusAdapter.SendData(sessionId, dataType, dataBuffer);
     dschedTransportSoftbusAdapter.SendBytesBySoftbus(sessionId, dataBuffer);